@@ -0,0 +1,16 @@
+#!/bin/sh
+# Run the generational and steady-state MOGA studies and compare wall time.
+# usage: compare_wall_time.sh [path/to/dakota]
+
+dakota=${1:-dakota}
+PATH=.:$PATH
+export PATH
+
+for mode in generational steady_state; do
+  start=$(date +%s)
+  $dakota -i dakota_moga_$mode.in -o dakota_moga_$mode.out > /dev/null 2>&1
+  end=$(date +%s)
+  evals=$(grep -c '^ *[0-9]' moga_$mode.dat)
+  echo "$mode: $((end - start)) s wall time, $evals evaluations"
+  rm -f params.in.* results.out.*
+done
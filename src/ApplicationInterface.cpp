@@ -16,6 +16,7 @@
 #include "ParamResponsePair.hpp"
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
+#include "PerformanceRegistry.hpp"
 
 //#define DEBUG
 
@@ -401,6 +402,7 @@ final_eval_id_tag(int iface_eval_id)
 void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
 			       Response& response, bool asynch_flag)
 {
+  ScopedTimer map_timer("map", "interface");
   ++evalIdCntr; // all calls to map for this interface instance
   const ShortArray& asv = set.request_vector();
   size_t num_fns = asv.size();
@@ -450,15 +452,17 @@ void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
     asv_mapping(set, algebraic_set, core_set);
     algebraic_resp = Response(sharedRespData, algebraic_set);
     if (asynch_flag) {
-      ParamResponsePair prp(vars, interfaceId, algebraic_resp, evalIdCntr);
+      ParamResponsePair prp(evalPool.copy(vars), interfaceId,
+			    evalPool.copy(algebraic_resp), evalIdCntr, false);
       beforeSynchAlgPRPQueue.insert(prp);
     }
     else
       algebraic_mappings(vars, algebraic_set, algebraic_resp);
  
     if (coreMappings) { // both core and algebraic mappings active
-      // separate core_resp from response
-      core_resp = response.copy();
+      // separate core_resp from response (pooled storage is recycled at
+      // each synchronize, so is used for asynchronous evaluations only)
+      core_resp = (asynch_flag) ? evalPool.copy(response) : response.copy();
       core_resp.active_set(core_set);
     }
   }
@@ -473,6 +477,7 @@ void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
       // catches duplication both in data_pairs (core evals already computed)
       // and in beforeSynchCorePRPQueue (core evals queued for processing).
       duplicate = true;
+      performance_registry.increment("interface.duplicate_evaluations");
       if (outputLevel > SILENT_OUTPUT)
 	Cout << "Duplication detected: analysis_drivers not invoked.\n";
     }
@@ -495,9 +500,19 @@ void ApplicationInterface::map(const Variables& vars, const ActiveSet& set,
       }
 
       if (asynch_flag) { // multiple simultaneous evals. (local or parallel)
-	// use this constructor since deep copies of vars/response are needed
-	ParamResponsePair prp(vars, interfaceId, core_resp, evalIdCntr);
-	beforeSynchCorePRPQueue.insert(prp);
+	// deep copies of vars/response are needed.  The evaluation cache
+	// retains them as its own storage, so they are only drawn from the
+	// pool (avoiding per-evaluation allocation) when it is deactivated.
+	if (evalCacheFlag) {
+	  ParamResponsePair prp(vars.copy(), interfaceId, core_resp.copy(),
+				evalIdCntr, false);
+	  beforeSynchCorePRPQueue.insert(prp);
+	}
+	else {
+	  ParamResponsePair prp(evalPool.copy(vars), interfaceId,
+				evalPool.copy(core_resp), evalIdCntr, false);
+	  beforeSynchCorePRPQueue.insert(prp);
+	}
 	// jobs are not queued until call to synchronize() to allow dynamic
 	// scheduling. Response data headers and data_pair list insertion
 	// appear in synchronize().
@@ -642,7 +657,7 @@ duplication_detect(const Variables& vars, Response& response, bool asynch_flag)
     }
 
     if (asynch_flag) // asynch case: bookkeep
-      historyDuplicateMap[evalIdCntr] = response.copy();
+      historyDuplicateMap[evalIdCntr] = evalPool.copy(response);
 
     return true; // Duplication detected
   }
@@ -655,7 +670,7 @@ duplication_detect(const Variables& vars, Response& response, bool asynch_flag)
     if (queue_it != beforeSynchCorePRPQueue.get<hashed>().end()) {
       // Duplication detected: bookkeep
       beforeSynchDuplicateMap[evalIdCntr]
-	= std::make_pair(queue_it, response.copy());
+	= std::make_pair(queue_it, evalPool.copy(response));
       return true; // Duplication detected
     }
   }
@@ -701,7 +716,9 @@ void ApplicationInterface::init_default_asv(size_t num_fns) {
     derived_synchronize() in derived Model classes. */
 const IntResponseMap& ApplicationInterface::synchronize()
 {
+  ScopedTimer synch_timer("synchronize", "interface");
   rawResponseMap.clear();
+  evalPool.next_batch();
 
   size_t cached_eval = cachedResponseMap.size(),
     hist_duplicates  = historyDuplicateMap.size(),
@@ -822,7 +839,9 @@ const IntResponseMap& ApplicationInterface::synchronize()
     Called from derived_synchronize_nowait() in derived Model classes. */
 const IntResponseMap& ApplicationInterface::synchronize_nowait()
 {
+  ScopedTimer synch_timer("synchronize_nowait", "interface");
   rawResponseMap.clear();
+  evalPool.next_batch();
 
   size_t cached_eval = cachedResponseMap.size(),
     hist_duplicates  = historyDuplicateMap.size(),
@@ -18,6 +18,7 @@
 
 #include "DakotaInterface.hpp"
 #include "PRPMultiIndex.hpp"
+#include "EvaluationPool.hpp"
 #include "ParallelLibrary.hpp"
 #include "DataMethod.hpp"
 
@@ -533,6 +534,10 @@ private:
   /// that is later scheduled in synchronize() or synchronize_nowait().
   PRPQueue beforeSynchCorePRPQueue;
 
+  /// recycled storage for the deep copies of vars/response in the
+  /// queues, duplicate maps and algebraic mappings of asynchronous batches
+  EvaluationPool evalPool;
+
   /// used to bookkeep vars/set/response of asynchronous algebraic evaluations.
   /// This is the queue of algebraic jobs populated by asynchronous map()
   /// that is later evaluated in synchronize() or synchronize_nowait().
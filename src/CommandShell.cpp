@@ -14,12 +14,51 @@
 #include "CommandShell.hpp"
 #include "WorkdirHelper.hpp"
 #include "dakota_global_defs.hpp"
+#include <boost/algorithm/string/replace.hpp>
+
+#ifdef HAVE_POSIX_SPAWN
+  #include <cerrno>
+  #include <csignal>
+  #include <cstring>
+  #include <fcntl.h>
+  #include <spawn.h>
+  #include <sys/stat.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+  extern char** environ;
+#endif
 
 static const char rcsId[]="@(#) $Id: CommandShell.cpp 7021 2010-10-12 22:19:01Z wjbohnh $";
 
 
 namespace Dakota {
 
+#ifdef HAVE_POSIX_SPAWN
+/** Locate program on the PATH of this process as posix_spawnp() does,
+    returning it unchanged if it contains a slash or is not found. */
+static std::string search_path(const std::string& program)
+{
+  const char* env_path = std::getenv("PATH");
+  if (program.find('/') != std::string::npos || !env_path)
+    return program;
+  std::string path(env_path);
+  size_t begin = 0, end;
+  do {
+    end = path.find(':', begin);
+    std::string dir = path.substr(begin, end - begin);
+    // an empty entry denotes the working directory
+    std::string candidate = (dir.empty()) ? program : dir + '/' + program;
+    struct stat sb;
+    if (stat(candidate.c_str(), &sb) == 0 && S_ISREG(sb.st_mode) &&
+	access(candidate.c_str(), X_OK) == 0)
+      return candidate;
+    begin = end + 1;
+  } while (end != std::string::npos);
+  return program;
+}
+#endif
+
+
 /** Executes the sysCommand by passing it to system().  Appends an
     "&" if asynchFlag is set (background system call) and echos the
     sysCommand to Cout if suppressOutputFlag is not set. */
@@ -58,4 +97,325 @@ CommandShell& flush(CommandShell& shell)
   return shell;
 }
 
+
+/** Characters outside quotes are checked for shell syntax before
+    tokenizing.  Each redirection operator is isolated as a separate
+    token prefixed with a control character that cannot appear in the
+    command, so quoted text is never mistaken for a redirection.  To
+    match the shell's quoting rules exactly, backslashes, empty quoted
+    strings, and quotes nested within the other kind of quotes are left
+    to the shell. */
+bool SpawnCommand::parse(const std::string& command)
+{
+  args.clear(); redirections.clear();
+#ifdef HAVE_POSIX_SPAWN
+  const char op_mark = '\x01';
+  std::string marked;
+  char quote = 0;
+  bool word_start = true;
+  size_t i, len = command.size();
+  for (i=0; i<len; ++i) {
+    char c = command[i];
+    if (c == op_mark || c == '\\' || c == '\n')
+      return false;
+    if (quote) { // within quotes, only the closing quote is special
+      if (c == quote)
+	quote = 0;
+      else if (c == '"' || c == '\'' ||
+	       (quote == '"' && (c == '$' || c == '`')))
+	return false;
+      marked += c;
+      continue;
+    }
+    if (c == '"' || c == '\'') {
+      if (i+1 < len && command[i+1] == c && word_start)
+	return false; // empty argument
+      quote = c; marked += c; word_start = false;
+      continue;
+    }
+    if (c == ' ' || c == '\t')
+      { marked += c; word_start = true; continue; }
+    if (std::strchr("|&;()$`*?[]!}", c))
+      return false;
+    if (c == '{') { // only the file name tokens are allowed
+      if (command.compare(i, 12, "{PARAMETERS}") == 0)
+	{ marked += command.substr(i, 12); i += 11; word_start = false; }
+      else if (command.compare(i, 9, "{RESULTS}") == 0)
+	{ marked += command.substr(i, 9); i += 8; word_start = false; }
+      else
+	return false;
+      continue;
+    }
+    if (word_start && (c == '#' || c == '~'))
+      return false;
+    if (c == '<' || c == '>') {
+      std::string op(1, c);
+      // a lone 2 immediately preceding the operator is the stream number
+      if (c == '>' && !marked.empty() && marked.back() == '2' &&
+	  (marked.size() == 1 || marked[marked.size()-2] == ' ' ||
+	   marked[marked.size()-2] == '\t'))
+	{ marked.erase(marked.size()-1); op.insert(0, "2"); }
+      char next = (i+1 < len) ? command[i+1] : 0;
+      if (c == '<' && (next == '<' || next == '>'))
+	return false; // here-document or read-write
+      if (c == '>' && next == '>')
+	{ op += '>'; ++i; }
+      else if (c == '>' && next == '&') {
+	if (op != "2>" || command.compare(i+1, 2, "&1") != 0)
+	  return false;
+	op += "&1"; i += 2;
+      }
+      else if (c == '>' && next == '|')
+	return false;
+      marked += ' '; marked += op_mark; marked += op; marked += ' ';
+      word_start = true;
+      continue;
+    }
+    marked += c;
+    word_start = false;
+  }
+  if (quote)
+    return false;
+
+  StringArray tokens = WorkdirHelper::tokenize_driver(marked);
+  for (i=0; i<tokens.size(); ++i) {
+    const std::string& token = tokens[i];
+    if (token.empty())
+      continue;
+    if (token[0] != op_mark) {
+      // variable assignments preceding the program need a shell
+      if (args.empty() && token.find('=') != std::string::npos &&
+	  token.find('/') == std::string::npos)
+	return false;
+      args.push_back(token);
+      continue;
+    }
+    Redirection redir;
+    std::string op = token.substr(1);
+    redir.fd = (op[0] == '<') ? 0 : (op[0] == '2') ? 2 : 1;
+    redir.op = (redir.fd == 2) ? op.substr(1) : op;
+    if (redir.op != ">&1") {
+      // next non-empty token is the file name
+      while (++i < tokens.size() && tokens[i].empty()) ;
+      if (i == tokens.size() || tokens[i][0] == op_mark)
+	return false;
+      redir.file = tokens[i];
+    }
+    redirections.push_back(redir);
+  }
+  if (args.empty()) {
+    redirections.clear();
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+SpawnCommand SpawnCommand::
+substitute(const std::string& params, const std::string& results,
+	   bool append_files) const
+{
+  SpawnCommand cmd(*this);
+  for (size_t i=0; i<cmd.args.size(); ++i) {
+    boost::algorithm::replace_all(cmd.args[i], "{PARAMETERS}", params);
+    boost::algorithm::replace_all(cmd.args[i], "{RESULTS}", results);
+  }
+  for (size_t i=0; i<cmd.redirections.size(); ++i) {
+    boost::algorithm::replace_all(cmd.redirections[i].file, "{PARAMETERS}",
+				  params);
+    boost::algorithm::replace_all(cmd.redirections[i].file, "{RESULTS}",
+				  results);
+  }
+  if (append_files)
+    { cmd.args.push_back(params); cmd.args.push_back(results); }
+  return cmd;
+}
+
+
+/** The program is located on the PATH of this process, so the PATH,
+    working directory, and environment must be prepared before the
+    call, as for CommandShell::flush().  Like execvp(), a program that
+    is not a binary and lacks a #! line (ENOEXEC) is run as a script
+    by /bin/sh. */
+pid_t SpawnCommand::spawn() const
+{
+  pid_t pid = 0;
+#ifdef HAVE_POSIX_SPAWN
+  std::vector<char*> argv(args.size() + 1, (char*)NULL);
+  for (size_t i=0; i<args.size(); ++i)
+    argv[i] = const_cast<char*>(args[i].c_str());
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  for (size_t i=0; i<redirections.size(); ++i) {
+    const Redirection& redir = redirections[i];
+    if (redir.op == ">&1")
+      posix_spawn_file_actions_adddup2(&actions, 1, redir.fd);
+    else {
+      int flags = (redir.op == "<")  ? O_RDONLY :
+	          (redir.op == ">>") ? O_WRONLY | O_CREAT | O_APPEND :
+	                               O_WRONLY | O_CREAT | O_TRUNC;
+      posix_spawn_file_actions_addopen(&actions, redir.fd, redir.file.c_str(),
+				       flags, 0666);
+    }
+  }
+  int err = posix_spawnp(&pid, argv[0], &actions, NULL, &argv[0], environ);
+  if (err == ENOEXEC) {
+    std::string shell("/bin/sh"), script = search_path(args[0]);
+    argv.insert(argv.begin(), const_cast<char*>(shell.c_str()));
+    argv[1] = const_cast<char*>(script.c_str());
+    err = posix_spawn(&pid, argv[0], &actions, NULL, &argv[0], environ);
+  }
+  posix_spawn_file_actions_destroy(&actions);
+  if (err) {
+    Cerr << "\nError: could not launch \"" << command_line() << "\"; error "
+	 << "code " << err << " (" << std::strerror(err) << ")" << std::endl;
+    abort_handler(INTERFACE_ERROR);
+  }
+#else
+  Cerr << "Error: launching commands without a shell is not supported on "
+       << "this system." << std::endl;
+  abort_handler(-1);
+#endif
+  return pid;
+}
+
+
+int SpawnCommand::run() const
+{ return wait(spawn()); }
+
+
+std::string SpawnCommand::command_line() const
+{
+  std::string line;
+  for (size_t i=0; i<args.size(); ++i) {
+    if (i) line += ' ';
+    if (args[i].find_first_of(" \t") != std::string::npos)
+      line += '\'' + args[i] + '\'';
+    else
+      line += args[i];
+  }
+  for (size_t i=0; i<redirections.size(); ++i) {
+    const Redirection& redir = redirections[i];
+    line += ' ';
+    if (redir.fd == 2) line += '2';
+    line += redir.op;
+    if (!redir.file.empty())
+      line += ' ' + redir.file;
+  }
+  return line;
+}
+
+
+int SpawnCommand::wait(pid_t pid)
+{
+  int status = 0;
+#ifdef HAVE_POSIX_SPAWN
+  while (waitpid(pid, &status, 0) == -1 && errno == EINTR) ;
+#endif
+  return status;
+}
+
+
+bool SpawnCommand::exited(pid_t pid)
+{
+#ifdef HAVE_POSIX_SPAWN
+  int status = 0;
+  pid_t wpid = waitpid(pid, &status, WNOHANG);
+  // also report processes that can no longer be waited on (ECHILD)
+  return wpid == pid || wpid == -1;
+#else
+  return true;
+#endif
+}
+
+
+#ifdef HAVE_POSIX_SPAWN
+/// self-pipe written by notify_child_exit() (-1 until created)
+static int exitPipe[2] = { -1, -1 };
+
+/// SIGCHLD handler making the read end of exitPipe readable; it only
+/// notifies, leaving the children to be reaped by their owners
+static void notify_child_exit(int)
+{
+  int saved_errno = errno;
+  // if the pipe is full, a notification is already pending
+  if (write(exitPipe[1], "", 1) < 0) { }
+  errno = saved_errno;
+}
+#endif
+
+
+/** The handler is installed with SA_RESTART, so that it does not
+    interrupt waitpid() or reads elsewhere, and is reinstalled if the
+    disposition was reset to the default (e.g., by
+    ExecutableEnvironment::execute()).  A handler installed by another
+    party is left in place, in which case callers should test for
+    exits periodically instead. */
+int SpawnCommand::exit_notifier()
+{
+#ifdef HAVE_POSIX_SPAWN
+  if (exitPipe[0] < 0) {
+    int fds[2];
+    if (pipe(fds) != 0)
+      return -1;
+    for (int i=0; i<2; ++i) {
+      fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+      fcntl(fds[i], F_SETFD, FD_CLOEXEC);
+    }
+    exitPipe[1] = fds[1];
+    exitPipe[0] = fds[0];
+  }
+
+  struct sigaction current;
+  if (sigaction(SIGCHLD, NULL, &current) != 0)
+    return -1;
+  bool installed = !(current.sa_flags & SA_SIGINFO) &&
+    current.sa_handler == notify_child_exit;
+  if (!installed) {
+    if ((current.sa_flags & SA_SIGINFO) || current.sa_handler != SIG_DFL)
+      return -1;
+    struct sigaction action;
+    std::memset(&action, 0, sizeof(action));
+    action.sa_handler = notify_child_exit;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    if (sigaction(SIGCHLD, &action, NULL) != 0)
+      return -1;
+  }
+  return exitPipe[0];
+#else
+  return -1;
+#endif
+}
+
+
+void SpawnCommand::clear_exit_notifications()
+{
+#ifdef HAVE_POSIX_SPAWN
+  if (exitPipe[0] < 0)
+    return;
+  char buffer[64];
+  while (read(exitPipe[0], buffer, sizeof(buffer)) > 0) ;
+#endif
+}
+
+
+/** A forked child sharing the pipe would consume the notifications of
+    the parent; the child creates a new pipe when it next needs one. */
+void SpawnCommand::reopen_exit_notifier()
+{
+#ifdef HAVE_POSIX_SPAWN
+  if (exitPipe[0] < 0)
+    return;
+  int fds[2] = { exitPipe[0], exitPipe[1] };
+  exitPipe[0] = exitPipe[1] = -1;
+  close(fds[0]);
+  close(fds[1]);
+#endif
+}
+
 } // namespace Dakota
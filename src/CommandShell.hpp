@@ -18,7 +18,13 @@
 #define COMMAND_SHELL_H
 
 #include "dakota_system_defs.hpp"
+#include "dakota_data_types.hpp"
 #include <string>
+#ifdef _WIN32
+typedef intptr_t pid_t;
+#else
+#include <sys/types.h>
+#endif
 
 
 namespace Dakota {
@@ -28,7 +34,8 @@ namespace Dakota {
 
 /** The CommandShell class wraps the C system() utility and defines
     convenience operators for building a command string and then
-    passing it to the shell. */
+    passing it to the shell.  See SpawnCommand for commands that do
+    not need a shell. */
 
 class CommandShell
 {
@@ -121,6 +128,91 @@ inline void CommandShell::suppress_output_flag(const bool flag)
 inline bool CommandShell::suppress_output_flag() const
 { return suppressOutputFlag; }
 
+
+
+/// A driver or filter command launched directly, without a shell
+
+/** Commands consisting of a program, its arguments, and the simple
+    redirections <, >, >>, 2>, 2>>, and 2>&1 are parsed once, using
+    WorkdirHelper::tokenize_driver(), and launched with posix_spawnp(),
+    saving the shell process and making the process id available for
+    completion tracking.  parse() rejects commands that use any other
+    shell syntax (pipes, lists, substitutions, globbing, escapes, ...)
+    so that they can be passed to the shell instead. */
+
+class SpawnCommand
+{
+public:
+
+  //
+  //- Heading: Constructor and destructor
+  //
+
+  SpawnCommand();   ///< constructor
+  ~SpawnCommand();  ///< destructor
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// parse command; returns false if it requires a shell or if
+  /// launching without a shell is not supported on this platform
+  bool parse(const std::string& command);
+
+  /// copy of this command with the {PARAMETERS} and {RESULTS} tokens
+  /// replaced by params and results, which are also appended to the
+  /// arguments if append_files
+  SpawnCommand substitute(const std::string& params,
+			  const std::string& results, bool append_files) const;
+
+  /// launch the command; returns the process id (aborts on failure)
+  pid_t spawn() const;
+  /// launch the command and wait for it to exit; returns its status
+  int run() const;
+
+  /// the command in shell syntax, for output
+  std::string command_line() const;
+
+  /// wait for process pid to exit; returns its exit status
+  static int wait(pid_t pid);
+  /// test without blocking whether process pid has exited
+  static bool exited(pid_t pid);
+
+  /// descriptor that becomes readable when a child process exits, for
+  /// use with poll(); installs a SIGCHLD handler if none is installed
+  /// (returns -1 if another handler is installed or if unsupported)
+  static int exit_notifier();
+  /// discard the child exits notified so far
+  static void clear_exit_notifications();
+  /// in a forked child, stop sharing the notifier with the parent
+  static void reopen_exit_notifier();
+
+private:
+
+  //
+  //- Heading: Data members
+  //
+
+  /// a redirection of a standard stream, applied in order
+  struct Redirection {
+    int fd;           ///< stream to redirect (0, 1, or 2)
+    std::string op;   ///< <, >, >>, or >&1
+    std::string file; ///< file name (empty for >&1)
+  };
+
+  /// program and arguments
+  StringArray args;
+  /// redirections of the standard streams
+  std::vector<Redirection> redirections;
+};
+
+
+inline SpawnCommand::SpawnCommand()
+{ }
+
+inline SpawnCommand::~SpawnCommand()
+{ }
+
 } // namespace Dakota
 
 #endif
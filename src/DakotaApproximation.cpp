@@ -828,6 +828,35 @@ Real Approximation::prediction_variance(const RealVector& c_vars)
 }
 
 
+void Approximation::values(const RealMatrix& c_vars, RealVector& vals)
+{
+  if (approxRep)
+    { approxRep->values(c_vars, vals); return; }
+
+  int j, num_v = c_vars.numRows(), num_pts = c_vars.numCols();
+  if (vals.length() != num_pts) vals.sizeUninitialized(num_pts);
+  for (j=0; j<num_pts; ++j) {
+    RealVector c_vars_j(Teuchos::View, const_cast<Real*>(c_vars[j]), num_v);
+    vals[j] = value(c_vars_j);
+  }
+}
+
+
+void Approximation::
+prediction_variances(const RealMatrix& c_vars, RealVector& pred_vars)
+{
+  if (approxRep)
+    { approxRep->prediction_variances(c_vars, pred_vars); return; }
+
+  int j, num_v = c_vars.numRows(), num_pts = c_vars.numCols();
+  if (pred_vars.length() != num_pts) pred_vars.sizeUninitialized(num_pts);
+  for (j=0; j<num_pts; ++j) {
+    RealVector c_vars_j(Teuchos::View, const_cast<Real*>(c_vars[j]), num_v);
+    pred_vars[j] = prediction_variance(c_vars_j);
+  }
+}
+
+
 bool Approximation::advancement_available()
 {
   if (approxRep) return approxRep->advancement_available();
@@ -132,6 +132,14 @@ public:
   /// retrieve the variance of the predicted value for a given parameter vector
   virtual Real prediction_variance(const RealVector& c_vars);
 
+  /// retrieve the approximate function values for a set of parameter
+  /// vectors (the columns of c_vars); the default loops over value()
+  virtual void values(const RealMatrix& c_vars, RealVector& vals);
+  /// retrieve the prediction variances for a set of parameter vectors
+  /// (the columns of c_vars); the default loops over prediction_variance()
+  virtual void prediction_variances(const RealMatrix& c_vars,
+				    RealVector& pred_vars);
+
   /// return the mean of the expansion, where all active vars are random
   virtual Real mean();
   /// return the mean of the expansion for a given parameter vector,
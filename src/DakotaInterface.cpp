@@ -409,6 +409,48 @@ void Interface::init_evaluation_counters(size_t num_fns)
 }
 
 
+void Interface::evaluation_counters(IntArray& counts) const
+{
+  if (interfaceRep) // envelope fwd to letter
+    interfaceRep->evaluation_counters(counts);
+  else { // letter (not virtual)
+    counts.clear();
+    counts.push_back(evalIdCntr);
+    counts.push_back(newEvalIdCntr);
+    if (fineGrainEvalCounters) {
+      const IntArray* fn_counters[6] = { &fnValCounter, &fnGradCounter,
+	&fnHessCounter, &newFnValCounter, &newFnGradCounter,
+	&newFnHessCounter };
+      for (size_t c=0; c<6; ++c)
+	counts.insert(counts.end(), fn_counters[c]->begin(),
+		      fn_counters[c]->end());
+    }
+  }
+}
+
+
+/** The fine-grained counters are only incremented when their sizes
+    agree with those of counts. */
+void Interface::increment_evaluation_counters(const IntArray& counts)
+{
+  if (interfaceRep) // envelope fwd to letter
+    interfaceRep->increment_evaluation_counters(counts);
+  else if (counts.size() >= 2) { // letter (not virtual)
+    evalIdCntr    += counts[0];
+    newEvalIdCntr += counts[1];
+    size_t i, num_fns = fnValCounter.size();
+    if (fineGrainEvalCounters && counts.size() == 2 + 6*num_fns) {
+      IntArray* fn_counters[6] = { &fnValCounter, &fnGradCounter,
+	&fnHessCounter, &newFnValCounter, &newFnGradCounter,
+	&newFnHessCounter };
+      for (size_t c=0; c<6; ++c)
+	for (i=0; i<num_fns; ++i)
+	  (*fn_counters[c])[i] += counts[2 + c*num_fns + i];
+    }
+  }
+}
+
+
 void Interface::set_evaluation_reference()
 {
   if (interfaceRep) // envelope fwd to letter
@@ -1502,6 +1544,15 @@ void Interface::file_cleanup() const
   // else no-op
 }
 
+
+void Interface::
+evaluation_components(int after_id, const StringArray& an_comps)
+{
+  if (interfaceRep)
+    interfaceRep->evaluation_components(after_id, an_comps);
+  // else no-op: only interfaces writing parameters files use them
+}
+
 /** Rationale: The parser allows multiple user-specified interfaces with
     empty (unspecified) ID. However, only a single Interface with empty
     ID can be constructed (if it's the only one present, or the "last
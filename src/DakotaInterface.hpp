@@ -252,6 +252,12 @@ public:
   /// clean up any interface parameter/response files when aborting
   virtual void file_cleanup() const;
 
+  /// supplement the analysis components written for the evaluations
+  /// with IDs above after_id (e.g., the location of input data generated
+  /// for them), until superseded by a call with a larger after_id
+  virtual void evaluation_components(int after_id,
+				     const StringArray& an_comps);
+
   //
   //- Heading: Set and Inquire functions
   //
@@ -290,6 +296,12 @@ public:
   void init_evaluation_counters(size_t num_fns);
   /// set evaluation count reference points for the interface
   void set_evaluation_reference();
+  /// retrieve the evaluation counters (total and new evaluations, then
+  /// any fine-grained counters), e.g., for transfer to another process
+  void evaluation_counters(IntArray& counts) const;
+  /// add evaluations counted elsewhere, as differences of
+  /// evaluation_counters(), to the counters for the interface
+  void increment_evaluation_counters(const IntArray& counts);
 
   /// print an evaluation summary for the interface
   void print_evaluation_summary(std::ostream& s, bool minimal_header,
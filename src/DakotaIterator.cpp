@@ -14,6 +14,7 @@
 
 #include "dakota_data_io.hpp"
 #include "DakotaIterator.hpp"
+#include "PerformanceRegistry.hpp"
 #include "DakotaTraitsBase.hpp"
 #include "MetaIterator.hpp"
 #include "ConcurrentMetaIterator.hpp"
@@ -1049,6 +1050,7 @@ void Iterator::run()
     }
 
     String method_string = method_enum_to_string(methodName);
+    ScopedTimer run_timer(method_string, "iterator");
     initialize_run();
     if (summaryOutputFlag)
       Cout << "\n>>>>> Running "  << method_string <<" iterator.\n";
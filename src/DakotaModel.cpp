@@ -29,6 +29,7 @@
 #include "DakotaGraphics.hpp"
 #include "pecos_stat_util.hpp"
 #include "EvaluationStore.hpp"
+#include "PerformanceRegistry.hpp"
 
 static const char rcsId[]="@(#) $Id: DakotaModel.cpp 7029 2010-10-22 00:17:02Z mseldre $";
 
@@ -88,6 +89,8 @@ Model::Model(BaseConstructor, ProblemDescDB& problem_db):
   hessIdAnalytic(problem_db.get_is("responses.hessians.mixed.id_analytic")),
   hessIdNumerical(problem_db.get_is("responses.hessians.mixed.id_numerical")),
   hessIdQuasi(problem_db.get_is("responses.hessians.mixed.id_quasi")),
+  stencilReuse(problem_db.get_bool("responses.fd_stencil_reuse")),
+  stencilCompact(problem_db.get_bool("responses.fd_stencil_compact")),
   warmStartFlag(false), supportsEstimDerivs(true), mappingInitialized(false),
   probDescDB(problem_db), parallelLib(problem_db.parallel_library()),
   modelPCIter(parallelLib.parallel_configuration_iterator()),
@@ -232,9 +235,9 @@ Model(LightWtBaseConstructor, const SharedVariablesData& svd, bool share_svd,
       ParallelLibrary& parallel_lib):
   numDerivVars(set.derivative_vector().size()),
   numFns(set.request_vector().size()), evaluationsDB(evaluation_store_db),
-  fdGradStepType("relative"), fdHessStepType("relative"), warmStartFlag(false), 
-  supportsEstimDerivs(true), mappingInitialized(false), probDescDB(problem_db),
-  parallelLib(parallel_lib),
+  fdGradStepType("relative"), fdHessStepType("relative"), stencilReuse(false),
+  stencilCompact(false), warmStartFlag(false), supportsEstimDerivs(true),
+  mappingInitialized(false), probDescDB(problem_db), parallelLib(parallel_lib),
   modelPCIter(parallel_lib.parallel_configuration_iterator()),
   componentParallelMode(NO_PARALLEL_MODE), asynchEvalFlag(false),
   evaluationCapacity(1), outputLevel(output_level),
@@ -271,7 +274,8 @@ Model(LightWtBaseConstructor, const SharedVariablesData& svd, bool share_svd,
 Model::
 Model(LightWtBaseConstructor, ProblemDescDB& problem_db,
       ParallelLibrary& parallel_lib):
-  warmStartFlag(false), supportsEstimDerivs(true), mappingInitialized(false),
+  stencilReuse(false), stencilCompact(false), warmStartFlag(false),
+  supportsEstimDerivs(true), mappingInitialized(false),
   probDescDB(problem_db), parallelLib(parallel_lib),
   evaluationsDB(evaluation_store_db),
   modelPCIter(parallel_lib.parallel_configuration_iterator()),
@@ -1183,6 +1187,7 @@ void Model::evaluate()
   if (modelRep) // envelope fwd to letter
     modelRep->evaluate();
   else { // letter
+    ScopedTimer eval_timer(modelType, "model");
     ++modelEvalCntr;
     if (modelEvaluationsDBState == EvaluationsDBState::UNINITIALIZED) {
       modelEvaluationsDBState = evaluationsDB.model_allocate(modelId, modelType,
@@ -1222,6 +1227,7 @@ void Model::evaluate(const ActiveSet& set)
   if (modelRep) // envelope fwd to letter
     modelRep->evaluate(set);
   else { // letter
+    ScopedTimer eval_timer(modelType, "model");
     ++modelEvalCntr;
 
     if (modelEvaluationsDBState == EvaluationsDBState::UNINITIALIZED) {
@@ -1251,9 +1257,19 @@ void Model::evaluate(const ActiveSet& set)
       estimate_derivatives(map_asv, fd_grad_asv, fd_hess_asv, quasi_hess_asv,
 			   set, asynchEvalFlag);
       if (asynchEvalFlag) { // concatenate asynch map calls into 1 response
-        const IntResponseMap& fd_responses = derived_synchronize();
-        synchronize_derivatives(currentVariables, fd_responses, currentResponse,
-				fd_grad_asv, fd_hess_asv, quasi_hess_asv, set);
+        const IntResponseMap& raw_resp_map = derived_synchronize();
+	if (stencilReuse) { // recover stencil order from the stencil slots
+	  IntResponseMap fd_responses;
+	  stencil_responses(raw_resp_map, fd_responses);
+	  synchronize_derivatives(currentVariables, fd_responses,
+				  currentResponse, fd_grad_asv, fd_hess_asv,
+				  quasi_hess_asv, set);
+	  close_stencil_batch(raw_resp_map);
+	}
+	else
+	  synchronize_derivatives(currentVariables, raw_resp_map,
+				  currentResponse, fd_grad_asv, fd_hess_asv,
+				  quasi_hess_asv, set);
       }
     }
     else if (derived_master_overload()) {
@@ -1328,16 +1344,19 @@ void Model::evaluate_nowait(const ActiveSet& set)
       evaluationsDB.store_model_variables(modelId, modelType, modelEvalCntr,
           set, currentVariables);
 
-    // derived evaluation_id() not yet incremented (for first of several if est
-    // derivs); want the key for id map to be the first raw eval of the set
-    rawEvalIdMap[derived_evaluation_id() + 1] = modelEvalCntr;
-
     // Manage use of estimate_derivatives() for a particular asv based on
     // the user's gradients/Hessians spec.
     ShortArray map_asv(numFns, 0),    fd_grad_asv(numFns, 0),
            fd_hess_asv(numFns, 0), quasi_hess_asv(numFns, 0);
     bool use_est_deriv = manage_asv(set, map_asv, fd_grad_asv,
 				    fd_hess_asv, quasi_hess_asv);
+
+    // derived evaluation_id() not yet incremented (for first of several if est
+    // derivs); want the key for id map to be the first raw eval of the set.
+    // With stencil reuse, an estimate may not evaluate at all and its raw
+    // ids are instead tracked by stencilSlotList.
+    if (!use_est_deriv || !stencilReuse)
+      rawEvalIdMap[derived_evaluation_id() + 1] = modelEvalCntr;
     int num_fd_evals;
     if (use_est_deriv) {
       // Compute requested derivatives not available from the simulation.
@@ -1370,12 +1389,58 @@ const IntResponseMap& Model::synchronize()
   if (modelRep) // envelope fwd to letter
     return modelRep->synchronize();
   else { // letter
+    ScopedTimer synch_timer("synchronize", "model");
     responseMap.clear();
 
     const IntResponseMap& raw_resp_map = derived_synchronize();
     IntVarsMIter v_it; IntRespMCIter r_cit; IntIntMIter id_it;
 
-    if (estDerivsFlag) { // merge several responses into response gradients
+    if (estDerivsFlag && stencilReuse) {
+      // merge stencil slots, which may reference the evaluations of other
+      // estimates in the batch or data retrieved without evaluation
+      if (outputLevel > QUIET_OUTPUT)
+        Cout <<"-----------------------------------------\n"
+             << "Raw asynchronous response data captured.\n"
+	     << "Merging data to estimate derivatives:\n"
+	     << "----------------------------------------\n\n";
+      id_it = rawEvalIdMap.begin(); IntIntMIter fd_it = numFDEvalsMap.begin();
+      while (fd_it != numFDEvalsMap.end()) {
+	int model_id = fd_it->first, num_fd_evals = fd_it->second;
+	if (num_fd_evals >= 0) {
+	  if (outputLevel > QUIET_OUTPUT)
+	    Cout << "Merging " << num_fd_evals << " stencil responses for "
+		 << "evaluation " << model_id << '\n';
+	  v_it = varsMap.find(model_id);
+	  IntResponseMap tmp_response_map;
+	  stencil_responses(raw_resp_map, tmp_response_map);
+	  ShortArray fd_grad_asv    = asvList.front(); asvList.pop_front();
+	  ShortArray fd_hess_asv    = asvList.front(); asvList.pop_front();
+	  ShortArray quasi_hess_asv = asvList.front(); asvList.pop_front();
+	  ActiveSet  orig_set       = setList.front(); setList.pop_front();
+	  synchronize_derivatives(v_it->second, tmp_response_map,
+				  responseMap[model_id], fd_grad_asv,
+				  fd_hess_asv, quasi_hess_asv, orig_set);
+	  if (!modelAutoGraphicsFlag) varsMap.erase(v_it);
+	  numFDEvalsMap.erase(fd_it++);
+	}
+	else { // rawEvalIdMap only tracks the evaluations without estimates
+	  r_cit = (id_it == rawEvalIdMap.end()) ? raw_resp_map.end() :
+	    raw_resp_map.find(id_it->first);
+	  if (r_cit != raw_resp_map.end()) {
+	    if (outputLevel > QUIET_OUTPUT)
+	      Cout << "Asynchronous response " << id_it->first
+		   << " does not require merging.\n";
+	    responseMap[model_id] = r_cit->second;
+	    numFDEvalsMap.erase(fd_it++); rawEvalIdMap.erase(id_it++);
+	  }
+	  else // preserve bookkeeping for a subsequent synchronization pass
+	    { ++fd_it; if (id_it != rawEvalIdMap.end()) ++id_it; }
+	}
+      }
+      close_stencil_batch(raw_resp_map);
+      estDerivsFlag = false;
+    }
+    else if (estDerivsFlag) { // merge several responses into response grads
       if (outputLevel > QUIET_OUTPUT)
         Cout <<"-----------------------------------------\n"
              << "Raw asynchronous response data captured.\n"
@@ -1740,6 +1805,8 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
   if (asynch_flag) { // communicate settings to synchronize_derivatives()
     initialMapList.push_back(initial_map);
     dbCaptureList.push_back(db_capture);
+    if (stencilReuse) // stencil slots of this estimate
+      stencilSlotList.push_back(IntArray());
   }
 
   if (initial_map) {
@@ -1750,7 +1817,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
       Cout << ":\n";
     }
     if (asynch_flag) {
-      derived_evaluate_nowait(new_set);
+      stencil_evaluate_nowait(new_set);
       if (outputLevel > SILENT_OUTPUT)
 	Cout << "\n\n";
     }
@@ -1802,6 +1869,14 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
     const RealVector& fn_vals_x0  = initial_map_response.function_values();
     const RealMatrix& fn_grads_x0 = initial_map_response.function_gradients();
 
+    // points of the previous batch that may replace forward difference
+    // stencil points (Hessian steps are tied to the gradient steps)
+    std::multimap<size_t, size_t> compact_offsets;
+    if (asynch_flag && stencilReuse && stencilCompact &&
+	intervalType == "forward" && !fd_hess_flag)
+      compact_stencil_points(x0, active_derivs, inactive_derivs, fd_grad_asv,
+			     compact_offsets);
+
     // ------------------------
     // Loop over num_deriv_vars
     // ------------------------
@@ -1826,6 +1901,42 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
         // Compute the offset for the ith gradient variable.
         Real h = forward_grad_step(num_deriv_vars, xj_index, x0_j, lb_j, ub_j);
 
+        // Replace x0 + h by the previous point offset from x0 in x[j] whose
+        // step is closest to h, provided it is within a factor of two
+        std::pair<std::multimap<size_t, size_t>::const_iterator,
+		  std::multimap<size_t, size_t>::const_iterator>
+	  offset_range = compact_offsets.equal_range(xj_index);
+        Real compact_h = 0., compact_ratio = std::log(2.);
+        const StencilPoint* compact_pt = NULL;
+        for (std::multimap<size_t, size_t>::const_iterator
+	       o_it=offset_range.first; o_it!=offset_range.second; ++o_it) {
+          const StencilPoint& prev_pt = prevStencilPoints[o_it->second];
+          Real xp_j = (active_derivs) ?
+	    prev_pt.vars.continuous_variable(xj_index) : (inactive_derivs) ?
+	    prev_pt.vars.inactive_continuous_variables()[xj_index] :
+	    prev_pt.vars.all_continuous_variables()[xj_index];
+          Real ratio = std::fabs(std::log(std::fabs((xp_j - x0_j) / h)));
+          if (ratio <= compact_ratio &&
+	      ( ignoreBounds || ( xp_j >= lb_j && xp_j <= ub_j ) ) ) {
+	    compact_h = xp_j - x0_j; compact_ratio = ratio;
+	    compact_pt = &prev_pt;
+	  }
+        }
+        if (compact_pt) {
+          if (outputLevel > SILENT_OUTPUT)
+            Cout << ">>>>> Dakota finite difference gradient evaluation for x["
+                 << j+1 << "] + h retrieved from previous stencil (h = "
+                 << compact_h << ")\n\n";
+          deltaList.push_back(compact_h);
+          Response compact_resp(currentResponse.shared_data(), new_set);
+          compact_resp.update(compact_pt->response);
+          stencilCaptures.push_back(compact_resp);
+          stencilSlotList.back().push_back(-(int)stencilCaptures.size());
+          ++stencilCntr.requested; ++stencilCntr.compact;
+          ++map_counter;
+          continue;
+        }
+
         if (asynch_flag) // communicate settings to synchronize_derivatives()
           deltaList.push_back(h);
 
@@ -1844,7 +1955,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
         else
           currentVariables.all_continuous_variables(x);
         if (asynch_flag) {
-          derived_evaluate_nowait(new_set);
+          stencil_evaluate_nowait(new_set);
           if (outputLevel > SILENT_OUTPUT)
             Cout << "\n\n";
         }
@@ -1878,7 +1989,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
             currentVariables.all_continuous_variables(x);
           if (asynch_flag) {
             deltaList.push_back(h2);
-            derived_evaluate_nowait(new_set);
+            stencil_evaluate_nowait(new_set);
             if (outputLevel > SILENT_OUTPUT)
               Cout << "\n\n";
           }
@@ -1951,7 +2062,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
             else
               currentVariables.all_continuous_variables(x);
             if (asynch_flag) {
-              derived_evaluate_nowait(new_set);
+              stencil_evaluate_nowait(new_set);
               if (outputLevel > SILENT_OUTPUT)
                 Cout << "\n\n";
             }
@@ -1974,7 +2085,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
             else
               currentVariables.all_continuous_variables(x);
             if (asynch_flag) {
-              derived_evaluate_nowait(new_set);
+              stencil_evaluate_nowait(new_set);
               if (outputLevel > SILENT_OUTPUT)
                 Cout << "\n\n";
             }
@@ -2015,7 +2126,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
               else
                 currentVariables.all_continuous_variables(x);
               if (asynch_flag) {
-                derived_evaluate_nowait(new_set);
+                stencil_evaluate_nowait(new_set);
                 if (outputLevel > SILENT_OUTPUT)
                   Cout << "\n\n";
               }
@@ -2038,7 +2149,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
               else
                 currentVariables.all_continuous_variables(x);
               if (asynch_flag) {
-                derived_evaluate_nowait(new_set);
+                stencil_evaluate_nowait(new_set);
                 if (outputLevel > SILENT_OUTPUT)
                   Cout << "\n\n";
               }
@@ -2061,7 +2172,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
               else
                 currentVariables.all_continuous_variables(x);
               if (asynch_flag) {
-                derived_evaluate_nowait(new_set);
+                stencil_evaluate_nowait(new_set);
                 if (outputLevel > SILENT_OUTPUT)
                   Cout << "\n\n";
               }
@@ -2084,7 +2195,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
               else
                 currentVariables.all_continuous_variables(x);
               if (asynch_flag) {
-                derived_evaluate_nowait(new_set);
+                stencil_evaluate_nowait(new_set);
                 if (outputLevel > SILENT_OUTPUT)
                   Cout << "\n\n";
               }
@@ -2143,7 +2254,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
             else
               currentVariables.all_continuous_variables(x);
             if (asynch_flag) {
-              derived_evaluate_nowait(new_set);
+              stencil_evaluate_nowait(new_set);
               if (outputLevel > SILENT_OUTPUT)
                 Cout << "\n\n";
             }
@@ -2166,7 +2277,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
             else
               currentVariables.all_continuous_variables(x);
             if (asynch_flag) {
-              derived_evaluate_nowait(new_set);
+              stencil_evaluate_nowait(new_set);
               if (outputLevel > SILENT_OUTPUT)
                 Cout << "\n\n";
             }
@@ -2219,7 +2330,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
               else
                 currentVariables.all_continuous_variables(x);
               if (asynch_flag) {
-                derived_evaluate_nowait(new_set);
+                stencil_evaluate_nowait(new_set);
                 if (outputLevel > SILENT_OUTPUT)
                   Cout << "\n\n";
               }
@@ -2266,7 +2377,7 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
           else
             currentVariables.all_continuous_variables(x);
           if (asynch_flag) {
-            derived_evaluate_nowait(new_set);
+            stencil_evaluate_nowait(new_set);
             if (outputLevel > SILENT_OUTPUT)
               Cout << "\n\n";
           }
@@ -2327,6 +2438,178 @@ estimate_derivatives(const ShortArray& map_asv, const ShortArray& fd_grad_asv,
 }
 
 
+/** A stencil point is covered by data at the same point when that data
+    include every request, with a consistent derivative vector. */
+static bool stencil_set_covers(const ActiveSet& avail, const ActiveSet& req)
+{
+  const ShortArray& avail_asv = avail.request_vector();
+  const ShortArray&   req_asv =   req.request_vector();
+  size_t i, num_fns = req_asv.size();
+  bool derivs = false;
+  for (i=0; i<num_fns; ++i) {
+    if ((avail_asv[i] & req_asv[i]) != req_asv[i])
+      return false;
+    if (req_asv[i] & 6)
+      derivs = true;
+  }
+  return (!derivs || avail.derivative_vector() == req.derivative_vector());
+}
+
+
+/** When stencilReuse is active, the stencil point at currentVariables is
+    only queued if it is not covered by a point already in the current
+    batch, by a point of the previous batch, or by the evaluation cache.
+    In all cases, the source of its data is appended to the stencil slots
+    of the current estimate for use by stencil_responses(). */
+void Model::stencil_evaluate_nowait(const ActiveSet& set)
+{
+  if (!stencilReuse)
+    { derived_evaluate_nowait(set); return; }
+
+  ++stencilCntr.requested;
+  IntArray& slots = stencilSlotList.back();
+  size_t hash = hash_value(currentVariables);
+  std::pair<std::multimap<size_t, size_t>::const_iterator,
+	    std::multimap<size_t, size_t>::const_iterator> range;
+  std::multimap<size_t, size_t>::const_iterator s_it;
+
+  // share the source of a coincident point in the current batch
+  range = stencilIndex.equal_range(hash);
+  for (s_it=range.first; s_it!=range.second; ++s_it) {
+    const StencilPoint& pt = stencilPoints[s_it->second];
+    if (stencil_set_covers(pt.set, set) && pt.vars == currentVariables) {
+      if (outputLevel > SILENT_OUTPUT)
+	Cout << ">>>>> stencil point shared with a pending evaluation";
+      slots.push_back(pt.source);
+      ++stencilCntr.batch;
+      return;
+    }
+  }
+
+  // retrieve a coincident point of the previous batch or the cache
+  Response found_resp(currentResponse.shared_data(), set);
+  bool found = false;
+  range = prevStencilIndex.equal_range(hash);
+  for (s_it=range.first; s_it!=range.second && !found; ++s_it) {
+    const StencilPoint& pt = prevStencilPoints[s_it->second];
+    if (stencil_set_covers(pt.set, set) && pt.vars == currentVariables)
+      { found_resp.update(pt.response); found = true; }
+  }
+  if (!found)
+    found = db_lookup(currentVariables, set, found_resp);
+
+  StencilPoint pt;
+  if (found) {
+    if (outputLevel > SILENT_OUTPUT)
+      Cout << ">>>>> stencil point evaluated previously and results retrieved";
+    stencilCaptures.push_back(found_resp);
+    pt.source = -(int)stencilCaptures.size();
+    ++stencilCntr.prior;
+  }
+  else {
+    derived_evaluate_nowait(set);
+    pt.source = derived_evaluation_id();
+    ++stencilCntr.evaluated;
+  }
+  slots.push_back(pt.source);
+
+  pt.vars = currentVariables.copy(); pt.set = set;
+  stencilIndex.insert(std::make_pair(hash, stencilPoints.size()));
+  stencilPoints.push_back(pt);
+}
+
+
+/** A point of the previous batch qualifies when it includes the function
+    values required by fd_grad_asv, its discrete variables coincide with
+    those of currentVariables (at x0), and its continuous variables differ
+    from those of currentVariables in a single entry of x0. */
+void Model::
+compact_stencil_points(const RealVector& x0, bool active_derivs,
+		       bool inactive_derivs, const ShortArray& fd_grad_asv,
+		       std::multimap<size_t, size_t>& offsets) const
+{
+  const RealVector& acv0 = currentVariables.all_continuous_variables();
+  size_t i, k, p, num_prev = prevStencilPoints.size(), num_x = x0.length(),
+    num_acv = acv0.length();
+  for (p=0; p<num_prev; ++p) {
+    const Variables&  vars = prevStencilPoints[p].vars;
+    const ShortArray& asv  = prevStencilPoints[p].set.request_vector();
+    for (i=0; i<numFns; ++i)
+      if ( (fd_grad_asv[i] & 1) && !(asv[i] & 1) )
+	break;
+    if (i < numFns ||
+	vars.all_discrete_int_variables() !=
+	currentVariables.all_discrete_int_variables() ||
+	vars.all_discrete_real_variables() !=
+	currentVariables.all_discrete_real_variables() ||
+	vars.all_discrete_string_variables() !=
+	currentVariables.all_discrete_string_variables())
+      continue;
+
+    const RealVector& acv = vars.all_continuous_variables();
+    size_t num_diff = 0;
+    for (k=0; k<num_acv && num_diff<2; ++k)
+      if (acv[k] != acv0[k])
+	++num_diff;
+    if (num_diff != 1)
+      continue;
+
+    const RealVector& x = (active_derivs) ? vars.continuous_variables() :
+      ( (inactive_derivs) ? vars.inactive_continuous_variables() : acv );
+    for (k=0; k<num_x; ++k)
+      if (x[k] != x0[k])
+	{ offsets.insert(std::make_pair(k, p)); break; }
+  }
+}
+
+
+void Model::
+stencil_responses(const IntResponseMap& raw_resp_map,
+		  IntResponseMap& fd_responses)
+{
+  const IntArray& slots = stencilSlotList.front();
+  size_t k, num_slots = slots.size();
+  for (k=0; k<num_slots; ++k) {
+    int source = slots[k];
+    if (source > 0) {
+      IntRespMCIter r_cit = raw_resp_map.find(source);
+      if (r_cit == raw_resp_map.end()) {
+	Cerr << "Error: finite difference stencil evaluation " << source
+	     << " not returned by synchronization in Model::"
+	     << "stencil_responses()." << std::endl;
+	abort_handler(MODEL_ERROR);
+      }
+      fd_responses[k] = r_cit->second;
+    }
+    else
+      fd_responses[k] = stencilCaptures[-source-1];
+  }
+  stencilSlotList.pop_front();
+}
+
+
+void Model::close_stencil_batch(const IntResponseMap& raw_resp_map)
+{
+  prevStencilPoints.clear(); prevStencilIndex.clear();
+  size_t p, num_pts = stencilPoints.size();
+  for (p=0; p<num_pts; ++p) {
+    StencilPoint& pt = stencilPoints[p];
+    if (pt.source > 0) {
+      IntRespMCIter r_cit = raw_resp_map.find(pt.source);
+      if (r_cit == raw_resp_map.end())
+	continue;
+      pt.response = r_cit->second;
+    }
+    else
+      pt.response = stencilCaptures[-pt.source-1];
+    prevStencilIndex.insert(std::make_pair(hash_value(pt.vars),
+					   prevStencilPoints.size()));
+    prevStencilPoints.push_back(pt);
+  }
+  stencilPoints.clear(); stencilIndex.clear(); stencilCaptures.clear();
+}
+
+
 /** Merge an array of fd_responses into a single new_response.  This
     function is used both by synchronous evaluate() for the
     case of asynchronous estimate_derivatives() and by synchronize()
@@ -5747,6 +6030,25 @@ print_evaluation_summary(std::ostream& s, bool minimal_header,
   }
 }
 
+void Model::stencil_evaluation_reference()
+{ stencilRefPt = stencilCntr; }
+
+
+void Model::print_stencil_summary(std::ostream& s, bool relative_count) const
+{
+  StencilCounters cntr = stencilCntr;
+  if (relative_count) {
+    cntr.requested -= stencilRefPt.requested;
+    cntr.evaluated -= stencilRefPt.evaluated;
+    cntr.batch     -= stencilRefPt.batch;
+    cntr.prior     -= stencilRefPt.prior;
+    cntr.compact   -= stencilRefPt.compact;
+  }
+  s << "  Finite difference stencil points: " << cntr.requested << " total ("
+    << cntr.evaluated << " evaluated, " << cntr.batch << " shared, "
+    << cntr.prior << " retrieved, " << cntr.compact << " compact)\n";
+}
+
 /// Derived classes containing additional models or interfaces should
 /// implement this function to pass along to their sub Models/Interfaces
 void Model::eval_tag_prefix(const String& eval_id_str)
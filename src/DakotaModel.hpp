@@ -1291,6 +1291,13 @@ protected:
   Real forward_grad_step(size_t num_deriv_vars, size_t xj_index,
                          Real x0_j, Real lb_j, Real ub_j);
 
+  /// reset the reference point for the finite difference stencil
+  /// counters reported by print_stencil_summary()
+  void stencil_evaluation_reference();
+  /// print the finite difference stencil points requested, evaluated,
+  /// and reused since the reference point (relative_count) or in total
+  void print_stencil_summary(std::ostream& s, bool relative_count) const;
+
   /// Return the interface flag for the EvaluationsDB state
   EvaluationsDBState evaluations_db_state(const Interface &interface);
   /// Return the model flag for the EvaluationsDB state
@@ -1406,6 +1413,13 @@ protected:
   bool ignoreBounds;
   /// option to use old 2nd-order finite diffs for Hessians
   bool centralHess;
+  /// option to reuse coincident points among the asynchronous finite
+  /// difference stencils of a batch, the previous batch, and the
+  /// evaluation cache
+  bool stencilReuse;
+  /// option to also reuse points of the previous batch that are offset
+  /// from x0 in a single coordinate as forward difference stencil points
+  bool stencilCompact;
   /// if in warm-start mode, don't reset accumulated data (e.g., quasiHessians)
   bool warmStartFlag;
   /// whether model should perform or forward derivative estimation
@@ -1560,6 +1574,23 @@ private:
   /// by bounds)
   Real FDstep2(Real x0_j, Real lb_j, Real ub_j, Real h);
 
+  /// queue an asynchronous finite difference evaluation at currentVariables,
+  /// reusing a coincident stencil point when stencilReuse is active
+  void stencil_evaluate_nowait(const ActiveSet& set);
+  /// identify the points of the previous stencil batch that differ from
+  /// x0 in a single derivative variable, keyed by its index within x0
+  void compact_stencil_points(const RealVector& x0, bool active_derivs,
+			      bool inactive_derivs,
+			      const ShortArray& fd_grad_asv,
+			      std::multimap<size_t, size_t>& offsets) const;
+  /// assemble the finite difference responses of the next asynchronous
+  /// derivative estimate, in stencil order, from the raw responses
+  void stencil_responses(const IntResponseMap& raw_resp_map,
+			 IntResponseMap& fd_responses);
+  /// retain the evaluated points of the current stencil batch for reuse
+  /// by the next batch and clear the current batch
+  void close_stencil_batch(const IntResponseMap& raw_resp_map);
+
   //
   //- Heading: Data
   //
@@ -1619,6 +1650,40 @@ private:
   /// Used for rekeying responseMap.
   IntIntMap rawEvalIdMap;
 
+  /// a finite difference stencil point together with the source of its data
+  struct StencilPoint {
+    Variables vars;    ///< point at which the stencil is evaluated
+    ActiveSet set;     ///< data requested at the point
+    int       source;  ///< raw evaluation id (> 0) or -(1 + stencilCaptures
+                       ///< index) for data retrieved without evaluation
+    Response  response;///< data at the point, once synchronized
+  };
+  /// counts of finite difference stencil points
+  struct StencilCounters {
+    size_t requested = 0; ///< stencil points required by the estimates
+    size_t evaluated = 0; ///< stencil points submitted for evaluation
+    size_t batch     = 0; ///< reused from earlier points of the same batch
+    size_t prior     = 0; ///< reused from the previous batch or the cache
+    size_t compact   = 0; ///< replaced by single-coordinate offset points
+  };
+  /// stencil points of the current batch of asynchronous estimates
+  std::vector<StencilPoint> stencilPoints;
+  /// lookup of stencilPoints by hash_value() of their variables
+  std::multimap<size_t, size_t> stencilIndex;
+  /// synchronized stencil points of the previous batch
+  std::vector<StencilPoint> prevStencilPoints;
+  /// lookup of prevStencilPoints by hash_value() of their variables
+  std::multimap<size_t, size_t> prevStencilIndex;
+  /// per asynchronous estimate, the source of each stencil slot (see
+  /// StencilPoint::source), consumed in order by stencil_responses()
+  std::list<IntArray> stencilSlotList;
+  /// responses retrieved for stencil slots without evaluation
+  ResponseArray stencilCaptures;
+  /// counts of stencil points since construction
+  StencilCounters stencilCntr;
+  /// stencilCntr at the last stencil_evaluation_reference()
+  StencilCounters stencilRefPt;
+
   /// previous parameter vectors used in computing s for quasi-Newton updates
   RealVectorArray xPrev;
   /// previous gradient vectors used in computing y for quasi-Newton updates
@@ -339,6 +339,20 @@ Response Response::copy(bool deep_srd) const
 }
 
 
+/** The letter of target may only be reused if no other handle can
+    observe the change.  A common SharedResponseData also guarantees a
+    common derived letter type for copy_rep(). */
+void Response::copy(Response& target) const
+{
+  if (responseRep && target.responseRep && target.responseRep != responseRep &&
+      target.responseRep.use_count() == 1 &&
+      target.responseRep->sharedRespData.same_rep(responseRep->sharedRespData))
+    target.responseRep->copy_rep(responseRep);
+  else
+    target = copy();
+}
+
+
 void Response::copy_rep(std::shared_ptr<Response> source_resp_rep)
 {
   functionValues    = source_resp_rep->functionValues;
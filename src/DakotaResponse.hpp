@@ -260,6 +260,10 @@ public:
   /// in history mechanisms (SharedResponseData uses a shallow copy by
   /// default)
   Response copy(bool deep_srd = false) const;
+  /// deep copy into the existing letter of target, reusing its storage,
+  /// when target holds the only reference to a letter with the same
+  /// SharedResponseData; otherwise target is assigned copy()
+  void copy(Response& target) const;
 
   /// return the number of doubles active in response.  Used for sizing 
   /// double* response_data arrays passed into read_data and write_data.
@@ -306,6 +310,8 @@ public:
 
   /// function to check responseRep (does this handle contain a body)
   bool is_null() const;
+  /// return the number of handles sharing responseRep
+  long reference_count() const;
  
   /// method to set the covariance matrix defined for ExperimentResponse
   virtual void set_scalar_covariance(RealVector& scalars);
@@ -960,6 +966,10 @@ inline bool Response::is_null() const
 { return (responseRep == NULL); }
 
 
+inline long Response::reference_count() const
+{ return responseRep.use_count(); }
+
+
 inline RealMatrix Response::field_gradients_view(size_t i) const
 {
   if (responseRep)
@@ -30,7 +30,8 @@ SurrogatesBaseApprox::
 SurrogatesBaseApprox(const ProblemDescDB& problem_db,
 		     const SharedApproxData& shared_data,
 		     const String& approx_label):
-  Approximation(BaseConstructor(), problem_db, shared_data, approx_label)
+  Approximation(BaseConstructor(), problem_db, shared_data, approx_label),
+  qoiIndex(0)
 {
   advanced_options_file = problem_db.get_string("model.advanced_options_file");
   set_verbosity();
@@ -39,7 +40,7 @@ SurrogatesBaseApprox(const ProblemDescDB& problem_db,
 
 SurrogatesBaseApprox::
 SurrogatesBaseApprox(const SharedApproxData& shared_data):
-  Approximation(NoDBBaseConstructor(), shared_data)
+  Approximation(NoDBBaseConstructor(), shared_data), qoiIndex(0)
 { set_verbosity(); }
 
 
@@ -54,7 +55,7 @@ Real SurrogatesBaseApprox::diagnostic(const String& metric_type)
   convert_surrogate_data(vars,resp);
 
   StringArray diag_set(1, metric_type);
-  auto metric_vals = model->evaluate_metrics(diag_set, vars, resp);
+  auto metric_vals = model->evaluate_metrics(diag_set, vars, resp, qoiIndex);
 
   Cout << std::setw(20) << diag_set[0] << "  " << metric_vals[0] << '\n';
 
@@ -96,7 +97,7 @@ void SurrogatesBaseApprox::primary_diagnostics(size_t fn_index)
     MatrixXd vars, resp;
     convert_surrogate_data(vars,resp);
 
-    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp);
+    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp, qoiIndex);
 
     Cout << "\nSurrogate quality metrics at build (training) points for "
 	 << func_description << ":\n";
@@ -146,7 +147,7 @@ challenge_diagnostics(size_t fn_index, const RealMatrix& challenge_points,
     Eigen::Map<Eigen::MatrixXd> resp(challenge_responses.values(),
 				     challenge_responses.length(), 1);
 
-    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp);
+    auto metric_vals = model->evaluate_metrics(diag_set, vars, resp, qoiIndex);
 
     Cout << "\nSurrogate quality metrics at challenge (test) points for "
 	 << func_description << ":\n";
@@ -229,7 +230,29 @@ SurrogatesBaseApprox::value(const RealVector& c_vars)
   }
 
   Eigen::Map<Eigen::RowVectorXd> eval_point(c_vars.values(), c_vars.length());
-  return model->value(eval_point)(0);
+  return model->value(eval_point, qoiIndex)(0);
+}
+
+
+/** All points are predicted by a single call to the surrogate, with
+    the evaluation points as the rows of the transposed c_vars. */
+void
+SurrogatesBaseApprox::values(const RealMatrix& c_vars, RealVector& vals)
+{
+  if (!model) {
+    Cerr << "Error: surface is null in SurrogatesBaseApprox::values()"
+	 << std::endl;
+    abort_handler(-1);
+  }
+
+  Eigen::Map<const Eigen::MatrixXd> eval_pts(c_vars.values(),
+					     c_vars.numRows(), c_vars.numCols());
+  VectorXd pred_vals = model->value(eval_pts.transpose(), qoiIndex);
+
+  int j, num_pts = c_vars.numCols();
+  if (vals.length() != num_pts) vals.sizeUninitialized(num_pts);
+  for (j=0; j<num_pts; ++j)
+    vals[j] = pred_vals(j);
 }
     
 const RealVector& SurrogatesBaseApprox::gradient(const RealVector& c_vars)
@@ -240,7 +263,7 @@ const RealVector& SurrogatesBaseApprox::gradient(const RealVector& c_vars)
   Eigen::Map<Eigen::MatrixXd> eval_pts(c_vars.values(), num_evals, num_vars);
 
   // not sending Eigen view of approxGradient as model->gradient calls resize()
-  MatrixXd pred_grad = model->gradient(eval_pts);
+  MatrixXd pred_grad = model->gradient(eval_pts, qoiIndex);
 
   approxGradient.sizeUninitialized(c_vars.length());
   for (size_t j = 0; j < num_vars; j++)
@@ -264,14 +287,28 @@ import_model(const ProblemDescDB& problem_db)
     (is_binary ? ".bin" : ".txt");
 
   model = dakota::surrogates::Surrogate::load(filename, is_binary);
+  qoiIndex = 0;
 
   if (sharedDataRep->outputLevel >= NORMAL_OUTPUT)
     Cout << "Imported surrogate for response '" << approxLabel
 	 << "' from file '" << filename << "'." << std::endl;
 
-  if (sharedDataRep->outputLevel >= SILENT_OUTPUT &&
-      !model->response_labels().empty()) {
-    auto imported_label = model->response_labels()[0];
+  // a surrogate exported for several responses predicts the labeled one
+  const auto& imported_labels = model->response_labels();
+  if (imported_labels.size() > 1) {
+    auto l_it = std::find(imported_labels.begin(), imported_labels.end(),
+			  approxLabel);
+    if (l_it != imported_labels.end())
+      qoiIndex = std::distance(imported_labels.begin(), l_it);
+    else if (sharedDataRep->outputLevel >= SILENT_OUTPUT)
+      Cout << "\nWarning: Surrogate imported from file " << filename
+	   << "\ndoes not predict response '" << approxLabel
+	   << "'; using its first response '" << imported_labels[0] << "'."
+	   << std::endl;
+  }
+  else if (sharedDataRep->outputLevel >= SILENT_OUTPUT &&
+	   !imported_labels.empty()) {
+    auto imported_label = imported_labels[0];
     if (imported_label != approxLabel)
       Cout << "\nWarning: Surrogate imported from file " << filename
 	   << "\nhas response label '" << imported_label << "'; expected '"
@@ -317,35 +354,38 @@ export_model(const StringArray& var_labels, const String& fn_label,
     return;
   }
 
-  model->variable_labels(var_labels);
+  std::shared_ptr<dakota::surrogates::Surrogate> export_surr =
+    export_surrogate();
+  export_surr->variable_labels(var_labels);
 
-  // This block uses prefix, label, maybe formats
-  String without_extension;
-  unsigned short formats;
-  if(export_format) {
-    model->response_labels(StringArray(1, fn_label));
-    without_extension = export_prefix + "." + fn_label;
-    formats = export_format;
-  }
-  else {
-    model->response_labels(StringArray(1, approxLabel));
-    without_extension = sharedDataRep->modelExportPrefix + "." + approxLabel;
-    formats = sharedDataRep->modelExportFormat;
-  }
+  // This block uses prefix, label, maybe formats; a surrogate predicting
+  // several responses retains their labels
+  const String& label = export_format ? fn_label : approxLabel;
+  if (export_surr->response_labels().size() <= 1)
+    export_surr->response_labels(StringArray(1, label));
+  String without_extension = (export_format ?
+    export_prefix : sharedDataRep->modelExportPrefix) + "." + label;
+  unsigned short formats = export_format ? export_format :
+    sharedDataRep->modelExportFormat;
 
   // This block without_extension, formats
   // Saving to text archive
   if(formats & TEXT_ARCHIVE) {
     String filename = without_extension + ".txt";
-    dakota::surrogates::Surrogate::save(model, filename, false);
+    dakota::surrogates::Surrogate::save(export_surr, filename, false);
   }
   // Saving to binary archive
   if(formats & BINARY_ARCHIVE) {
     String filename = without_extension + ".bin";
-    dakota::surrogates::Surrogate::save(model, filename, true);
+    dakota::surrogates::Surrogate::save(export_surr, filename, true);
   }
 }
 
+std::shared_ptr<dakota::surrogates::Surrogate>
+SurrogatesBaseApprox::export_surrogate()
+{ return model; }
+
+
 void SurrogatesBaseApprox::set_verbosity()
 {
   auto dak_verb = sharedDataRep->outputLevel;
@@ -36,7 +36,7 @@ public:
   //
 
   /// default constructor
-  SurrogatesBaseApprox() { }
+  SurrogatesBaseApprox(): qoiIndex(0) { }
   /// standard constructor: 
   SurrogatesBaseApprox(const ProblemDescDB& problem_db,
 		       const SharedApproxData& shared_data,
@@ -77,9 +77,14 @@ protected:
 
   const RealVector& gradient(const RealVector& c_vars) override;
 
+  void values(const RealMatrix& c_vars, RealVector& vals) override;
+
   /// set the surrogate's verbosity level according to Dakota's verbosity
   void set_verbosity();
 
+  /// surrogate exported for this response (defaults to model)
+  virtual std::shared_ptr<dakota::surrogates::Surrogate> export_surrogate();
+
   /// construct-time only import of serialized surrogate
   void import_model(const ProblemDescDB& problem_db);
 
@@ -103,9 +108,12 @@ protected:
   /// Key/value config options for underlying surrogate
   dakota::ParameterList surrogateOpts;
 
-  /// The native surrogate model
+  /// The native surrogate model, which may predict other responses as well
   std::shared_ptr<dakota::surrogates::Surrogate> model;
 
+  /// index of this response among the QoIs predicted by model
+  int qoiIndex;
+
   /// Advanced configurations options filename
   String advanced_options_file;
 
@@ -15,6 +15,8 @@
 
 // Headers from Surrogates module
 #include "SurrogatesGaussianProcess.hpp"
+
+#include <algorithm>
  
 using dakota::VectorXd;
 using dakota::MatrixXd;
@@ -25,7 +27,8 @@ SurrogatesGPApprox::
 SurrogatesGPApprox(const ProblemDescDB& problem_db,
 		   const SharedApproxData& shared_data,
 		   const String& approx_label):
-  SurrogatesBaseApprox(problem_db, shared_data, approx_label)
+  SurrogatesBaseApprox(problem_db, shared_data, approx_label),
+  modelBuildCount(0)
 {
   // DTS: Updated default behavior to have no trend (i.e. if trend
   // keyword is absent there is no trend)
@@ -75,6 +78,7 @@ SurrogatesGPApprox(const ProblemDescDB& problem_db,
   std::shared_ptr<SharedSurfpackApproxData> shared_surf_data_rep =
     std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep);
   shared_surf_data_rep->validate_metrics(allowed_metrics);
+  shared_surf_data_rep->gpApproxReps.push_back(this);
 
   if (problem_db.get_bool("model.surrogate.import_surrogate"))
     import_model(problem_db);
@@ -84,8 +88,11 @@ SurrogatesGPApprox(const ProblemDescDB& problem_db,
 /// On-the-fly constructor
 SurrogatesGPApprox::
 SurrogatesGPApprox(const SharedApproxData& shared_data):
-  SurrogatesBaseApprox(shared_data)
+  SurrogatesBaseApprox(shared_data), modelBuildCount(0)
 {
+  std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep)->
+    gpApproxReps.push_back(this);
+
   // other GPs default to reduced_quadratic
   //surrogateOpts.sublist("Trend").set("estimate trend", true);
   //surrogateOpts.sublist("Trend").sublist("Options").set("max degree", 2);
@@ -116,6 +123,19 @@ SurrogatesGPApprox(const SharedApproxData& shared_data):
   //  .set("upper bound", nugget_bounds(1));
 }
 
+SurrogatesGPApprox::~SurrogatesGPApprox()
+{
+  if (sharedDataRep) {
+    std::vector<SurrogatesGPApprox*>& gp_approx_reps =
+      std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep)->
+      gpApproxReps;
+    gp_approx_reps.erase(std::remove(gp_approx_reps.begin(),
+				     gp_approx_reps.end(), this),
+			 gp_approx_reps.end());
+  }
+}
+
+
 int
 SurrogatesGPApprox::min_coefficients() const
 {
@@ -126,29 +146,86 @@ SurrogatesGPApprox::min_coefficients() const
 }
 
 
+/** Within a build of the shared data, the first response built also
+    builds the responses sharing its build points and configuration,
+    such that one GaussianProcess predicts all of them, e.g., for the
+    responses of a field QoI.  The later build() calls for those
+    responses are then no-ops. */
 void
 SurrogatesGPApprox::build()
 {
+  std::shared_ptr<SharedSurfpackApproxData> shared_surf_data_rep =
+    std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep);
+  size_t build_count = shared_surf_data_rep->buildCount;
+  if (build_count && modelBuildCount == build_count)
+    return; // already built along with an earlier response
+
   // clear any imported model mapping
   modelIsImported = false;
-  std::static_pointer_cast<SharedSurfpackApproxData>(sharedDataRep)->
-    varsMapIndices.clear();
+  shared_surf_data_rep->varsMapIndices.clear();
 
   MatrixXd vars, resp;
   convert_surrogate_data(vars, resp);
 
+  // collect the responses predicted by the GP in order of construction
+  std::vector<SurrogatesGPApprox*> qoi_approxs;
+  std::vector<MatrixXd> qoi_resp;
+  if (build_count)
+    for (SurrogatesGPApprox* gp_approx : shared_surf_data_rep->gpApproxReps) {
+      if (gp_approx == this) {
+	qoi_approxs.push_back(this);
+	qoi_resp.push_back(resp);
+	continue;
+      }
+      if (gp_approx->modelBuildCount == build_count ||
+	  gp_approx->advanced_options_file != advanced_options_file ||
+	  !(gp_approx->surrogateOpts == surrogateOpts))
+	continue;
+      MatrixXd gp_vars, gp_resp;
+      gp_approx->convert_surrogate_data(gp_vars, gp_resp);
+      if (gp_vars.rows() == vars.rows() && gp_vars.cols() == vars.cols() &&
+	  gp_vars == vars) {
+	qoi_approxs.push_back(gp_approx);
+	qoi_resp.push_back(gp_resp);
+      }
+    }
+  if (qoi_approxs.size() > 1) {
+    resp.resize(vars.rows(), qoi_approxs.size());
+    for (size_t q=0; q<qoi_approxs.size(); ++q)
+      resp.col(q) = qoi_resp[q].col(0);
+  }
+  else
+    qoi_approxs.assign(1, this);
+
   /* DTS: Should also consider the case when we want config options to change
    * over the course of EG*-type algorithms */
 
+  std::shared_ptr<dakota::surrogates::Surrogate> gp_model;
   if (!advanced_options_file.empty()) {
-    model.reset(new dakota::surrogates::GaussianProcess
+    gp_model.reset(new dakota::surrogates::GaussianProcess
           (vars, resp, advanced_options_file));
   }
   else {
-    model.reset(new dakota::surrogates::GaussianProcess
+    gp_model.reset(new dakota::surrogates::GaussianProcess
           (vars, resp, surrogateOpts));
   }
 
+  // label the QoIs for export of a GP whose hyperparameters are tied
+  size_t q, num_qoi = qoi_approxs.size();
+  if (num_qoi > 1) {
+    StringArray qoi_labels(num_qoi);
+    for (q=0; q<num_qoi; ++q)
+      qoi_labels[q] = qoi_approxs[q]->approxLabel;
+    gp_model->response_labels(qoi_labels);
+  }
+  for (q=0; q<num_qoi; ++q) {
+    SurrogatesGPApprox* gp_approx = qoi_approxs[q];
+    gp_approx->model = gp_model;
+    gp_approx->qoiIndex = q;
+    gp_approx->modelIsImported = false;
+    gp_approx->modelBuildCount = build_count;
+  }
+
   /* DTS: This is not working as I thought it would ... */
   /*
   if (!model) {
@@ -186,7 +263,42 @@ Real SurrogatesGPApprox::prediction_variance(const RealVector& c_vars)
   auto gp_model =
       std::static_pointer_cast<dakota::surrogates::GaussianProcess>(model);
 
-  return gp_model->variance(eval_point)(0);
+  return gp_model->variance(eval_point, qoiIndex)(0);
+}
+
+void SurrogatesGPApprox::
+prediction_variances(const RealMatrix& c_vars, RealVector& pred_vars)
+{
+  if (!model) {
+    Cerr << "Error: surface is null in SurrogatesGPApprox::"
+	 << "prediction_variances()" << std::endl;
+    abort_handler(-1);
+  }
+
+  // one batched prediction with the evaluation points as rows
+  Eigen::Map<const Eigen::MatrixXd> eval_pts(c_vars.values(),
+					     c_vars.numRows(), c_vars.numCols());
+  auto gp_model =
+      std::static_pointer_cast<dakota::surrogates::GaussianProcess>(model);
+  VectorXd pred_var = gp_model->variance(eval_pts.transpose(), qoiIndex);
+
+  int j, num_pts = c_vars.numCols();
+  if (pred_vars.length() != num_pts) pred_vars.sizeUninitialized(num_pts);
+  for (j=0; j<num_pts; ++j)
+    pred_vars[j] = pred_var(j);
+}
+
+/** When the hyperparameters of a multi-output GP are not tied, only the
+    GP for this response is exported, as for a single-output GP. */
+std::shared_ptr<dakota::surrogates::Surrogate>
+SurrogatesGPApprox::export_surrogate()
+{
+  std::shared_ptr<dakota::surrogates::GaussianProcess> qoi_model =
+    std::static_pointer_cast<dakota::surrogates::GaussianProcess>(model)->
+    qoi_model(qoiIndex);
+  if (qoi_model)
+    return qoi_model;
+  return model;
 }
 
 void set_model_gp_options(Model& model, const String& options_file) {
@@ -19,7 +19,9 @@ namespace Dakota {
 /// Derived approximation class for Surrogates approximation classes.
 
 /** This class interfaces Dakota to the Dakota Surrogates Gaussian
-    Process Module.  */
+    Process Module.  When built through the shared approximation data,
+    the approximations of responses with the same build points share
+    one multi-output GaussianProcess and predict their own QoI. */
 class SurrogatesGPApprox: public SurrogatesBaseApprox
 {
 public:
@@ -29,7 +31,7 @@ public:
   //
 
   /// default constructor
-  SurrogatesGPApprox() { }
+  SurrogatesGPApprox(): modelBuildCount(0) { }
   /// standard constructor: 
   SurrogatesGPApprox(const ProblemDescDB& problem_db,
 		     const SharedApproxData& shared_data,
@@ -37,7 +39,7 @@ public:
   /// alternate constructor
   SurrogatesGPApprox(const SharedApproxData& shared_data);
   /// destructor
-  ~SurrogatesGPApprox() { }
+  ~SurrogatesGPApprox();
 
 protected:
 
@@ -51,6 +53,21 @@ protected:
 
   Real prediction_variance(const RealVector& c_vars) override;
 
+  void prediction_variances(const RealMatrix& c_vars,
+			    RealVector& pred_vars) override;
+
+  std::shared_ptr<dakota::surrogates::Surrogate> export_surrogate() override;
+
+private:
+
+  //
+  //- Heading: Data
+  //
+
+  /// shared data build count at which model was built (0 if not built
+  /// through the shared data)
+  size_t modelBuildCount;
+
 };
 
 // free function for setting up experimental GPs with an
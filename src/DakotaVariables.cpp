@@ -824,6 +824,27 @@ Variables Variables::copy(bool deep_svd) const
 }
 
 
+/** The letter of target may only be reused if no other handle can
+    observe the change.  A common SharedVariablesData also guarantees a
+    common derived letter type and common array sizes. */
+void Variables::copy(Variables& target) const
+{
+  if (variablesRep && target.variablesRep &&
+      target.variablesRep != variablesRep &&
+      target.variablesRep.use_count() == 1 &&
+      target.variablesRep->sharedVarsData.same_rep(variablesRep->sharedVarsData)){
+    std::shared_ptr<Variables>& target_rep = target.variablesRep;
+    target_rep->allContinuousVars     = variablesRep->allContinuousVars;
+    target_rep->allDiscreteIntVars    = variablesRep->allDiscreteIntVars;
+    target_rep->allDiscreteStringVars = variablesRep->allDiscreteStringVars;
+    target_rep->allDiscreteRealVars   = variablesRep->allDiscreteRealVars;
+    target_rep->build_views();
+  }
+  else
+    target = copy();
+}
+
+
 void Variables::shape()
 {
   if (variablesRep) // envelope
@@ -525,6 +525,10 @@ public:
   /// a deep variables copy for use in history mechanisms
   /// (SharedVariablesData uses a shallow copy by default)
   Variables copy(bool deep_svd = false) const;
+  /// deep copy into the existing letter of target, reusing its storage,
+  /// when target holds the only reference to a letter with the same
+  /// SharedVariablesData; otherwise target is assigned copy()
+  void copy(Variables& target) const;
 
   /// returns variablesView
   const std::pair<short,short>& view() const;
@@ -541,6 +545,8 @@ public:
 
   /// function to check variablesRep (does this envelope contain a letter)
   bool is_null() const;
+  /// return the number of handles sharing variablesRep
+  long reference_count() const;
 
 protected:
 
@@ -1592,6 +1598,10 @@ inline bool Variables::is_null() const
 { return (variablesRep == NULL); }
 
 
+inline long Variables::reference_count() const
+{ return variablesRep.use_count(); }
+
+
 inline void Variables::build_views()
 {
   // called only from letters
@@ -29,7 +29,9 @@ DataEnvironmentRep::DataEnvironmentRep():
   outputPrecision(0), 
   resultsOutputFlag(false), resultsOutputFile("dakota_results"),
   resultsOutputFormat(0), modelEvalsSelection(MODEL_EVAL_STORE_TOP_METHOD),
-  interfEvalsSelection(INTERF_EVAL_STORE_SIMULATION)
+  interfEvalsSelection(INTERF_EVAL_STORE_SIMULATION), perfSummaryFlag(false),
+  outputJournalFlag(false), journalCommitRecords(100),
+  journalCommitInterval(1.)
 { }
 
 
@@ -43,7 +45,9 @@ void DataEnvironmentRep::write(MPIPackBuffer& s) const
     << graphicsFlag << tabularDataFlag << tabularDataFile << tabularFormat 
     << outputPrecision << resultsOutputFlag << resultsOutputFile 
     << resultsOutputFormat << modelEvalsSelection << interfEvalsSelection
-    << topMethodPointer;
+    << topMethodPointer
+    << perfSummaryFlag << perfTraceFile
+    << outputJournalFlag << journalCommitRecords << journalCommitInterval;
 }
 
 
@@ -57,7 +61,9 @@ void DataEnvironmentRep::read(MPIUnpackBuffer& s)
     >> graphicsFlag >> tabularDataFlag >> tabularDataFile >> tabularFormat 
     >> outputPrecision
     >> resultsOutputFlag >> resultsOutputFile >> resultsOutputFormat 
-    >> modelEvalsSelection >> interfEvalsSelection >> topMethodPointer;
+    >> modelEvalsSelection >> interfEvalsSelection >> topMethodPointer
+    >> perfSummaryFlag >> perfTraceFile
+    >> outputJournalFlag >> journalCommitRecords >> journalCommitInterval;
 }
 
 
@@ -71,7 +77,9 @@ void DataEnvironmentRep::write(std::ostream& s) const
     << graphicsFlag << tabularDataFlag << tabularDataFile << tabularFormat 
     << outputPrecision
     << resultsOutputFlag << resultsOutputFile << resultsOutputFormat 
-    << modelEvalsSelection << interfEvalsSelection << topMethodPointer;
+    << modelEvalsSelection << interfEvalsSelection << topMethodPointer
+    << perfSummaryFlag << perfTraceFile
+    << outputJournalFlag << journalCommitRecords << journalCommitInterval;
 }
 
 
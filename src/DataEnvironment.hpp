@@ -102,6 +102,20 @@ public:
   unsigned short modelEvalsSelection;
   /// Interface selection for eval storage
   unsigned short interfEvalsSelection;
+  /// flags collection and output of hierarchical performance timers
+  /// (from the \c performance_summary specification)
+  bool perfSummaryFlag;
+  /// named file for Chrome trace output of performance timers
+  String perfTraceFile;
+  /// flags group-commit journaling of restart and tabular output
+  /// (from the \c output_journal specification)
+  bool outputJournalFlag;
+  /// number of records per group commit (from the \c commit_records
+  /// specification)
+  int journalCommitRecords;
+  /// maximum seconds between group commits (from the \c commit_interval
+  /// specification)
+  Real journalCommitInterval;
   /// method identifier for the environment (from the \c top_method_pointer
   /// specification
   String topMethodPointer;
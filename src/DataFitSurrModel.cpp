@@ -24,6 +24,7 @@
 #include <boost/accumulators/statistics/stats.hpp>
 #include <boost/accumulators/statistics/rolling_mean.hpp>
 #include "EvaluationStore.hpp"
+#include "PerformanceRegistry.hpp"
 
 static const char rcsId[]="@(#) $Id: DataFitSurrModel.cpp 7034 2010-10-22 20:16:32Z mseldre $";
 
@@ -512,6 +513,7 @@ derived_init_communicators(ParLevLIter pl_iter, int max_eval_concurrency,
     for SurrogateData::anchor{Vars,Resp}, so is an unconstrained build. */
 void DataFitSurrModel::build_approximation()
 {
+  ScopedTimer build_timer("build_approximation", "surrogate");
   Cout << "\n>>>>> Building " << surrogateType << " approximations.\n";
 
   // update actualModel w/ variable values/bounds/labels
@@ -20,7 +20,8 @@ namespace Dakota {
 
 DataInterfaceRep::DataInterfaceRep():
   interfaceType(DEFAULT_INTERFACE),
-  allowExistingResultsFlag(false), verbatimFlag(false), apreproFlag(false),
+  allowExistingResultsFlag(false), verbatimFlag(false), shellFlag(false),
+  apreproFlag(false),
   resultsFileFormat(FLEXIBLE_RESULTS), fileTagFlag(false), fileSaveFlag(false),
   batchEvalFlag(false), asynchFlag(false),
   asynchLocalEvalConcurrency(0), asynchLocalEvalScheduling(DEFAULT_SCHEDULING),
@@ -31,7 +32,8 @@ DataInterfaceRep::DataInterfaceRep():
   evalCacheFlag(true), nearbyEvalCacheFlag(false),
   nearbyEvalCacheTol(DBL_EPSILON), // default relative tolerance is tight
   restartFileFlag(true), useWorkdir(false), dirTag(false),
-  dirSave(false), templateReplace(false), numpyFlag(false)
+  dirSave(false), templateReplace(false), workdirPool(false),
+  numpyFlag(false)
   // asynchLocal{Eval,Analysis}Concurrency, procsPer{Eval,Analysis} and
   // {eval,analysis}Servers default to zero in order to allow detection of
   // user overrides > 0
@@ -42,7 +44,8 @@ void DataInterfaceRep::write(MPIPackBuffer& s) const
 {
   s << idInterface << interfaceType << algebraicMappings << analysisDrivers
     << analysisComponents << inputFilter << outputFilter << parametersFile
-    << resultsFile << allowExistingResultsFlag  << verbatimFlag << apreproFlag 
+    << resultsFile << allowExistingResultsFlag  << verbatimFlag << shellFlag
+    << apreproFlag 
     << resultsFileFormat << fileTagFlag << fileSaveFlag //<< gridHostNames << gridProcsPerHost
     << batchEvalFlag << asynchFlag << asynchLocalEvalConcurrency
     << asynchLocalEvalScheduling << asynchLocalAnalysisConcurrency
@@ -51,7 +54,8 @@ void DataInterfaceRep::write(MPIPackBuffer& s) const
     << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
     << nearbyEvalCacheFlag << nearbyEvalCacheTol << restartFileFlag
     << useWorkdir << workDir << dirTag << dirSave << linkFiles
-    << copyFiles << templateReplace << pluginLibraryPath << numpyFlag;
+    << copyFiles << templateFiles << templateReplace << workdirPool
+    << pluginLibraryPath << numpyFlag;
 }
 
 
@@ -59,7 +63,8 @@ void DataInterfaceRep::read(MPIUnpackBuffer& s)
 {
   s >> idInterface >> interfaceType >> algebraicMappings >> analysisDrivers
     >> analysisComponents >> inputFilter >> outputFilter >> parametersFile
-    >> resultsFile >> allowExistingResultsFlag  >> verbatimFlag >> apreproFlag 
+    >> resultsFile >> allowExistingResultsFlag  >> verbatimFlag >> shellFlag
+    >> apreproFlag 
     >> resultsFileFormat >> fileTagFlag >> fileSaveFlag //>> gridHostNames >> gridProcsPerHost
     >> batchEvalFlag >> asynchFlag >> asynchLocalEvalConcurrency
     >> asynchLocalEvalScheduling >> asynchLocalAnalysisConcurrency
@@ -68,7 +73,8 @@ void DataInterfaceRep::read(MPIUnpackBuffer& s)
     >> recoveryFnVals >> activeSetVectorFlag >> evalCacheFlag
     >> nearbyEvalCacheFlag >> nearbyEvalCacheTol >> restartFileFlag
     >> useWorkdir >> workDir >> dirTag >> dirSave >> linkFiles
-    >> copyFiles >> templateReplace >> pluginLibraryPath >> numpyFlag;
+    >> copyFiles >> templateFiles >> templateReplace >> workdirPool
+    >> pluginLibraryPath >> numpyFlag;
 }
 
 
@@ -76,7 +82,8 @@ void DataInterfaceRep::write(std::ostream& s) const
 {
   s << idInterface << interfaceType << algebraicMappings << analysisDrivers
     << analysisComponents << inputFilter << outputFilter << parametersFile
-    << resultsFile << allowExistingResultsFlag  << verbatimFlag << apreproFlag 
+    << resultsFile << allowExistingResultsFlag  << verbatimFlag << shellFlag
+    << apreproFlag 
     << resultsFileFormat << fileTagFlag << fileSaveFlag //<< gridHostNames << gridProcsPerHost
     << batchEvalFlag << asynchFlag << asynchLocalEvalConcurrency
     << asynchLocalEvalScheduling << asynchLocalAnalysisConcurrency
@@ -85,7 +92,8 @@ void DataInterfaceRep::write(std::ostream& s) const
     << recoveryFnVals << activeSetVectorFlag << evalCacheFlag
     << nearbyEvalCacheFlag << nearbyEvalCacheTol << restartFileFlag
     << useWorkdir << workDir << dirTag << dirSave << linkFiles
-    << copyFiles << templateReplace << pluginLibraryPath << numpyFlag;
+    << copyFiles << templateFiles << templateReplace << workdirPool
+    << pluginLibraryPath << numpyFlag;
 }
 
 
@@ -134,6 +134,10 @@ public:
   /// analysis_drivers/input_filter/output_filter syntax (from the \c
   /// verbatim specification in \ref InterfApplicSC and \ref InterfApplicF)
   bool verbatimFlag;
+  /// flag for launching all analysis_drivers/input_filter/output_filter
+  /// commands through the shell (from the \c shell specification for the
+  /// system interface)
+  bool shellFlag;
   /// flag for aprepro format usage in the parameters file for
   /// system call and fork interfaces (from the \c aprepro
   /// specification in \ref InterfApplicSC and \ref InterfApplicF)
@@ -231,8 +235,12 @@ public:
   StringArray linkFiles;
   /// files to copy into work directories
   StringArray copyFiles;
+  /// input templates to process into work directories
+  StringArray templateFiles;
   /// whether to replace / overwrite existing files
   bool templateReplace;
+  /// whether to stage work directories in a background pool
+  bool workdirPool;
   /// path to plugin to runtime load
   String pluginLibraryPath;
   /// Python interface: use NumPy data structures (default is list data)
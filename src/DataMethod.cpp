@@ -98,7 +98,7 @@ DataMethodRep::DataMethodRep():
   percentChange(0.1), numGenerations(15), fitnessLimit(6.0),
   shrinkagePercent(0.9), nichingType("null_niching"), numDesigns(100),
   postProcessorType("null_postprocessor"), logFile("JEGAGlobal.log"),
-  printPopFlag(false),
+  printPopFlag(false), steadyStateFlag(false), steadyStateFraction(0.5),
   // JEGA/COLINY
   constraintPenalty(-1.), crossoverRate(-1.), //crossoverType(""),
   initializationType("unique_random"),
@@ -128,6 +128,7 @@ DataMethodRep::DataMethodRep():
   fixedSequenceFlag(false), //default is variable sampling patterns
   vbdFlag(false),
   vbdDropTolerance(-1.),backfillFlag(false), pcaFlag(false),
+  streamingStatsFlag(false),
   percentVarianceExplained(0.95), wilksFlag(false), wilksOrder(1),
   wilksConfidenceLevel(0.95), wilksSidedInterval(ONE_SIDED_UPPER),
   // NonD
@@ -152,7 +153,8 @@ DataMethodRep::DataMethodRep():
   adaptedBasisAdvancements(3), normalizedCoeffs(false), tensorGridFlag(false),
   sampleType(SUBMETHOD_DEFAULT), dOptimal(false), numCandidateDesigns(0),
   //reliabilitySearchType(MV),
-  integrationRefine(NO_INT_REFINE), optSubProbSolver(SUBMETHOD_DEFAULT),
+  lockstepMPPSearch(false), integrationRefine(NO_INT_REFINE),
+  optSubProbSolver(SUBMETHOD_DEFAULT), concurrentBoundsFlag(false),
   numericalSolveMode(NUMERICAL_FALLBACK),
   multilevAllocControl(DEFAULT_MLMF_CONTROL),
   multilevEstimatorRate(2.), multilevDiscrepEmulation(DEFAULT_EMULATION),
@@ -163,7 +165,8 @@ DataMethodRep::DataMethodRep():
   mcmcType("dram"), standardizedSpace(false), adaptPosteriorRefine(false),
   logitTransform(false), gpmsaNormalize(false), posteriorStatsKL(false),
   posteriorStatsMutual(false), posteriorStatsKDE(false),
-  chainDiagnostics(false), chainDiagnosticsCI(false), modelEvidence(false),
+  chainDiagnostics(false), chainDiagnosticsCI(false),
+  fuseModelTransforms(false), modelEvidence(false),
   modelEvidMC(false), modelEvidLaplace(false), priorPropCovMult(1.0),
   proposalCovUpdatePeriod(std::numeric_limits<int>::max()),
   fitnessMetricType("predicted_variance"), batchSelectionType("naive"),
@@ -184,6 +187,7 @@ DataMethodRep::DataMethodRep():
   numPushforwardSamples(10000),
   // Parameter Study
   numSteps(0), pstudyFileFormat(TABULAR_ANNOTATED), pstudyFileActive(false),
+  pstudyStreaming(false),
   // Verification
   refinementRate(2.),
   // Point import/export files
@@ -266,7 +270,7 @@ void DataMethodRep::write(MPIPackBuffer& s) const
 
   // JEGA/COLINY
   s << initializationType << flatFile << logFile << populationSize
-    << printPopFlag;
+    << printPopFlag << steadyStateFlag << steadyStateFraction;
 
   // NCSU
   s << volBoxSize;
@@ -294,6 +298,7 @@ void DataMethodRep::write(MPIPackBuffer& s) const
   // NonD & DACE
   s << numSamples << fixedSeedFlag << fixedSequenceFlag
     << vbdFlag << vbdDropTolerance << backfillFlag << pcaFlag
+    << streamingStatsFlag
     << percentVarianceExplained << wilksFlag << wilksOrder
     << wilksConfidenceLevel << wilksSidedInterval;
 
@@ -313,8 +318,9 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << tensorGridFlag << tensorGridOrder
     << importExpansionFile << exportExpansionFile << sampleType << dOptimal
     << numCandidateDesigns //<< reliabilitySearchType
-    << reliabilityIntegration << integrationRefine << refineSamples
-    << optSubProbSolver << numericalSolveMode
+    << reliabilityIntegration << lockstepMPPSearch << integrationRefine
+    << refineSamples
+    << optSubProbSolver << concurrentBoundsFlag << numericalSolveMode
     << pilotSamples << ensembleSampSolnMode << truthPilotConstraint
     << multilevAllocControl << multilevEstimatorRate
     << multilevDiscrepEmulation << finalStatsType << finalMomentsType
@@ -324,7 +330,7 @@ void DataMethodRep::write(MPIPackBuffer& s) const
     << emulatorOrder << emulatorType << mcmcType << standardizedSpace
     << adaptPosteriorRefine << logitTransform << gpmsaNormalize
     << posteriorStatsKL << posteriorStatsMutual << posteriorStatsKDE
-    << chainDiagnostics << chainDiagnosticsCI
+    << chainDiagnostics << chainDiagnosticsCI << fuseModelTransforms
     << modelEvidence << modelEvidLaplace << modelEvidMC
     << proposalCovType << priorPropCovMult << proposalCovUpdatePeriod
     << proposalCovInputType << proposalCovData << proposalCovFile
@@ -351,7 +357,7 @@ void DataMethodRep::write(MPIPackBuffer& s) const
   // Parameter Study
   s << finalPoint << stepVector << numSteps << stepsPerVariable << listOfPoints
     << pstudyFilename << pstudyFileFormat << pstudyFileActive
-    << varPartitions;
+    << pstudyStreaming << varPartitions;
 
   // Verification
   s << refinementRate;
@@ -434,7 +440,7 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
 
   // JEGA/COLINY
   s >> initializationType >> flatFile >> logFile >> populationSize
-    >> printPopFlag;
+    >> printPopFlag >> steadyStateFlag >> steadyStateFraction;
 
   // NCSU
   s >> volBoxSize;
@@ -462,6 +468,7 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
   // NonD & DACE
   s >> numSamples >> fixedSeedFlag >> fixedSequenceFlag
     >> vbdFlag >> vbdDropTolerance >> backfillFlag >> pcaFlag
+    >> streamingStatsFlag
     >> percentVarianceExplained >> wilksFlag >> wilksOrder
     >> wilksConfidenceLevel >> wilksSidedInterval;
 
@@ -481,8 +488,9 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> tensorGridFlag >> tensorGridOrder
     >> importExpansionFile >> exportExpansionFile >> sampleType >> dOptimal
     >> numCandidateDesigns //>> reliabilitySearchType
-    >> reliabilityIntegration >> integrationRefine >> refineSamples
-    >> optSubProbSolver >> numericalSolveMode
+    >> reliabilityIntegration >> lockstepMPPSearch >> integrationRefine
+    >> refineSamples
+    >> optSubProbSolver >> concurrentBoundsFlag >> numericalSolveMode
     >> pilotSamples >> ensembleSampSolnMode >> truthPilotConstraint
     >> multilevAllocControl >> multilevEstimatorRate
     >> multilevDiscrepEmulation >> finalStatsType >> finalMomentsType
@@ -492,7 +500,7 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
     >> emulatorOrder >> emulatorType >> mcmcType >> standardizedSpace
     >> adaptPosteriorRefine >> logitTransform >> gpmsaNormalize
     >> posteriorStatsKL >> posteriorStatsMutual >> posteriorStatsKDE
-    >> chainDiagnostics >> chainDiagnosticsCI
+    >> chainDiagnostics >> chainDiagnosticsCI >> fuseModelTransforms
     >> modelEvidence >> modelEvidLaplace >> modelEvidMC
     >> proposalCovType >> priorPropCovMult >> proposalCovUpdatePeriod
     >> proposalCovInputType >> proposalCovData >> proposalCovFile
@@ -519,7 +527,7 @@ void DataMethodRep::read(MPIUnpackBuffer& s)
   // Parameter Study
   s >> finalPoint >> stepVector >> numSteps >> stepsPerVariable >> listOfPoints
     >> pstudyFilename >> pstudyFileFormat >> pstudyFileActive
-    >> varPartitions;
+    >> pstudyStreaming >> varPartitions;
 
   // Verification
   s >> refinementRate;
@@ -602,7 +610,7 @@ void DataMethodRep::write(std::ostream& s) const
 
   // JEGA/COLINY
   s << initializationType << flatFile << logFile << populationSize
-    << printPopFlag;
+    << printPopFlag << steadyStateFlag << steadyStateFraction;
 
   // NCSU
   s << volBoxSize;
@@ -630,6 +638,7 @@ void DataMethodRep::write(std::ostream& s) const
   // NonD & DACE
   s << numSamples << fixedSeedFlag << fixedSequenceFlag
     << vbdFlag << vbdDropTolerance << backfillFlag << pcaFlag
+    << streamingStatsFlag
     << percentVarianceExplained << wilksFlag << wilksOrder
     << wilksConfidenceLevel << wilksSidedInterval;
 
@@ -649,8 +658,9 @@ void DataMethodRep::write(std::ostream& s) const
     << tensorGridFlag << tensorGridOrder
     << importExpansionFile << exportExpansionFile << sampleType << dOptimal
     << numCandidateDesigns //<< reliabilitySearchType
-    << reliabilityIntegration << integrationRefine << refineSamples
-    << optSubProbSolver << numericalSolveMode
+    << reliabilityIntegration << lockstepMPPSearch << integrationRefine
+    << refineSamples
+    << optSubProbSolver << concurrentBoundsFlag << numericalSolveMode
     << pilotSamples << ensembleSampSolnMode << truthPilotConstraint
     << multilevAllocControl << multilevEstimatorRate
     << multilevDiscrepEmulation << finalStatsType << finalMomentsType
@@ -660,7 +670,7 @@ void DataMethodRep::write(std::ostream& s) const
     << emulatorOrder << emulatorType << mcmcType << standardizedSpace
     << adaptPosteriorRefine << logitTransform << gpmsaNormalize
     << posteriorStatsKL << posteriorStatsMutual << posteriorStatsKDE
-    << chainDiagnostics << chainDiagnosticsCI
+    << chainDiagnostics << chainDiagnosticsCI << fuseModelTransforms
     << modelEvidence << modelEvidLaplace << modelEvidMC
     << proposalCovType << priorPropCovMult << proposalCovUpdatePeriod
     << proposalCovInputType << proposalCovData << proposalCovFile
@@ -687,7 +697,7 @@ void DataMethodRep::write(std::ostream& s) const
   // Parameter Study
   s << finalPoint << stepVector << numSteps << stepsPerVariable << listOfPoints
     << pstudyFilename << pstudyFileFormat << pstudyFileActive
-    << varPartitions;
+    << pstudyStreaming << varPartitions;
 
   // Verification
   s << refinementRate;
@@ -730,6 +730,12 @@ public:
   /// The \c print_each_pop flag to set the printing of the population
   /// at each generation
   bool printPopFlag;
+  /// The \c steady_state flag to submit and merge JEGA evaluations
+  /// incrementally rather than synchronizing each generation
+  bool steadyStateFlag;
+  /// the \c completion_fraction of submitted JEGA evaluations that must
+  /// complete before the GA proceeds in \c steady_state mode
+  Real steadyStateFraction;
 
   // NCSU
 
@@ -862,6 +868,9 @@ public:
   /// Flag to specify the calculation of principal components when
   /// using LHS
   bool pcaFlag;
+  /// the \c streaming_statistics option accumulates sampling statistics
+  /// as evaluations complete rather than retaining all responses
+  bool streamingStatsFlag;
   /// The percentage of variance explained by using a truncated
   /// number of principal components in PCA
   Real percentVarianceExplained;
@@ -1006,6 +1015,9 @@ public:
   /// the \c first_order or \c second_order integration selection in
   /// \ref MethodNonDLocalRel
   String reliabilityIntegration;
+  /// the \c lockstep specification in \ref MethodNonDLocalRel: concurrent
+  /// MPP searches across response functions
+  bool lockstepMPPSearch;
   /// the \c import, \c adapt_import, or \c mm_adapt_import integration
   /// refinement selection in \ref MethodNonDLocalRel, \ref MethodNonDPCE,
   /// and \ref MethodNonDSC
@@ -1018,6 +1030,10 @@ public:
   /// the method used for solving an optimization sub-problem (e.g.,
   /// pre-solve for the MAP point)
   unsigned short optSubProbSolver;
+  /// the \c concurrent_bounds specification for global_evidence and
+  /// global_interval_est: lockstep bound solves across cells with batched
+  /// truth evaluations
+  bool concurrentBoundsFlag;
   /// approach for overriding an analytic solution based on simplifying
   /// assumptions that might be violated, suggesting a fallback approach,
   /// or lacking robustness, suggesting an optional override replacement
@@ -1102,6 +1118,9 @@ public:
   /// flag indicating calculation of confidence intervals as a chain
   /// diagnositc
   bool chainDiagnosticsCI;
+  /// the \c fuse_model_transforms option applies the stack of residual
+  /// model transformations in a single pass per evaluation
+  bool fuseModelTransforms;
   /// flag indicating calculation of the evidence of the model
   bool modelEvidence;
   /// flag indicating use of Monte Carlo approximation for evidence calc.
@@ -1259,6 +1278,9 @@ public:
   unsigned short pstudyFileFormat;
   /// whether to import active variables only
   bool pstudyFileActive;
+  /// whether to generate parameter study points on demand rather than
+  /// storing the full set (\c streaming specification)
+  bool pstudyStreaming;
   /// the \c partitions specification for PStudy method in \ref MethodPSMPS
   UShortArray varPartitions;
 
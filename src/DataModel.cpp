@@ -32,6 +32,7 @@ DataModelRep::DataModelRep():
   exportApproxFormat(TABULAR_ANNOTATED),
   exportApproxVarianceFormat(TABULAR_ANNOTATED), numRestarts(10),
   approxCorrectionType(NO_CORRECTION), approxCorrectionOrder(0),
+  overlapEvalsFlag(false),
   modelUseDerivsFlag(false), respScalingFlag(false), polynomialOrder(2),
   krigingMaxTrials(0), krigingNugget(0.0), krigingFindNugget(0),
   mlsWeightFunction(0), rbfBases(0), rbfMaxPts(0), rbfMaxSubsets(0),
@@ -44,6 +45,7 @@ DataModelRep::DataModelRep():
   importChalUseVariableLabels(false), importChallengeActive(false),
   identityRespMap(false),
   subMethodServers(0), subMethodProcs(0), // 0 defaults to detect user spec
+  subMethodLocalConcurrency(1),
   subMethodScheduling(DEFAULT_SCHEDULING), initialSamples(0),
   maxIterations(SZ_MAX), convergenceTolerance(1.e-4), softConvergenceLimit(0),
   subspaceIdBingLi(false), subspaceIdConstantine(false),
@@ -84,6 +86,7 @@ void DataModelRep::write(MPIPackBuffer& s) const
     << exportApproxPtsFile << exportApproxFormat
     << exportApproxVarianceFile << exportApproxVarianceFormat
     << numRestarts << approxCorrectionType << approxCorrectionOrder
+    << overlapEvalsFlag
     << modelUseDerivsFlag << respScalingFlag << polynomialOrder
     << krigingCorrelations << krigingOptMethod << krigingMaxTrials
     << krigingMaxCorrelations << krigingMinCorrelations
@@ -98,7 +101,8 @@ void DataModelRep::write(MPIPackBuffer& s) const
     << importChallengeActive << advancedOptionsFilename
     << optionalInterfRespPointer << primaryVarMaps << secondaryVarMaps
     << primaryRespCoeffs << secondaryRespCoeffs << identityRespMap
-    << subMethodServers << subMethodProcs << subMethodScheduling 
+    << subMethodServers << subMethodProcs << subMethodLocalConcurrency
+    << subMethodScheduling 
     << initialSamples << refineSamples << maxIterations 
     << convergenceTolerance << softConvergenceLimit << subspaceIdBingLi 
     << subspaceIdConstantine << subspaceIdEnergy << subspaceBuildSurrogate
@@ -134,6 +138,7 @@ void DataModelRep::read(MPIUnpackBuffer& s)
     >> exportApproxPtsFile >> exportApproxFormat
     >> exportApproxVarianceFile >> exportApproxVarianceFormat
     >> numRestarts >> approxCorrectionType >> approxCorrectionOrder
+    >> overlapEvalsFlag
     >> modelUseDerivsFlag >> respScalingFlag >> polynomialOrder
     >> krigingCorrelations >> krigingOptMethod >> krigingMaxTrials
     >> krigingMaxCorrelations >> krigingMinCorrelations
@@ -148,7 +153,8 @@ void DataModelRep::read(MPIUnpackBuffer& s)
     >> importChallengeActive >> advancedOptionsFilename
     >> optionalInterfRespPointer >> primaryVarMaps >> secondaryVarMaps
     >> primaryRespCoeffs >> secondaryRespCoeffs >> identityRespMap
-    >> subMethodServers >> subMethodProcs >> subMethodScheduling 
+    >> subMethodServers >> subMethodProcs >> subMethodLocalConcurrency
+    >> subMethodScheduling 
     >> initialSamples >> refineSamples >> maxIterations 
     >> convergenceTolerance >> softConvergenceLimit >> subspaceIdBingLi 
     >> subspaceIdConstantine >> subspaceIdEnergy >> subspaceBuildSurrogate
@@ -184,6 +190,7 @@ void DataModelRep::write(std::ostream& s) const
     << exportApproxPtsFile << exportApproxFormat
     << exportApproxVarianceFile << exportApproxVarianceFormat
     << numRestarts << approxCorrectionType << approxCorrectionOrder
+    << overlapEvalsFlag
     << modelUseDerivsFlag << respScalingFlag << polynomialOrder
     << krigingCorrelations << krigingOptMethod << krigingMaxTrials
     << krigingMaxCorrelations << krigingMinCorrelations
@@ -198,7 +205,8 @@ void DataModelRep::write(std::ostream& s) const
     << importChallengeActive << advancedOptionsFilename
     << optionalInterfRespPointer << primaryVarMaps << secondaryVarMaps
     << primaryRespCoeffs << secondaryRespCoeffs << identityRespMap
-    << subMethodServers << subMethodProcs << subMethodScheduling 
+    << subMethodServers << subMethodProcs << subMethodLocalConcurrency
+    << subMethodScheduling 
     << initialSamples << refineSamples << maxIterations 
     << convergenceTolerance << softConvergenceLimit << subspaceIdBingLi 
     << subspaceIdConstantine << subspaceIdEnergy << subspaceBuildSurrogate
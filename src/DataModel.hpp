@@ -219,6 +219,10 @@ public:
   /// 1, or 2 (from the \c correction specification in \ref ModelSurrG
   /// and \ref ModelSurrH)
   short approxCorrectionOrder;
+  /// flag for overlapping the truth and approximation evaluations of a
+  /// blocking hierarchical evaluation (from the \c overlap_evaluations
+  /// specification in \ref ModelSurrH)
+  bool overlapEvalsFlag;
   /// flags the use of derivatives in building global approximations
   /// (from the \c use_derivatives specification in \ref ModelSurrG)
   bool modelUseDerivsFlag;
@@ -346,6 +350,9 @@ public:
   int subMethodServers;
   /// number of processors for each concurrent sub-iterator partition
   int subMethodProcs;
+  /// number of sub-iterator jobs executed concurrently by forked
+  /// processes within a single (non-MPI) iterator server
+  int subMethodLocalConcurrency;
   /// scheduling approach for concurrent sub-iterator parallelism:
   /// {DEFAULT,MASTER,PEER}_SCHEDULING
   short subMethodScheduling;
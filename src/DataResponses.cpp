@@ -27,7 +27,8 @@ DataResponsesRep::DataResponsesRep():
   numFieldLeastSqTerms(0), numFieldNonlinearIneqConstraints(0),
   numFieldNonlinearEqConstraints(0), numFieldResponseFunctions(0),
   calibrationDataFlag(false), numExperiments(1), numExpConfigVars(0),
-  scalarDataFormat(TABULAR_EXPER_ANNOT), ignoreBounds(false), centralHess(false), 
+  scalarDataFormat(TABULAR_EXPER_ANNOT), ignoreBounds(false), centralHess(false),
+  fdStencilReuse(false), fdStencilCompact(false), 
   methodSource("dakota"), intervalType("forward"), interpolateFlag(false),
   fdGradStepType("relative"), fdHessStepType("relative"), readFieldCoords(false)
 { }
@@ -56,6 +57,7 @@ void DataResponsesRep::write(MPIPackBuffer& s) const
     << scalarDataFileName << scalarDataFormat
     // derivative settings
     << gradientType << hessianType << ignoreBounds << centralHess
+    << fdStencilReuse << fdStencilCompact
     << quasiHessianType << methodSource << intervalType << interpolateFlag 
     << fdGradStepSize << fdGradStepType << fdHessStepSize << fdHessStepType
     << idNumericalGrads << idAnalyticGrads
@@ -89,6 +91,7 @@ void DataResponsesRep::read(MPIUnpackBuffer& s)
     >> scalarDataFileName >> scalarDataFormat
     // derivative settings
     >> gradientType >> hessianType >> ignoreBounds >> centralHess
+    >> fdStencilReuse >> fdStencilCompact
     >> quasiHessianType >> methodSource >> intervalType >> interpolateFlag 
     >> fdGradStepSize >> fdGradStepType >> fdHessStepSize >> fdHessStepType
     >> idNumericalGrads >> idAnalyticGrads
@@ -123,6 +126,7 @@ void DataResponsesRep::write(std::ostream& s) const
     << scalarDataFileName << scalarDataFormat
     // derivative settings
     << gradientType << hessianType << ignoreBounds << centralHess
+    << fdStencilReuse << fdStencilCompact
     << quasiHessianType << methodSource << intervalType << interpolateFlag 
     << fdGradStepSize << fdGradStepType << fdHessStepSize << fdHessStepType
     << idNumericalGrads << idAnalyticGrads
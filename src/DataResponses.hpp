@@ -195,6 +195,13 @@ public:
   /// Temporary(?) option to use old 2nd-order diffs when computing
   /// finite-difference Hessians; default is forward differences.
   bool centralHess;
+  /// option to reuse coincident points among asynchronous finite
+  /// difference stencils (from the \c stencil_reuse specification in
+  /// \ref RespGrad)
+  bool fdStencilReuse;
+  /// option to also reuse single-coordinate offsets of the previous
+  /// stencil batch (from the \c compact specification in \ref RespGrad)
+  bool fdStencilCompact;
   /// quasi-Hessian type: bfgs, damped_bfgs, or sr1 (from the \c bfgs 
   /// and \c sr1 specifications in \ref RespHess)
   String quasiHessianType;
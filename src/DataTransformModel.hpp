@@ -85,6 +85,9 @@ protected:
 
   void init_metadata() override;
 
+  /// fusable unless each evaluation spans experiment configurations
+  bool fusable_recast() const;
+
   void update_from_subordinate_model(size_t depth = SZ_MAX);
 
   /// update all continuous variables from sub-model, skipping hyper-parameters
@@ -258,6 +261,10 @@ inline void DataTransformModel::assign_instance()
 { dtModelInstance = this; }
 
 
+inline bool DataTransformModel::fusable_recast() const
+{ return (expData.num_config_vars() == 0); }
+
+
 } // namespace Dakota
 
 #endif
@@ -30,6 +30,10 @@
 #include "DakotaModel.hpp"
 #include "DakotaResponse.hpp"
 #include "NormalRandomVariable.hpp"
+#include "dakota_stat_util.hpp"
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <algorithm>
 #include <string>
 
 //#define DEBUG
@@ -48,11 +52,18 @@ EffGlobalMinimizer(ProblemDescDB& problem_db, Model& model):
   batchSizeExploration(probDescDB.get_int("method.batch_size.exploration")),
   dataOrder(1), batchEvalId(1),
   batchAsynch(probDescDB.get_short("method.synchronization") ==
-	      NONBLOCKING_SYNCHRONIZATION)
+	      NONBLOCKING_SYNCHRONIZATION),
+  acquisitionCandidates(probDescDB.get_sizet("method.num_candidates")),
+  meritLipschitz(0.)
 {
   // substract the total batchSize from batchSizeExploration
   batchSizeAcquisition = batchSize - batchSizeExploration;
 
+  if (acquisitionCandidates) {
+    int seed = probDescDB.get_int("method.random_seed");
+    candidateRNG.seed((seed > 0) ? seed : generate_system_seed());
+  }
+
   // historical default convergence tolerances
   if (convergenceTol < 0.) convergenceTol = 1.e-12;
   distanceTol = probDescDB.get_real("method.x_conv_tol");
@@ -106,7 +117,7 @@ EffGlobalMinimizer(Model& model, const String& approx_type, int samples,
   SurrBasedMinimizer(model, max_iter, max_eval, conv_tol,
 		     std::shared_ptr<TraitsBase>(new EffGlobalTraits())),
   batchSize(1), batchSizeExploration(0), dataOrder(1), batchEvalId(1),
-  batchAsynch(false)
+  batchAsynch(false), acquisitionCandidates(0), meritLipschitz(0.)
 {
   methodName = EFFICIENT_GLOBAL;
 
@@ -322,6 +333,7 @@ void EffGlobalMinimizer::build_gp()
   if (batchAsynch)
     fHatModel.track_evaluation_ids(true); // enable replacements by eval id
   fHatModel.build_approximation();
+  reset_batched_acquisition();
   // initialize counter for GP refinements (used for vars{Acq,Expl}Map)
   batchEvalId = iteratedModel.evaluation_id() + 1;
 }
@@ -401,15 +413,23 @@ construct_batch_acquisition(size_t new_acq, size_t new_batch)
     Cout << "\n>>>>> Initiating global iteration " << ++globalIterCount
 	 << " (acquisition batch " << i+1 << ")\n";
 
-    // determine meritFnStar for use in EIF
-    compute_best_sample();
+    // determine meritFnStar for use in EIF (batched acquisition determines
+    // it once per GP build, since liars are not built into the GP)
+    if (!acquisitionCandidates)
+      compute_best_sample();
 
     // execute GLOBAL search and retrieve results
-    ParLevLIter pl_iter = methodPCIter->mi_parallel_level_iterator(miPLIndex);
-    approxSubProbMinimizer.reset();
-    approxSubProbMinimizer.run(pl_iter); // maximize the EI acquisition fn
-    const Variables&   vars_star = approxSubProbMinimizer.variables_results();
-    const Response& ei_resp_star = approxSubProbMinimizer.response_results();
+    Variables vars_star;  Response ei_resp_star;
+    if (acquisitionCandidates)
+      solve_batched_sub_problem(false, vars_star, ei_resp_star);
+    else {
+      ParLevLIter pl_iter
+	= methodPCIter->mi_parallel_level_iterator(miPLIndex);
+      approxSubProbMinimizer.reset();
+      approxSubProbMinimizer.run(pl_iter); // maximize the EI acquisition fn
+      vars_star    = approxSubProbMinimizer.variables_results();
+      ei_resp_star = approxSubProbMinimizer.response_results();
+    }
 
     if (outputLevel >= NORMAL_OUTPUT)
       Cout << "\nResults of EGO iteration:\nFinal point =\n" << vars_star
@@ -424,8 +444,11 @@ construct_batch_acquisition(size_t new_acq, size_t new_batch)
     // approx sub-problem solve (cost does not justify increased complexity in
     // replace/pop logic).  But do suppress an unnecessary rebuild if last
     // look-ahead before truth synchronization, since this can be expensive.
+    // Batched acquisition never rebuilds for a liar, relying instead on a
+    // local penalization of the acquisition around the pending points.
     if (parallelFlag) {
-      bool rebuild = (new_batch > new_acq || i+1 < new_acq);
+      bool rebuild = (!acquisitionCandidates &&
+		      (new_batch > new_acq || i+1 < new_acq));
       append_liar(vars_star, batchEvalId, rebuild);
     }
 
@@ -461,13 +484,19 @@ construct_batch_exploration(size_t new_expl, size_t new_batch)
 	 << " (exploration batch " << i+1 << ")\n";
     
     // execute GLOBAL search and retrieve results
-    ParLevLIter pl_iter = methodPCIter->mi_parallel_level_iterator(miPLIndex);
-    approxSubProbMinimizer.reset();
-    approxSubProbMinimizer.run(pl_iter); // maximize the posterior variance fn
-    const Variables& vars_star = approxSubProbMinimizer.variables_results();
+    Variables vars_star;  Response pv_resp_star;
+    if (acquisitionCandidates)
+      solve_batched_sub_problem(true, vars_star, pv_resp_star);
+    else {
+      ParLevLIter pl_iter
+	= methodPCIter->mi_parallel_level_iterator(miPLIndex);
+      approxSubProbMinimizer.reset();
+      approxSubProbMinimizer.run(pl_iter); // maximize the posterior variance fn
+      vars_star    = approxSubProbMinimizer.variables_results();
+      pv_resp_star = approxSubProbMinimizer.response_results();
+    }
 
     if (outputLevel >= NORMAL_OUTPUT) {
-      const Response& pv_resp_star = approxSubProbMinimizer.response_results();
       Real pv_star = -pv_resp_star.function_value(0);
       Cout << "\nResults of EGO iteration:\nFinal point =\n" << vars_star
 	   << "Prediction Variance     =\n                     "
@@ -486,7 +515,7 @@ construct_batch_exploration(size_t new_expl, size_t new_batch)
     // replace/pop logic).  But do suppress an unnecessary rebuild if last
     // look-ahead before truth synchronization, since this can be expensive.
     if (parallelFlag) {
-      bool rebuild = (i+1 < new_expl);
+      bool rebuild = (!acquisitionCandidates && i+1 < new_expl);
       append_liar(vars_star, batchEvalId, rebuild);
     }
 
@@ -565,6 +594,7 @@ void EffGlobalMinimizer::evaluate_batch(bool rebuild)
   }
 
   varsAcquisitionMap.clear();  varsExplorationMap.clear();
+  if (rebuild) reset_batched_acquisition();
 }
 
 
@@ -656,6 +686,7 @@ process_truth_response_map(const IntResponseMap& truth_resp_map, bool rebuild)
 
   // Process completions: replace liar resp w/ new truth resp based on eval ids
   fHatModel.replace_approximation(truth_resp_map, rebuild);
+  if (rebuild) reset_batched_acquisition();
   // update constraints (truth resp only, not for liar resp)
   if (numNonlinearConstraints)
     update_constraints(truth_resp_map);
@@ -708,6 +739,24 @@ void EffGlobalMinimizer::compute_best_sample()
   const Pecos::SDVArray&    sdv_array_0 = gp_data_0.variables_data();
   size_t i, index_star = 0, num_data_pts = gp_data_0.points();
   Real merit_fn;  meritFnStar = DBL_MAX;
+
+  if (acquisitionCandidates) {
+    // one batched GP prediction per response over all of the build data
+    RealMatrix c_vars(numContinuousVars, num_data_pts, false), means, vars;
+    for (i=0; i<num_data_pts; ++i) {
+      const RealVector& cv = sdv_array_0[i].continuous_variables();
+      copy_data(cv, c_vars[i], (int)numContinuousVars);
+    }
+    predict_batch(c_vars, false, means, vars);
+    for (i=0; i<num_data_pts; ++i) {
+      RealVector f_hat(Teuchos::View, means[i], (int)numFunctions);
+      merit_fn = augmented_lagrangian(f_hat);
+      if (merit_fn < meritFnStar)
+	{ index_star = i;  meritFnStar = merit_fn; }
+    }
+    return;
+  }
+
   RealVector fn_sample(numFunctions);
   for (i=0; i<num_data_pts; ++i) {
 
@@ -775,6 +824,260 @@ extract_qoi_build_data(size_t data_index, RealVector& fn_vals)
 }
 
 
+/** The sub-problem is solved by screening the candidates, whose merit
+    moments are shared by all sub-problems of a batch, and refining the
+    best of them by a compass search that advances all starts in
+    lockstep, such that each poll predicts the trial points of every
+    start in one batch.  The solution is then retained to penalize the
+    acquisition for the remaining sub-problems of the batch. */
+void EffGlobalMinimizer::
+solve_batched_sub_problem(bool exploration, Variables& vars_star,
+			  Response& acq_resp_star)
+{
+  if (candidatePoints.empty())
+    generate_candidates();
+
+  // screen the candidates using the current penalization
+  size_t i, j, s, num_cand = candidatePoints.numCols();
+  RealVector cand_acq(num_cand, false);
+  for (j=0; j<num_cand; ++j)
+    cand_acq[j] = penalized_acquisition(exploration, candidatePoints[j],
+					candidateMeans[j], candidateStdevs[j]);
+
+  // hard-wired number of starts for local refinement
+  size_t num_starts = std::min(num_cand, (size_t)10);
+  SizetArray order(num_cand);
+  for (j=0; j<num_cand; ++j) order[j] = j;
+  std::partial_sort(order.begin(), order.begin() + num_starts, order.end(),
+		    [&cand_acq](size_t a, size_t b)
+		    { return cand_acq[a] > cand_acq[b]; });
+
+  // initial step is the spacing of the candidates along each coordinate
+  Real init_step = std::min(0.25,
+    std::pow((Real)num_cand, -1./(Real)numContinuousVars)),
+    min_step = 1.e-5;
+  RealMatrix starts(numContinuousVars, num_starts, false);
+  RealVector start_acq(num_starts, false), start_means(num_starts, false),
+    start_stdevs(num_starts, false), steps(num_starts, false);
+  for (s=0; s<num_starts; ++s) {
+    j = order[s];
+    for (i=0; i<numContinuousVars; ++i)
+      starts(i,s) = candidatePoints(i,j);
+    start_acq[s]  = cand_acq[j];
+    start_means[s] = candidateMeans[j];  start_stdevs[s] = candidateStdevs[j];
+    steps[s] = init_step;
+  }
+
+  size_t a, p, col, num_polls = 2*numContinuousVars, sweep, max_sweeps = 100;
+  SizetArray active;
+  RealVector poll_means, poll_stdevs;
+  for (sweep=0; sweep<max_sweeps; ++sweep) {
+    active.clear();
+    for (s=0; s<num_starts; ++s)
+      if (steps[s] >= min_step)
+	active.push_back(s);
+    if (active.empty()) break;
+
+    // poll +/- each coordinate from every active start
+    size_t num_active = active.size();
+    RealMatrix polls(numContinuousVars, num_active * num_polls, false);
+    for (a=0; a<num_active; ++a) {
+      s = active[a];
+      for (p=0; p<num_polls; ++p) {
+	col = a * num_polls + p;
+	for (i=0; i<numContinuousVars; ++i)
+	  polls(i,col) = starts(i,s);
+	i = p / 2;
+	Real trial = (p % 2) ? starts(i,s) - steps[s] : starts(i,s) + steps[s];
+	polls(i,col) = std::min(1., std::max(0., trial));
+      }
+    }
+    batch_merit_moments(polls, poll_means, poll_stdevs);
+
+    // move to the best improving poll point, else contract the step
+    for (a=0; a<num_active; ++a) {
+      s = active[a];
+      size_t best_col = _NPOS;  Real best_acq = start_acq[s];
+      for (p=0; p<num_polls; ++p) {
+	col = a * num_polls + p;
+	Real acq = penalized_acquisition(exploration, polls[col],
+					 poll_means[col], poll_stdevs[col]);
+	if (acq > best_acq)
+	  { best_acq = acq;  best_col = col; }
+      }
+      if (best_col == _NPOS)
+	steps[s] *= 0.5;
+      else {
+	for (i=0; i<numContinuousVars; ++i)
+	  starts(i,s) = polls(i,best_col);
+	start_acq[s]   = best_acq;
+	start_means[s] = poll_means[best_col];
+	start_stdevs[s] = poll_stdevs[best_col];
+      }
+    }
+  }
+
+  size_t s_star = 0;
+  for (s=1; s<num_starts; ++s)
+    if (start_acq[s] > start_acq[s_star])
+      s_star = s;
+  if (outputLevel >= VERBOSE_OUTPUT)
+    Cout << "\nBatched acquisition: " << num_cand << " candidates, "
+	 << num_starts << " refinement starts, " << sweep << " poll sweeps, "
+	 << pendingPoints.size() << " pending points.\n";
+
+  // map the solution to the variable bounds
+  const RealVector& c_l_bnds = fHatModel.continuous_lower_bounds();
+  const RealVector& c_u_bnds = fHatModel.continuous_upper_bounds();
+  RealVector c_vars_star(numContinuousVars, false);
+  for (i=0; i<numContinuousVars; ++i)
+    c_vars_star[i] = c_l_bnds[i]
+                   + starts(i,s_star) * (c_u_bnds[i] - c_l_bnds[i]);
+  vars_star = approxSubProbModel.current_variables().copy();
+  vars_star.continuous_variables(c_vars_star);
+
+  // consistent with DIRECT, return the negated (unpenalized) acquisition
+  Real mean_star = start_means[s_star], stdv_star = start_stdevs[s_star],
+    acq_star = (exploration) ? stdv_star
+                             : expected_improvement(mean_star, stdv_star);
+  acq_resp_star = approxSubProbModel.current_response().copy();
+  acq_resp_star.function_value(-acq_star, 0);
+
+  pendingPoints.push_back(RealVector(Teuchos::Copy, starts[s_star],
+				     (int)numContinuousVars));
+  pendingMeans.push_back(mean_star);
+  pendingStdevs.push_back(stdv_star);
+}
+
+
+/** Approximations are evaluated directly (rather than through
+    fHatModel) such that each response function is predicted for all
+    points in a single call.  Variances are only computed for the
+    response functions consumed by merit_moments(). */
+void EffGlobalMinimizer::
+predict_batch(const RealMatrix& c_vars, bool variance_flag,
+	      RealMatrix& means, RealMatrix& variances)
+{
+  std::vector<Approximation>& approxs = fHatModel.approximations();
+  size_t i;  int j, num_pts = c_vars.numCols();
+  means.shapeUninitialized(numFunctions, num_pts);
+  if (variance_flag)
+    variances.shape(numFunctions, num_pts); // zero for unused functions
+  RealVector fn_vals;
+  for (i=0; i<numFunctions; ++i) {
+    approxs[i].values(c_vars, fn_vals);
+    for (j=0; j<num_pts; ++j)
+      means(i,j) = fn_vals[j];
+    if (variance_flag && (i == 0 || i >= numUserPrimaryFns)) {
+      approxs[i].prediction_variances(c_vars, fn_vals);
+      for (j=0; j<num_pts; ++j)
+	variances(i,j) = std::max(fn_vals[j], 0.);
+    }
+  }
+}
+
+
+void EffGlobalMinimizer::
+batch_merit_moments(const RealMatrix& u_pts, RealVector& merit_means,
+		    RealVector& merit_stdevs)
+{
+  // map from the unit hypercube to the variable bounds
+  const RealVector& c_l_bnds = fHatModel.continuous_lower_bounds();
+  const RealVector& c_u_bnds = fHatModel.continuous_upper_bounds();
+  size_t i;  int j, num_pts = u_pts.numCols();
+  RealMatrix c_vars(numContinuousVars, num_pts, false), means, variances;
+  for (j=0; j<num_pts; ++j)
+    for (i=0; i<numContinuousVars; ++i)
+      c_vars(i,j) = c_l_bnds[i] + u_pts(i,j) * (c_u_bnds[i] - c_l_bnds[i]);
+  predict_batch(c_vars, true, means, variances);
+
+  if (merit_means.length() != num_pts)
+    merit_means.sizeUninitialized(num_pts);
+  if (merit_stdevs.length() != num_pts)
+    merit_stdevs.sizeUninitialized(num_pts);
+  for (j=0; j<num_pts; ++j) {
+    RealVector means_j(Teuchos::View, means[j], (int)numFunctions),
+      vars_j(Teuchos::View, variances[j], (int)numFunctions);
+    merit_moments(means_j, vars_j, merit_means[j], merit_stdevs[j]);
+  }
+}
+
+
+/** The candidates are a Latin hypercube sample of the unit hypercube,
+    whose merit moments are predicted once per GP build.  The Lipschitz
+    constant for the local penalization is estimated from the change in
+    the merit mean between a subset of the candidates and their nearest
+    neighbors. */
+void EffGlobalMinimizer::generate_candidates()
+{
+  // determine meritFnStar for use in EIF and the penalization
+  compute_best_sample();
+
+  size_t i, j, k, num_cand = acquisitionCandidates;
+  candidatePoints.shapeUninitialized(numContinuousVars, num_cand);
+  boost::random::uniform_real_distribution<> unif_real(0., 1.);
+  SizetArray perm(num_cand);
+  for (i=0; i<numContinuousVars; ++i) {
+    for (j=0; j<num_cand; ++j)
+      perm[j] = j;
+    for (j=num_cand-1; j>0; --j) { // Fisher-Yates shuffle of the strata
+      boost::random::uniform_int_distribution<size_t> unif_int(0, j);
+      std::swap(perm[j], perm[unif_int(candidateRNG)]);
+    }
+    for (j=0; j<num_cand; ++j)
+      candidatePoints(i,j)
+	= ((Real)perm[j] + unif_real(candidateRNG)) / (Real)num_cand;
+  }
+  batch_merit_moments(candidatePoints, candidateMeans, candidateStdevs);
+
+  size_t nn, num_lipschitz = std::min(num_cand, (size_t)256);
+  Real diff, dist2, nn_dist2;  meritLipschitz = 0.;
+  for (j=0; j<num_lipschitz; ++j) {
+    nn = j;  nn_dist2 = DBL_MAX;
+    for (k=0; k<num_cand; ++k) {
+      if (k == j) continue;
+      dist2 = 0.;
+      for (i=0; i<numContinuousVars; ++i) {
+	diff = candidatePoints(i,j) - candidatePoints(i,k);
+	dist2 += diff * diff;
+      }
+      if (dist2 < nn_dist2)
+	{ nn = k;  nn_dist2 = dist2; }
+    }
+    if (nn != j && nn_dist2 > 0.)
+      meritLipschitz = std::max(meritLipschitz,
+	std::fabs(candidateMeans[j] - candidateMeans[nn]) / std::sqrt(nn_dist2));
+  }
+  if (meritLipschitz < 1.e-7) // flat merit mean: fall back to a fixed value
+    meritLipschitz = 10.;
+}
+
+
+/** Each point selected since the last GP build multiplies the
+    acquisition by the probability that u lies outside of the ball
+    around that point that cannot contain the minimizer, given the
+    Lipschitz constant (local penalization; Gonzalez et al., 2016). */
+Real EffGlobalMinimizer::
+penalized_acquisition(bool exploration, const Real* u, Real mean, Real stdv)
+{
+  Real acq = (exploration) ? stdv : expected_improvement(mean, stdv);
+  size_t i, k, num_pending = pendingPoints.size();
+  for (k=0; k<num_pending && acq > 0.; ++k) {
+    const RealVector& u_k = pendingPoints[k];
+    Real diff, dist2 = 0.;
+    for (i=0; i<numContinuousVars; ++i)
+      { diff = u[i] - u_k[i]; dist2 += diff * diff; }
+    Real margin = meritLipschitz * std::sqrt(dist2) + meritFnStar
+                - pendingMeans[k];
+    if (pendingStdevs[k] > 0.)
+      acq *= Pecos::NormalRandomVariable::std_cdf(margin / pendingStdevs[k]);
+    else if (margin < 0.)
+      acq = 0.;
+  }
+  return acq;
+}
+
+
 bool EffGlobalMinimizer::converged()
 { 
   // set convergence flag if any counters have reached their limits
@@ -985,23 +1288,8 @@ Real EffGlobalMinimizer::
 compute_probability_improvement(const RealVector& means,
 				const RealVector& variances)
 {
-  // Objective calculation will incorporate any sense changes or
-  // weights, such that this is an objective to minimize.
-  Real mean = objective(means, iteratedModel.primary_response_fn_sense(),
-			iteratedModel.primary_response_fn_weights()), stdv;
-  if ( numNonlinearConstraints ) {
-    // mean_M = mean_f + lambda*EV + r_p*EV*EV
-    // stdv_M = stdv_f
-    const RealVector& ev = expected_violation(means, variances);
-    for (size_t i=0; i<numNonlinearConstraints; ++i)
-      mean += augLagrangeMult[i]*ev[i] + penaltyParameter*ev[i]*ev[i];
-    stdv = std::sqrt(variances[0]); // ***
-  }
-  else { // extend for NLS/MOO ***
-    // mean_M = M(mu_f)
-    // stdv_M = sqrt(var_f)
-    stdv = std::sqrt(variances[0]); // *** sqrt(sum(variances(1:nUsrPrimaryFns))
-  }
+  Real mean, stdv;
+  merit_moments(means, variances, mean, stdv);
   // Calculate the probability improvement
   Real cdf, snv = (meritFnStar - mean); // standard normal variate
   if (std::fabs(snv) >= std::fabs(stdv)*50.0)
@@ -1019,23 +1307,15 @@ Real EffGlobalMinimizer::
 compute_expected_improvement(const RealVector& means,
 			     const RealVector& variances)
 {
-  // Objective calculation will incorporate any sense changes or
-  // weights, such that this is an objective to minimize.
-  Real mean = objective(means, iteratedModel.primary_response_fn_sense(),
-			iteratedModel.primary_response_fn_weights()), stdv;
-  if ( numNonlinearConstraints ) {
-    // mean_M = mean_f + lambda*EV + r_p*EV*EV
-    // stdv_M = stdv_f
-    const RealVector& ev = expected_violation(means, variances);
-    for (size_t i=0; i<numNonlinearConstraints; ++i)
-      mean += augLagrangeMult[i]*ev[i] + penaltyParameter*ev[i]*ev[i]; // ***
-    stdv = std::sqrt(variances[0]); // *** if variance is only dependent on parameter points and not on QoI observations, then this would be Ok
-  }
-  else { // extend for NLS/MOO ***
-    // mean_M = M(mu_f)
-    // stdv_M = sqrt(var_f)
-    stdv = std::sqrt(variances[0]); // *** sqrt(sum(variances(1:nUsrPrimaryFns))
-  }
+  Real mean, stdv;
+  merit_moments(means, variances, mean, stdv);
+  return expected_improvement(mean, stdv);
+}
+
+
+/** Compute the EI acquisition function from the merit fn moments **/
+Real EffGlobalMinimizer::expected_improvement(Real mean, Real stdv)
+{
   // Calculate the expected improvement
   Real cdf, pdf;
   Real snv = (meritFnStar - mean); // standard normal variate
@@ -1058,27 +1338,38 @@ compute_expected_improvement(const RealVector& means,
 Real EffGlobalMinimizer::
 compute_lower_confidence_bound(const RealVector& means,
 			       const RealVector& variances)
+{
+  Real mean, stdv;
+  merit_moments(means, variances, mean, stdv);
+
+  Real kappa = 2.; // in future, vary this parameter as a function of iterations
+  return -mean + kappa * stdv; // lower confidence bound
+}
+
+
+/** Compute the moments of the merit function shared by the acquisition
+    functions **/
+void EffGlobalMinimizer::
+merit_moments(const RealVector& means, const RealVector& variances,
+	      Real& mean, Real& stdv)
 {
   // Objective calculation will incorporate any sense changes or
   // weights, such that this is an objective to minimize.
-  Real mean = objective(means, iteratedModel.primary_response_fn_sense(),
-			iteratedModel.primary_response_fn_weights()), stdv;
+  mean = objective(means, iteratedModel.primary_response_fn_sense(),
+		   iteratedModel.primary_response_fn_weights());
   if ( numNonlinearConstraints ) {
     // mean_M = mean_f + lambda*EV + r_p*EV*EV
     // stdv_M = stdv_f
     const RealVector& ev = expected_violation(means, variances);
     for (size_t i=0; i<numNonlinearConstraints; ++i)
-      mean += augLagrangeMult[i]*ev[i] + penaltyParameter*ev[i]*ev[i];
-    stdv = std::sqrt(variances[0]); // ***
+      mean += augLagrangeMult[i]*ev[i] + penaltyParameter*ev[i]*ev[i]; // ***
+    stdv = std::sqrt(variances[0]); // *** if variance is only dependent on parameter points and not on QoI observations, then this would be Ok
   }
   else { // extend for NLS/MOO ***
     // mean_M = M(mu_f)
     // stdv_M = sqrt(var_f)
-    stdv = std::sqrt(variances[0]);// *** sqrt(sum(variances(1:numUserPrimary))
+    stdv = std::sqrt(variances[0]); // *** sqrt(sum(variances(1:nUsrPrimaryFns))
   }
-
-  Real kappa = 2.; // in future, vary this parameter as a function of iterations
-  return -mean + kappa * stdv; // lower confidence bound
 }
 
 
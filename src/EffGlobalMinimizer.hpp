@@ -19,6 +19,7 @@
 #define EGO_MINIMIZER_H
 
 #include "SurrBasedMinimizer.hpp"
+#include "dakota_mersenne_twister.hpp"
 
 
 namespace Dakota {
@@ -178,6 +179,31 @@ private:
 
   /// determine meritFnStar from among the GP build data for use in EIF
   void compute_best_sample();
+
+  /// solve an approximate sub-problem (maximize EI or, for exploration,
+  /// the posterior standard deviation) by screening acquisitionCandidates
+  /// and refining the best of them, using batched GP predictions
+  void solve_batched_sub_problem(bool exploration, Variables& vars_star,
+				 Response& acq_resp_star);
+  /// predict the GP means and (optionally) the variances required by
+  /// merit_moments() for the points in the columns of c_vars, with one
+  /// batched prediction per response function
+  void predict_batch(const RealMatrix& c_vars, bool variance_flag,
+		     RealMatrix& means, RealMatrix& variances);
+  /// compute the merit function means and standard deviations for the
+  /// points in the columns of u_pts (normalized to the unit hypercube)
+  void batch_merit_moments(const RealMatrix& u_pts, RealVector& merit_means,
+			   RealVector& merit_stdevs);
+  /// generate the Latin hypercube candidates and their merit moments
+  /// that are shared by the sub-problems of a batch
+  void generate_candidates();
+  /// value of the locally-penalized acquisition function for a point u
+  /// (normalized) with merit function mean and standard deviation
+  Real penalized_acquisition(bool exploration, const Real* u, Real mean,
+			     Real stdv);
+  /// clear the candidates and selected points that are specific to the
+  /// current GP build
+  void reset_batched_acquisition();
   /// extract best solution from among the GP build data for final results
   void extract_best_sample();
   /// extra response function build data from across the set of QoI
@@ -212,6 +238,12 @@ private:
   /// expected violation function for the constraint functions
   RealVector expected_violation(const RealVector& means,
 				const RealVector& variances);
+  /// compute the mean and standard deviation of the merit function from
+  /// the GP means and variances of the response functions
+  void merit_moments(const RealVector& means, const RealVector& variances,
+		     Real& mean, Real& stdv);
+  /// EI in terms of the mean and standard deviation of the merit function
+  Real expected_improvement(Real mean, Real stdv);
 
   /// initialize and update the penaltyParameter
   void update_penalty();
@@ -330,6 +362,30 @@ private:
 
   /// counter for global iteration
   unsigned short globalIterCount;
+
+  // batched acquisition
+  /// number of candidates screened in each approximate sub-problem using
+  /// batched GP predictions; zero solves the sub-problems with DIRECT
+  size_t acquisitionCandidates;
+  /// random number generator for the acquisition candidates
+  boost::mt19937 candidateRNG;
+  /// Latin hypercube candidates in the unit hypercube (one per column),
+  /// shared by the sub-problems of a batch
+  RealMatrix candidatePoints;
+  /// merit function means at candidatePoints
+  RealVector candidateMeans;
+  /// merit function standard deviations at candidatePoints
+  RealVector candidateStdevs;
+  /// points (normalized) selected since the last GP build, which
+  /// penalize the acquisition in place of rebuilding the GP for each liar
+  RealVectorArray pendingPoints;
+  /// merit function means at pendingPoints
+  RealArray pendingMeans;
+  /// merit function standard deviations at pendingPoints
+  RealArray pendingStdevs;
+  /// estimate of the Lipschitz constant of the merit function mean in
+  /// normalized coordinates, used by the local penalization
+  Real meritLipschitz;
 };
 
 
@@ -341,6 +397,14 @@ inline const Model& EffGlobalMinimizer::algorithm_space_model() const
 { return fHatModel; }
 
 
+inline void EffGlobalMinimizer::reset_batched_acquisition()
+{
+  candidatePoints.shape(0, 0);
+  candidateMeans.sizeUninitialized(0); candidateStdevs.sizeUninitialized(0);
+  pendingPoints.clear(); pendingMeans.clear(); pendingStdevs.clear();
+}
+
+
 inline void EffGlobalMinimizer::initialize_counters_limits()
 {
   // note that eif/dist conv triggers must be sequential:
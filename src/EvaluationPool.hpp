@@ -0,0 +1,175 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       EvaluationPool
+//- Description: Recycled storage for deep copies of queued evaluations
+//- Owner:
+//- Version: $Id$
+
+#ifndef EVALUATION_POOL_H
+#define EVALUATION_POOL_H
+
+#include "DakotaVariables.hpp"
+#include "DakotaResponse.hpp"
+#include <algorithm>
+
+
+namespace Dakota {
+
+/// Recycles the Variables and Response letters used for deep copies of
+/// queued evaluations
+
+/** Each asynchronous evaluation requires deep copies of its variables
+    and response, and for large numbers of inexpensive evaluations, the
+    associated heap allocations dominate.  Copies are instead made into
+    pooled slots, reusing the letter of a slot when no handle outside the
+    pool still references it (see Variables::copy(Variables&)).  Slots
+    are organized in two generations that alternate with each batch
+    (synchronization), since the responses of the most recent batch
+    typically remain referenced (e.g., in response maps) while the next
+    batch is queued.  Allocation is thereby bounded by the batch size
+    rather than the total number of evaluations.
+
+    The evaluation cache keeps the queued copies of every new evaluation
+    as its own storage, so ApplicationInterface only pools them when the
+    cache is deactivated; with the cache active (the default), only the
+    copies of duplicate evaluations and algebraic mappings are recycled,
+    and the benefit for large numbers of inexpensive evaluations
+    requires "deactivate evaluation_cache".  Copies that are nonetheless
+    still referenced when their generation becomes active again are
+    relinquished to their owner and their slots removed, such that the
+    pool only holds recyclable storage. */
+
+class EvaluationPool
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  EvaluationPool();  ///< default constructor
+  ~EvaluationPool(); ///< destructor
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// return a deep copy of vars, recycling pooled storage if possible
+  Variables copy(const Variables& vars);
+  /// return a deep copy of response, recycling pooled storage if possible
+  Response copy(const Response& response);
+
+  /// advance to the next batch of evaluations, relinquishing the
+  /// retained copies of the generation that becomes active
+  void next_batch();
+
+  /// number of Variables and Response letters held by the pool
+  size_t size() const;
+
+  /// release all pooled storage
+  void clear();
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// copy source into the next slot of pool, extending it as needed
+  template <typename T>
+  const T& pooled_copy(const T& source, std::vector<T>& pool, size_t& cursor);
+  /// remove the slots of pool whose letters are referenced elsewhere
+  template <typename T>
+  void relinquish_retained(std::vector<T>& pool);
+
+  //
+  //- Heading: Data
+  //
+
+  /// index of the active generation (0 or 1)
+  unsigned short activeGen;
+
+  /// two generations of pooled Variables
+  std::vector<Variables> varsPool[2];
+  /// two generations of pooled Responses
+  std::vector<Response> respPool[2];
+  /// next Variables slot in the active generation
+  size_t varsCursor;
+  /// next Response slot in the active generation
+  size_t respCursor;
+};
+
+
+inline EvaluationPool::EvaluationPool():
+  activeGen(0), varsCursor(0), respCursor(0)
+{ }
+
+
+inline EvaluationPool::~EvaluationPool()
+{ }
+
+
+template <typename T> const T& EvaluationPool::
+pooled_copy(const T& source, std::vector<T>& pool, size_t& cursor)
+{
+  if (cursor < pool.size())
+    source.copy(pool[cursor]); // reuses the letter when it is free
+  else
+    pool.push_back(source.copy());
+  return pool[cursor++];
+}
+
+
+template <typename T>
+void EvaluationPool::relinquish_retained(std::vector<T>& pool)
+{
+  pool.erase(std::remove_if(pool.begin(), pool.end(), [](const T& pooled)
+    { return pooled.reference_count() > 1; }), pool.end());
+}
+
+
+inline Variables EvaluationPool::copy(const Variables& vars)
+{ return pooled_copy(vars, varsPool[activeGen], varsCursor); }
+
+
+inline Response EvaluationPool::copy(const Response& response)
+{ return pooled_copy(response, respPool[activeGen], respCursor); }
+
+
+inline void EvaluationPool::next_batch()
+{
+  // nothing was queued: retain the active generation
+  if (!varsCursor && !respCursor)
+    return;
+  activeGen = !activeGen;
+  varsCursor = respCursor = 0;
+  relinquish_retained(varsPool[activeGen]);
+  relinquish_retained(respPool[activeGen]);
+}
+
+
+inline size_t EvaluationPool::size() const
+{
+  return varsPool[0].size() + varsPool[1].size() +
+    respPool[0].size() + respPool[1].size();
+}
+
+
+inline void EvaluationPool::clear()
+{
+  for (size_t g=0; g<2; ++g)
+    { varsPool[g].clear(); respPool[g].clear(); }
+  activeGen = 0;
+  varsCursor = respCursor = 0;
+}
+
+} // namespace Dakota
+
+#endif
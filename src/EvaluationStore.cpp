@@ -24,6 +24,7 @@
 #include "dakota_data_types.hpp"
 #include "dakota_results_types.hpp"
 #include "MarginalsCorrDistribution.hpp"
+#include "PerformanceRegistry.hpp"
 
 namespace Dakota {
 
@@ -247,6 +248,7 @@ void EvaluationStore::store_model_variables(const String &model_id, const String
 #ifdef DAKOTA_HAVE_HDF5
   if(!active())
     return;
+  ScopedTimer store_timer("evaluation_store", "evaluation_store");
   const DefaultSet &default_set_s = modelDefaultSets[model_id];
   if(set.request_vector().size() != default_set_s.numFunctions) {
     if(resizedModels.find(model_id) == resizedModels.end()) {
@@ -288,6 +290,7 @@ void EvaluationStore::store_model_response(const String &model_id, const String
 #ifdef DAKOTA_HAVE_HDF5
   if(!active())
     return;
+  ScopedTimer store_timer("evaluation_store", "evaluation_store");
   const DefaultSet &default_set_s = modelDefaultSets[model_id];
   std::tuple<String, int> key(model_id, eval_id);
   int response_index = modelResponseIndexCache[key];
@@ -309,6 +312,7 @@ void EvaluationStore::store_interface_variables(const String &model_id, const St
 #ifdef DAKOTA_HAVE_HDF5
   if(!active())
     return;
+  ScopedTimer store_timer("evaluation_store", "evaluation_store");
   String root_group = create_interface_root(model_id, interface_id);
   String scale_root = create_scale_root(root_group);
   const auto set_key = std::make_pair(model_id, interface_id);
@@ -338,6 +342,7 @@ void EvaluationStore::store_interface_response(const String &model_id, const Str
 #ifdef DAKOTA_HAVE_HDF5
   if(!active())
     return;
+  ScopedTimer store_timer("evaluation_store", "evaluation_store");
   std::tuple<String, String, int> key(model_id, interface_id, eval_id);
   int response_index = interfaceResponseIndexCache[key];
   String root_group = create_interface_root(model_id, interface_id);
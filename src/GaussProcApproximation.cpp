@@ -218,6 +218,14 @@ Real GaussProcApproximation::prediction_variance(const Variables& vars)
 { GPmodel_apply(vars.continuous_variables(),true,false); return approxVariance;}
 
 
+Real GaussProcApproximation::value(const RealVector& c_vars)
+{ GPmodel_apply(c_vars,false,false); return approxValue; }
+
+
+Real GaussProcApproximation::prediction_variance(const RealVector& c_vars)
+{ GPmodel_apply(c_vars,true,false); return approxVariance; }
+
+
 void GaussProcApproximation::GPmodel_build()
 {
   // Point selection is off by default, but will be forced if a large
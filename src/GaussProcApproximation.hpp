@@ -85,6 +85,12 @@ protected:
   /// retrieve the variance of the predicted value for a given parameter set
   Real prediction_variance(const Variables& vars);
 
+  /// retrieve the function value for a given parameter vector
+  Real value(const RealVector& c_vars);
+
+  /// retrieve the variance of the predicted value for a given parameter vector
+  Real prediction_variance(const RealVector& c_vars);
+
 private: 
 
   //
@@ -26,6 +26,7 @@ extern Model dummy_model; // defined in DakotaModel.cpp
 HierarchSurrModel::HierarchSurrModel(ProblemDescDB& problem_db):
   EnsembleSurrModel(problem_db),
   corrOrder(problem_db.get_short("model.surrogate.correction_order")),
+  overlapEvals(problem_db.get_bool("model.surrogate.overlap_evaluations")),
   correctionMode(SINGLE_CORRECTION)
 {
   const StringArray& ordered_model_ptrs
@@ -522,10 +523,37 @@ void HierarchSurrModel::derived_evaluate(const ActiveSet& set)
   //   the current solution index state is currently as expensive as resetting
   //   it, so just reset each time.
 
+  // ------------------------------------------------------
+  // Compute high and low fidelity responses simultaneously
+  // ------------------------------------------------------
+  bool overlap = false;
+  if (mixed_eval) {
+    ActiveSet hi_fi_set(set), lo_fi_set(set);
+    if (responseMode != MODEL_DISCREPANCY) {
+      hi_fi_set.request_vector(hi_fi_asv);
+      lo_fi_set.request_vector(lo_fi_asv);
+    }
+    overlap = overlap_evaluations(hf_model, hi_fi_set, lf_model, lo_fi_set);
+    if (overlap) {
+      // if build_approximation has not yet been called, call it now
+      if ( responseMode == AUTO_CORRECTED_SURROGATE &&
+	   ( !approxBuilds || force_rebuild() ) )
+	build_approximation();
+      update_model(hf_model);  update_model(lf_model);
+      evaluate_overlapped(hf_model, hi_fi_set, lf_model, lo_fi_set,
+			  hi_fi_response, lo_fi_response);
+      // LF resp should not be corrected directly (see derived_synchronize())
+      if (responseMode == AUTO_CORRECTED_SURROGATE) {
+	lo_fi_response = lo_fi_response.copy();
+	recursive_apply(currentVariables, lo_fi_response);
+      }
+    }
+  }
+
   // ------------------------------
   // Compute high fidelity response
   // ------------------------------
-  if (hi_fi_eval) {
+  if (hi_fi_eval && !overlap) {
     component_parallel_mode(TRUTH_MODEL_MODE); // TO DO: sameModelInstance
     assign_truth_key();
     if (!sameModelInstance) update_model(hf_model);
@@ -559,7 +587,7 @@ void HierarchSurrModel::derived_evaluate(const ActiveSet& set)
   // -----------------------------
   // Compute low fidelity response
   // -----------------------------
-  if (lo_fi_eval) {
+  if (lo_fi_eval && !overlap) {
     // pre-process
     switch (responseMode) {
     case AUTO_CORRECTED_SURROGATE:
@@ -605,6 +633,9 @@ void HierarchSurrModel::derived_evaluate(const ActiveSet& set)
         currentResponse.update(lf_model.current_response(), true); // pull meta
       }
       break;
+    case MODEL_DISCREPANCY: case AGGREGATED_MODELS:
+      lo_fi_response = lf_model.current_response(); // shared rep
+      break;
     }
   }
 
@@ -617,13 +648,12 @@ void HierarchSurrModel::derived_evaluate(const ActiveSet& set)
     // just update currentResponse (managed as surrogate data at a higher level)
     bool quiet_flag = (outputLevel < NORMAL_OUTPUT);
     currentResponse.active_set(set);
-    deltaCorr[activeKey].compute(hi_fi_response, lf_model.current_response(),
+    deltaCorr[activeKey].compute(hi_fi_response, lo_fi_response,
 				 currentResponse, quiet_flag);
     break;
   }
   case AGGREGATED_MODELS:
-    aggregate_response(hi_fi_response, lf_model.current_response(),
-                       currentResponse);
+    aggregate_response(hi_fi_response, lo_fi_response, currentResponse);
     break;
   case UNCORRECTED_SURROGATE:   case AUTO_CORRECTED_SURROGATE:
     if (mixed_eval) {
@@ -635,6 +665,79 @@ void HierarchSurrModel::derived_evaluate(const ActiveSet& set)
 }
 
 
+/** Overlapping requires distinct, asynchronous HF and LF models that
+    evaluate without multiprocessor servers (which are stopped when
+    switching component parallel modes) and without finite difference
+    or quasi-Newton derivative estimation (which is not supported by
+    Model::synchronize_nowait()).  It also requires that no asynchronous
+    evaluations of this model are pending, since their completions would
+    be returned by the same synchronizations. */
+bool HierarchSurrModel::
+overlap_evaluations(Model& hf_model, const ActiveSet& hi_fi_set,
+		    Model& lf_model, const ActiveSet& lo_fi_set)
+{
+  if (!overlapEvals || sameModelInstance ||
+      !hf_model.asynch_flag() || !lf_model.asynch_flag() ||
+      model_servers(hf_model) || model_servers(lf_model) ||
+      !modelIdMaps[0].empty() || !modelIdMaps[1].empty())
+    return false;
+
+  const ShortArray& hf_asv = hi_fi_set.request_vector();
+  const ShortArray& lf_asv = lo_fi_set.request_vector();
+  size_t i, num_hf = hf_asv.size(), num_lf = lf_asv.size();
+  for (i=0; i<num_hf; ++i)
+    if ( ( (hf_asv[i] & 2) && hf_model.gradient_type() != "analytic" ) ||
+	 ( (hf_asv[i] & 4) && hf_model.hessian_type()  != "analytic" ) )
+      return false;
+  for (i=0; i<num_lf; ++i)
+    if ( ( (lf_asv[i] & 2) && lf_model.gradient_type() != "analytic" ) ||
+	 ( (lf_asv[i] & 4) && lf_model.hessian_type()  != "analytic" ) )
+      return false;
+  return true;
+}
+
+
+/** Both evaluations are queued before either is synchronized, so that
+    the LF evaluation runs alongside the HF one and the wall time of a
+    blocking evaluation of both fidelities approaches that of the more
+    expensive one.  When a sub-model is itself a HierarchSurrModel, its
+    derived_evaluate_nowait() launches its own sub-models in turn, so
+    the overlap extends through multilevel hierarchies. */
+void HierarchSurrModel::
+evaluate_overlapped(Model& hf_model, const ActiveSet& hi_fi_set,
+		    Model& lf_model, const ActiveSet& lo_fi_set,
+		    Response& hi_fi_response, Response& lo_fi_response)
+{
+  // don't need to set component parallel mode since only queues the jobs
+  assign_truth_key();
+  hf_model.evaluate_nowait(hi_fi_set);
+  int hf_eval_id = hf_model.evaluation_id();
+  assign_surrogate_key();
+  lf_model.evaluate_nowait(lo_fi_set);
+  int lf_eval_id = lf_model.evaluation_id();
+
+  // alternate nonblocking synchronizations until both have completed
+  bool hf_pending = true, lf_pending = true;
+  IntRespMCIter r_cit;
+  while (hf_pending || lf_pending) {
+    if (hf_pending) {
+      component_parallel_mode(TRUTH_MODEL_MODE);
+      const IntResponseMap& hf_resp_map = hf_model.synchronize_nowait();
+      r_cit = hf_resp_map.find(hf_eval_id);
+      if (r_cit != hf_resp_map.end())
+	{ hi_fi_response = r_cit->second; hf_pending = false; }
+    }
+    if (lf_pending) {
+      component_parallel_mode(SURROGATE_MODEL_MODE);
+      const IntResponseMap& lf_resp_map = lf_model.synchronize_nowait();
+      r_cit = lf_resp_map.find(lf_eval_id);
+      if (r_cit != lf_resp_map.end())
+	{ lo_fi_response = r_cit->second; lf_pending = false; }
+    }
+  }
+}
+
+
 /** Compute the response asynchronously using LF model, HF model, or
     both (mixed case).  For the LF model portion, compute the high
     fidelity response with build_approximation() (for correcting the
@@ -237,6 +237,19 @@ private:
   /// stop the servers for the orderedModels instance identified by
   /// the passed index
   void stop_model(size_t ordered_model_index);
+  /// whether the passed model evaluates on multiprocessor servers, which
+  /// are stopped when the other component parallel mode is activated
+  static bool model_servers(Model& model);
+
+  /// whether the HF and LF evaluations of a blocking derived_evaluate()
+  /// can be overlapped (see overlapEvals)
+  bool overlap_evaluations(Model& hf_model, const ActiveSet& hi_fi_set,
+			   Model& lf_model, const ActiveSet& lo_fi_set);
+  /// launch the HF and LF evaluations with evaluate_nowait() and
+  /// synchronize them together, returning the raw responses
+  void evaluate_overlapped(Model& hf_model, const ActiveSet& hi_fi_set,
+			   Model& lf_model, const ActiveSet& lo_fi_set,
+			   Response& hi_fi_response, Response& lo_fi_response);
 
   //
   //- Heading: Data members
@@ -248,6 +261,9 @@ private:
   std::map<Pecos::ActiveKey, DiscrepancyCorrection> deltaCorr;
   /// order of correction: 0, 1, or 2
   short corrOrder;
+  /// flag for overlapping the HF and LF evaluations of blocking
+  /// evaluations of both fidelities (overlap_evaluations specification)
+  bool overlapEvals;
 
   unsigned short correctionMode;
 
@@ -724,13 +740,19 @@ inline void HierarchSurrModel::derived_init_serial()
 }
 
 
-inline void HierarchSurrModel::stop_model(size_t ordered_model_index)
+inline bool HierarchSurrModel::model_servers(Model& model)
 {
-  Model& model = orderedModels[ordered_model_index];
   ParConfigLIter pc_it = model.parallel_configuration_iterator();
   size_t index = model.mi_parallel_level_index();
-  if (pc_it->mi_parallel_level_defined(index) &&
-      pc_it->mi_parallel_level(index).server_communicator_size() > 1)
+  return (pc_it->mi_parallel_level_defined(index) &&
+	  pc_it->mi_parallel_level(index).server_communicator_size() > 1);
+}
+
+
+inline void HierarchSurrModel::stop_model(size_t ordered_model_index)
+{
+  Model& model = orderedModels[ordered_model_index];
+  if (model_servers(model))
     model.stop_servers();
 }
 
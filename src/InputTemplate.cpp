@@ -0,0 +1,754 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       InputTemplate
+//- Description: Implementation code for the InputTemplate class
+//- Owner:
+//- Checked by:
+
+#include "InputTemplate.hpp"
+#include "dakota_data_util.hpp"
+#include "dakota_global_defs.hpp"
+#include <boost/filesystem/path.hpp>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+namespace bfs = boost::filesystem;
+
+static const char rcsId[]="@(#) $Id$";
+
+
+namespace Dakota {
+
+namespace {
+
+/// functions available to template expressions (ordered by name)
+enum { FN_ABS, FN_ACOS, FN_ACOSH, FN_ASIN, FN_ASINH, FN_ATAN, FN_ATAN2,
+       FN_ATANH, FN_CEIL, FN_COS, FN_COSH, FN_DEGREES, FN_EXP, FN_FABS,
+       FN_FLOAT, FN_FLOOR, FN_HYPOT, FN_INT, FN_LOG, FN_LOG10, FN_MAX,
+       FN_MIN, FN_POW, FN_RADIANS, FN_ROUND, FN_SIN, FN_SINH, FN_SQRT,
+       FN_TAN, FN_TANH, NUM_FUNCTIONS };
+
+/// name and number of arguments of each function
+const struct {
+  const char* name;
+  size_t minArgs, maxArgs;
+} templateFunctions[NUM_FUNCTIONS] = {
+  {"abs", 1, 1},   {"acos", 1, 1},    {"acosh", 1, 1}, {"asin", 1, 1},
+  {"asinh", 1, 1}, {"atan", 1, 1},    {"atan2", 2, 2}, {"atanh", 1, 1},
+  {"ceil", 1, 1},  {"cos", 1, 1},     {"cosh", 1, 1},  {"degrees", 1, 1},
+  {"exp", 1, 1},   {"fabs", 1, 1},    {"float", 1, 1}, {"floor", 1, 1},
+  {"hypot", 2, 2}, {"int", 1, 1},     {"log", 1, 2},   {"log10", 1, 1},
+  {"max", 1, _NPOS}, {"min", 1, _NPOS}, {"pow", 2, 2}, {"radians", 1, 1},
+  {"round", 1, 2}, {"sin", 1, 1},     {"sinh", 1, 1},  {"sqrt", 1, 1},
+  {"tan", 1, 1},   {"tanh", 1, 1}
+};
+
+bool is_blank(char c)
+{ return (c == ' ' || c == '\t' || c == '\f' || c == '\r'); }
+
+bool is_name_start(char c)
+{ return (std::isalpha((unsigned char)c) || c == '_'); }
+
+bool is_name_char(char c)
+{ return (std::isalnum((unsigned char)c) || c == '_'); }
+
+String trim(const String& str)
+{
+  size_t first = 0, last = str.size();
+  while (first < last && (is_blank(str[first]) || str[first] == '\n')) ++first;
+  while (last > first && (is_blank(str[last-1]) || str[last-1] == '\n')) --last;
+  return str.substr(first, last - first);
+}
+
+/// position following the quoted string starting at pos, or _NPOS if
+/// unterminated
+size_t skip_quoted(const String& text, size_t pos)
+{
+  char quote = text[pos];
+  for (++pos; pos < text.size(); ++pos)
+    if (text[pos] == '\\') ++pos;
+    else if (text[pos] == quote) return pos + 1;
+  return _NPOS;
+}
+
+/// position of close in text at or after pos, skipping quoted strings
+size_t find_unquoted(const String& text, size_t pos, const String& close)
+{
+  while (pos < text.size()) {
+    if (text[pos] == '"' || text[pos] == '\'') {
+      pos = skip_quoted(text, pos);
+      if (pos == _NPOS) return _NPOS;
+    }
+    else if (text.compare(pos, close.size(), close) == 0)
+      return pos;
+    else
+      ++pos;
+  }
+  return _NPOS;
+}
+
+} // anonymous namespace
+
+
+/// Recursive descent parser that compiles an expression into postfix
+/// instructions, with the precedence of Python's arithmetic operators
+class InputTemplate::Parser
+{
+public:
+
+  Parser(InputTemplate& tmpl, const String& expr, size_t line,
+	 std::vector<Instruction>& code):
+    inputTemplate(tmpl), exprText(expr), exprLine(line), pos(0),
+    exprCode(code)
+  { }
+
+  /// compile the full expression text
+  void parse()
+  {
+    expression();
+    skip_blanks();
+    if (pos < exprText.size())
+      error("unexpected '" + exprText.substr(pos) + "'");
+  }
+
+private:
+
+  void expression()
+  {
+    term();
+    for (;;) {
+      if      (accept("+")) { term(); emit(ADD); }
+      else if (accept("-")) { term(); emit(SUBTRACT); }
+      else return;
+    }
+  }
+
+  void term()
+  {
+    unary();
+    for (;;) {
+      if      (accept("//")) { unary(); emit(FLOOR_DIVIDE); }
+      else if (accept("/"))  { unary(); emit(DIVIDE); }
+      else if (accept("*"))  { unary(); emit(MULTIPLY); }
+      else if (accept("%"))  { unary(); emit(MODULO); }
+      else return;
+    }
+  }
+
+  void unary()
+  {
+    if (accept("-"))      { unary(); emit(NEGATE); }
+    else if (accept("+"))   unary();
+    else                    power();
+  }
+
+  /// ** binds more tightly than a unary operator on its left but less
+  /// tightly than one on its right: -2**-1 is -(2**(-1))
+  void power()
+  {
+    primary();
+    if (accept("**"))
+      { unary(); emit(POWER); }
+  }
+
+  void primary()
+  {
+    skip_blanks();
+    if (pos >= exprText.size())
+      error("incomplete expression");
+    char c = exprText[pos];
+    if (c == '(') {
+      ++pos;
+      expression();
+      if (!accept(")")) error("missing ')'");
+    }
+    else if (c == '"' || c == '\'')
+      string_literal();
+    else if (std::isdigit((unsigned char)c) ||
+	     (c == '.' && pos + 1 < exprText.size() &&
+	      std::isdigit((unsigned char)exprText[pos+1])))
+      number();
+    else if (is_name_start(c)) {
+      size_t start = pos;
+      while (pos < exprText.size() && is_name_char(exprText[pos])) ++pos;
+      String name = exprText.substr(start, pos - start);
+      if (accept("("))
+	call(name);
+      else
+	emit(PUSH_VAR, inputTemplate.symbol_index(name));
+    }
+    else
+      error("unexpected '" + exprText.substr(pos) + "'");
+  }
+
+  void call(const String& name)
+  {
+    size_t fn = 0;
+    while (fn < NUM_FUNCTIONS && name != templateFunctions[fn].name) ++fn;
+    if (fn == NUM_FUNCTIONS)
+      error("unsupported function '" + name + "'");
+    size_t num_args = 0;
+    if (!accept(")")) {
+      do { expression(); ++num_args; } while (accept(","));
+      if (!accept(")")) error("missing ')' in call to " + name);
+    }
+    if (num_args < templateFunctions[fn].minArgs ||
+	num_args > templateFunctions[fn].maxArgs)
+      error("wrong number of arguments to " + name);
+    emit(CALL, fn, num_args);
+  }
+
+  void number()
+  {
+    const char* start = exprText.c_str() + pos;
+    char* end;
+    Real val = std::strtod(start, &end);
+    pos += end - start;
+    if (pos < exprText.size() && is_name_char(exprText[pos]))
+      error("invalid number '" + exprText.substr(start - exprText.c_str()) +
+	    "'");
+    emit(PUSH_CONST, inputTemplate.constant_index(TemplateValue(val)));
+  }
+
+  void string_literal()
+  {
+    size_t end = skip_quoted(exprText, pos);
+    if (end == _NPOS) error("unterminated string");
+    String val;
+    for (size_t i=pos+1; i<end-1; ++i) {
+      char c = exprText[i];
+      if (c == '\\' && i+1 < end-1) {
+	c = exprText[++i];
+	if      (c == 'n') c = '\n';
+	else if (c == 't') c = '\t';
+	else if (c != '\\' && c != '"' && c != '\'') val += '\\';
+      }
+      val += c;
+    }
+    pos = end;
+    emit(PUSH_CONST, inputTemplate.constant_index(TemplateValue(val)));
+  }
+
+  void skip_blanks()
+  {
+    while (pos < exprText.size() &&
+	   (is_blank(exprText[pos]) || exprText[pos] == '\n'))
+      ++pos;
+  }
+
+  /// consume tok if next; a single * or / does not match ** or //
+  bool accept(const char* tok)
+  {
+    skip_blanks();
+    String t(tok);
+    if (exprText.compare(pos, t.size(), t) != 0)
+      return false;
+    if (t.size() == 1 && (t[0] == '*' || t[0] == '/') &&
+	pos + 1 < exprText.size() && exprText[pos+1] == t[0])
+      return false;
+    pos += t.size();
+    return true;
+  }
+
+  void emit(unsigned short op, size_t arg = 0, size_t num_args = 0)
+  {
+    Instruction instr;
+    instr.op = op; instr.arg = arg; instr.numArgs = num_args;
+    exprCode.push_back(instr);
+  }
+
+  void error(const String& msg)
+  { inputTemplate.template_error(msg + " in expression '" + exprText + "'",
+				 exprLine); }
+
+  InputTemplate& inputTemplate;      ///< template receiving symbols/constants
+  const String& exprText;            ///< expression being compiled
+  size_t exprLine;                   ///< line number for error messages
+  size_t pos;                        ///< current position in exprText
+  std::vector<Instruction>& exprCode; ///< compiled expression
+};
+
+
+void InputTemplate::compile(const String& template_file)
+{
+  std::ifstream template_stream(template_file.c_str(), std::ios::binary);
+  if (!template_stream) {
+    Cerr << "\nError: cannot open template file " << template_file
+	 << std::endl;
+    abort_handler(IO_ERROR);
+  }
+  std::ostringstream text;
+  text << template_stream.rdbuf();
+
+  bfs::path out_path = bfs::path(template_file).filename();
+  if (out_path.extension() == ".template" || out_path.extension() == ".tmpl")
+    out_path = out_path.stem();
+  outputName = out_path.string();
+
+  compile(text.str(), template_file);
+}
+
+
+/** Mirrors the pyprepro preparser: code lines and {% %} blocks produce
+    no output, and a block on a line by itself does not leave an empty
+    line. */
+void InputTemplate::compile(const String& text, const String& source)
+{
+  sourceName = source;
+  segments.clear(); symbols.clear(); constants.clear();
+
+  size_t pos = 0, len = text.size(), line = 1;
+  // skip a UTF-8 byte order mark
+  if (text.compare(0, 3, "\xEF\xBB\xBF") == 0)
+    pos = 3;
+  String lit;
+  bool line_start = true, line_blank = true;
+  while (pos < len) {
+    if (line_start) {
+      // "% statement" lines (not "%}", which closes a block)
+      size_t p = pos;
+      while (p < len && is_blank(text[p])) ++p;
+      if (p < len && text[p] == '%' && !(p+1 < len && text[p+1] == '}')) {
+	size_t eol = text.find('\n', p);
+	if (eol == String::npos) eol = len;
+	compile_statement(text.substr(p+1, eol-p-1), false, line);
+	pos = (eol < len) ? eol + 1 : len;
+	++line;
+	continue;
+      }
+      line_start = false; line_blank = true;
+    }
+
+    char c = text[pos];
+    if (c == '\\' && pos+2 < len && text[pos+1] == '\\' &&
+	(text[pos+2] == '{' || text[pos+2] == '}')) {
+      // \\{ outputs \{
+      lit += '\\'; lit += text[pos+2]; pos += 3; line_blank = false;
+    }
+    else if (c == '\\' && pos+1 < len &&
+	     (text[pos+1] == '{' || text[pos+1] == '}')) {
+      // \{ outputs {
+      lit += text[pos+1]; pos += 2; line_blank = false;
+    }
+    else if (c == '{') {
+      bool block = (pos+1 < len && text[pos+1] == '%');
+      String close = (block) ? "%}" : "}";
+      size_t start = pos + ((block) ? 2 : 1),
+	end = find_unquoted(text, start, close);
+      if (end == _NPOS)
+	template_error("missing '" + close + "'", line);
+      String content = text.substr(start, end - start);
+      size_t stmt_line = line;
+      for (char cc : content)
+	if (cc == '\n') ++line;
+      pos = end + close.size();
+
+      if (block) {
+	// a block alone on its line is removed along with the line
+	size_t eol = pos;
+	while (eol < len && is_blank(text[eol])) ++eol;
+	if (line_blank && (eol == len || text[eol] == '\n')) {
+	  size_t bol = lit.find_last_of('\n');
+	  lit.erase((bol == String::npos) ? 0 : bol + 1);
+	  if (eol < len) { pos = eol + 1; ++line; line_start = true; }
+	  else pos = len;
+	}
+	append_text(lit); lit.clear();
+	size_t stmt_start = 0, stmt_end;
+	do {
+	  stmt_end = std::min(find_unquoted(content, stmt_start, ";"),
+			      find_unquoted(content, stmt_start, "\n"));
+	  compile_statement(content.substr(stmt_start, stmt_end - stmt_start),
+			    false, stmt_line);
+	  stmt_start = stmt_end + 1;
+	} while (stmt_end != _NPOS);
+      }
+      else {
+	append_text(lit); lit.clear();
+	compile_statement(content, true, stmt_line);
+	line_blank = false;
+      }
+    }
+    else {
+      lit += c; ++pos;
+      if (c == '\n')
+	{ ++line; line_start = true; }
+      else if (!is_blank(c))
+	line_blank = false;
+    }
+  }
+  append_text(lit);
+}
+
+
+void InputTemplate::
+compile_statement(const String& stmt_text, bool print, size_t line)
+{
+  String stmt = trim(stmt_text);
+  if (stmt.empty()) {
+    if (print)
+      template_error("empty inline expression", line);
+    return;
+  }
+
+  // locate an assignment: a single = outside of quotes and parentheses
+  size_t eq = _NPOS, depth = 0, i, len = stmt.size();
+  for (i=0; i<len && eq == _NPOS; ++i) {
+    char c = stmt[i];
+    if (c == '"' || c == '\'') {
+      i = skip_quoted(stmt, i);
+      if (i == _NPOS) break;
+      --i;
+    }
+    else if (c == '(') ++depth;
+    else if (c == ')' && depth) --depth;
+    else if (c == '=' && !depth) {
+      bool comparison = (i+1 < len && stmt[i+1] == '=') ||
+	(i > 0 && (stmt[i-1] == '<' || stmt[i-1] == '>' || stmt[i-1] == '!' ||
+		   stmt[i-1] == '='));
+      if (comparison)
+	template_error("comparisons are not supported in '" + stmt +
+		       "'; use pyprepro for conditional templates", line);
+      eq = i;
+    }
+  }
+
+  Segment seg;
+  seg.line = line; seg.print = print; seg.target = 0; seg.assignOp = 0;
+  String expr = stmt;
+  if (eq == _NPOS) {
+    if (!print)
+      template_error("unsupported statement '" + stmt + "'; only assignments "
+		     "are supported, so use pyprepro for this template", line);
+    seg.type = EXPR_SEGMENT;
+  }
+  else {
+    String target = trim(stmt.substr(0, eq));
+    if (!target.empty()) {
+      char op = target[target.size()-1];
+      if (op == '+' || op == '-' || op == '*' || op == '/') {
+	seg.assignOp = (op == '+') ? ADD : (op == '-') ? SUBTRACT :
+	  (op == '*') ? MULTIPLY : DIVIDE;
+	target = trim(target.substr(0, target.size()-1));
+      }
+    }
+    target = variable_name(target);
+    bool valid = !target.empty() && is_name_start(target[0]);
+    for (i=1; valid && i<target.size(); ++i)
+      valid = is_name_char(target[i]);
+    if (!valid)
+      template_error("invalid assignment '" + stmt + "'", line);
+    seg.type   = ASSIGN_SEGMENT;
+    seg.target = symbol_index(target);
+    expr = stmt.substr(eq + 1);
+  }
+
+  Parser parser(*this, expr, line, seg.code);
+  parser.parse();
+  segments.push_back(seg);
+}
+
+
+void InputTemplate::append_text(const String& text)
+{
+  if (text.empty())
+    return;
+  if (!segments.empty() && segments.back().type == TEXT_SEGMENT)
+    segments.back().text += text;
+  else {
+    Segment seg;
+    seg.type = TEXT_SEGMENT; seg.text = text;
+    seg.target = 0; seg.assignOp = 0; seg.print = true; seg.line = 0;
+    segments.push_back(seg);
+  }
+}
+
+
+String InputTemplate::variable_name(const String& label)
+{
+  String name(trim(label));
+  for (char& c : name)
+    if (c == ':') c = '_';
+  if (!name.empty() && std::isdigit((unsigned char)name[0]))
+    name.insert(0, 1, 'i');
+  return name;
+}
+
+
+size_t InputTemplate::symbol_index(const String& name)
+{
+  size_t index = find_index(symbols, name);
+  if (index == _NPOS) {
+    index = symbols.size();
+    symbols.push_back(name);
+  }
+  return index;
+}
+
+
+size_t InputTemplate::constant_index(const TemplateValue& val)
+{
+  constants.push_back(val);
+  return constants.size() - 1;
+}
+
+
+void InputTemplate::render(const TemplateEnv& params, std::ostream& s) const
+{
+  // parameters are immutable; pi and e may be redefined by the template
+  size_t i, num_sym = symbols.size();
+  std::vector<TemplateValue> vals(num_sym);
+  BitArray defined(num_sym), immutable(num_sym);
+  for (i=0; i<num_sym; ++i) {
+    TemplateEnv::const_iterator p_it = params.find(symbols[i]);
+    if (p_it != params.end())
+      { vals[i] = p_it->second; defined.set(i); immutable.set(i); }
+    else if (symbols[i] == "pi")
+      { vals[i] = TemplateValue(std::acos(-1.)); defined.set(i); }
+    else if (symbols[i] == "e")
+      { vals[i] = TemplateValue(std::exp(1.)); defined.set(i); }
+  }
+
+  for (const Segment& seg : segments) {
+    switch (seg.type) {
+    case TEXT_SEGMENT:
+      s << seg.text; break;
+    case EXPR_SEGMENT:
+      write_value(s, evaluate(seg, vals, defined)); break;
+    case ASSIGN_SEGMENT: {
+      size_t t = seg.target;
+      if (!immutable[t]) {
+	TemplateValue val = evaluate(seg, vals, defined);
+	if (seg.assignOp) {
+	  if (!defined[t])
+	    template_error("undefined variable '" + symbols[t] + "'", seg.line);
+	  val = binary_op(seg.assignOp, vals[t], val, seg);
+	}
+	vals[t] = val; defined.set(t);
+      }
+      if (seg.print)
+	write_value(s, vals[t]);
+      break;
+    }
+    }
+  }
+}
+
+
+void InputTemplate::
+render(const TemplateEnv& params, const String& output_file) const
+{
+  std::ofstream output_stream(output_file.c_str());
+  if (!output_stream) {
+    Cerr << "\nError: cannot create template output file " << output_file
+	 << std::endl;
+    abort_handler(IO_ERROR);
+  }
+  render(params, output_stream);
+}
+
+
+TemplateValue InputTemplate::
+evaluate(const Segment& seg, std::vector<TemplateValue>& vals,
+	 const BitArray& defined) const
+{
+  std::vector<TemplateValue> stack;
+  for (const Instruction& instr : seg.code) {
+    switch (instr.op) {
+    case PUSH_CONST:
+      stack.push_back(constants[instr.arg]); break;
+    case PUSH_VAR:
+      if (!defined[instr.arg])
+	template_error("undefined variable '" + symbols[instr.arg] + "'",
+		       seg.line);
+      stack.push_back(vals[instr.arg]); break;
+    case NEGATE:
+      if (stack.back().isString)
+	template_error("cannot negate a string", seg.line);
+      stack.back().num = -stack.back().num; break;
+    case CALL: {
+      size_t j, num_args = instr.numArgs, first = stack.size() - num_args;
+      for (j=first; j<stack.size(); ++j)
+	if (stack[j].isString) {
+	  // float() and int() convert strings
+	  const String& str = stack[j].str;
+	  char* end;
+	  Real val = std::strtod(str.c_str(), &end);
+	  if ( (instr.arg != FN_FLOAT && instr.arg != FN_INT) ||
+	       str.empty() || *end != '\0' )
+	    template_error("invalid string argument '" + str + "' to " +
+			   templateFunctions[instr.arg].name, seg.line);
+	  stack[j] = TemplateValue(val);
+	}
+      Real x = stack[first].num, y = (num_args > 1) ? stack[first+1].num : 0.,
+	result = 0.;
+      switch (instr.arg) {
+      case FN_ABS: case FN_FABS: result = std::fabs(x);  break;
+      case FN_ACOS:    result = std::acos(x);            break;
+      case FN_ACOSH:   result = std::acosh(x);           break;
+      case FN_ASIN:    result = std::asin(x);            break;
+      case FN_ASINH:   result = std::asinh(x);           break;
+      case FN_ATAN:    result = std::atan(x);            break;
+      case FN_ATAN2:   result = std::atan2(x, y);        break;
+      case FN_ATANH:   result = std::atanh(x);           break;
+      case FN_CEIL:    result = std::ceil(x);            break;
+      case FN_COS:     result = std::cos(x);             break;
+      case FN_COSH:    result = std::cosh(x);            break;
+      case FN_DEGREES: result = x * 180. / std::acos(-1.); break;
+      case FN_EXP:     result = std::exp(x);             break;
+      case FN_FLOAT:   result = x;                       break;
+      case FN_FLOOR:   result = std::floor(x);           break;
+      case FN_HYPOT:   result = std::hypot(x, y);        break;
+      case FN_INT:     result = std::trunc(x);           break;
+      case FN_LOG:
+	result = (num_args > 1) ? std::log(x) / std::log(y) : std::log(x);
+	break;
+      case FN_LOG10:   result = std::log10(x);           break;
+      case FN_MAX: case FN_MIN:
+	result = x;
+	for (j=first+1; j<stack.size(); ++j)
+	  if ( (instr.arg == FN_MAX) ? (stack[j].num > result) :
+	                               (stack[j].num < result) )
+	    result = stack[j].num;
+	break;
+      case FN_POW:     result = std::pow(x, y);          break;
+      case FN_RADIANS: result = x * std::acos(-1.) / 180.; break;
+      case FN_ROUND: { // round half to even, as in Python 3
+	Real scale = std::pow(10., y);
+	result = (num_args > 1) ? std::nearbyint(x * scale) / scale :
+	  std::nearbyint(x);
+	break;
+      }
+      case FN_SIN:     result = std::sin(x);             break;
+      case FN_SINH:    result = std::sinh(x);            break;
+      case FN_SQRT:    result = std::sqrt(x);            break;
+      case FN_TAN:     result = std::tan(x);             break;
+      case FN_TANH:    result = std::tanh(x);            break;
+      }
+      stack.resize(first);
+      stack.push_back(TemplateValue(result));
+      break;
+    }
+    default: { // binary operators
+      TemplateValue rhs = stack.back();
+      stack.pop_back();
+      stack.back() = binary_op(instr.op, stack.back(), rhs, seg);
+      break;
+    }
+    }
+  }
+  return stack.back();
+}
+
+
+/** Strings may be concatenated with + and formatted with % as in
+    Python's printf-style formatting, for a single conversion. */
+TemplateValue InputTemplate::
+binary_op(unsigned short op, const TemplateValue& lhs,
+	  const TemplateValue& rhs, const Segment& seg) const
+{
+  if (lhs.isString || rhs.isString) {
+    if (op == ADD && lhs.isString && rhs.isString)
+      return TemplateValue(lhs.str + rhs.str);
+    if (op == MODULO && lhs.isString) {
+      // locate the single conversion in the format string
+      const String& fmt = lhs.str;
+      size_t i = 0, conv = _NPOS, len = fmt.size();
+      bool valid = true;
+      for ( ; valid && i < len; ++i)
+	if (fmt[i] == '%') {
+	  if (i+1 < len && fmt[i+1] == '%') { ++i; continue; }
+	  size_t j = i + 1;
+	  while (j < len && std::strchr("-+ #0", fmt[j])) ++j;
+	  while (j < len && std::isdigit((unsigned char)fmt[j])) ++j;
+	  if (j < len && fmt[j] == '.')
+	    for (++j; j < len && std::isdigit((unsigned char)fmt[j]); ) ++j;
+	  valid = (conv == _NPOS && j < len &&
+		   std::strchr("diouxXeEfFgGs", fmt[j]));
+	  conv = j; i = j;
+	}
+      if (valid && conv != _NPOS) {
+	char type = fmt[conv], buf[256];
+	String spec = fmt; // trailing text is formatted along with the spec
+	int n;
+	if (type == 's')
+	  n = (rhs.isString) ? std::snprintf(buf, sizeof(buf), spec.c_str(),
+					     rhs.str.c_str()) : -1;
+	else if (rhs.isString)
+	  n = -1;
+	else if (std::strchr("diouxX", type)) {
+	  if (type == 'i') spec[conv] = 'd';
+	  spec.insert(conv, "ll");
+	  n = std::snprintf(buf, sizeof(buf), spec.c_str(),
+			    (long long)std::trunc(rhs.num));
+	}
+	else
+	  n = std::snprintf(buf, sizeof(buf), spec.c_str(), rhs.num);
+	if (n >= 0 && n < (int)sizeof(buf))
+	  return TemplateValue(String(buf));
+	if (type == 's' && !rhs.isString) {
+	  std::ostringstream num_str;
+	  write_value(num_str, rhs);
+	  return binary_op(op, lhs, TemplateValue(num_str.str()), seg);
+	}
+      }
+      template_error("unsupported string format '" + fmt + "'", seg.line);
+    }
+    template_error("unsupported operation on a string", seg.line);
+  }
+
+  Real x = lhs.num, y = rhs.num;
+  switch (op) {
+  case ADD:      return TemplateValue(x + y);
+  case SUBTRACT: return TemplateValue(x - y);
+  case MULTIPLY: return TemplateValue(x * y);
+  case POWER:    return TemplateValue(std::pow(x, y));
+  default:
+    if (y == 0.)
+      template_error("division by zero", seg.line);
+    if (op == DIVIDE)
+      return TemplateValue(x / y);
+    if (op == FLOOR_DIVIDE)
+      return TemplateValue(std::floor(x / y));
+    // Python modulo takes the sign of the divisor
+    Real r = std::fmod(x, y);
+    if (r != 0. && ( (r < 0.) != (y < 0.) ))
+      r += y;
+    return TemplateValue(r);
+  }
+}
+
+
+void InputTemplate::write_value(std::ostream& s, const TemplateValue& val)
+{
+  if (val.isString)
+    s << val.str;
+  else {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%0.10g", val.num);
+    s << buf;
+  }
+}
+
+
+void InputTemplate::template_error(const String& msg, size_t line) const
+{
+  Cerr << "\nError: " << msg << " in template " << sourceName;
+  if (line)
+    Cerr << ", line " << line;
+  Cerr << '.' << std::endl;
+  abort_handler(INTERFACE_ERROR);
+}
+
+} // namespace Dakota
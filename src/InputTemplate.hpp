@@ -0,0 +1,177 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       InputTemplate
+//- Description: Compiled pyprepro-style template for simulation input files
+//- Owner:
+//- Version: $Id$
+
+#ifndef INPUT_TEMPLATE_H
+#define INPUT_TEMPLATE_H
+
+#include "dakota_data_types.hpp"
+#include <iosfwd>
+
+
+namespace Dakota {
+
+/// value of a template variable or expression: a number or a string
+struct TemplateValue
+{
+  TemplateValue(): isString(false), num(0.) { }
+  TemplateValue(Real val): isString(false), num(val) { }
+  TemplateValue(const String& val): isString(true), num(0.), str(val) { }
+
+  bool isString; ///< whether str (rather than num) holds the value
+  Real num;      ///< numerical value
+  String str;    ///< string value
+};
+
+/// parameter values passed to InputTemplate::render(), keyed by label
+typedef std::map<String, TemplateValue> TemplateEnv;
+
+
+/// Simulation input template in the pyprepro syntax, compiled once and
+/// rendered for each evaluation
+
+/** Supports the subset of pyprepro (dprepro) syntax that does not
+    require a Python interpreter: inline expressions {expr}, inline
+    assignments {name = expr} (which also output the value), compound
+    assignments (+=, -=, *=, /=), non-printing assignments in {% %}
+    blocks and in lines beginning with %, and escaped braces \\{ and
+    \\}.  Expressions combine numbers, quoted strings, and variables
+    with + - * / // % ** and parentheses, and may call the functions of
+    Python's math module that take real arguments (plus abs, min, max,
+    round, int, and float).  As in pyprepro, parameter values are
+    immutable, so template assignments to them only provide defaults,
+    and numbers are output in %0.10g format.  Control flow, includes,
+    and other Python code are rejected when the template is compiled;
+    such templates should be processed by pyprepro in an input filter or
+    analysis driver. */
+
+class InputTemplate
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  InputTemplate();  ///< default constructor
+  ~InputTemplate(); ///< destructor
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// read and compile template_file; the output file name is its file
+  /// name less any .template or .tmpl extension
+  void compile(const String& template_file);
+  /// compile the template text; source is used in error messages
+  void compile(const String& text, const String& source);
+
+  /// render the template to s, given the parameter values
+  void render(const TemplateEnv& params, std::ostream& s) const;
+  /// render the template to the file output_file
+  void render(const TemplateEnv& params, const String& output_file) const;
+
+  /// name of the file to generate in each work directory
+  const String& output_name() const;
+
+  /// transform a parameter label into a template variable name as
+  /// pyprepro does for assignments (':' to '_'; leading digit prefixed
+  /// with 'i')
+  static String variable_name(const String& label);
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// expression opcodes
+  enum { PUSH_CONST, PUSH_VAR, NEGATE, ADD, SUBTRACT, MULTIPLY, DIVIDE,
+	 FLOOR_DIVIDE, MODULO, POWER, CALL };
+  /// segment types
+  enum { TEXT_SEGMENT, EXPR_SEGMENT, ASSIGN_SEGMENT };
+
+  /// one step of a compiled (postfix) expression
+  struct Instruction {
+    unsigned short op; ///< opcode
+    size_t arg;        ///< constant, symbol, or function index
+    size_t numArgs;    ///< number of function arguments
+  };
+
+  /// literal text, an output expression, or an assignment
+  struct Segment {
+    unsigned short type;           ///< TEXT_SEGMENT, EXPR_SEGMENT, ...
+    String text;                   ///< literal text
+    size_t target;                 ///< assigned symbol index
+    unsigned short assignOp;       ///< 0 for =, else ADD, SUBTRACT, ...
+    bool print;                    ///< whether to output the assigned value
+    std::vector<Instruction> code; ///< compiled expression
+    size_t line;                   ///< line number in the template
+  };
+
+  /// recursive descent parser for a single expression or statement
+  class Parser;
+
+  /// compile a statement within {} (print) or {% %} / % (no print)
+  void compile_statement(const String& stmt, bool print, size_t line);
+  /// append literal text, merging with a preceding text segment
+  void append_text(const String& text);
+
+  /// index of symbol name, adding it if needed
+  size_t symbol_index(const String& name);
+  /// index of a new constant
+  size_t constant_index(const TemplateValue& val);
+
+  /// evaluate a compiled expression
+  TemplateValue evaluate(const Segment& seg, std::vector<TemplateValue>& vals,
+			 const BitArray& defined) const;
+  /// apply a binary operator
+  TemplateValue binary_op(unsigned short op, const TemplateValue& lhs,
+			  const TemplateValue& rhs, const Segment& seg) const;
+  /// format a value as pyprepro does
+  static void write_value(std::ostream& s, const TemplateValue& val);
+
+  /// report an error at line of the template and abort
+  void template_error(const String& msg, size_t line) const;
+
+  //
+  //- Heading: Data
+  //
+
+  /// template file (or other source) name used in error messages
+  String sourceName;
+  /// output file name
+  String outputName;
+  /// compiled template
+  std::vector<Segment> segments;
+  /// variable names referenced by the template
+  StringArray symbols;
+  /// literal values referenced by the template
+  std::vector<TemplateValue> constants;
+};
+
+
+inline InputTemplate::InputTemplate()
+{ }
+
+
+inline InputTemplate::~InputTemplate()
+{ }
+
+
+inline const String& InputTemplate::output_name() const
+{ return outputName; }
+
+} // namespace Dakota
+
+#endif
@@ -15,24 +15,69 @@
 #include "IteratorScheduler.hpp"
 #include "DakotaIterator.hpp"
 #include "ParallelLibrary.hpp"
+#include "ProgramOptions.hpp"
+#include "OutputManager.hpp"
+#include "EvaluationStore.hpp"
+#include "DakotaInterface.hpp"
+#include "WorkdirPool.hpp"
+#include "ResultsFileWatcher.hpp"
+#include "CommandShell.hpp"
+#include <algorithm>
+#if defined(HAVE_WORKING_FORK) && defined(HAVE_SYS_WAIT_H) && defined(HAVE_UNISTD_H)
+#define DAKOTA_LOCAL_ITERATOR_JOBS
+#include <sys/wait.h> // for waitpid
+#include <unistd.h>   // for fork, pipe, read, write, _exit
+#include <poll.h>     // for poll
+#include <cerrno>
+#include <cstring>
+#endif
 
 static const char rcsId[]="@(#) $Id: IteratorScheduler.cpp 6492 2009-12-19 00:04:28Z briadam $";
 
 
 namespace Dakota {
 
+extern EvaluationStore evaluation_store_db;
+
 /** Current constructor parameters are the input specification
     components, which are requests subject to override by
     ParallelLibrary::init_iterator_communicators(). */
 IteratorScheduler::
 IteratorScheduler(ParallelLibrary& parallel_lib, bool peer_assign_jobs,
-		  int num_servers, int procs_per_iterator, short scheduling):
+		  int num_servers, int procs_per_iterator, short scheduling,
+		  int local_concurrency):
   parallelLib(parallel_lib), numIteratorJobs(1),
   numIteratorServers(num_servers), procsPerIterator(procs_per_iterator),
   iteratorCommRank(0), iteratorCommSize(1), iteratorServerId(0),
   messagePass(false), iteratorScheduling(scheduling),//maxIteratorConcurrency(1)
-  peerAssignJobs(peer_assign_jobs), paramsMsgLen(0), resultsMsgLen(0)
+  peerAssignJobs(peer_assign_jobs), localIteratorConcurrency(local_concurrency),
+  paramsMsgLen(0), resultsMsgLen(0), nextLocalOutputJob(0)
 {
+  // Local concurrency forks the process holding the sub-iterator; disallow
+  // when fork is unavailable, when MPI is initialized (forking an MPI
+  // process is unsupported), or when children would share an HDF5 file.
+  if (localIteratorConcurrency > 1) {
+#ifdef DAKOTA_LOCAL_ITERATOR_JOBS
+    if (parallelLib.mpirun_flag()) {
+      Cerr << "\nWarning: local_iterator_concurrency is not supported in "
+	   << "MPI runs;\n         sub-iterator jobs will be executed "
+	   << "sequentially." << std::endl;
+      localIteratorConcurrency = 1;
+    }
+    else if (evaluation_store_db.active()) {
+      Cerr << "\nWarning: local_iterator_concurrency is not supported with "
+	   << "HDF5 evaluation storage;\n         sub-iterator jobs will be "
+	   << "executed sequentially." << std::endl;
+      localIteratorConcurrency = 1;
+    }
+#else
+    Cerr << "\nWarning: local_iterator_concurrency requires fork(), which is "
+	 << "not available on this\n         platform; sub-iterator jobs will "
+	 << "be executed sequentially." << std::endl;
+    localIteratorConcurrency = 1;
+#endif
+  }
+
   // Supported examples of a single level of concurrent iterators:
   //   ConcurrentMinimizer (multi_start, pareto_set), BranchBndMinimizer
   //   --> explicit parallelism management at Strat level
@@ -524,4 +569,264 @@ void IteratorScheduler::stop_iterator_servers()
   }
 }
 
+
+
+/** The child pushes an output tag unique to this job such that its
+    console output and restart records are written to tagged files
+    rather than interleaved with those of the parent and its siblings;
+    the parent merges the restart records and console output in
+    wait_local_job().
+
+    Background threads are not inherited by the child, so they are
+    quiesced first: the journal writers (the child then writes its
+    records synchronously) and the work directory pool threads (each
+    restarts on demand).  Surrogate prediction threads are joined
+    before their calls return, so none are active here. */
+bool IteratorScheduler::fork_local_job(int job_index)
+{
+#ifdef DAKOTA_LOCAL_ITERATOR_JOBS
+  // avoid duplicating buffered output or journaled records in the child
+  Cout.flush(); Cerr.flush();
+  OutputManager& output_mgr = parallelLib.output_manager();
+  output_mgr.suspend_journals();
+  WorkdirPool::suspend_all();
+
+  int pipe_fd[2];
+  if (pipe(pipe_fd) == -1) {
+    Cerr << "\nError: could not create pipe for local iterator job; error "
+	 << "code " << errno << " (" << std::strerror(errno) << ")" <<std::endl;
+    abort_handler(-1);
+  }
+
+  pid_t pid = fork();
+  if (pid == -1) {
+    Cerr << "\nError: could not fork local iterator job; error code " << errno
+	 << " (" << std::strerror(errno) << ")" << std::endl;
+    abort_handler(-1);
+  }
+
+  if (pid == 0) { // child
+    // pooled work directories, results file events, and child exit
+    // notifications remain the parent's
+    WorkdirPool::relinquish_all();
+    ResultsFileWatcher::reopen_all();
+    SpawnCommand::reopen_exit_notifier();
+
+    close(pipe_fd[0]);
+    // release the sibling pipes inherited from the parent
+    for (std::list<LocalIteratorJob>::iterator j_it = localJobs.begin();
+	 j_it != localJobs.end(); ++j_it)
+      close(j_it->pipeFD);
+    localJobs.clear();
+    localJobs.push_back(LocalIteratorJob());
+    localJobs.back().jobIndex = job_index;
+    localJobs.back().processId = 0;
+    localJobs.back().pipeFD = pipe_fd[1];
+
+    // restart from a tagged file would duplicate the parent's evaluations
+    ProgramOptions prog_opts(parallelLib.program_options());
+    prog_opts.read_restart_file("");
+    output_mgr.push_output_tag(".local" + std::to_string(getpid()),
+			       prog_opts, true, true);
+    return false;
+  }
+
+  // parent: retain the read end only
+  output_mgr.resume_journals();
+  close(pipe_fd[1]);
+  localJobs.push_back(LocalIteratorJob());
+  LocalIteratorJob& job = localJobs.back();
+  job.jobIndex = job_index; job.processId = pid; job.pipeFD = pipe_fd[0];
+  return true;
+#else
+  Cerr << "\nError: local iterator jobs require fork()." << std::endl;
+  abort_handler(-1);
+  return true;
+#endif
+}
+
+
+/** The interfaces of the simulation models underlying the sub-iterator
+    are visited in a fixed order, which is common to the parent and its
+    forked children. */
+void IteratorScheduler::
+sub_iterator_interfaces(Iterator& sub_iterator,
+			std::vector<Interface*>& interfaces)
+{
+  interfaces.clear();
+  Model& sub_model = sub_iterator.iterated_model();
+  if (sub_model.is_null())
+    return;
+  ModelList models(sub_model.subordinate_models(true));
+  models.push_front(sub_model);
+  for (ModelLIter m_it=models.begin(); m_it!=models.end(); ++m_it)
+    if (m_it->model_type() == "simulation") {
+      Interface* iface = &m_it->derived_interface();
+      if (std::find(interfaces.begin(), interfaces.end(), iface)
+	  == interfaces.end())
+	interfaces.push_back(iface);
+    }
+}
+
+
+void IteratorScheduler::
+local_job_counters(Iterator& sub_iterator, Int2DArray& counts)
+{
+  std::vector<Interface*> interfaces;
+  sub_iterator_interfaces(sub_iterator, interfaces);
+  size_t i, num_iface = interfaces.size();
+  counts.resize(num_iface);
+  for (i=0; i<num_iface; ++i)
+    interfaces[i]->evaluation_counters(counts[i]);
+}
+
+
+/** Only the evaluations performed by the job, relative to the counters
+    inherited at fork, are returned to the parent. */
+void IteratorScheduler::
+pack_local_job_counters(MPIPackBuffer& send_buffer, Iterator& sub_iterator,
+			const Int2DArray& fork_counts)
+{
+  Int2DArray counts;
+  local_job_counters(sub_iterator, counts);
+  for (size_t i=0; i<counts.size() && i<fork_counts.size(); ++i)
+    for (size_t j=0; j<counts[i].size() && j<fork_counts[i].size(); ++j)
+      counts[i][j] -= fork_counts[i][j];
+  send_buffer << counts;
+}
+
+
+void IteratorScheduler::
+unpack_local_job_counters(MPIUnpackBuffer& recv_buffer, Iterator& sub_iterator)
+{
+  Int2DArray counts;
+  recv_buffer >> counts;
+  std::vector<Interface*> interfaces;
+  sub_iterator_interfaces(sub_iterator, interfaces);
+  for (size_t i=0; i<counts.size() && i<interfaces.size(); ++i)
+    interfaces[i]->increment_evaluation_counters(counts[i]);
+}
+
+
+void IteratorScheduler::exit_local_job(MPIPackBuffer& send_buffer)
+{
+#ifdef DAKOTA_LOCAL_ITERATOR_JOBS
+  int fd = localJobs.back().pipeFD, len = send_buffer.size(), status = 0;
+  // length header followed by the packed results
+  const char* chunks[2] = { reinterpret_cast<const char*>(&len),
+			    send_buffer.buf() };
+  size_t sizes[2] = { sizeof(int), (size_t)len };
+  for (size_t c=0; c<2 && !status; ++c) {
+    size_t sent = 0;
+    while (sent < sizes[c]) {
+      ssize_t n = write(fd, chunks[c] + sent, sizes[c] - sent);
+      if (n > 0)
+	sent += n;
+      else if (n == -1 && errno == EINTR)
+	continue;
+      else
+	{ status = 1; break; }
+    }
+  }
+  close(fd);
+
+  // close the tagged output and restart streams prior to exit
+  parallelLib.output_manager().pop_output_tag();
+  Cout.flush(); Cerr.flush();
+  // bypass atexit handlers and static destructors owned by the parent
+  _exit(status);
+#endif
+}
+
+
+int IteratorScheduler::wait_local_job(MPIUnpackBuffer& recv_buffer)
+{
+#ifdef DAKOTA_LOCAL_ITERATOR_JOBS
+  size_t i, num_jobs = localJobs.size();
+  std::vector<struct pollfd> poll_fds(num_jobs);
+  std::list<LocalIteratorJob>::iterator j_it;
+  char chunk[65536];
+  while (true) {
+    for (i=0, j_it=localJobs.begin(); i<num_jobs; ++i, ++j_it) {
+      poll_fds[i].fd = j_it->pipeFD;
+      poll_fds[i].events = POLLIN; poll_fds[i].revents = 0;
+    }
+    if (poll(&poll_fds[0], num_jobs, -1) == -1) {
+      if (errno == EINTR) continue;
+      Cerr << "\nError: poll failed for local iterator jobs; error code "
+	   << errno << " (" << std::strerror(errno) << ")" << std::endl;
+      abort_handler(-1);
+    }
+
+    // drain available data; a closed pipe denotes a completed job
+    for (i=0, j_it=localJobs.begin(); i<num_jobs; ++i, ++j_it) {
+      if (!poll_fds[i].revents)
+	continue;
+      ssize_t n = read(j_it->pipeFD, chunk, sizeof(chunk));
+      if (n > 0)
+	j_it->results.insert(j_it->results.end(), chunk, chunk + n);
+      else if (n == 0 || errno != EINTR) {
+	close(j_it->pipeFD);
+	int status = 0;
+	while (waitpid(j_it->processId, &status, 0) == -1 && errno == EINTR)
+	  ;
+	int len = 0;
+	if (j_it->results.size() >= sizeof(int))
+	  std::memcpy(&len, &j_it->results[0], sizeof(int));
+	if ( !WIFEXITED(status) || WEXITSTATUS(status) ||
+	     j_it->results.size() != sizeof(int) + (size_t)len ) {
+	  Cerr << "\nError: local iterator job " << j_it->jobIndex + 1
+	       << " (process " << j_it->processId << ") failed to return "
+	       << "results." << std::endl;
+	  abort_handler(-1);
+	}
+	char* buf = new char [len];
+	if (len)
+	  std::memcpy(buf, &j_it->results[sizeof(int)], len);
+	recv_buffer.setup(buf, len, true);
+
+	// append the job's restart records to the parent's restart file
+	OutputManager& output_mgr = parallelLib.output_manager();
+	output_mgr.merge_restart(
+	  parallelLib.program_options().write_restart_file() +
+	  output_mgr.build_output_tag() + ".local" +
+	  std::to_string(j_it->processId));
+
+	int job_index = j_it->jobIndex;
+	merge_local_job_output(job_index, j_it->processId);
+	localJobs.erase(j_it);
+	return job_index;
+      }
+    }
+  }
+#else
+  Cerr << "\nError: local iterator jobs require fork()." << std::endl;
+  abort_handler(-1);
+  return 0;
+#endif
+}
+
+/** Jobs complete in any order, but their console output is appended in
+    job order, as for sequential execution: a job's output is held back
+    until those of all earlier jobs have been merged. */
+void IteratorScheduler::merge_local_job_output(int job_index, int process_id)
+{
+  reapedLocalJobs[job_index] = process_id;
+
+  OutputManager& output_mgr = parallelLib.output_manager();
+  const ProgramOptions& prog_opts = parallelLib.program_options();
+  IntIntMIter r_it = reapedLocalJobs.begin();
+  while (r_it != reapedLocalJobs.end() && r_it->first == nextLocalOutputJob) {
+    String job_tag
+      = output_mgr.build_output_tag() + ".local" + std::to_string(r_it->second);
+    Cout << "\n>>>>> Output of local iterator job " << r_it->first + 1
+	 << " (process " << r_it->second << "):\n";
+    output_mgr.merge_output(prog_opts.output_file() + job_tag, Cout);
+    if (!prog_opts.error_file().empty())
+      output_mgr.merge_output(prog_opts.error_file() + job_tag, Cerr);
+    reapedLocalJobs.erase(r_it++);
+    ++nextLocalOutputJob;
+  }
+}
+
 } // namespace Dakota
@@ -23,6 +23,7 @@
 
 namespace Dakota {
 
+class Interface;
 class Iterator;
 class Model;
 class ProblemDescDB;
@@ -48,7 +49,8 @@ public:
   /// constructor
   IteratorScheduler(ParallelLibrary& parallel_lib, bool peer_assign_jobs,
 		    int num_servers = 0, int procs_per_iterator = 0,
-		    short scheduling = DEFAULT_SCHEDULING);
+		    short scheduling = DEFAULT_SCHEDULING,
+		    int local_concurrency = 1);
   /// destructor
   ~IteratorScheduler();
     
@@ -147,6 +149,16 @@ public:
   template <typename MetaType>
   void peer_static_schedule_iterators(MetaType& meta_object,
 				      Iterator& sub_iterator);
+  /// executed on a single (non-message-passing) iterator server to
+  /// overlap up to localIteratorConcurrency iterator jobs using forked
+  /// copies of the sub-iterator and its sub-model
+  template <typename MetaType>
+  void local_concurrent_schedule_iterators(MetaType& meta_object,
+					   Iterator& sub_iterator);
+
+  /// determines if the current job set can be scheduled using
+  /// local_concurrent_schedule_iterators()
+  bool local_concurrency() const;
 
   /// update schedPCIter
   void update(ParConfigLIter pc_iter);
@@ -182,6 +194,9 @@ public:
   //int maxIteratorConcurrency; // max concurrency possible in meta-algorithm
   bool peerAssignJobs;      ///< flag indicating need for peer 1 to assign jobs
                             ///< to peers 2-n
+  int localIteratorConcurrency; ///< number of iterator jobs to overlap within
+                                ///< a single iterator server using forked
+                                ///< processes (1 = sequential)
 
   ParConfigLIter schedPCIter; ///< iterator for active parallel configuration
   size_t miPLIndex;         ///< index of active parallel level (corresponding
@@ -194,12 +209,56 @@ private:
   //- Heading: Convenience member functions
   //
 
+  /// flush output and fork a process for a local iterator job; returns
+  /// true in the parent and false in the child
+  bool fork_local_job(int job_index);
+  /// send the packed results of a local iterator job to the parent and
+  /// terminate the child process (does not return)
+  void exit_local_job(MPIPackBuffer& send_buffer);
+  /// block until a local iterator job completes, load its packed results
+  /// into recv_buffer, merge its restart records, and return its job index
+  int wait_local_job(MPIUnpackBuffer& recv_buffer);
+  /// append the console output of a reaped local iterator job, together
+  /// with that of any later jobs it was holding back, to the parent streams
+  void merge_local_job_output(int job_index, int process_id);
+
+  /// collect the distinct interfaces of the simulation models underlying
+  /// the model of sub_iterator
+  void sub_iterator_interfaces(Iterator& sub_iterator,
+			       std::vector<Interface*>& interfaces);
+  /// retrieve the evaluation counters of sub_iterator_interfaces()
+  void local_job_counters(Iterator& sub_iterator, Int2DArray& counts);
+  /// pack the evaluations performed by a local iterator job since
+  /// fork_counts were retrieved
+  void pack_local_job_counters(MPIPackBuffer& send_buffer,
+			       Iterator& sub_iterator,
+			       const Int2DArray& fork_counts);
+  /// add the evaluations performed by a local iterator job to the
+  /// counters of the parent's interfaces
+  void unpack_local_job_counters(MPIUnpackBuffer& recv_buffer,
+				 Iterator& sub_iterator);
+
   //
   //- Heading: Data members
   //
 
   int  paramsMsgLen; ///< length of MPI buffer for parameter input instance(s)
   int resultsMsgLen; ///< length of MPI buffer for results  output instance(s)
+
+  /// bookkeeping for an in-progress local iterator job
+  struct LocalIteratorJob {
+    int jobIndex;               ///< index of the iterator job
+    int processId;              ///< process id of the forked child
+    int pipeFD;                 ///< read end of the results pipe
+    std::vector<char> results;  ///< packed results received so far
+  };
+  /// in-progress jobs from local_concurrent_schedule_iterators()
+  std::list<LocalIteratorJob> localJobs;
+  /// reaped jobs (job index to process id) whose console output awaits
+  /// that of an earlier job
+  IntIntMap reapedLocalJobs;
+  /// index of the next job whose console output is merged
+  int nextLocalOutputJob;
 };
 
 
@@ -317,7 +376,10 @@ schedule_iterators(MetaType& meta_object, Iterator& sub_iterator)
       serve_iterators(meta_object, sub_iterator);
   }
   else { // static scheduling of iterator jobs
-    if (iteratorServerId <= numIteratorServers) {
+    if (local_concurrency())
+      // single iterator server: overlap jobs using forked processes
+      local_concurrent_schedule_iterators(meta_object, sub_iterator);
+    else if (iteratorServerId <= numIteratorServers) {
       // jobs are not assigned by messages: stop_iterator_servers() is only
       // required for an idle server partition
       peer_static_schedule_iterators(meta_object, sub_iterator);
@@ -549,6 +611,50 @@ serve_iterators(MetaType& meta_object, Iterator& sub_iterator)
 }
 
 
+/** Each job is executed by a forked child holding a copy-on-write image
+    of the sub-iterator and sub-model, such that the jobs are independent
+    and no state is shared among them.  The child packs its results as
+    for serve_iterators() and returns them to the parent over a pipe. */
+template <typename MetaType> void IteratorScheduler::
+local_concurrent_schedule_iterators(MetaType& meta_object,
+				    Iterator& sub_iterator)
+{
+  Cout << "\nLocal iterator scheduling: " << numIteratorJobs << " jobs with "
+       << "concurrency " << localIteratorConcurrency << std::endl;
+
+  int i = 0; nextLocalOutputJob = 0;
+  while (i < numIteratorJobs || !localJobs.empty()) {
+    // launch jobs up to the local concurrency
+    for (; i < numIteratorJobs &&
+	   localJobs.size() < (size_t)localIteratorConcurrency; ++i)
+      if (!fork_local_job(i)) { // child: run the job and exit
+	Int2DArray fork_counts;
+	local_job_counters(sub_iterator, fork_counts);
+	meta_object.initialize_iterator(i);
+	run_iterator(sub_iterator);
+	meta_object.update_local_results(i);
+	MPIPackBuffer send_buffer;
+	meta_object.pack_results_buffer(send_buffer, i);
+	pack_local_job_counters(send_buffer, sub_iterator, fork_counts);
+	exit_local_job(send_buffer);
+      }
+
+    // recover a completed job (parent), including its evaluation counts
+    MPIUnpackBuffer recv_buffer;
+    int job_index = wait_local_job(recv_buffer);
+    meta_object.unpack_results_buffer(recv_buffer, job_index);
+    unpack_local_job_counters(recv_buffer, sub_iterator);
+  }
+}
+
+
+inline bool IteratorScheduler::local_concurrency() const
+{
+  return ( localIteratorConcurrency > 1 && numIteratorJobs > 1 &&
+	   !messagePass && iteratorCommSize == 1 );
+}
+
+
 inline void IteratorScheduler::
 iterator_message_lengths(int params_msg_len, int results_msg_len)
 { paramsMsgLen = params_msg_len; resultsMsgLen = results_msg_len; }
@@ -121,7 +121,12 @@ Includes
 #include <../Utilities/include/SingleObjectiveStatistician.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <set>
 #include <sstream>
+#include <thread>
 
 /*
 ===============================================================================
@@ -192,6 +197,31 @@ class JEGAOptimizer::Evaluator :
          */
         Model& _model;
 
+        /// Whether to use steady-state (non-generational) evaluation.
+        /**
+         * Only honored when the model supports asynchronous evaluation.
+         */
+        bool _steadyState;
+
+        /**
+         * \brief The fraction of the designs submitted by a call to
+         *        Evaluate that must complete before control is returned to
+         *        the GA in steady-state mode.
+         */
+        double _completionFraction;
+
+        /**
+         * \brief Designs submitted for asynchronous evaluation whose
+         *        responses have not yet been recorded, keyed by the Dakota
+         *        model evaluation id.
+         *
+         * In steady-state mode, designs still in flight when Evaluate
+         * returns are removed from their group and held here until their
+         * responses arrive, at which point they are merged into the group
+         * passed to the next call to Evaluate.
+         */
+        std::map<int, Design*> _pendingDesigns;
+
     /*
     ===========================================================================
     Public Methods
@@ -331,6 +361,67 @@ class JEGAOptimizer::Evaluator :
                    this->_model.num_linear_ineq_constraints();
         }
 
+        /**
+         * \brief Sets the current variable values of the model to those of
+         *        \a des.
+         *
+         * \param des The Design whose variables are to be evaluated.
+         * \param contVars Workspace for the continuous variables.
+         * \param discIntVars Workspace for the discrete integer variables.
+         * \param discRealVars Workspace for the discrete real variables.
+         * \param discStringVars Workspace for the discrete string variables.
+         */
+        void
+        LoadModelVariables(
+            const Design& des,
+            RealVector& contVars,
+            IntVector&  discIntVars,
+            RealVector& discRealVars,
+            StringMultiArray& discStringVars
+            );
+
+        /**
+         * \brief Records the responses of completed asynchronous evaluations
+         *        into their pending Designs.
+         *
+         * Designs that were submitted by a previous call to Evaluate (and
+         * were therefore removed from their group) are inserted into
+         * \a group so that they take part in the upcoming selection.
+         *
+         * \param responseMap The completed evaluations returned by Dakota.
+         * \param group The group currently being evaluated.
+         * \param submitted The Designs submitted by the current call to
+         *                  Evaluate, which are already members of \a group.
+         * \return The number of Designs whose responses were recorded.
+         */
+        std::size_t
+        RecordCompletions(
+            const IntResponseMap& responseMap,
+            DesignGroup& group,
+            const std::set<Design*>& submitted
+            );
+
+        /**
+         * \brief Evaluates \a group without waiting for the slowest
+         *        evaluations to complete.
+         *
+         * All unevaluated Designs are submitted at once and Dakota is polled
+         * using Model::synchronize_nowait, which launches queued evaluations
+         * as servers free up.  No new Designs are created while waiting;
+         * control returns to the GA as soon as the requested fraction of
+         * completions has been recorded, counting late completions from
+         * earlier calls which are merged into \a group.  Designs still in
+         * flight are removed from \a group and carried over to the next call.
+         *
+         * \param group The group of Design class objects to be evaluated.
+         * \return true if all evaluations were requested and false if the
+         *         evaluation budget was exhausted.
+         */
+        bool
+        EvaluateSteadyState(
+            DesignGroup& group
+            );
+
     /*
     ===========================================================================
     Subclass Overridable Methods
@@ -338,6 +429,18 @@ class JEGAOptimizer::Evaluator :
     */
     public:
 
+        /**
+         * \brief Waits for all evaluations still in flight from steady-state
+         *        mode and returns their Designs to the target.
+         *
+         * This is called when the evaluator is destroyed after the GA has
+         * finished iterating so that no outstanding jobs remain in the Dakota
+         * model's queues.
+         */
+        void
+        DrainPendingEvaluations(
+            );
+
         /// Does evaluation of each design in \a group.
         /**
          * This method uses the Model known by this class to get Designs
@@ -437,6 +540,21 @@ class JEGAOptimizer::Evaluator :
             return new Evaluator(*this, algorithm, _model);
         }
 
+        /**
+         * \brief Returns true if this evaluator will run in steady-state
+         *        mode.
+         *
+         * \return True if steady-state evaluation was requested and the
+         *         model is capable of asynchronous evaluation.
+         */
+        bool
+        SteadyStateEnabled(
+            ) const
+        {
+            EDDY_FUNC_DEBUGSCOPE
+            return this->_steadyState && this->_model.asynch_flag();
+        }
+
 
     /*
     ===========================================================================
@@ -452,13 +570,21 @@ class JEGAOptimizer::Evaluator :
          *
          * \param algorithm The GA for which the new evaluator is to be used.
          * \param model The model through which evaluations will be done.
+         * \param steadyState Whether to use steady-state evaluation.
+         * \param completionFraction The fraction of submitted designs that
+         *                           must complete before returning to the GA
+         *                           in steady-state mode.
          */
         Evaluator(
             GeneticAlgorithm& algorithm,
-            Model& model
+            Model& model,
+            bool steadyState = false,
+            double completionFraction = 1.0
             ) :
                 GeneticAlgorithmEvaluator(algorithm),
-                _model(model)
+                _model(model),
+                _steadyState(steadyState),
+                _completionFraction(completionFraction)
         {
             EDDY_FUNC_DEBUGSCOPE
         }
@@ -473,7 +599,9 @@ class JEGAOptimizer::Evaluator :
             const Evaluator& copy
             ) :
                 GeneticAlgorithmEvaluator(copy),
-                _model(copy._model)
+                _model(copy._model),
+                _steadyState(copy._steadyState),
+                _completionFraction(copy._completionFraction)
         {
             EDDY_FUNC_DEBUGSCOPE
         }
@@ -494,11 +622,25 @@ class JEGAOptimizer::Evaluator :
             Model& model
             ) :
                 GeneticAlgorithmEvaluator(copy, algorithm),
-                _model(model)
+                _model(model),
+                _steadyState(copy._steadyState),
+                _completionFraction(copy._completionFraction)
         {
             EDDY_FUNC_DEBUGSCOPE
         }
 
+        /// Destructs an Evaluator.
+        /**
+         * Any evaluations still in flight are completed and discarded.
+         */
+        virtual
+        ~Evaluator(
+            )
+        {
+            EDDY_FUNC_DEBUGSCOPE
+            this->DrainPendingEvaluations();
+        }
+
     private:
 
         /// This constructor has no implementation and cannot be used.
@@ -536,6 +678,15 @@ class JEGAOptimizer::EvaluatorCreator :
          */
         Model& _theModel;
 
+        /// Whether created evaluators should use steady-state evaluation.
+        bool _steadyState;
+
+        /**
+         * \brief The completion fraction passed to created evaluators for
+         *        steady-state evaluation.
+         */
+        double _completionFraction;
+
     /*
     ===========================================================================
     Subclass Overridable Methods
@@ -560,7 +711,8 @@ class JEGAOptimizer::EvaluatorCreator :
             )
         {
             EDDY_FUNC_DEBUGSCOPE
-	      return new Evaluator(alg, _theModel);
+	      return new Evaluator(alg, _theModel, _steadyState,
+				   _completionFraction);
         }
 
     /*
@@ -575,11 +727,18 @@ class JEGAOptimizer::EvaluatorCreator :
          *
          * \param theModel The Dakota::Model this creator will pass to the
          *                 created evaluator.
+         * \param steadyState Whether created evaluators should use
+         *                    steady-state evaluation.
+         * \param completionFraction The steady-state completion fraction.
          */
         EvaluatorCreator(
-            Model& theModel
+            Model& theModel,
+            bool steadyState = false,
+            double completionFraction = 1.0
             ) :
-                _theModel(theModel)
+                _theModel(theModel),
+                _steadyState(steadyState),
+                _completionFraction(completionFraction)
         {
             EDDY_FUNC_DEBUGSCOPE
         }
@@ -890,7 +1049,8 @@ JEGAOptimizer::core_run(
             "results have been passed back to DAKOTA.\n\n")
         )
 
-    // We can not destroy our GA.
+    // We can not destroy our GA.  In steady-state mode, this also completes
+    // and discards any late evaluations still in flight (see ~Evaluator).
     driver.DestroyAlgorithm(theGA);
 }
 
@@ -1949,8 +2109,17 @@ JEGAOptimizer::JEGAOptimizer(
       this->numFinalSolutions
 	= std::numeric_limits<std::size_t>::max(); // moga returns all Pareto
 
+    // Steady-state evaluation requires an asynchronous model; otherwise the
+    // generational evaluation is used.
+    bool steady_state = probDescDB.get_bool("method.jega.steady_state");
+    if (steady_state && !iteratedModel.asynch_flag())
+      Cerr << "\nWarning: JEGA steady_state evaluation requires asynchronous "
+	   << "evaluations;\n         using generational evaluation.\n"
+	   << std::endl;
+
     // We only ever need one EvaluatorCreator so we can create it now.
-    this->_theEvalCreator = new EvaluatorCreator(iteratedModel);
+    this->_theEvalCreator = new EvaluatorCreator(iteratedModel, steady_state,
+      probDescDB.get_real("method.jega.steady_state.completion_fraction"));
 }
 
 JEGAOptimizer::~JEGAOptimizer(
@@ -2088,6 +2257,196 @@ JEGAOptimizer::Evaluator::RecordResponses(
     }
 }
 
+void
+JEGAOptimizer::Evaluator::LoadModelVariables(
+    const Design& des,
+    RealVector& contVars,
+    IntVector&  discIntVars,
+    RealVector& discRealVars,
+    StringMultiArray& discStringVars
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    // extract the real and continuous variables
+    // from the current Design
+    this->SeparateVariables(des, contVars, discIntVars, discRealVars,
+        discStringVars);
+
+    this->_model.continuous_variables(contVars);
+    this->_model.discrete_int_variables(discIntVars);
+    this->_model.discrete_real_variables(discRealVars);
+    // Strings set by calling single value setter for each
+    for (size_t i=0; i<discStringVars.num_elements(); ++i)
+      this->_model.discrete_string_variable(discStringVars[i],i);
+    // Could use discrete_string_varables to avoid overhead of repeated 
+    // function calls, but it takes a StringMultiArrayConstView, which
+    // must be created from discStringVars. Maybe there's a simpler way,
+    // but...
+    // const size_t &dsv_len = discStringVars.num_elements();
+    // StringMultiArrayConstView dsv_view = discStringVars[ 
+    //   boost::indices[idx_range(0,dsv_len)]];
+    // this->_model.discrete_string_variables(dsv_view);
+}
+
+std::size_t
+JEGAOptimizer::Evaluator::RecordCompletions(
+    const IntResponseMap& responseMap,
+    DesignGroup& group,
+    const std::set<Design*>& submitted
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    const DesignTarget& target = this->GetDesignTarget();
+    std::size_t num_recorded = 0;
+
+    for(IntRespMCIter r_cit = responseMap.begin();
+        r_cit != responseMap.end(); ++r_cit)
+    {
+        std::map<int, Design*>::iterator p_it =
+            this->_pendingDesigns.find(r_cit->first);
+        if(p_it == this->_pendingDesigns.end()) continue;
+
+        Design* des = p_it->second;
+        this->_pendingDesigns.erase(p_it);
+
+        // Put the responses into the Design properly.
+        this->RecordResponses(r_cit->second.function_values(), *des);
+        des->SetEvaluated(true);
+        target.CheckFeasibility(*des);
+        this->IncrementNumberEvaluations();
+
+        // A late arrival from a previous generation joins the current group
+        // so that it competes in the upcoming selection.
+        if(submitted.find(des) == submitted.end()) group.Insert(des);
+
+        ++num_recorded;
+    }
+
+    return num_recorded;
+}
+
+bool
+JEGAOptimizer::Evaluator::EvaluateSteadyState(
+    DesignGroup& group
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    JEGALOG_II(this->GetLogger(), ldebug(), this,
+        ostream_entry(ldebug(), this->GetName() + ": Performing steady-state "
+            "group evaluation with ") << this->_pendingDesigns.size()
+            << " evaluations carried over."
+        )
+
+    if(group.IsEmpty() && this->_pendingDesigns.empty()) return true;
+
+    // first, let's see if we can avoid any evaluations.
+    if(!group.IsEmpty()) ResolveClones(group);
+
+    RealVector       contVars;
+    IntVector        discIntVars;
+    RealVector       discRealVars;
+    StringMultiArray discStringVars;
+
+    const DesignTarget& target = this->GetDesignTarget();
+    const ConstraintInfoVector& cninfos = target.GetConstraintInfos();
+    ConstraintInfoVector::const_iterator flincn(
+        cninfos.begin() + this->GetNumberNonLinearConstraints()
+        );
+    ConstraintInfoVector::const_iterator cit;
+
+    // completed evaluations plus those in flight count against the budget
+    const eddy::utilities::uint64_t priorReqs =
+        this->GetNumberEvaluations() + this->_pendingDesigns.size();
+    eddy::utilities::uint64_t numEvalReqs = 0;
+
+    bool ret = true;
+    std::set<Design*> submitted;
+
+    // Submit every unevaluated Design at once; Dakota launches them as
+    // evaluation servers become available.
+    const DesignDVSortSet::const_iterator e(group.EndDV());
+    for(DesignDVSortSet::const_iterator it(group.BeginDV()); it!=e; ++it)
+    {
+        if((*it)->IsEvaluated()) continue;
+
+        if((priorReqs + numEvalReqs) >= this->GetMaxEvaluations())
+        {
+            (*it)->SetEvaluated(true);
+            (*it)->SetIllconditioned(true);
+            ret = false;
+            continue;
+        }
+
+        this->LoadModelVariables(**it, contVars, discIntVars, discRealVars,
+            discStringVars);
+        this->_model.evaluate_nowait();
+        this->_pendingDesigns[this->_model.evaluation_id()] = *it;
+        submitted.insert(*it);
+        ++numEvalReqs;
+
+        // linear constraints are computed locally (see Evaluate)
+        for(cit=flincn; cit!=cninfos.end(); ++cit)
+        {
+            (*cit)->EvaluateConstraint(**it);
+            (*cit)->RecordViolation(**it);
+        }
+    }
+
+    // Wait for the requested fraction of this call's submissions, counting
+    // late arrivals from earlier calls, but never for the slowest stragglers.
+    // With nothing newly submitted, only merge what has already completed.
+    const std::size_t num_required = (numEvalReqs == 0) ? 0 :
+        std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(
+            this->_completionFraction * static_cast<double>(numEvalReqs))));
+    std::size_t num_completed = 0;
+    while(!this->_pendingDesigns.empty())
+    {
+        const std::size_t num_new = this->RecordCompletions(
+            this->_model.synchronize_nowait(), group, submitted
+            );
+        num_completed += num_new;
+        if(num_completed >= num_required) break;
+        if(num_new == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Designs from this call that are still in flight leave the group; they
+    // are merged back by a later call once their responses arrive.
+    for(std::set<Design*>::const_iterator s_it(submitted.begin());
+        s_it!=submitted.end(); ++s_it)
+        if(!(*s_it)->IsEvaluated()) group.Erase(*s_it);
+
+    JEGALOG_II(this->GetLogger(), ldebug(), this,
+        ostream_entry(ldebug(), this->GetName() + ": steady-state evaluation "
+            "recorded ") << num_completed << " completions; "
+            << this->_pendingDesigns.size() << " evaluations remain in flight."
+        )
+
+    return ret;
+}
+
+void
+JEGAOptimizer::Evaluator::DrainPendingEvaluations(
+    )
+{
+    EDDY_FUNC_DEBUGSCOPE
+
+    if(this->_pendingDesigns.empty()) return;
+
+    // Blocking synchronize clears all outstanding jobs from the model.  The
+    // results are counted but the Designs are no longer part of the GA.
+    const IntResponseMap& response_map = this->_model.synchronize();
+    this->IncrementNumberEvaluations(response_map.size());
+
+    for(std::map<int, Design*>::iterator p_it=this->_pendingDesigns.begin();
+        p_it!=this->_pendingDesigns.end(); ++p_it)
+        this->GetDesignTarget().TakeDesign(p_it->second);
+    this->_pendingDesigns.clear();
+}
+
 bool
 JEGAOptimizer::Evaluator::Evaluate(
     DesignGroup& group
@@ -2099,6 +2458,10 @@ JEGAOptimizer::Evaluator::Evaluate(
         text_entry(ldebug(), this->GetName() + ": Performing group evaluation.")
         )
 
+    // steady-state evaluation takes care of its own trivial conditions
+    // since late completions may need to be merged into an empty group.
+    if(this->SteadyStateEnabled()) return this->EvaluateSteadyState(group);
+
     // check for trivial abort conditions
     if(group.IsEmpty()) return true;
 
@@ -2159,29 +2522,12 @@ JEGAOptimizer::Evaluator::Evaluate(
             continue;
         }
 
-        // extract the real and continuous variables
-        // from the current Design
-        this->SeparateVariables(**it, contVars, discIntVars, discRealVars,
-	    discStringVars);
-
         // send this guy out for evaluation using the _model.
 
         // first, set the current values of the variables in the model
-        this->_model.continuous_variables(contVars);
-        this->_model.discrete_int_variables(discIntVars);
-        this->_model.discrete_real_variables(discRealVars);
-	// Strings set by calling single value setter for each
-	for (size_t i=0; i<discStringVars.num_elements(); ++i)
-	  this->_model.discrete_string_variable(discStringVars[i],i);
-	// Could use discrete_string_varables to avoid overhead of repeated 
-	// function calls, but it takes a StringMultiArrayConstView, which
-	// must be created from discStringVars. Maybe there's a simpler way,
-	// but...
-	// const size_t &dsv_len = discStringVars.num_elements();
-	// StringMultiArrayConstView dsv_view = discStringVars[ 
-	//   boost::indices[idx_range(0,dsv_len)]];
-        // this->_model.discrete_string_variables(dsv_view);
-	
+        this->LoadModelVariables(**it, contVars, discIntVars, discRealVars,
+            discStringVars);
+
         // now request the evaluation in synchronous or asyncronous mode.
         if(this->_model.asynch_flag())
         {
@@ -15,6 +15,7 @@
 #include <cctype>
 #include "dakota_system_defs.hpp"
 #include "MPIManager.hpp"
+#include "MPIPackBuffer.hpp"
 #include "dakota_data_types.hpp"
 #include "dakota_global_defs.hpp"
 
@@ -39,6 +40,7 @@ MPIManager::MPIManager():
     MPI_Comm_size(dakotaMPIComm, &dakotaWorldSize);
   }
 #endif
+  mpi_packing(mpirunFlag);
 }
 
 
@@ -60,6 +62,7 @@ MPIManager::MPIManager(int& argc, char**& argv):
     MPI_Comm_size(dakotaMPIComm, &dakotaWorldSize);
   }
 #endif
+  mpi_packing(mpirunFlag);
 }
 
 
@@ -77,6 +80,7 @@ MPIManager::MPIManager(MPI_Comm dakota_mpi_comm):
     MPI_Comm_size(dakotaMPIComm, &dakotaWorldSize);
   }
 #endif
+  mpi_packing(mpirunFlag);
 }
 
 
@@ -85,7 +89,7 @@ MPIManager::~MPIManager()
 #ifdef DAKOTA_HAVE_MPI
   // call MPI_Finalize only if DAKOTA called MPI_Init
   if (mpirunFlag && ownMPIFlag)
-    MPI_Finalize();
+    { MPI_Finalize(); mpi_packing(false); }
 #endif // DAKOTA_HAVE_MPI
 }
 
@@ -18,6 +18,25 @@
 
 namespace Dakota {
 
+#ifdef DAKOTA_HAVE_MPI
+/// whether data are packed with MPI_Pack (else in their native
+/// representation), as selected by mpi_packing()
+static bool mpiPacking = false;
+#endif // DAKOTA_HAVE_MPI
+
+
+/** Selected once by MPIManager, according to whether MPI is in use,
+    rather than queried from MPI for each item packed.  Without MPI
+    (e.g., a serial run exchanging buffers with forked processes), data
+    are packed in their native representation. */
+void mpi_packing(bool flag)
+{
+#ifdef DAKOTA_HAVE_MPI
+  mpiPacking = flag;
+#endif // DAKOTA_HAVE_MPI
+}
+
+
 //---------------------------------------------------------------------
 //
 // MPIPackBuffer
@@ -27,7 +46,8 @@ namespace Dakota {
 void MPIPackBuffer::resize(const int newsize)
 {
   if (Index + newsize >= Size) {
-    Size *= 2;
+    while (Index + newsize >= Size)
+      Size *= 2;
     char* tmp = new char [Size];
     std::memcpy(tmp, Buffer, Index);
     if (Buffer)
@@ -42,12 +62,20 @@ void MPIPackBuffer::resize(const int newsize)
 void MPIPackBuffer::pack(const type* data, const int num) \
 { \
   resize(MPIPackSize(data[0], num)); \
-  MPI_Pack((void*)data, num, mpitype, Buffer, Size, &Index, MPI_COMM_WORLD); \
+  if (mpiPacking) \
+    MPI_Pack((void*)data, num, mpitype, Buffer, Size, &Index, MPI_COMM_WORLD);\
+  else \
+    { std::memcpy(Buffer + Index, data, num*sizeof(type)); \
+      Index += num*sizeof(type); } \
 }
 #else
 #define PACKBUF(type, mpitype) \
-void MPIPackBuffer::pack(const type* /*data*/, const int /*num*/) \
-{ }
+void MPIPackBuffer::pack(const type* data, const int num) \
+{ \
+  resize(MPIPackSize(data[0], num)); \
+  std::memcpy(Buffer + Index, data, num*sizeof(type)); \
+  Index += num*sizeof(type); \
+}
 #endif // DAKOTA_HAVE_MPI
 
 
@@ -67,13 +95,16 @@ PACKBUF(float,MPI_FLOAT)
 
 void MPIPackBuffer::pack(const bool* data, const int num)
 {
-#ifdef DAKOTA_HAVE_MPI
   resize(num*MPIPackSize(data[0],1));
   for (int i=0; i<num; i++) {
     char c = (data[i]) ? 'T' : 'F';
-    MPI_Pack((void*)(&c), 1, MPI_CHAR, Buffer, Size, &Index, MPI_COMM_WORLD);
-  }
+#ifdef DAKOTA_HAVE_MPI
+    if (mpiPacking)
+      { MPI_Pack((void*)(&c), 1, MPI_CHAR, Buffer, Size, &Index,
+		 MPI_COMM_WORLD); continue; }
 #endif // DAKOTA_HAVE_MPI
+    Buffer[Index++] = c;
+  }
 }
 
 
@@ -108,11 +139,21 @@ void MPIUnpackBuffer::setup(char* buf_, int size_, bool flag_)
 #ifdef DAKOTA_HAVE_MPI
 #define UNPACKBUF(type, mpitype) \
 void MPIUnpackBuffer::unpack(type* data, const int num) \
-{ MPI_Unpack(Buffer, Size, &Index, (void*)data, num, mpitype, MPI_COMM_WORLD); }
+{ \
+  if (mpiPacking) \
+    MPI_Unpack(Buffer, Size, &Index, (void*)data, num, mpitype, \
+	       MPI_COMM_WORLD); \
+  else \
+    { std::memcpy(data, Buffer + Index, num*sizeof(type)); \
+      Index += num*sizeof(type); } \
+}
 #else
 #define UNPACKBUF(type, mpitype) \
-void MPIUnpackBuffer::unpack(type* /*data*/, const int /*num*/) \
-{ }
+void MPIUnpackBuffer::unpack(type* data, const int num) \
+{ \
+  std::memcpy(data, Buffer + Index, num*sizeof(type)); \
+  Index += num*sizeof(type); \
+}
 #endif // DAKOTA_HAVE_MPI
  
  
@@ -132,13 +173,17 @@ UNPACKBUF(float,MPI_FLOAT)
 
 void MPIUnpackBuffer::unpack(bool* data, const int num)
 {
-#ifdef DAKOTA_HAVE_MPI
   for (int i=0; i<num; i++) {
     char c;
-    MPI_Unpack(Buffer, Size, &Index, (void*)(&c), 1, MPI_CHAR, MPI_COMM_WORLD);
+#ifdef DAKOTA_HAVE_MPI
+    if (mpiPacking)
+      MPI_Unpack(Buffer, Size, &Index, (void*)(&c), 1, MPI_CHAR,
+		 MPI_COMM_WORLD);
+    else
+#endif // DAKOTA_HAVE_MPI
+      c = Buffer[Index++];
     data[i] = (c == 'T') ? true : false;
   }
-#endif // DAKOTA_HAVE_MPI
 }
 
 
@@ -152,14 +197,16 @@ void MPIUnpackBuffer::unpack(bool* data, const int num)
 #define PACKSIZE(type, mpitype)	\
 int MPIPackSize(const type& /*data*/, const int num) \
 { \
+  if (!mpiPacking) \
+    return num*sizeof(type); \
   int size; \
   MPI_Pack_size(num, mpitype, MPI_COMM_WORLD, &size); \
   return size; \
 }
 #else
 #define PACKSIZE(type, mpitype)	\
-int MPIPackSize(const type& /*data*/, const int /*num*/) \
-{ return 0; }
+int MPIPackSize(const type& /*data*/, const int num) \
+{ return num*sizeof(type); }
 #endif // DAKOTA_HAVE_MPI
 
 
@@ -180,12 +227,13 @@ PACKSIZE(float,MPI_FLOAT)
 int MPIPackSize(const bool& /*data*/, const int num)
 {
 #ifdef DAKOTA_HAVE_MPI
-  int size; 
-  MPI_Pack_size(num, MPI_CHAR, MPI_COMM_WORLD, &size);
-  return size;
-#else
-  return 0;
+  if (mpiPacking) {
+    int size; 
+    MPI_Pack_size(num, MPI_CHAR, MPI_COMM_WORLD, &size);
+    return size;
+  }
 #endif // DAKOTA_HAVE_MPI
+  return num;
 }
 
 } // namespace Dakota
@@ -351,6 +351,10 @@ int MPIPackSize(const float& data, const int num = 1);
 /// return packed size of a bool
 int MPIPackSize(const bool& data, const int num = 1);
 
+/// select MPI_Pack (true) or the native representation (false) for
+/// all subsequent packing, unpacking, and packed sizes
+void mpi_packing(bool flag);
+
 
 } // namespace Dakota
 
@@ -1973,11 +1973,11 @@ resp_true(const char *keyname, Values *val, void **g, void *v)
   (*(Resp_Info**)g)->dr->**(bool DataResponsesRep::**)v = true;
 }
 
-// void NIDRProblemDescDB::
-// env_Real(const char *keyname, Values *val, void **g, void *v)
-// {
-//   (*(DataEnvironmentRep**)g)->**(Real DataEnvironmentRep::**)v = *val->r;
-// }
+void NIDRProblemDescDB::
+env_Real(const char *keyname, Values *val, void **g, void *v)
+{
+  (*(DataEnvironmentRep**)g)->**(Real DataEnvironmentRep::**)v = *val->r;
+}
 
 // void NIDRProblemDescDB::
 // env_RealL(const char *keyname, Values *val, void **g, void *v)
@@ -6555,7 +6555,8 @@ static String2DArray
 static StringArray
 	MP_(analysisDrivers),
         MP_(copyFiles),
-	MP_(linkFiles);
+	MP_(linkFiles),
+	MP_(templateFiles);
 
 static bool
 	MP_(activeSetVectorFlag),
@@ -6571,9 +6572,11 @@ static bool
 	MP_(nearbyEvalCacheFlag),
 	MP_(numpyFlag),
 	MP_(restartFileFlag),
+	MP_(shellFlag),
 	MP_(templateReplace),
 	MP_(useWorkdir),
-	MP_(verbatimFlag);
+	MP_(verbatimFlag),
+	MP_(workdirPool);
 
 static int
 	MP_(analysisServers),
@@ -6774,6 +6777,7 @@ static Real
 	MP_(solverRoundingTol),
 	MP_(solverTol),
 	MP_(statsRoundingTol),
+	MP_(steadyStateFraction),
 	MP_(stepLenToBoundary),
 	MP_(threshDelta),
 	MP_(threshStepLength),
@@ -6892,6 +6896,7 @@ static bool
 	MP_(calModelDiscrepancy),
 	MP_(chainDiagnostics),
 	MP_(chainDiagnosticsCI),
+	MP_(concurrentBoundsFlag),
 	MP_(constantPenalty),
 	MP_(crossValidation),
 	MP_(crossValidNoiseOnly),
@@ -6902,11 +6907,13 @@ static bool
 	MP_(exportSurrogate),
 	MP_(fixedSeedFlag),
 	MP_(fixedSequenceFlag),
+	MP_(fuseModelTransforms),
         MP_(generatePosteriorSamples),
 	MP_(gpmsaNormalize),
 	MP_(importApproxActive),
 	MP_(importBuildActive),
 	MP_(latinizeFlag),
+	MP_(lockstepMPPSearch),
 	MP_(logitTransform),
 	MP_(mainEffectsFlag),
 	MP_(methodScaling),
@@ -6923,6 +6930,7 @@ static bool
 	MP_(posteriorStatsMutual),
 	MP_(printPopFlag),
 	MP_(pstudyFileActive),
+	MP_(pstudyStreaming),
 	MP_(randomizeOrderFlag),
 	MP_(regressDiag),
 	MP_(relativeConvMetric),
@@ -6931,6 +6939,8 @@ static bool
 	MP_(showMiscOptions),
 	MP_(speculativeFlag),
 	MP_(standardizedSpace),
+	MP_(steadyStateFlag),
+	MP_(streamingStatsFlag),
 	MP_(useTargetVarianceOptimizationFlag),
 	MP_(tensorGridFlag),
 	MP_(surrBasedGlobalReplacePts),
@@ -7513,6 +7523,7 @@ static bool
 	MP_(importChalUseVariableLabels),
 	MP_(importUseVariableLabels),
 	MP_(modelUseDerivsFlag),
+	MP_(overlapEvalsFlag),
         MP_(domainDecomp),
         MP_(pointSelection),
         MP_(pressFlag),
@@ -7557,6 +7568,7 @@ static int
         MP_(pointsTotal),
         MP_(refineCVFolds),
         MP_(softConvergenceLimit),
+        MP_(subMethodLocalConcurrency),
         MP_(subMethodProcs),
         MP_(subMethodServers),
         MP_(subspaceDimension),
@@ -7648,6 +7660,8 @@ static StringArray
 static bool
 	MP_(calibrationDataFlag),
 	MP_(centralHess),
+	MP_(fdStencilCompact),
+	MP_(fdStencilReuse),
 	MP_(interpolateFlag),
         MP_(ignoreBounds),
         MP_(readFieldCoords);
@@ -7714,6 +7728,7 @@ static Env_mp_utype
 static String
         MP_(errorFile),
         MP_(outputFile),
+        MP_(perfTraceFile),
         MP_(postRunInput),
         MP_(postRunOutput),
         MP_(preRunInput),
@@ -7729,6 +7744,8 @@ static String
 static bool
 	MP_(checkFlag),
 	MP_(graphicsFlag),
+	MP_(outputJournalFlag),
+	MP_(perfSummaryFlag),
 	MP_(postRunFlag),
 	MP_(preRunFlag),
         MP_(resultsOutputFlag),
@@ -7736,9 +7753,13 @@ static bool
 	MP_(tabularDataFlag);
 
 static int
+        MP_(journalCommitRecords),
         MP_(outputPrecision),
         MP_(stopRestart);
 
+static Real
+        MP_(journalCommitInterval);
+
 //#undef MP2
 #undef MP2s
 #undef MP_
@@ -229,7 +229,7 @@ public:
   KWH(resp_utype);
   KWH(resp_augment_utype);
 
-  //KWH(env_Real);
+  KWH(env_Real);
   //KWH(env_RealL);
   KWH(env_int);
   //KWH(env_lit);
@@ -33,7 +33,8 @@ NestedModel::NestedModel(ProblemDescDB& problem_db):
 		   true, // peer 1 must assign jobs to peers 2-n
 		   problem_db.get_int("model.nested.iterator_servers"),
 		   problem_db.get_int("model.nested.processors_per_iterator"),
-		   problem_db.get_short("model.nested.iterator_scheduling")),
+		   problem_db.get_short("model.nested.iterator_scheduling"),
+		   problem_db.get_int("model.nested.local_iterator_concurrency")),
   subMethodPointer(problem_db.get_string("model.nested.sub_method_pointer")),
   subIteratorJobCntr(0),
   optInterfacePointer(problem_db.get_string("model.interface_pointer"))
@@ -662,6 +663,13 @@ derived_set_communicators(ParLevLIter pl_iter, int max_eval_concurrency,
       asynchEvalFlag = true;
     if (subIteratorSched.numIteratorServers > evaluationCapacity)
       evaluationCapacity = subIteratorSched.numIteratorServers;
+    // local concurrency overlaps sub-iterator jobs within a single server
+    if (!subIteratorSched.messagePass &&
+	subIteratorSched.localIteratorConcurrency > 1) {
+      asynchEvalFlag = true;
+      if (subIteratorSched.localIteratorConcurrency > evaluationCapacity)
+	evaluationCapacity = subIteratorSched.localIteratorConcurrency;
+    }
   }
 }
 
@@ -1507,40 +1515,34 @@ const IntResponseMap& NestedModel::derived_synchronize()
 {
   nestedResponseMap.clear();
 
-  // TO DO: optInt/subIter scheduling is currently sequential, but could be
-  // overlapped as in HierarchSurrModel, given IteratorScheduler nowait support
-
-  IntIntMIter id_it; IntRespMCIter r_cit;
-  if (!optInterfacePointer.empty()) {
+  // optInt/subIter scheduling is sequential unless sub-iterator jobs are
+  // overlapped locally, in which case the optInt jobs are launched first
+  // (nowait) and recovered after the sub-iterator jobs complete
+  subIteratorSched.numIteratorJobs = subIteratorPRPQueue.size();
+  bool overlap = ( !optInterfacePointer.empty() &&
+		   !subIteratorPRPQueue.empty() && !optInterfaceIdMap.empty() &&
+		   subIteratorSched.local_concurrency() &&
+		   !( modelPCIter->ie_parallel_level_defined() &&
+		      modelPCIter->ie_parallel_level().message_pass() ) );
+
+  if (overlap) {
     component_parallel_mode(INTERFACE_MODE);
-
     ParConfigLIter pc_iter = parallelLib.parallel_configuration_iterator();
     parallelLib.parallel_configuration_iterator(modelPCIter);
-    const IntResponseMap& opt_int_resp_map = optionalInterface.synchronize();
+    opt_interface_response_overlay(optionalInterface.synchronize_nowait());
+    parallelLib.parallel_configuration_iterator(pc_iter); // restore
+  }
+  else if (!optInterfacePointer.empty()) {
+    component_parallel_mode(INTERFACE_MODE);
+    ParConfigLIter pc_iter = parallelLib.parallel_configuration_iterator();
+    parallelLib.parallel_configuration_iterator(modelPCIter);
+    opt_interface_response_overlay(optionalInterface.synchronize());
     parallelLib.parallel_configuration_iterator(pc_iter); // restore
-
-    // overlay response sets
-    r_cit = opt_int_resp_map.begin();
-    while (r_cit != opt_int_resp_map.end()) {
-      int oi_eval_id = r_cit->first;
-      id_it = optInterfaceIdMap.find(oi_eval_id);
-      if (id_it != optInterfaceIdMap.end()) {
-	interface_response_overlay(r_cit->second,
-				   nested_response(id_it->second));
-	optInterfaceIdMap.erase(id_it);
-	++r_cit;
-      }
-      else { // see also Model::rekey_synch()
-	++r_cit; // prior to invalidation from erase within cache_unmatched
-	optionalInterface.cache_unmatched_response(oi_eval_id);
-      }
-    }
   }
 
   if (!subIteratorPRPQueue.empty()) {
     // schedule subIteratorPRPQueue jobs
     component_parallel_mode(SUB_MODEL_MODE);
-    subIteratorSched.numIteratorJobs = subIteratorPRPQueue.size();
     subIteratorSched.schedule_iterators(*this, subIterator);
     // overlay response sets (no rekey or cache necessary)
     for (PRPQueueIter q_it=subIteratorPRPQueue.begin();
@@ -1556,8 +1558,17 @@ const IntResponseMap& NestedModel::derived_synchronize()
     subIteratorIdMap.clear(); subIteratorJobCntr = 0;
   }
 
+  // recover the optInt jobs that remain after the overlapped sub-iterator jobs
+  if (overlap && !optInterfaceIdMap.empty()) {
+    component_parallel_mode(INTERFACE_MODE);
+    ParConfigLIter pc_iter = parallelLib.parallel_configuration_iterator();
+    parallelLib.parallel_configuration_iterator(modelPCIter);
+    opt_interface_response_overlay(optionalInterface.synchronize());
+    parallelLib.parallel_configuration_iterator(pc_iter); // restore
+  }
+
   //nestedVarsMap.clear();
-  for (r_cit=nestedResponseMap.begin(); r_cit!=nestedResponseMap.end(); ++r_cit)
+  for (IntRespMCIter r_cit=nestedResponseMap.begin(); r_cit!=nestedResponseMap.end(); ++r_cit)
     Cout << "\n---------------------------\nNestedModel Evaluation "
 	 << std::setw(4) << r_cit->first << " total response:"
 	 << "\n---------------------------\n\nActive response data "
@@ -1566,6 +1577,28 @@ const IntResponseMap& NestedModel::derived_synchronize()
 }
 
 
+/** Overlay optionalInterface responses onto the nested responses, mapping
+    from optionalInterface evaluation ids through optInterfaceIdMap. */
+void NestedModel::opt_interface_response_overlay(const IntResponseMap& resp_map)
+{
+  IntIntMIter id_it; IntRespMCIter r_cit = resp_map.begin();
+  while (r_cit != resp_map.end()) {
+    int oi_eval_id = r_cit->first;
+    id_it = optInterfaceIdMap.find(oi_eval_id);
+    if (id_it != optInterfaceIdMap.end()) {
+      interface_response_overlay(r_cit->second,
+				 nested_response(id_it->second));
+      optInterfaceIdMap.erase(id_it);
+      ++r_cit;
+    }
+    else { // see also Model::rekey_synch()
+      ++r_cit; // prior to invalidation from erase within cache_unmatched
+      optionalInterface.cache_unmatched_response(oi_eval_id);
+    }
+  }
+}
+
+
 /* Asynchronous response computations are not currently supported by
    NestedModels.  Return a dummy to satisfy the compiler.
 const IntResponseMap& NestedModel::derived_synchronize_nowait()
@@ -234,6 +234,9 @@ private:
   /// within the total response for the model
   void interface_response_overlay(const Response& opt_interface_response,
 				  Response& mapped_response);
+  /// overlay a set of optional interface responses within the total
+  /// responses, mapping evaluation ids through optInterfaceIdMap
+  void opt_interface_response_overlay(const IntResponseMap& resp_map);
   /// overlay the sub-iteration response within the total response for
   /// the model using the primaryCoeffs/secondaryCoeffs mappings
   void iterator_response_overlay(const Response& sub_iterator_response,
@@ -128,6 +128,7 @@ NonDBayesCalibration(ProblemDescDB& problem_db, Model& model):
   posteriorStatsKDE(probDescDB.get_bool("method.posterior_stats.kde")),
   chainDiagnostics(probDescDB.get_bool("method.chain_diagnostics")),
   chainDiagnosticsCI(probDescDB.get_bool("method.chain_diagnostics.confidence_intervals")),
+  fuseModelTransforms(probDescDB.get_bool("method.fuse_model_transforms")),
   calModelEvidence(probDescDB.get_bool("method.model_evidence")),
   calModelEvidMC(probDescDB.get_bool("method.mc_approx")),
   calModelEvidLaplace(probDescDB.get_bool("method.laplace_approx")),
@@ -244,6 +245,7 @@ NonDBayesCalibration(ProblemDescDB& problem_db, Model& model):
   // Order is important: data transform, then scale, then weights
   if (scaleFlag)   scale_model();
   if (weightFlag)  weight_model();
+  fuse_residual_model();
 
   init_map_optimizer();
   construct_map_model();
@@ -1106,6 +1108,7 @@ void NonDBayesCalibration::calibrate_to_hifi()
     residualModel.assign_rep(std::make_shared<DataTransformModel>
 			     (mcmcModel, expData, numHyperparams,
 			      obsErrorMultiplierMode, mcmcDerivOrder));
+    fuse_residual_model();
     construct_map_model();
     construct_map_optimizer(); 
 
@@ -3776,4 +3779,21 @@ void NonDBayesCalibration::weight_model()
   residualModel.assign_rep(std::make_shared<WeightingModel>(residualModel));
 }
 
+
+/** Each chain sample evaluates the full stack of transformations (e.g.,
+    weighting, scaling, data, and probability transformations) over the
+    simulation or emulator model.  When requested and the stack consists
+    of two or more RecastModels, the top one applies all of their
+    mappings in a single pass without the per-layer Model evaluation
+    overhead. */
+void NonDBayesCalibration::fuse_residual_model()
+{
+  if (!fuseModelTransforms)
+    return;
+  std::shared_ptr<RecastModel> recast_rep
+    = std::dynamic_pointer_cast<RecastModel>(residualModel.model_rep());
+  if (recast_rep)
+    recast_rep->fuse_recasts(true);
+}
+
 } // namespace Dakota
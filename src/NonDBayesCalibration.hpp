@@ -269,6 +269,10 @@ protected:
   /// Wrap iteratedModel in a RecastModel that weights the residuals
   void weight_model();
 
+  /// fuse the stack of RecastModels in residualModel into single-pass
+  /// evaluations
+  void fuse_residual_model();
+
   //
   //- Heading: Data
   //
@@ -443,6 +447,9 @@ protected:
   /// flag indicating calculation of confidence intervals as a chain
   /// diagnositc
   bool chainDiagnosticsCI;
+  /// flag indicating single-pass evaluation of the residual model
+  /// transformations (see fuse_residual_model())
+  bool fuseModelTransforms;
   /// flag indicating calculation of the evidence of the model
   bool calModelEvidence;
   /// flag indicating use of Monte Carlo approximation to calculate evidence
@@ -56,6 +56,7 @@ NonDExpansion::NonDExpansion(ProblemDescDB& problem_db, Model& model):
   fixedSeed(problem_db.get_bool("method.fixed_seed")), mlmfIter(0),
   multilevAllocControl(
     problem_db.get_short("method.nond.multilevel_allocation_control")),
+  speculativeRefine(problem_db.get_bool("method.speculative")),
   multilevDiscrepEmulation(
     problem_db.get_short("method.nond.multilevel_discrepancy_emulation")),
   kappaEstimatorRate(
@@ -104,7 +105,7 @@ NonDExpansion(unsigned short method_name, Model& model,
   statsMetricMode(Pecos::DEFAULT_EXPANSION_STATS), relativeMetric(true),
   dimPrefSpec(dim_pref), collocRatio(colloc_ratio), termsOrder(1.),
   tensorRegression(false), randomSeed(seed), fixedSeed(false), mlmfIter(0),
-  multilevAllocControl(DEFAULT_MLMF_CONTROL),
+  multilevAllocControl(DEFAULT_MLMF_CONTROL), speculativeRefine(false),
   multilevDiscrepEmulation(DEFAULT_EMULATION), kappaEstimatorRate(2.),
   gammaEstimatorScale(1.), numSamplesOnModel(0), numSamplesOnExpansion(0),
   nestedRules(false), piecewiseBasis(piecewise_basis), useDerivs(use_derivs),
@@ -2094,54 +2095,59 @@ increment_sets(Real& delta_star, bool revert, bool print_metric)
     (uSpaceModel.subordinate_iterator().iterator_rep());
   const std::set<UShortArray>& active_mi = nond_sparse->active_multi_index();
   std::set<UShortArray>::const_iterator cit, cit_star = active_mi.end();
-  Real delta; delta_star = -DBL_MAX;  size_t index = 0, index_star = _NPOS;
+  // speculative refinement defers new active sets until the trial points of
+  // all of them have been evaluated as a single batch
+  std::vector<std::set<UShortArray>::const_iterator> queued_sets;
+  SizetArray queued_indices;
+  delta_star = -DBL_MAX;  size_t index = 0, index_star = _NPOS;
   for (cit=active_mi.begin(); cit!=active_mi.end(); ++cit, ++index) {
 
     // increment grid with current candidate
-    Cout << "\n>>>>> Evaluating trial index set:\n" << *cit;
     nond_sparse->increment_set(*cit);
     if (uSpaceModel.push_available()) {    // has been active previously
+      Cout << "\n>>>>> Evaluating trial index set:\n" << *cit;
       nond_sparse->push_set();
       uSpaceModel.push_approximation();
     }
+    else if (speculativeRefine) {            // a new active set: defer
+      nond_sparse->queue_set(*cit);
+      nond_sparse->decrement_set();
+      queued_sets.push_back(cit);  queued_indices.push_back(index);
+      continue;
+    }
     else {                                    // a new active set
+      Cout << "\n>>>>> Evaluating trial index set:\n" << *cit;
       nond_sparse->evaluate_set();
       uSpaceModel.append_approximation(true); // rebuild
     }
 
-    // combine expansions if necessary for metric computation:
-    // Note: Multilevel SC overrides this fn to remove roll-up for Hier SC
-    //       (its delta metrics can be computed w/o exp combination)
-    metric_roll_up(REFINEMENT_RESULTS);
-    // assess increment by computing refinement metric:
-    // defer revert (pass false) -> simplifies best candidate tracking to follow
-    switch (refineMetric) {
-    case Pecos::COVARIANCE_METRIC:
-      delta = compute_covariance_metric(false, print_metric);      break;
-    //case Pecos::MIXED_STATS_METRIC: // TO DO
-    //  compute_mixed_metric(); [retire compute_final_stats_metric()] break;
-    default: //case Pecos::LEVEL_STATS_METRIC:
-      delta = compute_level_mappings_metric(false, print_metric);  break;
-    }
-    compute_statistics(REFINEMENT_RESULTS);        // augment compute_*_metric()
-    if (print_metric) print_results(Cout, REFINEMENT_RESULTS); // augment output
-
-    // normalize effect of increment based on cost (# of collocation pts).
-    // Note: increment size is nonzero since growth restriction is precluded
-    //       for generalized sparse grids.
-    delta /= nond_sparse->increment_size();
-    Cout << "\n<<<<< Trial set refinement metric = " << delta << '\n';
-    // track best increment evaluated thus far
-    if (delta > delta_star) {
-      cit_star = cit;  delta_star = delta;  index_star = index;
-      pull_candidate(statsStar); // pull comp_*_metric() + augmented stats
-    }
-
+    assess_set(cit, index, print_metric, delta_star, cit_star, index_star);
     // restore previous state (destruct order is reversed from construct order)
     uSpaceModel.pop_approximation(true); // store data for use in push,finalize
     nond_sparse->decrement_set(); // store data for use in push_set()
-    if (revert || cit != --active_mi.end()) // else overwritten by push below
-      push_reference(stats_ref);
+    if (revert || std::next(cit) != active_mi.end() || !queued_sets.empty())
+      push_reference(stats_ref); // else overwritten by push below
+  }
+
+  if (!queued_sets.empty()) {
+    nond_sparse->evaluate_queued_sets();
+    size_t i, num_queued = queued_sets.size();
+    for (i=0; i<num_queued; ++i) {
+      cit = queued_sets[i];
+      Cout << "\n>>>>> Evaluating trial index set:\n" << *cit;
+      // restore the trial grid popped after queue_set(), such that each
+      // set is pushed and popped in turn as for a previously active set
+      nond_sparse->increment_set(*cit);
+      nond_sparse->retrieve_set(*cit);
+      uSpaceModel.append_approximation(true); // rebuild
+
+      assess_set(cit, queued_indices[i], print_metric, delta_star, cit_star,
+		 index_star);
+      uSpaceModel.pop_approximation(true);
+      nond_sparse->decrement_set();
+      if (revert || i + 1 < num_queued)
+	push_reference(stats_ref);
+    }
   }
   Cout << "\n<<<<< Evaluation of active index sets completed.\n"
        << "\n<<<<< Index set selection:\n" << *cit_star;
@@ -2155,6 +2161,45 @@ increment_sets(Real& delta_star, bool revert, bool print_metric)
 }
 
 
+void NonDExpansion::
+assess_set(std::set<UShortArray>::const_iterator cit, size_t index,
+	   bool print_metric, Real& delta_star,
+	   std::set<UShortArray>::const_iterator& cit_star, size_t& index_star)
+{
+  // combine expansions if necessary for metric computation:
+  // Note: Multilevel SC overrides this fn to remove roll-up for Hier SC
+  //       (its delta metrics can be computed w/o exp combination)
+  metric_roll_up(REFINEMENT_RESULTS);
+  // assess increment by computing refinement metric:
+  // defer revert (pass false) -> simplifies best candidate tracking to follow
+  Real delta;
+  switch (refineMetric) {
+  case Pecos::COVARIANCE_METRIC:
+    delta = compute_covariance_metric(false, print_metric);      break;
+  //case Pecos::MIXED_STATS_METRIC: // TO DO
+  //  compute_mixed_metric(); [retire compute_final_stats_metric()] break;
+  default: //case Pecos::LEVEL_STATS_METRIC:
+    delta = compute_level_mappings_metric(false, print_metric);  break;
+  }
+  compute_statistics(REFINEMENT_RESULTS);        // augment compute_*_metric()
+  if (print_metric) print_results(Cout, REFINEMENT_RESULTS); // augment output
+
+  // normalize effect of increment based on cost (# of collocation pts).
+  // Note: increment size is nonzero since growth restriction is precluded
+  //       for generalized sparse grids.
+  std::shared_ptr<NonDSparseGrid> nond_sparse =
+    std::static_pointer_cast<NonDSparseGrid>
+    (uSpaceModel.subordinate_iterator().iterator_rep());
+  delta /= nond_sparse->increment_size();
+  Cout << "\n<<<<< Trial set refinement metric = " << delta << '\n';
+  // track best increment evaluated thus far
+  if (delta > delta_star) {
+    cit_star = cit;  delta_star = delta;  index_star = index;
+    pull_candidate(statsStar); // pull comp_*_metric() + augmented stats
+  }
+}
+
+
 void NonDExpansion::finalize_sets(bool converged_within_tol, bool reverted)
 {
   Cout << "\n<<<<< Finalization of generalized sparse grid sets.\n";
@@ -453,6 +453,9 @@ protected:
   /// type of sample allocation scheme for discretization levels / model forms
   /// within multilevel / multifidelity methods
   short multilevAllocControl;
+  /// evaluate the new candidates of generalized sparse grid refinement as
+  /// a single batch prior to competing them
+  bool speculativeRefine;
   /// emulation approach for multilevel / multifidelity discrepancy:
   /// distinct or recursive
   short multilevDiscrepEmulation;
@@ -569,6 +572,12 @@ private:
 
   /// perform an adaptive refinement increment using generalized sparse grids
   size_t increment_sets(Real& delta_star, bool revert, bool print_metric);
+  /// compute the cost-normalized refinement metric for the active trial
+  /// index set and track the best candidate
+  void assess_set(std::set<UShortArray>::const_iterator cit, size_t index,
+		  bool print_metric, Real& delta_star,
+		  std::set<UShortArray>::const_iterator& cit_star,
+		  size_t& index_star);
   /// finalization of adaptive refinement using generalized sparse grids
   void finalize_sets(bool converged_within_tol, bool reverted = false);
 
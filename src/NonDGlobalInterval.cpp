@@ -45,7 +45,8 @@ NonDGlobalInterval::NonDGlobalInterval(ProblemDescDB& problem_db, Model& model):
   numSamples(probDescDB.get_int("method.samples")),
   rngName(probDescDB.get_string("method.random_number_generator")),
   allResponsesPerIter(false), dataOrder(1), distanceTol(convergenceTol),
-  distanceConvergeLimit(1), improvementConvergeLimit(2)
+  distanceConvergeLimit(1), improvementConvergeLimit(2),
+  concurrentBounds(probDescDB.get_bool("method.nond.concurrent_bounds"))
 {
   bool err_flag = false;
 
@@ -165,6 +166,14 @@ NonDGlobalInterval::NonDGlobalInterval(ProblemDescDB& problem_db, Model& model):
   else
     fHatModel = iteratedModel; // shared rep
 
+  // Without emulation, each bound solve evaluates the truth model directly
+  // and there are no truth evaluations to batch across the solves
+  if (concurrentBounds && !gpModelFlag) {
+    Cerr << "Warning: concurrent_bounds requires a Gaussian process emulator "
+	 << "in NonDGlobalInterval; solving bounds sequentially." << std::endl;
+    concurrentBounds = false;
+  }
+
   if (err_flag)
     abort_handler(-1);
 
@@ -313,6 +322,14 @@ void NonDGlobalInterval::core_run()
 	primary_resp_map, secondary_resp_map, nonlinear_resp_map, 
 	extract_objective, NULL);
 
+    if (concurrentBounds) {
+      // solve all cell bounds in lockstep, batching their truth evaluations
+      concurrent_bound_solves(pl_iter, primary_resp_map, nonlinear_resp_map);
+      post_process_response_fn_results(); // virtual fn: post-process respFn
+      nonlinear_resp_map[0][respFnCntr] = false; // reset
+      continue;
+    }
+
     for (cellCntr=0; cellCntr<numCells; ++cellCntr) {
 
       set_cell_bounds(); // virtual fn for setting bounds for local min/max
@@ -506,6 +523,20 @@ void NonDGlobalInterval::evaluate_response_star_truth()
     set.request_values(dataOrder);
   else
     { set.request_values(0); set.request_value(dataOrder, respFnCntr); }
+
+  if (concurrentBounds) {
+    // queue the evaluation; the GP is updated once the batch is synchronized.
+    // Solves that propose a common point (e.g., the DIRECT center point
+    // fallback) share a single evaluation, since duplicate data would damage
+    // the GP.
+    for (IntVarsMCIter v_cit=varsStarMap.begin();
+	 v_cit!=varsStarMap.end(); ++v_cit)
+      if (v_cit->second == vars_star)
+	return;
+    iteratedModel.evaluate_nowait(set);
+    varsStarMap[iteratedModel.evaluation_id()] = vars_star.copy();
+    return;
+  }
   iteratedModel.evaluate(set);
 
   // Update the GP approximation
@@ -515,6 +546,97 @@ void NonDGlobalInterval::evaluate_response_star_truth()
 }
 
 
+/** Each response function requires a minimization and a maximization
+    within each cell.  Rather than iterating each of these EGO/SBGO solves
+    to convergence in turn, all unconverged solves are advanced by one
+    iteration per round: the surrogate-based sub-problems are solved in
+    sequence on the shared GP, their truth evaluations are queued, and the
+    batch is synchronized and appended to the GP with a single rebuild.
+    The number of truth evaluations that may execute concurrently is
+    therefore up to twice the number of cells. */
+void NonDGlobalInterval::
+concurrent_bound_solves(ParLevLIter pl_iter,
+			const Sizet2DArray& primary_resp_map,
+			const BoolDequeArray& nonlinear_resp_map)
+{
+  std::shared_ptr<RecastModel> int_opt_model_rep =
+    std::static_pointer_cast<RecastModel>(intervalOptModel.model_rep());
+  Sizet2DArray vars_map, secondary_resp_map;
+  BoolDeque max_sense(1);
+
+  // even solves are minimizations and odd solves maximizations of cell i/2
+  size_t i, num_solves = 2*numCells, num_active = num_solves, num_rounds = 0;
+  std::vector<BoundSolveState> solve_states(num_solves);
+  while (num_active) {
+    ++num_rounds;
+    for (i=0; i<num_solves; ++i) {
+      BoundSolveState& state = solve_states[i];
+      if (state.boundConverged)
+	continue;
+
+      cellCntr = i / 2;  bool maximize = (i % 2);
+      set_cell_bounds(); // virtual fn for setting bounds for local min/max
+      if (eifFlag)
+	int_opt_model_rep->init_maps(vars_map, false, NULL, NULL,
+	  primary_resp_map, secondary_resp_map, nonlinear_resp_map,
+	  (maximize) ? EIF_objective_max : EIF_objective_min, NULL);
+      else {
+	max_sense[0] = maximize;
+	int_opt_model_rep->primary_response_fn_sense(max_sense);
+      }
+
+      swap_bound_state(state); // activate the iteration state of this solve
+      ++globalIterCntr;
+      // determine approxFnStar from minimum/maximum among sample data
+      if (eifFlag)
+	get_best_sample(maximize, true);
+
+      Cout << "\n>>>>> Initiating global "
+	   << ((maximize) ? "maximization" : "minimization") << ": response "
+	   << respFnCntr+1 << " cell " << cellCntr+1 << " iteration "
+	   << globalIterCntr << "\n\n";
+      intervalOptimizer.run(pl_iter);
+      // output iteration results, update convergence controls, and queue
+      // the truth evaluation
+      post_process_run_results(maximize);
+      swap_bound_state(state); // deactivate
+      if (state.boundConverged)
+	--num_active;
+    }
+
+    // evaluate the truth responses for this round and update the GP
+    if (!varsStarMap.empty()) {
+      Cout << "\n>>>>> Evaluating " << varsStarMap.size() << " truth responses"
+	   << " for bound estimation round " << num_rounds << "\n";
+      const IntResponseMap& truth_resp_map = iteratedModel.synchronize();
+      fHatModel.append_approximation(varsStarMap, truth_resp_map, true);
+      varsStarMap.clear();
+    }
+  }
+
+  // post-process the cell results in the order of the sequential solves
+  for (cellCntr=0; cellCntr<numCells; ++cellCntr) {
+    get_best_sample(false, false);    // pull truthFnStar from sample data
+    post_process_cell_results(false); // virtual fn: post-process min
+    get_best_sample(true, false);
+    post_process_cell_results(true);  // virtual fn: post-process max
+  }
+}
+
+
+void NonDGlobalInterval::swap_bound_state(BoundSolveState& state)
+{
+  std::swap(distanceConvergeCntr,    state.distanceConvergeCntr);
+  std::swap(improvementConvergeCntr, state.improvementConvergeCntr);
+  std::swap(globalIterCntr,          state.globalIterCntr);
+  std::swap(prevCVStar,              state.prevCVStar);
+  std::swap(prevDIVStar,             state.prevDIVStar);
+  std::swap(prevDRVStar,             state.prevDRVStar);
+  std::swap(prevFnStar,              state.prevFnStar);
+  std::swap(boundConverged,          state.boundConverged);
+}
+
+
 void NonDGlobalInterval::get_best_sample(bool maximize, bool eval_approx)
 { } // default is no-op
 
@@ -117,6 +117,31 @@ private:
   //- Heading: Convenience functions
   //
 
+  /// EGO/SBGO iteration state of a single cell minimization or
+  /// maximization, exchanged with the active state by swap_bound_state()
+  struct BoundSolveState {
+    BoundSolveState(): improvementConvergeCntr(0), distanceConvergeCntr(0),
+      prevFnStar(0.), globalIterCntr(0), boundConverged(false) { }
+    unsigned short improvementConvergeCntr;
+    unsigned short distanceConvergeCntr;
+    RealVector prevCVStar;
+    IntVector  prevDIVStar;
+    RealVector prevDRVStar;
+    Real prevFnStar;
+    size_t globalIterCntr;
+    bool boundConverged;
+  };
+
+  /// advance the minimization and maximization of all cells for the
+  /// current response function in lockstep, batching their truth
+  /// evaluations (concurrent_bounds specification)
+  void concurrent_bound_solves(ParLevLIter pl_iter,
+			       const Sizet2DArray& primary_resp_map,
+			       const BoolDequeArray& nonlinear_resp_map);
+  /// exchange the iteration state of a bound solve with the active
+  /// iteration state used by post_process_run_results()
+  void swap_bound_state(BoundSolveState& state);
+
   /// static function used as the objective function in the
   /// Expected Improvement Function (EIF) for minimizing the GP
   static void EIF_objective_min(const Variables& sub_model_vars,
@@ -191,6 +216,13 @@ private:
   /// order of the data used for surrogate construction, in ActiveSet
   /// request vector 3-bit format; user may override responses spec
   short dataOrder;
+
+  /// flag for solving the bounds of all cells in lockstep with batched
+  /// truth evaluations (concurrent_bounds specification)
+  bool concurrentBounds;
+  /// optimal variables of the truth evaluations queued during a round of
+  /// concurrent bound solves, keyed by evaluation id
+  IntVariablesMap varsStarMap;
 };
 
 
@@ -21,6 +21,7 @@
 #include "NonDLHSSampling.hpp"
 #include "NormalRandomVariable.hpp"
 #include "MarginalsCorrDistribution.hpp"
+#include <algorithm>
 
 //#define DEBUG
 
@@ -178,7 +179,9 @@ void NonDInterval::calculate_cells_and_bpas()
   int num_ciu  = ci_bpa.size(),         num_diu  = di_bpa.size(),
       num_dusi = dsi_vals_probs.size(), num_dusr = dsr_vals_probs.size();
 
-  UShortArray scale_factor(num_ciu + num_diu + num_dusi + num_dusr, 1);
+  size_t num_interval_vars = num_ciu + num_diu + num_dusi + num_dusr;
+  SizetArray& scale_factor = cellScaleFactors;
+  scale_factor.assign(num_interval_vars, 1);
   numCells = 1;
 
   // continuous interval variables
@@ -318,6 +321,38 @@ void NonDInterval::calculate_cells_and_bpas()
     }
   }
 
+  // index the intervals of each variable for locate_cells(); set values
+  // are treated as degenerate intervals
+  cellEndPoints.resize(num_interval_vars);
+  cellIntervalIndices.resize(num_interval_vars);
+  RealRealPairArray intervals;
+  for (j=0, var_cntr=0; j<num_ciu; ++j, ++var_cntr) {
+    intervals.clear();
+    for (RRPRMCIter cit=ci_bpa[j].begin(); cit!=ci_bpa[j].end(); ++cit)
+      intervals.push_back(cit->first);
+    initialize_cell_index(var_cntr, intervals);
+  }
+  for (j=0; j<num_diu; ++j, ++var_cntr) {
+    intervals.clear();
+    for (IIPRMCIter cit=di_bpa[j].begin(); cit!=di_bpa[j].end(); ++cit)
+      intervals.push_back(RealRealPair(cit->first.first, cit->first.second));
+    initialize_cell_index(var_cntr, intervals);
+  }
+  for (j=0; j<num_dusi; ++j, ++var_cntr) {
+    intervals.clear();
+    for (IRMCIter cit=dsi_vals_probs[j].begin();
+	 cit!=dsi_vals_probs[j].end(); ++cit)
+      intervals.push_back(RealRealPair(cit->first, cit->first));
+    initialize_cell_index(var_cntr, intervals);
+  }
+  for (j=0; j<num_dusr; ++j, ++var_cntr) {
+    intervals.clear();
+    for (RRMCIter cit=dsr_vals_probs[j].begin();
+	 cit!=dsr_vals_probs[j].end(); ++cit)
+      intervals.push_back(RealRealPair(cit->first, cit->first));
+    initialize_cell_index(var_cntr, intervals);
+  }
+
   StringMultiArrayConstView cv_labels
     = iteratedModel.continuous_variable_labels();
   StringMultiArrayConstView div_labels
@@ -361,6 +396,86 @@ void NonDInterval::calculate_cells_and_bpas()
 }
 
 
+/** Interval end points are inclusive, such that a point located at an
+    end point belongs to all of the intervals that share it. */
+void NonDInterval::
+initialize_cell_index(size_t var_index, const RealRealPairArray& intervals)
+{
+  size_t i, k, num_intervals = intervals.size();
+  RealArray end_pts; end_pts.reserve(2*num_intervals);
+  for (i=0; i<num_intervals; ++i) {
+    end_pts.push_back(intervals[i].first);
+    end_pts.push_back(intervals[i].second);
+  }
+  std::sort(end_pts.begin(), end_pts.end());
+  end_pts.erase(std::unique(end_pts.begin(), end_pts.end()), end_pts.end());
+  size_t num_end_pts = end_pts.size();
+
+  RealVector& var_end_pts = cellEndPoints[var_index];
+  var_end_pts.sizeUninitialized(num_end_pts);
+  for (k=0; k<num_end_pts; ++k)
+    var_end_pts[k] = end_pts[k];
+
+  // locations 2k are end point k and locations 2k+1 are the open segment
+  // between end points k and k+1
+  Sizet2DArray& var_indices = cellIntervalIndices[var_index];
+  var_indices.clear();
+  var_indices.resize((num_end_pts) ? 2*num_end_pts - 1 : 0);
+  for (i=0; i<num_intervals; ++i) {
+    size_t lo = std::lower_bound(end_pts.begin(), end_pts.end(),
+				 intervals[i].first)  - end_pts.begin(),
+           hi = std::lower_bound(end_pts.begin(), end_pts.end(),
+				 intervals[i].second) - end_pts.begin();
+    for (k=2*lo; k<=2*hi; ++k)
+      var_indices[k].push_back(i);
+  }
+}
+
+
+/** The intervals of each variable that contain the point are identified
+    by a binary search over its end points, and the containing cells are
+    the tensor product of these intervals (overlapping intervals may
+    contribute several cells per variable). */
+void NonDInterval::
+locate_cells(const RealVector& interval_vals, SizetArray& cells) const
+{
+  cells.clear();
+  size_t i, num_vars = cellEndPoints.size();
+  std::vector<const SizetArray*> var_indices(num_vars);
+  for (i=0; i<num_vars; ++i) {
+    const RealVector& end_pts = cellEndPoints[i];
+    const Real* first = end_pts.values(); int num_end_pts = end_pts.length();
+    Real val = interval_vals[i];
+    // number of end points <= val
+    size_t k = std::upper_bound(first, first + num_end_pts, val) - first;
+    if (k == 0) // below the lowest end point
+      return;
+    size_t loc = (end_pts[k-1] == val) ? 2*(k-1) : 2*(k-1) + 1;
+    if (loc >= cellIntervalIndices[i].size()) // above the highest end point
+      return;
+    var_indices[i] = &cellIntervalIndices[i][loc];
+    if (var_indices[i]->empty()) // in a gap between intervals
+      return;
+  }
+
+  // enumerate the tensor product of the containing intervals
+  SizetArray pos(num_vars, 0);
+  while (true) {
+    size_t cell = 0;
+    for (i=0; i<num_vars; ++i)
+      cell += (*var_indices[i])[pos[i]] * cellScaleFactors[i];
+    cells.push_back(cell);
+    for (i=0; i<num_vars; ++i) {
+      if (++pos[i] < var_indices[i]->size())
+	break;
+      pos[i] = 0;
+    }
+    if (i == num_vars)
+      break;
+  }
+}
+
+
 // GT: Attempts to replace CCBFPF_F77
 void NonDInterval::calculate_cbf_cpf(bool complementary)
 {
@@ -370,21 +485,23 @@ void NonDInterval::calculate_cbf_cpf(bool complementary)
   // sum up the BPAs, in that order; corresponding min value is response level
   // Similar logic for CCBF and CCPF
 
-  // Because cellFn values are of RealVector type, use sorted
-  // containers instead of STL algorithmic sort
-  std::multimap<Real, size_t> cell_min;
-  std::multimap<Real, size_t> cell_max;
-  std::multimap<Real, size_t>::iterator it_max, it_min;
+  // Sort the cell indices by function value; the stable sort preserves
+  // the cell order for ties, consistent with multimap insertion
   size_t i;
-  // Insert into a map and sort by key (i.e. function value)
   Real bpa_sum = 0.;
-  RealVector& cell_fn_lb = cellFnLowerBounds[respFnCntr];
-  RealVector& cell_fn_ub = cellFnUpperBounds[respFnCntr];
+  const RealVector& cell_fn_lb = cellFnLowerBounds[respFnCntr];
+  const RealVector& cell_fn_ub = cellFnUpperBounds[respFnCntr];
+  SizetArray cell_min(numCells), cell_max(numCells);
   for (i=0; i<numCells; ++i) {
     bpa_sum += cellBPA[i];
-    cell_min.insert(std::pair<Real, size_t>(cell_fn_lb[i], i));
-    cell_max.insert(std::pair<Real, size_t>(cell_fn_ub[i], i));
+    cell_min[i] = cell_max[i] = i;
   }
+  std::stable_sort(cell_min.begin(), cell_min.end(),
+		   [&cell_fn_lb](size_t a, size_t b)
+		   { return cell_fn_lb[a] < cell_fn_lb[b]; });
+  std::stable_sort(cell_max.begin(), cell_max.end(),
+		   [&cell_fn_ub](size_t a, size_t b)
+		   { return cell_fn_ub[a] < cell_fn_ub[b]; });
 
   Real bel_total, plaus_total;
   RealVector bel_fn(numCells, false),  plaus_fn(numCells, false),
@@ -392,13 +509,11 @@ void NonDInterval::calculate_cbf_cpf(bool complementary)
   // if CCBF/CCPF desired
   if (complementary) {
     bel_total = bpa_sum; plaus_total = bpa_sum;
-    for (it_max  = cell_max.begin(), it_min  = cell_min.begin(), i=0; 
-	 it_max != cell_max.end() && it_min != cell_min.end() && i<numCells;
-	 ++it_max, ++it_min, ++i) {
+    for (i=0; i<numCells; ++i) {
       bel_fn[i]    = bel_total;
       plaus_fn[i]  = plaus_total;
-      bel_val[i]   = it_min->first;
-      plaus_val[i] = it_max->first;
+      bel_val[i]   = cell_fn_lb[cell_min[i]];
+      plaus_val[i] = cell_fn_ub[cell_max[i]];
 
 #ifdef DEBUG
       Cout << "(response_level,belief)\t( " << bel_val[i] << ", " << bel_fn[i]
@@ -406,22 +521,20 @@ void NonDInterval::calculate_cbf_cpf(bool complementary)
 	   << plaus_val[i] << ", " << plaus_fn[i] << ")\n";
 #endif
 
-      bel_total   -= cellBPA[it_min->second];
-      plaus_total -= cellBPA[it_max->second];
+      bel_total   -= cellBPA[cell_min[i]];
+      plaus_total -= cellBPA[cell_max[i]];
     }
   }
   // if CBF/CPF desired
   else {
     bel_total = plaus_total = 0.;
-    for (it_max  = cell_max.begin(), it_min  = cell_min.begin(), i=0; 
-	 it_max != cell_max.end() && it_min != cell_min.end() && i<numCells;
-	 ++it_max, ++it_min, ++i) {
-      bel_total   += cellBPA[it_max->second];
-      plaus_total += cellBPA[it_min->second];
+    for (i=0; i<numCells; ++i) {
+      bel_total   += cellBPA[cell_max[i]];
+      plaus_total += cellBPA[cell_min[i]];
       bel_fn[i]    = bel_total;
       plaus_fn[i]  = plaus_total;
-      bel_val[i]   = it_max->first;
-      plaus_val[i] = it_min->first;
+      bel_val[i]   = cell_fn_ub[cell_max[i]];
+      plaus_val[i] = cell_fn_lb[cell_min[i]];
 
 #ifdef DEBUG
       Cout << "(response_level,belief)\t( " << bel_val[i] << ", " << bel_fn[i]
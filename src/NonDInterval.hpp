@@ -88,6 +88,11 @@ protected:
   /// function to compute (complementary) distribution functions on belief and
   /// plausibility replaces CCBFPF_F77 from wrapper calculate_cum_belief_plaus()
   void calculate_cbf_cpf(bool complementary = true);
+
+  /// identify the cells containing a point, given its values for the
+  /// interval variables (continuous intervals, discrete intervals, discrete
+  /// integer sets, then discrete real sets)
+  void locate_cells(const RealVector& interval_vals, SizetArray& cells) const;
   
   //
   //- Heading: Data
@@ -139,6 +144,25 @@ protected:
   size_t cellCntr;
   /// total number of interval combinations
   size_t numCells;	
+
+  /// stride of each interval variable within the cell index
+  SizetArray cellScaleFactors;
+  /// sorted unique interval end points for each interval variable
+  RealVectorArray cellEndPoints;
+  /// for each interval variable, the intervals containing each end point
+  /// (even locations) and each open segment between consecutive end points
+  /// (odd locations) of cellEndPoints
+  Sizet3DArray cellIntervalIndices;
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// define cellEndPoints and cellIntervalIndices for an interval variable
+  void initialize_cell_index(size_t var_index,
+			     const RealRealPairArray& intervals);
 };
 
 } // namespace Dakota
@@ -46,65 +46,63 @@ void NonDLHSEvidence::post_process_samples()
   const RealMatrix&     all_samples   = lhsSampler.all_samples();
   const IntResponseMap& all_responses = lhsSampler.all_responses();
 
+  size_t i, j, k;
   for (respFnCntr=0; respFnCntr<numFunctions; ++respFnCntr) {
-    // Use the max and mins to determine the cumulative distributions
-    // of plausibility and belief
-    RealVector& cell_fn_l_bnds = cellFnLowerBounds[respFnCntr];
-    RealVector& cell_fn_u_bnds = cellFnUpperBounds[respFnCntr];
-    for (size_t i=0; i <numCells; i++) {
-      cell_fn_l_bnds[i] =  DBL_MAX;
-      cell_fn_u_bnds[i] = -DBL_MAX; 
-    }
-    Cout << ">>>>> Identifying minimum and maximum samples for response "
-	 << "function " << respFnCntr+1 << " within cells 1 through "
-	 << numCells << '\n';
-    size_t i, j; IntRespMCIter it;
-    for (i=0, it=all_responses.begin(); i<numSamples; i++, ++it) {
-
-      const Real& fn_val = it->second.function_value(respFnCntr);
-      Variables vars = iteratedModel.current_variables().copy();
-      sample_to_variables(all_samples[i], vars);
-
-      const RealVector&  c_vars = vars.continuous_variables();
-      const IntVector&  di_vars = vars.discrete_int_variables();
-      const RealVector& dr_vars = vars.discrete_real_variables();
-
-      for (cellCntr=0; cellCntr<numCells; ++cellCntr) {
-        bool in_bounds = true;
-        for (j=0; j<numContIntervalVars; ++j)
-          if (c_vars[j] < cellContLowerBounds[cellCntr][j] ||
-              c_vars[j] > cellContUpperBounds[cellCntr][j])
-            { in_bounds = false; break; }
-        if (in_bounds)
-          for (j=0; j<numDiscIntervalVars; ++j)
-            if (di_vars[j] < cellIntRangeLowerBounds[cellCntr][j] ||
-                di_vars[j] > cellIntRangeUpperBounds[cellCntr][j]) // TO DO
-              { in_bounds = false; break; }
-        if (in_bounds)
-          for (j=0; j<numDiscSetIntUncVars; ++j)
-            if (di_vars[j+numDiscIntervalVars] != cellIntSetBounds[cellCntr][j]) // TO DO
-              { in_bounds = false; break; }
-        if (in_bounds)
-          for (j=0; j<numDiscSetRealUncVars; ++j)
-            if (dr_vars[j] != cellRealSetBounds[cellCntr][j]) // TO DO
-              { in_bounds = false; break; }
-
-	if (in_bounds) {
-	  if (fn_val < cell_fn_l_bnds[cellCntr]) 
-	    cell_fn_l_bnds[cellCntr] = fn_val;
-	  if (fn_val > cell_fn_u_bnds[cellCntr])
-	    cell_fn_u_bnds[cellCntr] = fn_val;
-	}
+    cellFnLowerBounds[respFnCntr] =  DBL_MAX;
+    cellFnUpperBounds[respFnCntr] = -DBL_MAX;
+  }
+  Cout << ">>>>> Identifying minimum and maximum samples for response "
+       << "functions 1 through " << numFunctions << " within cells 1 through "
+       << numCells << '\n';
+
+  // Locate the cell(s) containing each sample by binary search over the
+  // interval end points of each variable, then update the min/max of
+  // these cells for all response functions within the same pass
+  size_t num_di_vars = numDiscIntervalVars + numDiscSetIntUncVars,
+    num_interval_vars = numContIntervalVars + num_di_vars
+                      + numDiscSetRealUncVars;
+  RealVector interval_vals(num_interval_vars, false);
+  SizetArray cells;
+  Variables vars = iteratedModel.current_variables().copy();
+  IntRespMCIter it;
+  for (i=0, it=all_responses.begin(); i<numSamples; i++, ++it) {
+
+    sample_to_variables(all_samples[i], vars);
+    const RealVector&  c_vars = vars.continuous_variables();
+    const IntVector&  di_vars = vars.discrete_int_variables();
+    const RealVector& dr_vars = vars.discrete_real_variables();
+    for (j=0, k=0; j<numContIntervalVars; ++j, ++k)
+      interval_vals[k] = c_vars[j];
+    for (j=0; j<num_di_vars; ++j, ++k)
+      interval_vals[k] = (Real)di_vars[j];
+    for (j=0; j<numDiscSetRealUncVars; ++j, ++k)
+      interval_vals[k] = dr_vars[j];
+    locate_cells(interval_vals, cells);
+
+    const RealVector& fn_vals = it->second.function_values();
+    size_t c, num_sample_cells = cells.size();
+    for (c=0; c<num_sample_cells; ++c) {
+      cellCntr = cells[c];
+      for (respFnCntr=0; respFnCntr<numFunctions; ++respFnCntr) {
+	const Real& fn_val = fn_vals[respFnCntr];
+	Real& cell_fn_l_bnd = cellFnLowerBounds[respFnCntr][cellCntr];
+	Real& cell_fn_u_bnd = cellFnUpperBounds[respFnCntr][cellCntr];
+	if (fn_val < cell_fn_l_bnd) cell_fn_l_bnd = fn_val;
+	if (fn_val > cell_fn_u_bnd) cell_fn_u_bnd = fn_val;
       }
     }
+  }
+
+  for (respFnCntr=0; respFnCntr<numFunctions; ++respFnCntr) {
 #ifdef DEBUG
     for (i=0; i<numCells; i++) {
-      Cout << "CMAX " <<i<< " is " << cell_fn_u_bnds[i] << '\n' ;
-      Cout << "CMIN " <<i<< " is " << cell_fn_l_bnds[i] << '\n' ;
+      Cout << "CMAX " <<i<< " is " << cellFnUpperBounds[respFnCntr][i] << '\n';
+      Cout << "CMIN " <<i<< " is " << cellFnLowerBounds[respFnCntr][i] << '\n';
     }
 #endif //DEBUG
 
-    // replace with fortran free function to calculate CBF, CPF
+    // Use the max and mins to determine the cumulative distributions
+    // of plausibility and belief
     calculate_cbf_cpf();
   }
 
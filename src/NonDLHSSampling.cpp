@@ -109,6 +109,16 @@ NonDLHSSampling::NonDLHSSampling(ProblemDescDB& problem_db, Model& model):
 	     << "final design will not." << std::endl;
     }
   }
+  if (streamingStats &&
+      ( varBasedDecompFlag || pcaFlag || wilksFlag || refineSamples.length() ||
+	epistemicStats || !numResponseFunctions ) ) {
+    Cerr << "Warning: 'streaming_statistics' not supported with variance-"
+	 << "based decomposition,\n         principal components, Wilks, "
+	 << "refinement samples, epistemic variables,\n         or objective/"
+	 << "calibration responses; all responses will be retained."
+	 << std::endl;
+    streamingStats = false;
+  }
   qoiSamplesMatrix.shape(numFunctions, 0);
 
   initialize_final_statistics();
@@ -655,6 +665,11 @@ void NonDLHSSampling::post_input()
     statistics on the set of responses if statsFlag is set. */
 void NonDLHSSampling::core_run()
 {
+  if (streaming_statistics()) {
+    stream_parameter_sets(iteratedModel);
+    return;
+  }
+
   bool log_resp_flag = (allDataFlag || statsFlag);
   bool log_best_flag = !numResponseFunctions; // DACE mode w/ opt or NLS
   evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
@@ -733,7 +748,8 @@ void NonDLHSSampling::post_run(std::ostream& s)
       // iteratively called by print_results. However, when the sampling iterator 
       // is a subiterator (e.g. in a nested model), print_results isn't called.
       // Compute stats here for all samples.
-      compute_statistics(allSamples, allResponses);
+      if (streaming_statistics()) compute_streamed_statistics();
+      else compute_statistics(allSamples, allResponses);
       // JAS TODO
       archive_results(numSamples); 
     }
@@ -1018,7 +1034,8 @@ void NonDLHSSampling::print_results(std::ostream& s, short results_state)
     print_sobol_indices(s);
   else if (statsFlag) {
     if(refineSamples.length() == 0) {
-      compute_statistics(allSamples, allResponses);
+      if (streaming_statistics()) compute_streamed_statistics();
+      else compute_statistics(allSamples, allResponses);
       archive_results(numSamples);
       int actual_samples = allSamples.numCols();
       print_header_and_statistics(s, actual_samples);
@@ -56,6 +56,7 @@ NonDLocalReliability(ProblemDescDB& problem_db, Model& model):
   initialPtUserSpec(
     probDescDB.get_bool("variables.uncertain.initial_point_flag")),
   npsolFlag(false), warmStartFlag(true), nipModeOverrideFlag(true),
+  lockstepFlag(probDescDB.get_bool("method.nond.lockstep_mpp_search")),
   curvatureDataAvailable(false), kappaUpdated(false),
   secondOrderIntType(HOHENRACK), curvatureThresh(1.e-10), warningBits(0)
 {
@@ -162,6 +163,19 @@ NonDLocalReliability(ProblemDescDB& problem_db, Model& model):
   if (err_flag)
     abort_handler(METHOD_ERROR);
 
+  // Lockstep searches defer the truth evaluations of approximation-based
+  // MPP searches, for which X-space data are recovered from U-space
+  // values and gradients.  FORM/SORM searches evaluate the truth model
+  // within the optimizer and are performed sequentially.
+  if ( lockstepFlag && ( !mppSearchType ||
+			 mppSearchType == SUBMETHOD_NO_APPROX ||
+			 taylorOrder == 2 || integrationOrder == 2 ) ) {
+    Cerr << "\nWarning: lockstep MPP searches require an approximation-based "
+	 << "MPP search with\n         first-order approximations and "
+	 << "integration.  Performing sequential\n         MPP searches.\n";
+    lockstepFlag = false;
+  }
+
   // The model of the limit state in u-space (uSpaceModel) is constructed here
   // one time.  The RecastModel for the RIA/PMA formulations varies with the
   // level requests and is constructed for each level within mpp_search().
@@ -831,200 +845,71 @@ void NonDLocalReliability::mpp_search()
   // Loop over each response function in the responses specification.  It is
   // important to note that the MPP iteration is different for each response 
   // function, and it is not possible to combine the model evaluations for
-  // multiple response functions.
-  size_t i;
-  const ShortArray& final_asv = finalStatistics.active_set_request_vector();
-  for (respFnCount=0; respFnCount<numFunctions; ++respFnCount) {
-
-    if (finalMomentsType) {
-      // approximate response mean already computed
-      finalStatistics.function_value(momentStats(0,respFnCount), statCount);
-      // sensitivity of response mean
-      if (final_asv[statCount] & 2) {
-	RealVector fn_grad_mean_x(numContinuousVars, false);
-	for (i=0; i<numContinuousVars; i++)
-	  fn_grad_mean_x[i] = fnGradsMeanX(i,respFnCount);
-	// evaluate dg/ds at the variable means and store in finalStatistics
-	RealVector final_stat_grad;
-	dg_ds_eval(ranVarMeansX, fn_grad_mean_x, final_stat_grad);
-	finalStatistics.function_gradient(final_stat_grad, statCount);
-      }
-      ++statCount;
+  // multiple response functions.  Lockstep searches instead overlap the
+  // evaluations of the separate iterations.
+  if (lockstepFlag)
+    lockstep_mpp_search();
+  else {
+    for (respFnCount=0; respFnCount<numFunctions; ++respFnCount) {
 
-      // approximate response std deviation or variance already computed
-      finalStatistics.function_value(momentStats(1,respFnCount), statCount);
-      // sensitivity of response std deviation
-      if (final_asv[statCount] & 2) {
-	// Differentiating the first-order second-moment expression leads to
-	// 2nd-order d^2g/dxds sensitivities which would be awkward to compute
-	// (nonstandard DVV containing active and inactive vars)
-	Cerr << "Error: response std deviation sensitivity not yet supported."
-	     << std::endl;
-	abort_handler(METHOD_ERROR);
-	// TO DO: back out from RIA/PMA equations (use closest level to mean?):
-	// RIA: dsigma/ds = (dmean/ds - sigma dbeta_cdf/ds) / beta_cdf
-	// PMA: dsigma/ds = (dmean/ds - dz/ds) / beta_cdf
-      }
-      ++statCount;
-    }
+      // approximate response moments and their sensitivities
+      assign_final_moments();
 
-    // The most general case is to allow a combination of response, probability,
-    // reliability, and generalized reliability level specifications for each
-    // response function.
-    size_t rl_len = requestedRespLevels[respFnCount].length(),
-           pl_len = requestedProbLevels[respFnCount].length(),
-           bl_len = requestedRelLevels[respFnCount].length(),
-           gl_len = requestedGenRelLevels[respFnCount].length(),
-           index, num_levels = rl_len + pl_len + bl_len + gl_len;
+      // The most general case is to allow a combination of response,
+      // probability, reliability, and generalized reliability level
+      // specifications for each response function.
+      size_t num_levels = requestedRespLevels[respFnCount].length()
+	+ requestedProbLevels[respFnCount].length()
+	+ requestedRelLevels[respFnCount].length()
+	+ requestedGenRelLevels[respFnCount].length();
 
-    // Initialize (or warm-start for repeated reliability analyses) initialPtU,
-    // mostProbPointX/U, computedRespLevel, fnGradX/U, and fnHessX/U.
-    curvatureDataAvailable = false; // no data (yet) for this response function
-    if (num_levels)
-      initialize_level_data();
+      // Initialize (or warm-start for repeated reliability analyses)
+      // initialPtU, mostProbPointX/U, computedRespLevel, fnGradX/U, and
+      // fnHessX/U.
+      curvatureDataAvailable = false; // no data (yet) for this response fn
+      if (num_levels)
+	initialize_level_data();
 
-    // Loop over response/probability/reliability levels
-    for (levelCount=0; levelCount<num_levels; ++levelCount) {
+      // Loop over response/probability/reliability levels
+      for (levelCount=0; levelCount<num_levels; ++levelCount) {
 
-      // The rl_len response levels are performed first using the RIA
-      // formulation, followed by the pl_len probability levels and the
-      // bl_len reliability levels using the PMA formulation.
-      bool ria_flag = (levelCount < rl_len),
-	pma2_flag = ( integrationOrder == 2 && ( levelCount < rl_len + pl_len ||
-		      levelCount >= rl_len + pl_len + bl_len ) );
-      if (ria_flag) {
-        requestedTargetLevel = requestedRespLevels[respFnCount][levelCount];
-	Cout << "\n>>>>> Reliability Index Approach (RIA) for response level "
-	     << levelCount+1 << " = " << requestedTargetLevel << '\n';
-      }
-      else if (levelCount < rl_len + pl_len) { 
-	index  = levelCount - rl_len;
-	Real p = requestedProbLevels[respFnCount][index];
-	Cout << "\n>>>>> Performance Measure Approach (PMA) for probability "
-	     << "level " << index + 1 << " = " << p << '\n';
-	// gen beta target for 2nd-order PMA; beta target for 1st-order PMA:
-	requestedTargetLevel = reliability(p);
-
-	// CDF probability < 0.5  -->  CDF beta > 0  -->  minimize g
-	// CDF probability > 0.5  -->  CDF beta < 0  -->  maximize g
-	// CDF probability = 0.5  -->  CDF beta = 0  -->  compute g
-	// Note: "compute g" means that min/max is irrelevant since there is
-	// a single G(u) value when the radius beta collapses to the origin
-	Real p_cdf   = (cdfFlag) ? p : 1. - p;
-	pmaMaximizeG = (p_cdf > 0.5); // updated in update_pma_maximize()
-      }
-      else if (levelCount < rl_len + pl_len + bl_len) {
-	index = levelCount - rl_len - pl_len;
-	requestedTargetLevel = requestedRelLevels[respFnCount][index];
-	Cout << "\n>>>>> Performance Measure Approach (PMA) for reliability "
-	     << "level " << index + 1 << " = " << requestedTargetLevel << '\n';
-	Real beta_cdf = (cdfFlag) ?
-	  requestedTargetLevel : -requestedTargetLevel;
-	pmaMaximizeG = (beta_cdf < 0.);
-      }
-      else {
-	index = levelCount - rl_len - pl_len - bl_len;
-	requestedTargetLevel = requestedGenRelLevels[respFnCount][index];
-	Cout << "\n>>>>> Performance Measure Approach (PMA) for generalized "
-	     << "reliability level " << index + 1 << " = "
-	     << requestedTargetLevel << '\n';
-	Real gen_beta_cdf = (cdfFlag) ?
-	  requestedTargetLevel : -requestedTargetLevel;
-	pmaMaximizeG = (gen_beta_cdf < 0.); // updated in update_pma_maximize()
-      }
+	// Assign requestedTargetLevel and pmaMaximizeG for this level
+	assign_level_target();
 
-      // Assign cold/warm-start values for initialPtU, mostProbPointX/U,
-      // computedRespLevel, fnGradX/U, and fnHessX/U.
-      if (levelCount)
-	initialize_mpp_search_data();
+	// Assign cold/warm-start values for initialPtU, mostProbPointX/U,
+	// computedRespLevel, fnGradX/U, and fnHessX/U.
+	if (levelCount)
+	  initialize_mpp_search_data();
 
 #ifdef DERIV_DEBUG
-      // numerical verification of analytic Jacobian/Hessian routines
-      if (mppSearchType == SUBMETHOD_NO_APPROX && levelCount == 0)
-        mostProbPointU = ranVarMeansU;//mostProbPointX = ranVarMeansX;
-      //nataf.verify_trans_jacobian_hessian(mostProbPointU);
-      //nataf.verify_trans_jacobian_hessian(mostProbPointX);
-      nataf.verify_design_jacobian(mostProbPointU);
+	// numerical verification of analytic Jacobian/Hessian routines
+	if (mppSearchType == SUBMETHOD_NO_APPROX && levelCount == 0)
+	  mostProbPointU = ranVarMeansU;//mostProbPointX = ranVarMeansX;
+	//nataf.verify_trans_jacobian_hessian(mostProbPointU);
+	//nataf.verify_trans_jacobian_hessian(mostProbPointX);
+	nataf.verify_design_jacobian(mostProbPointU);
 #endif // DERIV_DEBUG
 
-      // For AMV+/TANA approximations, iterate until current expansion point
-      // converges to the MPP.
-      approxIters = 0;
-      approxConverged = false;
-      while (!approxConverged) {
-
-	Sizet2DArray vars_map, primary_resp_map, secondary_resp_map;
-	BoolDequeArray nonlinear_resp_map(2);
-	std::shared_ptr<RecastModel> mpp_model_rep =
-	  std::static_pointer_cast<RecastModel>(mppModel.model_rep());
-	if (ria_flag) { // RIA: g is in constraint
-	  primary_resp_map.resize(1);   // one objective, no contributors
-	  secondary_resp_map.resize(1); // one constraint, one contributor
-	  secondary_resp_map[0].resize(1);
-	  secondary_resp_map[0][0] = respFnCount;
-	  nonlinear_resp_map[1] = BoolDeque(1, false);
-	  mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
-	    primary_resp_map, secondary_resp_map, nonlinear_resp_map,
-	    RIA_objective_eval, RIA_constraint_eval);
-	}
-	else { // PMA: g is in objective
-	  primary_resp_map.resize(1);   // one objective, one contributor
-	  primary_resp_map[0].resize(1);
-	  primary_resp_map[0][0] = respFnCount;
-	  secondary_resp_map.resize(1); // one constraint, no contributors
-	  nonlinear_resp_map[0] = BoolDeque(1, false);
-	  // If 2nd-order PMA with p-level or generalized beta-level, use
-	  // PMA2_set_mapping() & PMA2_constraint_eval().  For approx-based
-	  // 2nd-order PMA, we utilize curvature of the surrogate (if any)
-	  // to update beta* 
-	  if (pma2_flag)
-	    mpp_model_rep->init_maps(vars_map, false, NULL, PMA2_set_mapping,
-	      primary_resp_map, secondary_resp_map, nonlinear_resp_map,
-	      PMA_objective_eval, PMA2_constraint_eval);
-	  else
-	    mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
-	      primary_resp_map, secondary_resp_map, nonlinear_resp_map,
-	      PMA_objective_eval, PMA_constraint_eval);	    
-	}
-	mppModel.continuous_variables(initialPtU);
-
-        // Execute MPP search and retrieve u-space results
-        Cout << "\n>>>>> Initiating search for most probable point (MPP)\n";
-	ParLevLIter pl_iter
-	  = methodPCIter->mi_parallel_level_iterator(miPLIndex);
-	mppOptimizer.run(pl_iter);
-        const Variables& vars_star = mppOptimizer.variables_results();
-        const Response&  resp_star = mppOptimizer.response_results();
-	const RealVector& fns_star = resp_star.function_values();
-        Cout << "\nResults of MPP optimization:\nInitial point (u-space) =\n"
-             << initialPtU << "Final point (u-space)   =\n"
-	     << vars_star.continuous_variables();
-	if (ria_flag)
-	  Cout << "RIA optimum             =\n                     "
-	       << std::setw(write_precision+7) << fns_star[0] << " [u'u]\n"
-	       << "                     " << std::setw(write_precision+7)
-	       << fns_star[1] << " [G(u) - z]\n";
-	else {
-	  Cout << "PMA optimum             =\n                     "
-	       << std::setw(write_precision+7) << fns_star[0] << " [";
-	  if (pmaMaximizeG) Cout << '-';
-	  Cout << "G(u)]\n                     " << std::setw(write_precision+7)
-	       << fns_star[1];
-	  if (pma2_flag) Cout << " [B* - bar-B*]\n";
-	  else           Cout << " [u'u - B^2]\n";
-	}
+	// For AMV+/TANA approximations, iterate until current expansion point
+	// converges to the MPP.
+	approxIters = 0;
+	approxConverged = false;
+	while (!approxConverged) {
 
-	// Update MPP search data
-	update_mpp_search_data(vars_star, resp_star);
+	  // Execute MPP search and update MPP search data
+	  mpp_optimization();
+	  update_mpp_search_data(mppOptimizer.variables_results(),
+				 mppOptimizer.response_results());
 
-      } // end AMV+ while loop
+	} // end AMV+ while loop
 
-      // Update response/probability/reliability level data
-      update_level_data();
+	// Update response/probability/reliability level data
+	update_level_data();
 
-      ++statCount;
-    } // end loop over levels
-  } // end loop over response fns
+	++statCount;
+      } // end loop over levels
+    } // end loop over response fns
+  }
 
   // Update warm-start data
   if (warmStartFlag && subIteratorFlag) // view->copy
@@ -1039,6 +924,286 @@ void NonDLocalReliability::mpp_search()
 }
 
 
+/** Performs the MPP searches of all response functions concurrently.
+    Each cycle solves the approximate RIA/PMA subproblem of every active
+    search (inexpensive, as these are posed on the limit state
+    approximations), evaluates the truth model at the resulting MPP
+    estimates concurrently, and then updates each approximation.  Searches
+    that converge advance to their next level, for which they are warm
+    started from the MPP of the previous level, such that the number of
+    concurrent truth evaluations is the number of response functions with
+    remaining levels. */
+void NonDLocalReliability::lockstep_mpp_search()
+{
+  std::vector<MPPSearchState> searches;
+  for (respFnCount=0; respFnCount<numFunctions; ++respFnCount) {
+
+    // approximate response moments and their sensitivities
+    assign_final_moments();
+
+    size_t num_levels = requestedRespLevels[respFnCount].length()
+      + requestedProbLevels[respFnCount].length()
+      + requestedRelLevels[respFnCount].length()
+      + requestedGenRelLevels[respFnCount].length();
+    if (num_levels) {
+      // Initialize (or warm-start) the search data at level 0
+      curvatureDataAvailable = false;
+      levelCount = 0;
+      initialize_level_data();
+      MPPSearchState search;
+      search.numLevels = num_levels;
+      search.newLevel  = true;
+      store_search_state(search);
+      searches.push_back(search);
+    }
+    statCount += num_levels;
+  }
+
+  size_t s, cycle = 0, num_active = searches.size();
+  SizetArray active_searches(num_active);
+  for (s=0; s<num_active; ++s)
+    active_searches[s] = s;
+  bool asynch_flag = uSpaceModel.asynch_flag();
+  while (!active_searches.empty()) {
+
+    num_active = active_searches.size();
+    Cout << "\n>>>>> Lockstep MPP search cycle " << ++cycle << " for "
+	 << num_active << " response function(s)\n";
+
+    // Solve the approximate subproblems at the current expansion points
+    for (s=0; s<num_active; ++s) {
+      MPPSearchState& search = searches[active_searches[s]];
+      restore_search_state(search);
+      SizetSet surr_fn_indices;
+      surr_fn_indices.insert(respFnCount);
+      uSpaceModel.surrogate_function_indices(surr_fn_indices);
+      if (search.newLevel) {
+	assign_level_target();
+	if (levelCount)
+	  initialize_mpp_search_data();
+	approxIters = 0;
+	approxConverged = false;
+	search.newLevel = false;
+      }
+      mpp_optimization();
+      copy_data(mppOptimizer.response_results().function_values(),
+		search.fnsStar);
+      search.truthMode = update_mpp_iterate(
+	mppOptimizer.variables_results().continuous_variables());
+      store_search_state(search);
+    }
+
+    // Evaluate the truth model at the new MPP estimates
+    Cout << "\n>>>>> Evaluating " << num_active << " MPP estimate(s)\n";
+    uSpaceModel.component_parallel_mode(TRUTH_MODEL_MODE);
+    uSpaceModel.surrogate_response_mode(BYPASS_SURROGATE);
+    std::map<int, size_t> eval_search;
+    IntResponseMap truth_responses;
+    for (s=0; s<num_active; ++s) {
+      const MPPSearchState& search = searches[active_searches[s]];
+      uSpaceModel.continuous_variables(search.mppU);
+      activeSet.request_values(0);
+      activeSet.request_value(search.truthMode, search.respFn);
+      if (asynch_flag)
+	uSpaceModel.evaluate_nowait(activeSet);
+      else {
+	uSpaceModel.evaluate(activeSet);
+	truth_responses[uSpaceModel.evaluation_id()]
+	  = uSpaceModel.current_response().copy();
+      }
+      eval_search[uSpaceModel.evaluation_id()] = active_searches[s];
+    }
+    if (asynch_flag)
+      truth_responses = uSpaceModel.synchronize();
+    uSpaceModel.surrogate_response_mode(UNCORRECTED_SURROGATE); // restore
+
+    // Update the approximations and advance converged searches
+    active_searches.clear();
+    for (IntRespMCIter r_it=truth_responses.begin();
+	 r_it!=truth_responses.end(); ++r_it) {
+      size_t index = eval_search[r_it->first];
+      MPPSearchState& search = searches[index];
+      restore_search_state(search);
+      SizetSet surr_fn_indices;
+      surr_fn_indices.insert(respFnCount);
+      uSpaceModel.surrogate_function_indices(surr_fn_indices);
+      assign_truth_response(search.truthMode, r_it->second);
+      update_mpp_approximation();
+      update_computed_reliability(search.fnsStar);
+      if (approxConverged) {
+	// Update response/probability/reliability level data
+	update_level_data();
+	++levelCount; ++statCount;
+	search.newLevel = true;
+      }
+      store_search_state(search);
+      if (levelCount < search.numLevels)
+	active_searches.push_back(index);
+    }
+  }
+}
+
+
+void NonDLocalReliability::assign_final_moments()
+{
+  if (!finalMomentsType)
+    return;
+
+  const ShortArray& final_asv = finalStatistics.active_set_request_vector();
+  // approximate response mean already computed
+  finalStatistics.function_value(momentStats(0,respFnCount), statCount);
+  // sensitivity of response mean
+  if (final_asv[statCount] & 2) {
+    RealVector fn_grad_mean_x(numContinuousVars, false);
+    for (size_t i=0; i<numContinuousVars; i++)
+      fn_grad_mean_x[i] = fnGradsMeanX(i,respFnCount);
+    // evaluate dg/ds at the variable means and store in finalStatistics
+    RealVector final_stat_grad;
+    dg_ds_eval(ranVarMeansX, fn_grad_mean_x, final_stat_grad);
+    finalStatistics.function_gradient(final_stat_grad, statCount);
+  }
+  ++statCount;
+
+  // approximate response std deviation or variance already computed
+  finalStatistics.function_value(momentStats(1,respFnCount), statCount);
+  // sensitivity of response std deviation
+  if (final_asv[statCount] & 2) {
+    // Differentiating the first-order second-moment expression leads to
+    // 2nd-order d^2g/dxds sensitivities which would be awkward to compute
+    // (nonstandard DVV containing active and inactive vars)
+    Cerr << "Error: response std deviation sensitivity not yet supported."
+	 << std::endl;
+    abort_handler(METHOD_ERROR);
+    // TO DO: back out from RIA/PMA equations (use closest level to mean?):
+    // RIA: dsigma/ds = (dmean/ds - sigma dbeta_cdf/ds) / beta_cdf
+    // PMA: dsigma/ds = (dmean/ds - dz/ds) / beta_cdf
+  }
+  ++statCount;
+}
+
+
+/** The rl_len response levels are performed first using the RIA
+    formulation, followed by the pl_len probability levels and the
+    bl_len reliability levels using the PMA formulation. */
+void NonDLocalReliability::assign_level_target()
+{
+  size_t rl_len = requestedRespLevels[respFnCount].length(),
+         pl_len = requestedProbLevels[respFnCount].length(),
+         bl_len = requestedRelLevels[respFnCount].length(), index;
+  if (levelCount < rl_len) {
+    requestedTargetLevel = requestedRespLevels[respFnCount][levelCount];
+    Cout << "\n>>>>> Reliability Index Approach (RIA) for response level "
+	 << levelCount+1 << " = " << requestedTargetLevel << '\n';
+  }
+  else if (levelCount < rl_len + pl_len) { 
+    index  = levelCount - rl_len;
+    Real p = requestedProbLevels[respFnCount][index];
+    Cout << "\n>>>>> Performance Measure Approach (PMA) for probability "
+	 << "level " << index + 1 << " = " << p << '\n';
+    // gen beta target for 2nd-order PMA; beta target for 1st-order PMA:
+    requestedTargetLevel = reliability(p);
+
+    // CDF probability < 0.5  -->  CDF beta > 0  -->  minimize g
+    // CDF probability > 0.5  -->  CDF beta < 0  -->  maximize g
+    // CDF probability = 0.5  -->  CDF beta = 0  -->  compute g
+    // Note: "compute g" means that min/max is irrelevant since there is
+    // a single G(u) value when the radius beta collapses to the origin
+    Real p_cdf   = (cdfFlag) ? p : 1. - p;
+    pmaMaximizeG = (p_cdf > 0.5); // updated in update_pma_maximize()
+  }
+  else if (levelCount < rl_len + pl_len + bl_len) {
+    index = levelCount - rl_len - pl_len;
+    requestedTargetLevel = requestedRelLevels[respFnCount][index];
+    Cout << "\n>>>>> Performance Measure Approach (PMA) for reliability "
+	 << "level " << index + 1 << " = " << requestedTargetLevel << '\n';
+    Real beta_cdf = (cdfFlag) ?
+      requestedTargetLevel : -requestedTargetLevel;
+    pmaMaximizeG = (beta_cdf < 0.);
+  }
+  else {
+    index = levelCount - rl_len - pl_len - bl_len;
+    requestedTargetLevel = requestedGenRelLevels[respFnCount][index];
+    Cout << "\n>>>>> Performance Measure Approach (PMA) for generalized "
+	 << "reliability level " << index + 1 << " = "
+	 << requestedTargetLevel << '\n';
+    Real gen_beta_cdf = (cdfFlag) ?
+      requestedTargetLevel : -requestedTargetLevel;
+    pmaMaximizeG = (gen_beta_cdf < 0.); // updated in update_pma_maximize()
+  }
+}
+
+
+void NonDLocalReliability::mpp_optimization()
+{
+  size_t rl_len = requestedRespLevels[respFnCount].length(),
+         pl_len = requestedProbLevels[respFnCount].length(),
+         bl_len = requestedRelLevels[respFnCount].length();
+  bool ria_flag = (levelCount < rl_len),
+    pma2_flag = ( integrationOrder == 2 && ( levelCount < rl_len + pl_len ||
+		  levelCount >= rl_len + pl_len + bl_len ) );
+
+  Sizet2DArray vars_map, primary_resp_map, secondary_resp_map;
+  BoolDequeArray nonlinear_resp_map(2);
+  std::shared_ptr<RecastModel> mpp_model_rep =
+    std::static_pointer_cast<RecastModel>(mppModel.model_rep());
+  if (ria_flag) { // RIA: g is in constraint
+    primary_resp_map.resize(1);   // one objective, no contributors
+    secondary_resp_map.resize(1); // one constraint, one contributor
+    secondary_resp_map[0].resize(1);
+    secondary_resp_map[0][0] = respFnCount;
+    nonlinear_resp_map[1] = BoolDeque(1, false);
+    mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
+      primary_resp_map, secondary_resp_map, nonlinear_resp_map,
+      RIA_objective_eval, RIA_constraint_eval);
+  }
+  else { // PMA: g is in objective
+    primary_resp_map.resize(1);   // one objective, one contributor
+    primary_resp_map[0].resize(1);
+    primary_resp_map[0][0] = respFnCount;
+    secondary_resp_map.resize(1); // one constraint, no contributors
+    nonlinear_resp_map[0] = BoolDeque(1, false);
+    // If 2nd-order PMA with p-level or generalized beta-level, use
+    // PMA2_set_mapping() & PMA2_constraint_eval().  For approx-based
+    // 2nd-order PMA, we utilize curvature of the surrogate (if any)
+    // to update beta* 
+    if (pma2_flag)
+      mpp_model_rep->init_maps(vars_map, false, NULL, PMA2_set_mapping,
+	primary_resp_map, secondary_resp_map, nonlinear_resp_map,
+	PMA_objective_eval, PMA2_constraint_eval);
+    else
+      mpp_model_rep->init_maps(vars_map, false, NULL, NULL,
+	primary_resp_map, secondary_resp_map, nonlinear_resp_map,
+	PMA_objective_eval, PMA_constraint_eval);	    
+  }
+  mppModel.continuous_variables(initialPtU);
+
+  // Execute MPP search and retrieve u-space results
+  Cout << "\n>>>>> Initiating search for most probable point (MPP)\n";
+  ParLevLIter pl_iter = methodPCIter->mi_parallel_level_iterator(miPLIndex);
+  mppOptimizer.run(pl_iter);
+  const Variables& vars_star = mppOptimizer.variables_results();
+  const Response&  resp_star = mppOptimizer.response_results();
+  const RealVector& fns_star = resp_star.function_values();
+  Cout << "\nResults of MPP optimization:\nInitial point (u-space) =\n"
+       << initialPtU << "Final point (u-space)   =\n"
+       << vars_star.continuous_variables();
+  if (ria_flag)
+    Cout << "RIA optimum             =\n                     "
+	 << std::setw(write_precision+7) << fns_star[0] << " [u'u]\n"
+	 << "                     " << std::setw(write_precision+7)
+	 << fns_star[1] << " [G(u) - z]\n";
+  else {
+    Cout << "PMA optimum             =\n                     "
+	 << std::setw(write_precision+7) << fns_star[0] << " [";
+    if (pmaMaximizeG) Cout << '-';
+    Cout << "G(u)]\n                     " << std::setw(write_precision+7)
+	 << fns_star[1];
+    if (pma2_flag) Cout << " [B* - bar-B*]\n";
+    else           Cout << " [u'u - B^2]\n";
+  }
+}
+
+
 /** An initial first- or second-order Taylor-series approximation is
     required for MV/AMV/AMV+/TANA or for the case where momentStats
     (from MV) are required within finalStatistics for subIterator usage
@@ -1497,91 +1662,20 @@ void NonDLocalReliability::initialize_mpp_search_data()
 void NonDLocalReliability::
 update_mpp_search_data(const Variables& vars_star, const Response& resp_star)
 {
-  size_t rl_len = requestedRespLevels[respFnCount].length(),
-         pl_len = requestedProbLevels[respFnCount].length(),
-         bl_len = requestedRelLevels[respFnCount].length();
-  bool ria_flag = (levelCount < rl_len);
-  const RealVector&    mpp_u = vars_star.continuous_variables(); // view
-  const RealVector& fns_star = resp_star.function_values();
-
-  // Update MPP arrays from optimization results
-  Real conv_metric;
-  switch (mppSearchType) {
-  case SUBMETHOD_AMV_PLUS_X:  case SUBMETHOD_TANA_X:  case SUBMETHOD_QMEA_X:
-  case SUBMETHOD_AMV_PLUS_U:  case SUBMETHOD_TANA_U:  case SUBMETHOD_QMEA_U: {
-    RealVector del_u(numContinuousVars, false);
-    for (size_t i=0; i<numContinuousVars; i++)
-      del_u[i] = mpp_u[i] - mostProbPointU[i];
-    conv_metric = del_u.normFrobenius();
-    break;
-  }
-  }
-  copy_data(mpp_u, mostProbPointU); // view -> copy
-
-  // Set computedRespLevel to the current g(x) value by either performing
-  // a validation function evaluation (AMV/AMV+) or retrieving data from
-  // resp_star (FORM).  Also update approximations and convergence tols.
-  switch (mppSearchType) {
-  case SUBMETHOD_AMV_X: case SUBMETHOD_AMV_U: {
-    approxConverged = true; // break out of while loop
-    truth_evaluation(1); // only update truth function value
-    break;
-  }
-  case SUBMETHOD_AMV_PLUS_X:  case SUBMETHOD_TANA_X:  case SUBMETHOD_QMEA_X:
-  case SUBMETHOD_AMV_PLUS_U:  case SUBMETHOD_TANA_U:  case SUBMETHOD_QMEA_U: {
-    // Assess AMV+/TANA iteration convergence.  ||del_u|| is not a perfect
-    // metric since cycling between MPP estimates can occur.  Therefore,
-    // a maximum number of iterations is also enforced.
-    //conv_metric = std::fabs(fn_vals[respFnCount] - requestedRespLevel);
-    ++approxIters;
-    if (conv_metric < convergenceTol)
-      approxConverged = true;
-    else if (approxIters >= maxIterations) {
-      Cerr << "\nWarning: maximum number of limit state approximation cycles "
-	   << "exceeded.\n";
-      warningBits |= 1; // first warning in output summary
-      approxConverged = true;
-    }
-    // Update response data for local/multipoint MPP approximation
-    short mode = 1;
-    if (approxConverged) {
-      Cout << "\n>>>>> Approximate MPP iterations converged.  "
-	   << "Evaluating final response.\n";
-      // fnGradX/U needed for warm starting by projection, final_stat_grad,
-      // and/or 2nd-order integration.
-      const ShortArray& final_asv = finalStatistics.active_set_request_vector();
-      if ( warmStartFlag || ( final_asv[statCount] & 2 ) )
-	mode |= 2;
-      if (integrationOrder == 2)
-	mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
-    }
-    else { // not converged
-      Cout << "\n>>>>> Updating approximation for MPP iteration "
-	   << approxIters+1 << "\n";
-      mode |= 2;            // update AMV+/TANA approximation
-      if (taylorOrder == 2) // update AMV^2+ approximation
-	mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
-      if (warmStartFlag) // warm start initialPtU for next AMV+ iteration
-	initialPtU = mostProbPointU;
-    }
-
-    // evaluate new expansion point
-    truth_evaluation(mode);
-#ifdef MPP_CONVERGE_RATE
-    Cout << "u'u = "  << mostProbPointU.dot(mostProbPointU)
-	 << " G(u) = " << computedRespLevel << '\n';
-#endif // MPP_CONVERGE_RATE
-
-    // Update the limit state surrogate model
-    update_limit_state_surrogate();
-
-    // Update pmaMaximizeG if 2nd-order PMA for specified p / beta* level
-    if ( !approxConverged && !ria_flag && integrationOrder == 2 )
-      update_pma_maximize(mostProbPointU, fnGradU, fnHessU);
-
-    break;
-  }
-  case SUBMETHOD_NO_APPROX: { // FORM/SORM
+  const RealVector& mpp_u = vars_star.continuous_variables(); // view
+  if (mppSearchType < SUBMETHOD_NO_APPROX) { // AMV/AMV+/TANA/QMEA
+    // Set computedRespLevel to the current g(x) value by performing a
+    // validation function evaluation and update approximations
+    truth_evaluation(update_mpp_iterate(mpp_u));
+    update_mpp_approximation();
+  }
+  else { // FORM/SORM
+    size_t rl_len = requestedRespLevels[respFnCount].length(),
+           pl_len = requestedProbLevels[respFnCount].length(),
+           bl_len = requestedRelLevels[respFnCount].length();
+    bool ria_flag = (levelCount < rl_len);
+    const RealVector& fns_star = resp_star.function_values();
+    copy_data(mpp_u, mostProbPointU); // view -> copy
 
     // direct optimization converges to MPP: no new approximation to compute
     approxConverged = true; // break out of while loop
@@ -1650,7 +1744,7 @@ update_mpp_search_data(const Variables& vars_star, const Response& resp_star)
       PRPCacheHIter cache_it = lookup_by_val(data_pairs,
 	iteratedModel.interface_id(), search_vars, search_set);
       if (cache_it != data_pairs.get<hashed>().end()) {
-        fnHessX = cache_it->response().function_hessian(respFnCount);
+	fnHessX = cache_it->response().function_hessian(respFnCount);
 	uSpaceModel.trans_hess_X_to_U(fnHessX, fnHessU, mostProbPointX,fnGradX);
 	curvatureDataAvailable = true; kappaUpdated = false;
 	found_mode |= 4;
@@ -1662,12 +1756,94 @@ update_mpp_search_data(const Variables& vars_star, const Response& resp_star)
       Cout << "\n>>>>> Evaluating limit state derivatives at MPP\n";
       truth_evaluation(remaining_mode);
     }
-    break;
-  }
   }
 
   // set computedRelLevel using u'u from fns_star; must follow fnGradU update
-  if (ria_flag)
+  update_computed_reliability(resp_star.function_values());
+}
+
+
+/** Updates mostProbPointU and assesses convergence of the AMV/AMV+/TANA
+    iteration, returning the data required from the truth evaluation at
+    the updated MPP estimate. */
+short NonDLocalReliability::update_mpp_iterate(const RealVector& mpp_u)
+{
+  if (mppSearchType == SUBMETHOD_AMV_X || mppSearchType == SUBMETHOD_AMV_U) {
+    copy_data(mpp_u, mostProbPointU); // view -> copy
+    approxConverged = true; // break out of while loop
+    return 1; // only update truth function value
+  }
+
+  // Assess AMV+/TANA iteration convergence.  ||del_u|| is not a perfect
+  // metric since cycling between MPP estimates can occur.  Therefore,
+  // a maximum number of iterations is also enforced.
+  //conv_metric = std::fabs(fn_vals[respFnCount] - requestedRespLevel);
+  RealVector del_u(numContinuousVars, false);
+  for (size_t i=0; i<numContinuousVars; i++)
+    del_u[i] = mpp_u[i] - mostProbPointU[i];
+  Real conv_metric = del_u.normFrobenius();
+  copy_data(mpp_u, mostProbPointU); // view -> copy
+
+  ++approxIters;
+  if (conv_metric < convergenceTol)
+    approxConverged = true;
+  else if (approxIters >= maxIterations) {
+    Cerr << "\nWarning: maximum number of limit state approximation cycles "
+	 << "exceeded.\n";
+    warningBits |= 1; // first warning in output summary
+    approxConverged = true;
+  }
+  // Update response data for local/multipoint MPP approximation
+  short mode = 1;
+  if (approxConverged) {
+    Cout << "\n>>>>> Approximate MPP iterations converged.  "
+	 << "Evaluating final response.\n";
+    // fnGradX/U needed for warm starting by projection, final_stat_grad,
+    // and/or 2nd-order integration.
+    const ShortArray& final_asv = finalStatistics.active_set_request_vector();
+    if ( warmStartFlag || ( final_asv[statCount] & 2 ) )
+      mode |= 2;
+    if (integrationOrder == 2)
+      mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
+  }
+  else { // not converged
+    Cout << "\n>>>>> Updating approximation for MPP iteration "
+	 << approxIters+1 << "\n";
+    mode |= 2;            // update AMV+/TANA approximation
+    if (taylorOrder == 2) // update AMV^2+ approximation
+      mode |= 4;// RecastModel::transform_set() augments if nonlinear_vars_map
+    if (warmStartFlag) // warm start initialPtU for next AMV+ iteration
+      initialPtU = mostProbPointU;
+  }
+  return mode;
+}
+
+
+void NonDLocalReliability::update_mpp_approximation()
+{
+  // AMV approximations are not updated
+  if (mppSearchType == SUBMETHOD_AMV_X || mppSearchType == SUBMETHOD_AMV_U)
+    return;
+
+#ifdef MPP_CONVERGE_RATE
+  Cout << "u'u = "  << mostProbPointU.dot(mostProbPointU)
+       << " G(u) = " << computedRespLevel << '\n';
+#endif // MPP_CONVERGE_RATE
+
+  // Update the limit state surrogate model
+  update_limit_state_surrogate();
+
+  // Update pmaMaximizeG if 2nd-order PMA for specified p / beta* level
+  bool ria_flag = (levelCount < requestedRespLevels[respFnCount].length());
+  if ( !approxConverged && !ria_flag && integrationOrder == 2 )
+    update_pma_maximize(mostProbPointU, fnGradU, fnHessU);
+}
+
+
+void NonDLocalReliability::
+update_computed_reliability(const RealVector& fns_star)
+{
+  if (levelCount < requestedRespLevels[respFnCount].length()) // RIA
     computedRelLevel = signed_norm(std::sqrt(fns_star[0]));
   else if (integrationOrder == 2) { // second-order PMA
     // no op: computed{Rel,GenRel}Level updated in PMA2_constraint_eval()
@@ -1901,6 +2077,60 @@ void NonDLocalReliability::truth_evaluation(short mode)
 }
 
 
+/** X-space data are recovered from the u-space truth response, since
+    concurrent evaluations are not retained in iteratedModel. */
+void NonDLocalReliability::
+assign_truth_response(short mode, const Response& u_resp)
+{
+  Pecos::ProbabilityTransformation& nataf
+    = uSpaceModel.probability_transformation();
+  nataf.trans_U_to_X(mostProbPointU, mostProbPointX);
+  if (mode & 1) // function values are invariant to the transformation
+    computedRespLevel = u_resp.function_value(respFnCount);
+  if (mode & 2) {
+    fnGradU = u_resp.function_gradient_copy(respFnCount);
+    uSpaceModel.trans_grad_U_to_X(fnGradU, fnGradX, mostProbPointX);
+  }
+}
+
+
+void NonDLocalReliability::store_search_state(MPPSearchState& search)
+{
+  search.respFn      = respFnCount;
+  search.level       = levelCount;
+  search.stat        = statCount;
+  search.iters       = approxIters;
+  search.converged   = approxConverged;
+  search.maximizeG   = pmaMaximizeG;
+  search.targetLevel = requestedTargetLevel;
+  search.respLevel   = computedRespLevel;
+  search.relLevel    = computedRelLevel;
+  search.genRelLevel = computedGenRelLevel;
+  search.initPtU = initialPtU;     search.mppX  = mostProbPointX;
+  search.mppU    = mostProbPointU; search.gradX = fnGradX;
+  search.gradU   = fnGradU;
+}
+
+
+void NonDLocalReliability::
+restore_search_state(const MPPSearchState& search)
+{
+  respFnCount          = search.respFn;
+  levelCount           = search.level;
+  statCount            = search.stat;
+  approxIters          = search.iters;
+  approxConverged      = search.converged;
+  pmaMaximizeG         = search.maximizeG;
+  requestedTargetLevel = search.targetLevel;
+  computedRespLevel    = search.respLevel;
+  computedRelLevel     = search.relLevel;
+  computedGenRelLevel  = search.genRelLevel;
+  initialPtU = search.initPtU;  mostProbPointX = search.mppX;
+  mostProbPointU = search.mppU; fnGradX = search.gradX;
+  fnGradU = search.gradU;
+}
+
+
 /** This function recasts a G(u) response set (already transformed and
     approximated in other recursions) into an RIA objective function. */
 void NonDLocalReliability::
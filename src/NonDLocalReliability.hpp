@@ -79,6 +79,35 @@ public:
 
 private:
 
+  //
+  //- Heading: Types
+  //
+
+  /// state of the MPP search for a single response function within
+  /// lockstep_mpp_search(), exchanged with the corresponding class data
+  /// prior to and following each search operation
+  struct MPPSearchState {
+    int    respFn;              ///< response function index (respFnCount)
+    size_t level;               ///< current level index (levelCount)
+    size_t numLevels;           ///< number of z/p/beta levels for respFn
+    size_t stat;                ///< finalStatistics index (statCount)
+    bool   newLevel;            ///< current level requires initialization
+    size_t iters;               ///< approxIters
+    bool   converged;           ///< approxConverged
+    bool   maximizeG;           ///< pmaMaximizeG
+    Real   targetLevel;         ///< requestedTargetLevel
+    Real   respLevel;           ///< computedRespLevel
+    Real   relLevel;            ///< computedRelLevel
+    Real   genRelLevel;         ///< computedGenRelLevel
+    RealVector initPtU;         ///< initialPtU
+    RealVector mppX;            ///< mostProbPointX
+    RealVector mppU;            ///< mostProbPointU
+    RealVector gradX;           ///< fnGradX
+    RealVector gradU;           ///< fnGradU
+    RealVector fnsStar;         ///< RIA/PMA optimum from the last MPP search
+    short  truthMode;           ///< request for the pending truth evaluation
+  };
+
   //
   //- Heading: Objective/constraint/set mappings passed to RecastModel
   //
@@ -148,10 +177,17 @@ private:
   /// convenience function for encapsulating the reliability methods that
   /// employ a search for the most probable point (AMV, AMV+, FORM, SORM)
   void mpp_search();
+  /// perform the MPP searches for all response functions concurrently,
+  /// advancing their approximate MPP iterations in lockstep
+  void lockstep_mpp_search();
 
   /// convenience function for initializing class scope arrays
   void initialize_class_data();
 
+  /// convenience function for assigning approximate response moments
+  /// (and their sensitivities) to finalStatistics for respFnCount
+  void assign_final_moments();
+
   /// convenience function for initializing/warm starting MPP search
   /// data for each response function prior to level 0
   void initialize_level_data();
@@ -160,11 +196,30 @@ private:
   /// data for each z/p/beta level for each response function
   void initialize_mpp_search_data();
 
+  /// convenience function for assigning requestedTargetLevel and
+  /// pmaMaximizeG for the current z/p/beta level
+  void assign_level_target();
+
+  /// configure mppModel for the RIA/PMA formulation of the current level
+  /// and perform the MPP optimization starting from initialPtU
+  void mpp_optimization();
+
   /// convenience function for updating MPP search data for each
   /// z/p/beta level for each response function
   void update_mpp_search_data(const Variables& vars_star,
 			      const Response& resp_star);
 
+  /// update mostProbPointU and assess convergence of the approximate MPP
+  /// iteration; returns the request for the truth evaluation at the new MPP
+  short update_mpp_iterate(const RealVector& mpp_u);
+
+  /// update the limit state approximation after the truth evaluation at
+  /// the current MPP estimate
+  void update_mpp_approximation();
+
+  /// update computedRelLevel from the RIA/PMA optimal function values
+  void update_computed_reliability(const RealVector& fns_star);
+
   /// convenience function for updating z/p/beta level data and final
   /// statistics following MPP convergence
   void update_level_data();
@@ -198,6 +253,13 @@ private:
   /// perform an evaluation of the actual model and store value,grad,Hessian
   /// data in X,U spaces
   void truth_evaluation(short mode);
+  /// store value/gradient data from a u-space truth response in X,U spaces
+  void assign_truth_response(short mode, const Response& u_resp);
+
+  /// copy the class data for the current MPP search into search
+  void store_search_state(MPPSearchState& search);
+  /// copy the data of search into the class data for the current MPP search
+  void restore_search_state(const MPPSearchState& search);
 
   //
   //- Heading: Utility routines
@@ -334,6 +396,9 @@ private:
   bool warmStartFlag;
   /// flag indicating the use of move overrides within OPT++ NIP
   bool nipModeOverrideFlag;
+  /// flag indicating concurrent MPP searches across response functions
+  /// (\c lockstep specification)
+  bool lockstepFlag;
   /// flag indicating that sufficient data (i.e., fnGradU, fnHessU,
   /// mostProbPointU) is available for computing principal curvatures
   bool curvatureDataAvailable;
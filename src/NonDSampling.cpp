@@ -25,6 +25,8 @@
 #include "pecos_data_types.hpp"
 #include "NormalRandomVariable.hpp"
 #include <algorithm>
+#include <chrono>
+#include <thread>
 
 #include <boost/math/special_functions/beta.hpp>
 
@@ -47,6 +49,7 @@ NonDSampling::NonDSampling(ProblemDescDB& problem_db, Model& model):
   sampleRanksMode(IGNORE_RANKS),
   varyPattern(!probDescDB.get_bool("method.fixed_seed")), 
   backfillDuplicates(probDescDB.get_bool("method.backfill")),
+  streamingStats(probDescDB.get_bool("method.streaming_statistics")),
   wilksFlag(probDescDB.get_bool("method.wilks")), numLHSRuns(0)
 {
   // pushed down as some derived classes (MLMC) use a MC default
@@ -120,7 +123,7 @@ NonDSampling(unsigned short method_name, Model& model,
   sampleType(sample_type), wilksFlag(false), samplesIncrement(0),
   statsFlag(false), allDataFlag(true), samplingVarsMode(sampling_vars_mode),
   sampleRanksMode(IGNORE_RANKS), varyPattern(vary_pattern),
-  backfillDuplicates(false), numLHSRuns(0)
+  backfillDuplicates(false), streamingStats(false), numLHSRuns(0)
 {
   subIteratorFlag = true; // suppress some output
 
@@ -154,7 +157,8 @@ NonDSampling(unsigned short sample_type, size_t samples, int seed,
   numSamples(samples), rngName(rng), sampleType(sample_type), wilksFlag(false),
   samplesIncrement(0), statsFlag(false), allDataFlag(true),
   samplingVarsMode(ACTIVE_UNIFORM), sampleRanksMode(IGNORE_RANKS),
-  varyPattern(true), backfillDuplicates(false), numLHSRuns(0)
+  varyPattern(true), backfillDuplicates(false), streamingStats(false),
+  numLHSRuns(0)
 {
   subIteratorFlag = true; // suppress some output
 
@@ -180,7 +184,7 @@ NonDSampling(unsigned short sample_type, size_t samples, int seed,
   numSamples(samples), rngName(rng), sampleType(sample_type), wilksFlag(false),
   samplesIncrement(0), statsFlag(false), allDataFlag(true),
   samplingVarsMode(ACTIVE), sampleRanksMode(IGNORE_RANKS), varyPattern(true),
-  backfillDuplicates(false), numLHSRuns(0)
+  backfillDuplicates(false), streamingStats(false), numLHSRuns(0)
 {
   subIteratorFlag = true; // suppress some output
 
@@ -202,7 +206,8 @@ NonDSampling(Model& model, const RealMatrix& sample_matrix):
   samplesSpec(sample_matrix.numCols()), sampleType(SUBMETHOD_DEFAULT),
   wilksFlag(false), samplesIncrement(0), statsFlag(true), allDataFlag(true),
   samplingVarsMode(ACTIVE), sampleRanksMode(IGNORE_RANKS),
-  varyPattern(false), backfillDuplicates(false), numLHSRuns(0)
+  varyPattern(false), backfillDuplicates(false), streamingStats(false),
+  numLHSRuns(0)
 {
   allSamples = sample_matrix; compactMode = true;
   samplesRef = numSamples = samplesSpec;
@@ -944,6 +949,98 @@ void NonDSampling::core_run()
 }
 
 
+/** Mirrors Analyzer::evaluate_parameter_sets(), except that each response
+    is accumulated into streamStats as it completes and is then released.
+    Asynchronous evaluations are queued up to the evaluation capacity of
+    the model and backfilled as completions are detected, such that the
+    number of responses held at any time is bounded by the concurrency
+    rather than the number of samples. */
+void NonDSampling::stream_parameter_sets(Model& model)
+{
+  size_t i, num_evals
+    = (compactMode) ? allSamples.numCols() : allVariables.size();
+  bool header_flag = (allHeaders.size() == num_evals);
+  bool asynch_flag = model.asynch_flag();
+
+  allResponses.clear();
+  initialize_streaming_statistics();
+  // responses are archived by sample index, as in evaluate_parameter_sets()
+  int id_offset = model.evaluation_id();
+  size_t num_queued = 0,
+    max_queued = std::max(model.evaluation_capacity(), 1);
+
+  for (i=0; i<num_evals; ++i) {
+    // output the evaluation header (if present)
+    if (header_flag)
+      Cout << allHeaders[i];
+
+    if (compactMode)
+      update_model_from_sample(model, allSamples[i]);
+    else
+      update_model_from_variables(model, allVariables[i]);
+
+    if (asynch_flag) {
+      model.evaluate_nowait(activeSet);
+      archive_model_variables(model, i);
+      // backfill: wait for a completion once the queue is full
+      for (++num_queued; num_queued >= max_queued; ) {
+	size_t num_done
+	  = accumulate_streaming_statistics(model.synchronize_nowait(),
+					    id_offset);
+	num_queued -= num_done;
+	if (!num_done)
+	  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+    else {
+      model.evaluate(activeSet);
+      IntResponseMap resp_map;
+      resp_map[model.evaluation_id()] = model.current_response();
+      accumulate_streaming_statistics(resp_map, id_offset);
+      archive_model_variables(model, i);
+    }
+  }
+  // drain the remaining asynchronous evaluations
+  if (asynch_flag && num_queued)
+    accumulate_streaming_statistics(model.synchronize(), id_offset);
+}
+
+
+void NonDSampling::initialize_streaming_statistics()
+{
+  // define the cumulative probabilities needed for p/beta* -> z mappings
+  RealVectorArray cdf_prob_levels(numFunctions);
+  size_t i, j;
+  for (i=0; i<numFunctions; ++i) {
+    size_t pl_len = requestedProbLevels[i].length(),
+           gl_len = requestedGenRelLevels[i].length();
+    RealVector& cdf_pl_i = cdf_prob_levels[i];
+    cdf_pl_i.sizeUninitialized(pl_len + gl_len);
+    for (j=0; j<pl_len+gl_len; ++j) {
+      Real p = (j<pl_len) ? requestedProbLevels[i][j] : Pecos::
+	NormalRandomVariable::std_cdf(-requestedGenRelLevels[i][j-pl_len]);
+      cdf_pl_i[j] = (cdfFlag) ? p : 1. - p;
+    }
+  }
+  // z -> beta mappings are projected from moments and do not require bins
+  if (respLevelTarget == RELIABILITIES)
+    streamStats.initialize(numFunctions, RealVectorArray(), cdf_prob_levels);
+  else
+    streamStats.initialize(numFunctions, requestedRespLevels, cdf_prob_levels);
+}
+
+
+size_t NonDSampling::
+accumulate_streaming_statistics(const IntResponseMap& resp_map, int id_offset)
+{
+  for (IntRespMCIter r_cit=resp_map.begin(); r_cit!=resp_map.end(); ++r_cit) {
+    streamStats.update(r_cit->second.function_values());
+    archive_model_response(r_cit->second, r_cit->first - id_offset - 1);
+  }
+  return resp_map.size();
+}
+
+
 void NonDSampling::
 compute_statistics(const RealMatrix&     vars_samples,
 		   const IntResponseMap& resp_samples)
@@ -1004,6 +1101,51 @@ compute_statistics(const RealMatrix&     vars_samples,
 }
 
 
+/** Counterpart to compute_statistics() for the statistics accumulated by
+    stream_parameter_sets().  Correlations require the full set of samples
+    and are omitted. */
+void NonDSampling::compute_streamed_statistics()
+{
+  if (resultsDB.active())
+    resultsDB.insert(run_identifier(), resultsNames.fn_labels,
+		     iteratedModel.response_labels());
+
+  const StringArray& resp_labels = iteratedModel.response_labels();
+  size_t i, num_obs = streamStats.num_observations();
+  if (!num_obs) {
+    Cerr << "Error: no samples accumulated in NonDSampling::compute_"
+	 << "streamed_statistics()." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+
+  // compute means and std deviations with confidence intervals
+  if (momentStats.empty()) momentStats.shapeUninitialized(4, numFunctions);
+  SizetArray sample_counts(numFunctions);
+  for (i=0; i<numFunctions; ++i) {
+    sample_counts[i] = streamStats.count(i);
+    if (sample_counts[i] != num_obs)
+      Cerr << "Warning: sampling statistics for " << resp_labels[i] << " omit "
+	   << num_obs-sample_counts[i] << " failed evaluations out of "
+	   << num_obs << " samples.\n";
+    if (!sample_counts[i])
+      Cerr << "Warning: Number of samples for " << resp_labels[i]
+	   << " must be nonzero for moment calculation in NonDSampling::"
+	   << "compute_streamed_statistics().\n";
+    streamStats.moments(i, finalMomentsType, momentStats[i]);
+  }
+  compute_moment_confidence_intervals(momentStats, momentCIs, sample_counts,
+				      finalMomentsType);
+  functionMomentsComputed = true;
+
+  // compute CDF/CCDF mappings of z to p/beta and p/beta to z
+  if (totalLevelRequests)
+    compute_level_mappings(streamStats);
+
+  // push results into finalStatistics
+  update_final_statistics();
+}
+
+
 void NonDSampling::
 compute_intervals(RealRealPairArray& extreme_fns, const IntResponseMap& samples)
 {
@@ -1540,10 +1682,9 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
   // For the samples array, calculate the following statistics:
   // > CDF/CCDF mappings of response levels to probability/reliability levels
   // > CDF/CCDF mappings of probability/reliability levels to response levels
-  size_t i, j, k, num_obs = samples.size(), num_samp, bin_accumulator;
-  const StringArray& resp_labels = iteratedModel.response_labels();
-  std::multiset<Real> sorted_samples; // STL-based array for sorting
-  SizetArray bins; Real min, max, sample;
+  size_t i, j, k, num_samp;
+  RealArray sorted_samples; // finite samples, sorted for p/beta* -> z
+  SizetArray bins; RealVector prob_level_resp; Real min, max, sample;
 
   // check if moments are required, and if so, compute them now
   if (momentStats.empty()) {
@@ -1568,20 +1709,14 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
   }
 
   if (pdfOutput) extremeValues.resize(numFunctions);
-  IntRespMCIter s_it; std::multiset<Real>::iterator ss_it;
-  const ShortArray& final_asv = finalStatistics.active_set_request_vector();
-  bool extrapolated_mappings = false,
-    central_mom = (finalMomentsType == Pecos::CENTRAL_MOMENTS);
-  size_t cntr = 0,
-    num_deriv_vars = finalStatistics.active_set_derivative_vector().size(),
-    moment_offset = (finalMomentsType) ? 2 : 0;
-  RealVector mean_grad, mom2_grad;
+  IntRespMCIter s_it; RealArray::const_iterator ss_it;
+  bool extrapolated_mappings = false;
+  size_t cntr = 0;
   for (i=0; i<numFunctions; ++i) {
 
     // CDF/CCDF mappings: z -> p/beta/beta* and p/beta/beta* -> z
     size_t rl_len = requestedRespLevels[i].length(),
            pl_len = requestedProbLevels[i].length(),
-           bl_len = requestedRelLevels[i].length(),
            gl_len = requestedGenRelLevels[i].length();
 
     // ----------------------------------------------------------------------
@@ -1590,14 +1725,17 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
     num_samp = 0;
     if (pl_len || gl_len) { // sort samples array for p/beta* -> z mappings
       sorted_samples.clear();
+      sorted_samples.reserve(samples.size());
       for (s_it=samples.begin(); s_it!=samples.end(); ++s_it) {
         sample = s_it->second.function_value(i);
 	if (std::isfinite(sample))
-	  { ++num_samp; sorted_samples.insert(sample); }
+	  sorted_samples.push_back(sample);
       }
       // sort in ascending order
+      std::sort(sorted_samples.begin(), sorted_samples.end());
+      num_samp = sorted_samples.size();
       if (pdfOutput)
-        { min = *sorted_samples.begin(); max = *(--sorted_samples.end()); }
+        { min = sorted_samples.front(); max = sorted_samples.back(); }
       // in case of rl_len mixed with pl_len/gl_len, bin using sorted array.
       if (rl_len && respLevelTarget != RELIABILITIES) {
 	const RealVector& req_rl_i = requestedRespLevels[i];
@@ -1607,6 +1745,37 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
 	    { ++bins[j]; ++ss_it; }
 	bins[rl_len] += std::distance(ss_it, sorted_samples.end());
       }
+
+      // p/beta* -> z
+      prob_level_resp.sizeUninitialized(pl_len+gl_len);
+      for (j=0; j<pl_len+gl_len; j++) {
+	Real p = (j<pl_len) ? requestedProbLevels[i][j] : Pecos::
+	  NormalRandomVariable::std_cdf(-requestedGenRelLevels[i][j-pl_len]);
+	Real p_cdf = (cdfFlag) ? p : 1. - p;
+	// since each sample has 1/N probability, p can be directly converted
+	// to an index within sorted_samples (id = p * N; index = id - 1)
+	// Note 1: duplicate samples are not aggregated (separate id increments).
+	// Note 2: since p_cdf(min_sample) = 1/N and p_cdf(max_sample) = 1, we
+	//   extrapolate to the left of min, but not to the right of max.
+	//   id < 1 indicates this extrapolation left of the min sample.
+	// Note 3: we exclude any extrapolated z from extremeValues; should we
+	//   omit any out-of-bounds resp levels within NonD::compute_densities()?
+	//   --> PDF estimation based only on z->p binning or p->z interpolation
+	//       within the sample bounds.
+	Real cdf_incr_id = p_cdf * (Real)num_samp, lo_id;
+	if (cdf_incr_id < 1.) { // extrapolate left of min sample using 1st slope
+	  lo_id = 1.; extrapolated_mappings = true;
+	  Cerr << "Warning: extrapolation required for response " << i+1;
+	  if (j<pl_len) Cerr <<    " for probability level " << j+1      <<".\n";
+	  else Cerr << " for generalized reliability level " << j+1-pl_len<<".\n";
+	}
+	else // linear interpolation between closest neighbors in sequence
+	  lo_id = std::floor(cdf_incr_id);
+	k = (size_t)lo_id - 1;
+	Real z_lo = sorted_samples[k];
+	prob_level_resp[j] = (k+1 == num_samp) ? z_lo :
+	  z_lo + (cdf_incr_id - lo_id) * (sorted_samples[k+1] - z_lo);
+      }
     }
     else if (rl_len && respLevelTarget != RELIABILITIES) {
       // in case of rl_len without pl_len/gl_len, bin from original sample set
@@ -1634,133 +1803,173 @@ void NonDSampling::compute_level_mappings(const IntResponseMap& samples)
     if (pdfOutput)
       { extremeValues[i].first = min; extremeValues[i].second = max; }
 
-    cntr += moment_offset;
-    // ----------------
-    // Process mappings
-    // ----------------
-    if (rl_len) {
-      switch (respLevelTarget) {
-      case PROBABILITIES: case GEN_RELIABILITIES: // z -> p/beta* (from binning)
-	bin_accumulator = 0;
-	for (j=0; j<rl_len; ++j, ++cntr) { // compute CDF/CCDF p/beta*
-	  bin_accumulator += bins[j];
-	  Real cdf_prob = (Real)bin_accumulator/(Real)num_samp;
-	  Real computed_prob = (cdfFlag) ? cdf_prob : 1. - cdf_prob;
-	  if (respLevelTarget == PROBABILITIES)
-	    computedProbLevels[i][j] = computed_prob;
-	  else
-	    computedGenRelLevels[i][j]
-	      = -Pecos::NormalRandomVariable::inverse_std_cdf(computed_prob);
-	}
-	break;
-      case RELIABILITIES: { // z -> beta (from moment projection)
-	Real mean  = momentStats(0,i);
-	Real stdev = (central_mom) ?
-	  std::sqrt(momentStats(1,i)) : momentStats(1,i);
-	if (!momentGrads.empty()) {
-	  int i2 = 2*i;
-	  mean_grad = Teuchos::getCol(Teuchos::View, momentGrads, i2);
-	  mom2_grad = Teuchos::getCol(Teuchos::View, momentGrads, i2+1);
-	}
-	for (j=0; j<rl_len; j++, ++cntr) {
-	  // *** beta
-	  Real z_bar = requestedRespLevels[i][j];
-	  if (!Pecos::is_small(stdev))
-	    computedRelLevels[i][j] = (cdfFlag) ?
-	      (mean - z_bar)/stdev : (z_bar - mean)/stdev;
-	  else
-	    computedRelLevels[i][j]
-	      = ( (cdfFlag && mean <= z_bar) || (!cdfFlag && mean > z_bar) )
-	      ? -Pecos::LARGE_NUMBER : Pecos::LARGE_NUMBER;
-	  // *** beta gradient
-	  if (final_asv[cntr] & 2) {
-	    RealVector beta_grad = finalStatistics.function_gradient_view(cntr);
-	    if (!Pecos::is_small(stdev)) {
-	      for (k=0; k<num_deriv_vars; ++k) {
-		Real stdev_grad = (central_mom) ?
-		  mom2_grad[k] / (2.*stdev) : mom2_grad[k];
-		Real dratio_dx = (stdev*mean_grad[k] - (mean-z_bar)*stdev_grad)
-		               / std::pow(stdev, 2);
-		beta_grad[k] = (cdfFlag) ? dratio_dx : -dratio_dx;
-	      }
-	    }
-	    else
-	      beta_grad = 0.;
-	  }
-	}
-	break;
-      }
-      }
-    }
-    for (j=0; j<pl_len+gl_len; j++, ++cntr) { // p/beta* -> z
-      Real p = (j<pl_len) ? requestedProbLevels[i][j] :	Pecos::
+    map_levels(i, bins, num_samp, prob_level_resp, cntr);
+  }
+
+  if (extrapolated_mappings)
+    Cerr << "Warning: extrapolations required to evaluate inverse mappings.  "
+	 << "Consistent slope\n         (uniform density) assumed for "
+	 << "extrapolation into distribution tail.\n\n";
+
+  // post-process computed z/p/beta* levels to form PDFs (prob_refined and
+  // all_levels_computed default to false).  embedding this call within
+  // compute_level_mappings() simplifies management of min/max.
+  compute_densities(extremeValues);
+}
+
+
+/** Streaming counterpart to compute_level_mappings(const IntResponseMap&):
+    z -> p/beta* mappings use the exact bin counts and p/beta* -> z
+    mappings use the quantile estimates of stream_stats. */
+void NonDSampling::
+compute_level_mappings(const StreamingStatistics& stream_stats)
+{
+  initialize_level_mappings();
+  archive_allocate_mappings();
+
+  if (pdfOutput) extremeValues.resize(numFunctions);
+  bool extrapolated_mappings = false;
+  size_t i, j, num_samp, cntr = 0;
+  RealVector prob_level_resp;
+  for (i=0; i<numFunctions; ++i) {
+    size_t pl_len = requestedProbLevels[i].length(),
+           gl_len = requestedGenRelLevels[i].length();
+    num_samp = stream_stats.count(i);
+
+    prob_level_resp.sizeUninitialized(pl_len+gl_len);
+    for (j=0; j<pl_len+gl_len; j++) {
+      Real p = (j<pl_len) ? requestedProbLevels[i][j] : Pecos::
 	NormalRandomVariable::std_cdf(-requestedGenRelLevels[i][j-pl_len]);
       Real p_cdf = (cdfFlag) ? p : 1. - p;
-      // since each sample has 1/N probability, p can be directly converted
-      // to an index within sorted_samples (id = p * N; index = id - 1)
-      // Note 1: duplicate samples are not aggregated (separate id increments).
-      // Note 2: since p_cdf(min_sample) = 1/N and p_cdf(max_sample) = 1, we
-      //   extrapolate to the left of min, but not to the right of max.
-      //   id < 1 indicates this extrapolation left of the min sample.
-      // Note 3: we exclude any extrapolated z from extremeValues; should we
-      //   omit any out-of-bounds resp levels within NonD::compute_densities()?
-      //   --> PDF estimation based only on z->p binning or p->z interpolation
-      //       within the sample bounds.
-      Real cdf_incr_id = p_cdf * (Real)num_samp, lo_id;
-      ss_it = sorted_samples.begin();
-      if (cdf_incr_id < 1.) { // extrapolate left of min sample using 1st slope
-	lo_id = 1.; extrapolated_mappings = true;
+      if (p_cdf * (Real)num_samp < 1.) {
+	extrapolated_mappings = true;
 	Cerr << "Warning: extrapolation required for response " << i+1;
 	if (j<pl_len) Cerr <<    " for probability level " << j+1       <<".\n";
 	else Cerr << " for generalized reliability level " << j+1-pl_len<<".\n";
       }
-      else { // linear interpolation between closest neighbors in sequence
-        lo_id = std::floor(cdf_incr_id);
-	std::advance(ss_it, (size_t)lo_id - 1);
-      }
-      Real z, z_lo = *ss_it; ++ss_it;
-      if (ss_it == sorted_samples.end()) z = z_lo;
-      else          z = z_lo + (cdf_incr_id - lo_id) * (*ss_it - z_lo);
-      if (j<pl_len) computedRespLevels[i][j] = z;
-      else          computedRespLevels[i][j+bl_len] = z;
+      prob_level_resp[j] = stream_stats.quantile(i, j);
+    }
+    if (pdfOutput) {
+      extremeValues[i].first  = stream_stats.minimum(i);
+      extremeValues[i].second = stream_stats.maximum(i);
     }
-    if (bl_len) {
+
+    map_levels(i, stream_stats.bins(i), num_samp, prob_level_resp, cntr);
+  }
+
+  if (extrapolated_mappings)
+    Cerr << "Warning: extrapolations required to evaluate inverse mappings.  "
+	 << "Consistent slope\n         (uniform density) assumed for "
+	 << "extrapolation into distribution tail.\n\n";
+
+  compute_densities(extremeValues);
+}
+
+
+/** Shared by the sample-based and streaming level mappings: z -> p/beta*
+    from bins, z -> beta and beta -> z from momentStats (and momentGrads,
+    if available), and p/beta* -> z from prob_level_resp. */
+void NonDSampling::
+map_levels(size_t i, const SizetArray& bins, size_t num_samp,
+	   const RealVector& prob_level_resp, size_t& cntr)
+{
+  const ShortArray& final_asv = finalStatistics.active_set_request_vector();
+  bool central_mom = (finalMomentsType == Pecos::CENTRAL_MOMENTS);
+  size_t j, k, bin_accumulator,
+    num_deriv_vars = finalStatistics.active_set_derivative_vector().size(),
+    rl_len = requestedRespLevels[i].length(),
+    pl_len = requestedProbLevels[i].length(),
+    bl_len = requestedRelLevels[i].length(),
+    gl_len = requestedGenRelLevels[i].length();
+  RealVector mean_grad, mom2_grad;
+
+  if (finalMomentsType) cntr += 2;
+  // ----------------
+  // Process mappings
+  // ----------------
+  if (rl_len) {
+    switch (respLevelTarget) {
+    case PROBABILITIES: case GEN_RELIABILITIES: // z -> p/beta* (from binning)
+      bin_accumulator = 0;
+      for (j=0; j<rl_len; ++j, ++cntr) { // compute CDF/CCDF p/beta*
+	bin_accumulator += bins[j];
+	Real cdf_prob = (Real)bin_accumulator/(Real)num_samp;
+	Real computed_prob = (cdfFlag) ? cdf_prob : 1. - cdf_prob;
+	if (respLevelTarget == PROBABILITIES)
+	  computedProbLevels[i][j] = computed_prob;
+	else
+	  computedGenRelLevels[i][j]
+	    = -Pecos::NormalRandomVariable::inverse_std_cdf(computed_prob);
+      }
+      break;
+    case RELIABILITIES: { // z -> beta (from moment projection)
       Real mean  = momentStats(0,i);
-      Real stdev = (finalMomentsType == Pecos::CENTRAL_MOMENTS) ?
+      Real stdev = (central_mom) ?
 	std::sqrt(momentStats(1,i)) : momentStats(1,i);
       if (!momentGrads.empty()) {
 	int i2 = 2*i;
 	mean_grad = Teuchos::getCol(Teuchos::View, momentGrads, i2);
 	mom2_grad = Teuchos::getCol(Teuchos::View, momentGrads, i2+1);
       }
-      for (j=0; j<bl_len; j++, ++cntr) {
-	// beta_bar -> z
-	Real beta_bar = requestedRelLevels[i][j];
-	computedRespLevels[i][j+pl_len] = (cdfFlag) ?
-	  mean - beta_bar * stdev : mean + beta_bar * stdev;
-	// *** z gradient
+      for (j=0; j<rl_len; j++, ++cntr) {
+	// *** beta
+	Real z_bar = requestedRespLevels[i][j];
+	if (!Pecos::is_small(stdev))
+	  computedRelLevels[i][j] = (cdfFlag) ?
+	    (mean - z_bar)/stdev : (z_bar - mean)/stdev;
+	else
+	  computedRelLevels[i][j]
+	    = ( (cdfFlag && mean <= z_bar) || (!cdfFlag && mean > z_bar) )
+	    ? -Pecos::LARGE_NUMBER : Pecos::LARGE_NUMBER;
+	// *** beta gradient
 	if (final_asv[cntr] & 2) {
-	  RealVector z_grad = finalStatistics.function_gradient_view(cntr);
-	  for (k=0; k<num_deriv_vars; ++k) {
-	    Real stdev_grad = (central_mom) ?
-	      mom2_grad[k] / (2.*stdev) : mom2_grad[k];
-	    z_grad[k] = (cdfFlag) ? mean_grad[k] - beta_bar * stdev_grad
-	                          : mean_grad[k] + beta_bar * stdev_grad;
+	  RealVector beta_grad = finalStatistics.function_gradient_view(cntr);
+	  if (!Pecos::is_small(stdev)) {
+	    for (k=0; k<num_deriv_vars; ++k) {
+	      Real stdev_grad = (central_mom) ?
+		mom2_grad[k] / (2.*stdev) : mom2_grad[k];
+	      Real dratio_dx = (stdev*mean_grad[k] - (mean-z_bar)*stdev_grad)
+			     / std::pow(stdev, 2);
+	      beta_grad[k] = (cdfFlag) ? dratio_dx : -dratio_dx;
+	    }
 	  }
+	  else
+	    beta_grad = 0.;
+	}
+      }
+      break;
+    }
+    }
+  }
+  for (j=0; j<pl_len+gl_len; j++, ++cntr) // p/beta* -> z
+    if (j<pl_len) computedRespLevels[i][j] = prob_level_resp[j];
+    else          computedRespLevels[i][j+bl_len] = prob_level_resp[j];
+  if (bl_len) {
+    Real mean  = momentStats(0,i);
+    Real stdev = (finalMomentsType == Pecos::CENTRAL_MOMENTS) ?
+      std::sqrt(momentStats(1,i)) : momentStats(1,i);
+    if (!momentGrads.empty()) {
+      int i2 = 2*i;
+      mean_grad = Teuchos::getCol(Teuchos::View, momentGrads, i2);
+      mom2_grad = Teuchos::getCol(Teuchos::View, momentGrads, i2+1);
+    }
+    for (j=0; j<bl_len; j++, ++cntr) {
+      // beta_bar -> z
+      Real beta_bar = requestedRelLevels[i][j];
+      computedRespLevels[i][j+pl_len] = (cdfFlag) ?
+	mean - beta_bar * stdev : mean + beta_bar * stdev;
+      // *** z gradient
+      if (final_asv[cntr] & 2) {
+	RealVector z_grad = finalStatistics.function_gradient_view(cntr);
+	for (k=0; k<num_deriv_vars; ++k) {
+	  Real stdev_grad = (central_mom) ?
+	    mom2_grad[k] / (2.*stdev) : mom2_grad[k];
+	  z_grad[k] = (cdfFlag) ? mean_grad[k] - beta_bar * stdev_grad
+				: mean_grad[k] + beta_bar * stdev_grad;
 	}
       }
     }
   }
-
-  if (extrapolated_mappings)
-    Cerr << "Warning: extrapolations required to evaluate inverse mappings.  "
-	 << "Consistent slope\n         (uniform density) assumed for "
-	 << "extrapolation into distribution tail.\n\n";
-
-  // post-process computed z/p/beta* levels to form PDFs (prob_refined and
-  // all_levels_computed default to false).  embedding this call within
-  // compute_level_mappings() simplifies management of min/max.
-  compute_densities(extremeValues);
 }
 
 
@@ -20,6 +20,7 @@
 #include "DakotaNonD.hpp"
 #include "LHSDriver.hpp"
 #include "SensAnalysisGlobal.hpp"
+#include "StreamingStatistics.hpp"
 
 namespace Dakota {
 
@@ -113,6 +114,9 @@ public:
   /// called by compute_statistics() to calculate CDF/CCDF mappings of
   /// z to p/beta and of p/beta to z as well as PDFs
   void compute_level_mappings(const IntResponseMap& samples);
+  /// calculate CDF/CCDF mappings of z to p/beta and of p/beta to z as
+  /// well as PDFs from accumulated streaming statistics
+  void compute_level_mappings(const StreamingStatistics& stream_stats);
 
   /// prints the statistics computed in compute_statistics()
   void print_statistics(std::ostream& s) const;
@@ -224,6 +228,15 @@ protected:
   /// set varyPattern
   void vary_pattern(bool pattern_flag);
 
+  /// evaluate allSamples/allVariables, accumulating streaming statistics
+  /// from each completed evaluation in place of logging allResponses
+  void stream_parameter_sets(Model& model);
+  /// compute moments and level mappings from the statistics accumulated
+  /// by stream_parameter_sets()
+  void compute_streamed_statistics();
+  /// return whether statistics are accumulated by stream_parameter_sets()
+  bool streaming_statistics() const;
+
   /// Uses lhsDriver to generate a set of samples from the
   /// distributions/bounds defined in the incoming model.
   void get_parameter_sets(Model& model);
@@ -343,6 +356,9 @@ protected:
   /// flags whether to use backfill to enforce uniqueness of discrete
   /// LHS samples
   bool backfillDuplicates;
+  /// flags accumulation of statistics as evaluations complete, such that
+  /// responses are not retained (\c streaming_statistics specification)
+  bool streamingStats;
 
   /// Minimum and maximum values of response functions for epistemic
   /// calculations (calculated in compute_intervals()),
@@ -357,7 +373,19 @@ private:
   //
   //- Heading: Convenience functions
   //
-  
+
+  /// initialize streamStats from the requested response/probability levels
+  void initialize_streaming_statistics();
+  /// accumulate completed evaluations into streamStats, returning the
+  /// number of evaluations processed
+  size_t accumulate_streaming_statistics(const IntResponseMap& resp_map,
+					 int id_offset);
+  /// compute the CDF/CCDF mappings for response function i from its
+  /// response level bins, finite sample count, and response values at
+  /// the probability/generalized reliability levels
+  void map_levels(size_t i, const SizetArray& bins, size_t num_samp,
+		  const RealVector& prob_level_resp, size_t& cntr);
+
   /// helper function to consolidate update code
   void sample_to_variables(const Real* sample_vars, Variables& vars,
 			   Model& model);
@@ -394,6 +422,9 @@ private:
   /// Matrix of confidence internals on moments, with rows for mean_lower,
   /// mean_upper, sd_lower, sd_upper (calculated in compute_moments())
   RealMatrix momentCIs;
+
+  /// one-pass statistics accumulated by stream_parameter_sets()
+  StreamingStatistics streamStats;
 };
 
 
@@ -502,6 +533,22 @@ inline bool NonDSampling::seed_updated()
 }
 
 
+/** Streaming is bypassed when responses must be retained (allDataFlag)
+    or statistics are not needed, as well as when derivatives of the
+    final statistics are requested, since moment gradients require the
+    gradient samples. */
+inline bool NonDSampling::streaming_statistics() const
+{
+  if (!streamingStats || !statsFlag || allDataFlag || epistemicStats)
+    return false;
+  const ShortArray& asv = activeSet.request_vector();
+  for (size_t i=0; i<asv.size(); ++i)
+    if (asv[i] & 6)
+      return false;
+  return true;
+}
+
+
 inline unsigned short NonDSampling::sampling_scheme() const
 { return sampleType; }
 
@@ -314,4 +314,68 @@ void NonDSparseGrid::decrement_grid()
   ssgDriver->level(ssgLevelPrev);
 }
 
+
+void NonDSparseGrid::queue_set(const UShortArray& set)
+{ ssgDriver->compute_trial_grid(queuedSamples[set]); }
+
+
+/** The trial points of all queued sets are evaluated together, such
+    that an asynchronous iteratedModel can schedule them concurrently,
+    and the responses are partitioned by set in evaluation order. */
+void NonDSparseGrid::evaluate_queued_sets()
+{
+  queuedResponses.clear();
+  if (queuedSamples.empty())
+    return;
+
+  std::map<UShortArray, RealMatrix>::iterator s_it;
+  int i, j, num_rows = queuedSamples.begin()->second.numRows(), num_pts = 0;
+  for (s_it=queuedSamples.begin(); s_it!=queuedSamples.end(); ++s_it)
+    num_pts += s_it->second.numCols();
+  Cout << "\nEvaluating " << num_pts << " trial points from "
+       << queuedSamples.size() << " index sets as a single batch.\n";
+
+  allSamples.shapeUninitialized(num_rows, num_pts);
+  int cntr = 0;
+  for (s_it=queuedSamples.begin(); s_it!=queuedSamples.end(); ++s_it) {
+    const RealMatrix& set_samples = s_it->second;
+    for (j=0; j<set_samples.numCols(); ++j, ++cntr)
+      for (i=0; i<num_rows; ++i)
+	allSamples(i, cntr) = set_samples(i, j);
+  }
+  evaluate_parameter_sets(iteratedModel, true, false);
+
+  // evaluation ids increase in the order of submission
+  IntRespMCIter r_cit = allResponses.begin();
+  for (s_it=queuedSamples.begin(); s_it!=queuedSamples.end(); ++s_it) {
+    IntResponseMap& set_resp = queuedResponses[s_it->first];
+    for (j=0; j<s_it->second.numCols() && r_cit!=allResponses.end();
+	 ++j, ++r_cit)
+      set_resp.insert(*r_cit);
+  }
+}
+
+
+/** The trial grid computed by queue_set() was stored by the subsequent
+    decrement_set(), so it is restored rather than recomputed, leaving
+    a single stored copy once the set is decremented again. */
+void NonDSparseGrid::retrieve_set(const UShortArray& set)
+{
+  std::map<UShortArray, RealMatrix>::iterator s_it = queuedSamples.find(set);
+  std::map<UShortArray, IntResponseMap>::iterator r_it
+    = queuedResponses.find(set);
+  if (s_it == queuedSamples.end() || r_it == queuedResponses.end()) {
+    Cerr << "Error: index set not evaluated by evaluate_queued_sets() in "
+	 << "NonDSparseGrid::retrieve_set()." << std::endl;
+    abort_handler(METHOD_ERROR);
+  }
+
+  ssgDriver->push_set();
+  std::swap(allSamples,   s_it->second);
+  std::swap(allResponses, r_it->second);
+  queuedSamples.erase(s_it);
+  queuedResponses.erase(r_it);
+  ++numIntegrations;
+}
+
 } // namespace Dakota
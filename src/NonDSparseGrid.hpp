@@ -99,6 +99,15 @@ public:
   void push_set();
   /// invokes SparseGridDriver::compute_trial_grid()
   void evaluate_set();
+  /// invokes SparseGridDriver::compute_trial_grid() and defers evaluation
+  /// of the trial points to evaluate_queued_sets(); the set is then
+  /// decremented
+  void queue_set(const UShortArray& set);
+  /// evaluate the trial points of all queued sets as a single batch
+  void evaluate_queued_sets();
+  /// invokes SparseGridDriver::push_set() for a queued set and retrieves
+  /// its trial points and responses from evaluate_queued_sets()
+  void retrieve_set(const UShortArray& set);
   /// invokes SparseGridDriver::pop_set()
   void decrement_set();
   /// invokes SparseGridDriver::update_sets()
@@ -152,6 +161,13 @@ private:
   /// in decrement_grid() since increment must induce a change in grid size
   /// and this adaptive increment in not reversible
   unsigned short ssgLevelPrev;
+
+  /// trial points of the sets deferred by queue_set(), pending
+  /// retrieval by retrieve_set()
+  std::map<UShortArray, RealMatrix> queuedSamples;
+  /// responses of the sets evaluated by evaluate_queued_sets(), pending
+  /// retrieval by retrieve_set()
+  std::map<UShortArray, IntResponseMap> queuedResponses;
 };
 
 
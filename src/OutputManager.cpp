@@ -12,6 +12,8 @@
 //- Owner:       Brian Adams
 //- Checked by:
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <boost/algorithm/string/predicate.hpp>
@@ -28,6 +30,8 @@
 #include "dakota_tabular_io.hpp"
 #include "ResultsDBAny.hpp"
 #include "EvaluationStore.hpp"
+#include "PerformanceRegistry.hpp"
+#include "WorkdirHelper.hpp"
 
 #ifdef DAKOTA_HAVE_HDF5
 #include "HDF5_IO.hpp"
@@ -54,8 +58,9 @@ OutputManager::OutputManager():
   coutRedirector(dakota_cout, &std::cout), 
   cerrRedirector(dakota_cerr, &std::cerr),
   tabularFormat(TABULAR_ANNOTATED),
-  graphicsCntr(1), tabularCntrLabel("eval_id"),
-  tabularInterfLabel("interface"), outputLevel(NORMAL_OUTPUT)
+  graphicsCntr(1), journalCommitRecords(0), journalCommitInterval(0.),
+  tabularCntrLabel("eval_id"), tabularInterfLabel("interface"),
+  outputLevel(NORMAL_OUTPUT)
 {  /* empty ctor */  }
 
 
@@ -68,8 +73,9 @@ OutputManager(const ProgramOptions& prog_opts, int dakota_world_rank,
   worldRank(dakota_world_rank), mpirunFlag(dakota_mpirun_flag), 
   coutRedirector(dakota_cout, &std::cout), 
   cerrRedirector(dakota_cerr, &std::cerr),
-  graphicsCntr(1), tabularCntrLabel("eval_id"),
-  tabularInterfLabel("interface"), outputLevel(NORMAL_OUTPUT)
+  graphicsCntr(1), journalCommitRecords(0), journalCommitInterval(0.),
+  tabularCntrLabel("eval_id"), tabularInterfLabel("interface"),
+  outputLevel(NORMAL_OUTPUT)
 {
   // This call will redirect based on command-line options
   initial_redirects(prog_opts);
@@ -226,6 +232,8 @@ void OutputManager::close_streams()
 
   // any remaining restart files will be closed at the destructor...
   //restartDestinations.clear();
+  // ...but journaled records are committed now in case this is an abort
+  commit_journals();
 
   // After completion of timings in ParallelLibrary... 
   //
@@ -238,8 +246,10 @@ void OutputManager::close_streams()
       dakotaGraphics.close();
     // only close tabular stream if initialization was previously performed
     // not an error when not open so all ranks can call this
-    if (tabularDataFlag && tabularDataFStream.is_open())
+    if (tabularDataFlag && tabularDataFStream.is_open()) {
+      close_tabular_journal();
       tabularDataFStream.close();
+    }
 
     // could omit entirely or do this unconditionally...
     graphicsCntr = 1;
@@ -263,6 +273,20 @@ void OutputManager::parse(const ProgramOptions& prog_opts,
   resultsOutputFormat = problem_db.get_ushort("environment.results_output_format");
   if(resultsOutputFlag && resultsOutputFormat == 0)
     resultsOutputFormat = RESULTS_OUTPUT_TEXT;
+
+  // group commit of restart and tabular records; restart destinations
+  // are opened after parse() at the first push_output_tag()
+  if (problem_db.get_bool("environment.output_journal")) {
+    journalCommitRecords
+      = problem_db.get_int("environment.journal_commit_records");
+    journalCommitInterval
+      = problem_db.get_real("environment.journal_commit_interval");
+  }
+
+  // performance timers are collected on each rank, but output on rank 0
+  if (problem_db.get_bool("environment.performance_summary"))
+    performance_registry.activate(
+      problem_db.get_string("environment.performance_trace_file"));
   
   int db_write_precision = problem_db.get_int("environment.output_precision");
   if (db_write_precision > 0) {  // assign global write_precision
@@ -412,10 +436,24 @@ void OutputManager::append_restart(const ParamResponsePair& prp)
   std::shared_ptr<RestartWriter> rst_writer = restartDestinations.back();
   rst_writer->append_prp(prp);
   // flush is critical so we have a complete restart record should Dakota abort
+  // (when journaled, this completes the record for the next group commit)
   rst_writer->flush();
 }
 
 
+/** Called on abnormal termination, such that no journaled records
+    remain pending in memory. */
+void OutputManager::commit_journals()
+{
+  for (size_t i=0; i<restartDestinations.size(); ++i)
+    restartDestinations[i]->commit();
+  if (tabularJournal) {
+    tabularDataFStream.flush(); // complete any partial row
+    tabularJournal->commit();
+  }
+}
+
+
 /** Opens the tabular data file stream and prints headings, one for
     each active continuous and discrete variable and one for each response
     function, using the variable and response function labels. This
@@ -434,6 +472,14 @@ void OutputManager::open_tabular_datastream()
     String file_tag = build_output_tag();
     TabularIO::open_file(tabularDataFStream, tabularDataFile + file_tag, 
 			 "DakotaGraphics");
+    // each row ends with std::endl, so journal rows rather than flushing
+    // each one; the ofstream retains its file buffer as the journal sink
+    if (journalCommitRecords > 0) {
+      tabularJournal.reset(new OutputJournal(tabularDataFStream.rdbuf(),
+					     journalCommitRecords,
+					     journalCommitInterval));
+      tabularDataFStream.std::ostream::rdbuf(tabularJournal.get());
+    }
   }
 }
 
@@ -615,12 +661,107 @@ add_tabular_data(const Response& response, size_t start_index, size_t num_items)
 void OutputManager::close_tabular_datastream()
 {
   if (tabularDataFStream.is_open()) {
+    close_tabular_journal();
     tabularDataFStream.close();
     //TabularIO::close_file(tabularDataFStream, ...);
   }
 }
 
 
+void OutputManager::suspend_journals()
+{
+  for (size_t i=0; i<restartDestinations.size(); ++i)
+    restartDestinations[i]->suspend();
+  if (tabularJournal) {
+    tabularDataFStream.flush(); // complete any partial row
+    tabularJournal->suspend();
+  }
+}
+
+
+void OutputManager::resume_journals()
+{
+  for (size_t i=0; i<restartDestinations.size(); ++i)
+    restartDestinations[i]->resume();
+  if (tabularJournal)
+    tabularJournal->resume();
+}
+
+
+/** The records are read as in read_write_restart() and appended in
+    order; a missing file (e.g., a job that wrote no records) is
+    ignored. */
+void OutputManager::merge_restart(const String& restart_filename)
+{
+  if (!bfs::exists(restart_filename))
+    return;
+
+  bool write_restart = !restartDestinations.empty() &&
+    !restartDestinations.back()->filename().empty();
+  int cntr = 0;
+  if (write_restart) {
+    try {
+      RestartVersion rst_ver =
+	RestartVersion::check_restart_version(restart_filename);
+      std::ifstream restart_input_fs(restart_filename.c_str(),
+				     std::ios::binary);
+      boost::archive::binary_iarchive restart_input_archive(restart_input_fs);
+      if (RestartVersion::restartFirstVersionNumber <= rst_ver.restartVersion)
+	restart_input_archive & rst_ver;
+      restart_input_fs.peek(); // peek to force EOF if the last record was read
+      while (restart_input_fs.good() && !restart_input_fs.eof()) {
+	ParamResponsePair current_pair;
+	restart_input_archive & current_pair;
+	append_restart(current_pair);
+	++cntr;
+	restart_input_fs.peek();
+      }
+    }
+    catch (const std::exception& e) {
+      Cerr << "\nWarning: error merging restart file '" << restart_filename
+	   << "' after " << cntr << " records.\nDetails: " << e.what()
+	   << std::endl;
+      return; // retain the file for recovery
+    }
+  }
+
+  WorkdirHelper::recursive_remove(restart_filename, FILEOP_WARN);
+}
+
+
+void OutputManager::
+merge_output(const String& output_filename, std::ostream& os)
+{
+  if (!bfs::exists(output_filename))
+    return;
+
+  std::ifstream output_fs(output_filename.c_str());
+  if (!output_fs.good()) {
+    Cerr << "\nWarning: could not open output file '" << output_filename
+	 << "' for merging." << std::endl;
+    return; // retain the file for inspection
+  }
+  // inserting an empty streambuf would set failbit on os
+  if (output_fs.peek() != std::ifstream::traits_type::eof())
+    os << output_fs.rdbuf();
+  os.flush();
+  output_fs.close();
+
+  WorkdirHelper::recursive_remove(output_filename, FILEOP_WARN);
+}
+
+
+void OutputManager::close_tabular_journal()
+{
+  if (tabularJournal) {
+    tabularJournal->close();
+    // rebind the stream to its own file buffer
+    tabularDataFStream.std::ostream::rdbuf(tabularDataFStream.rdbuf());
+    tabularJournal.reset();
+  }
+}
+
+
 void OutputManager::tabular_counter_label(const std::string& label)
 { tabularCntrLabel = label; }
 
@@ -835,7 +976,9 @@ void OutputManager::read_write_restart(bool restart_requested,
 
     // create a new restart destination
     std::shared_ptr<RestartWriter>
-      rst_writer(new RestartWriter(write_restart_filename));
+      rst_writer(new RestartWriter(write_restart_filename, true,
+				   journalCommitRecords,
+				   journalCommitInterval));
     restartDestinations.push_back(rst_writer);
 
     // Write any processed records from the old restart file to the new file.
@@ -1014,7 +1157,8 @@ RestartWriter::RestartWriter()
 
 
 RestartWriter::RestartWriter(const String& write_restart_filename,
-			     bool write_version):
+			     bool write_version, int commit_records,
+			     Real commit_interval):
   restartOutputFilename(write_restart_filename),
   restartOutputFS(restartOutputFilename.c_str(), std::ios::binary)
 {
@@ -1024,7 +1168,17 @@ RestartWriter::RestartWriter(const String& write_restart_filename,
     abort_handler(IO_ERROR);
   }
 
-  restartOutputArchive.reset(new boost::archive::binary_oarchive(restartOutputFS));
+  // the archive binds to a stream buffer at construction, so a journal
+  // must be interposed now
+  if (commit_records > 0) {
+    restartJournal.reset(new OutputJournal(restartOutputFS.rdbuf(),
+					   commit_records, commit_interval));
+    restartOutputArchive.reset(
+      new boost::archive::binary_oarchive(*restartJournal));
+  }
+  else
+    restartOutputArchive.reset(
+      new boost::archive::binary_oarchive(restartOutputFS));
 
   if (write_version) {
     RestartVersion rst_version(DakotaBuildInfo::get_release_num(),
@@ -1075,7 +1229,175 @@ void RestartWriter::append_prp(const ParamResponsePair& prp_in)
 }
 
 void RestartWriter::flush()
-{ restartOutputFS.flush(); }
+{
+  if (restartJournal) restartJournal->pubsync();
+  else                restartOutputFS.flush();
+}
+
+
+void RestartWriter::commit()
+{
+  if (restartJournal)
+    restartJournal->commit();
+}
+
+
+void RestartWriter::suspend()
+{
+  if (restartJournal)
+    restartJournal->suspend();
+}
+
+
+void RestartWriter::resume()
+{
+  if (restartJournal)
+    restartJournal->resume();
+}
+
+
+OutputJournal::
+OutputJournal(std::streambuf* sink_buf, int commit_records,
+	      Real commit_interval):
+  sinkBuf(sink_buf), commitRecords(std::max(commit_records, 1)),
+  commitInterval(std::max(1L, (long)(1000.*commit_interval))),
+  putArea(8192), pendingRecords(0), stopFlag(false), failFlag(false)
+{
+  setp(putArea.data(), putArea.data() + putArea.size());
+  writerThread = std::thread(&OutputJournal::commit_loop, this);
+}
+
+
+OutputJournal::~OutputJournal()
+{ close(); }
+
+
+void OutputJournal::drain_put_area()
+{
+  openRecord.append(pbase(), pptr() - pbase());
+  setp(putArea.data(), putArea.data() + putArea.size());
+}
+
+
+std::streamsize OutputJournal::xsputn(const char* s, std::streamsize n)
+{
+  if (n <= epptr() - pptr())
+    { std::memcpy(pptr(), s, n); pbump((int)n); }
+  else
+    { drain_put_area(); openRecord.append(s, n); }
+  return n;
+}
+
+
+OutputJournal::int_type OutputJournal::overflow(int_type c)
+{
+  drain_put_area();
+  if (!traits_type::eq_int_type(c, traits_type::eof()))
+    openRecord.push_back(traits_type::to_char_type(c));
+  return traits_type::not_eof(c);
+}
+
+
+int OutputJournal::sync()
+{
+  drain_put_area();
+  if (openRecord.empty())
+    return 0;
+
+  bool stopped;
+  {
+    std::lock_guard<std::mutex> journal_lock(journalMutex);
+    pendingBlock.append(openRecord);
+    stopped = stopFlag;
+    if (++pendingRecords >= commitRecords && !stopped)
+      commitCondition.notify_one();
+  }
+  openRecord.clear();
+  // no writer remains after close(), so write through
+  if (stopped)
+    commit();
+  return 0;
+}
+
+
+void OutputJournal::commit()
+{
+  // holding sinkMutex across the swap and write preserves record order
+  // between the writer thread and client commits
+  std::lock_guard<std::mutex> sink_lock(sinkMutex);
+  String block;
+  {
+    std::lock_guard<std::mutex> journal_lock(journalMutex);
+    block.swap(pendingBlock);
+    pendingRecords = 0;
+  }
+  write_block(block);
+}
+
+
+void OutputJournal::write_block(const String& block)
+{
+  if (block.empty())
+    return;
+  std::streamsize len = block.size();
+  if (sinkBuf->sputn(block.data(), len) != len || sinkBuf->pubsync() == -1)
+    failFlag = true;
+}
+
+
+void OutputJournal::commit_loop()
+{
+  std::unique_lock<std::mutex> journal_lock(journalMutex);
+  while (!stopFlag) {
+    // commit when enough records are pending or the interval elapses
+    commitCondition.wait_for(journal_lock, commitInterval, [this]
+      { return stopFlag || pendingRecords >= commitRecords; });
+    if (pendingBlock.empty())
+      continue;
+    journal_lock.unlock();
+    commit();
+    journal_lock.lock();
+  }
+}
+
+
+void OutputJournal::close()
+{
+  sync(); // queue any partial record
+  suspend();
+
+  if (failFlag) {
+    Cerr << "\nWarning: error writing journaled output; output file may be "
+	 << "incomplete." << std::endl;
+    failFlag = false;
+  }
+}
+
+
+/** The partial record, if any, remains open. */
+void OutputJournal::suspend()
+{
+  {
+    std::lock_guard<std::mutex> journal_lock(journalMutex);
+    stopFlag = true;
+  }
+  commitCondition.notify_one();
+  if (writerThread.joinable())
+    writerThread.join();
+  commit();
+}
+
+
+void OutputJournal::resume()
+{
+  if (writerThread.joinable())
+    return;
+  {
+    std::lock_guard<std::mutex> journal_lock(journalMutex);
+    stopFlag = false;
+  }
+  writerThread = std::thread(&OutputJournal::commit_loop, this);
+}
 
 
 #ifdef Want_Heartbeat /*{*/
@@ -22,7 +22,12 @@
 #include "dakota_tabular_io.hpp"
 #include "DakotaGraphics.hpp"
 #include "RestartVersion.hpp"
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <streambuf>
+#include <thread>
 
 
 namespace Dakota {
@@ -118,6 +123,95 @@ private:
 };
 
 
+/** Group-commit stream buffer for restart and tabular output.  Data
+    written through the journal accumulate in memory and each sync
+    (e.g., std::endl or flush()) marks a record boundary.  Complete
+    records are written to the underlying stream buffer in large blocks
+    by a background thread, once the number of pending records reaches
+    a threshold or the commit interval elapses.  Only complete records
+    reach the file, so at most one commit interval of output is lost on
+    abnormal termination and a truncated restart file remains readable
+    (e.g., with -stop_restart). */
+class OutputJournal: public std::streambuf {
+
+public:
+
+  /// constructor taking the destination stream buffer (not owned) and
+  /// the commit policy: record count and interval in seconds
+  OutputJournal(std::streambuf* sink_buf, int commit_records,
+		Real commit_interval);
+
+  /// destructor; closes the journal, committing any pending output
+  ~OutputJournal();
+
+  /// synchronously write all complete records to the destination
+  void commit();
+
+  /// commit all output, including a partial record, and stop the
+  /// background writer
+  void close();
+
+  /// commit all complete records and stop the background writer;
+  /// records are written through on each sync until resume()
+  void suspend();
+  /// restart the background writer after suspend()
+  void resume();
+
+protected:
+
+  /// append a character sequence to the open record
+  std::streamsize xsputn(const char* s, std::streamsize n) override;
+  /// move the full put area to the open record and append c
+  int_type overflow(int_type c) override;
+  /// complete the open record and queue it for commit
+  int sync() override;
+
+private:
+
+  /// copy constructor is disallowed due to writer thread
+  OutputJournal(const OutputJournal&);
+  /// assignment is disallowed due to writer thread
+  const OutputJournal& operator=(const OutputJournal&);
+
+  /// move the contents of the put area to openRecord
+  void drain_put_area();
+  /// write a block of records to sinkBuf; sinkMutex must be held
+  void write_block(const String& block);
+  /// background writer loop
+  void commit_loop();
+
+  /// destination for committed records
+  std::streambuf* sinkBuf;
+  /// number of pending records that triggers a commit
+  size_t commitRecords;
+  /// maximum time records remain pending
+  std::chrono::milliseconds commitInterval;
+
+  /// put area for formatted output
+  std::vector<char> putArea;
+  /// the record in progress (accessed only by the client thread)
+  String openRecord;
+  /// complete records awaiting commit
+  String pendingBlock;
+  /// number of records in pendingBlock
+  size_t pendingRecords;
+
+  /// whether the writer thread is stopping (or was never started)
+  bool stopFlag;
+  /// whether a write to sinkBuf has failed
+  bool failFlag;
+  /// protects pendingBlock, pendingRecords, and stopFlag
+  std::mutex journalMutex;
+  /// serializes writes to sinkBuf so records are committed in order
+  std::mutex sinkMutex;
+  /// signals the writer when a commit is due or on close
+  std::condition_variable commitCondition;
+  /// background thread committing pending records
+  std::thread writerThread;
+
+};  // class OutputJournal
+
+
 /** Component for writing restart files.  Creation and destruction of
     archive and associated stream are managed here. */
 class RestartWriter {
@@ -126,9 +220,11 @@ public:
   /// optional default ctor allowing a non-outputting RestartWriter
   RestartWriter();
 
-  /// typical ctor taking a filename; this class encapsulates the output stream
+  /// typical ctor taking a filename; this class encapsulates the output
+  /// stream, which is journaled when commit_records > 0
   RestartWriter(const String& write_restart_filename,
-		bool write_version = true);
+		bool write_version = true, int commit_records = 0,
+		Real commit_interval = 0.);
 
   /// alternate ctor taking non-default version info, helpful for testing
   RestartWriter(const String& write_restart_filename,
@@ -150,9 +246,19 @@ public:
   void append_prp(const ParamResponsePair& prp_in);
 
   /// flush the restart stream so we have a complete restart record
-  /// should Dakota abort
+  /// should Dakota abort; when journaled, the record is queued for the
+  /// next group commit
   void flush();
 
+  /// synchronously write any journaled records to the restart file
+  void commit();
+
+  /// stop the journal's background writer, if any (see
+  /// OutputJournal::suspend())
+  void suspend();
+  /// restart the journal's background writer, if any
+  void resume();
+
 private:
   /// copy constructor is disallowed due to file stream
   RestartWriter(const RestartWriter&);
@@ -165,6 +271,10 @@ private:
   /// Binary stream to which restart data is written
   std::ofstream restartOutputFS;
 
+  /// optional group-commit journal between the archive and
+  /// restartOutputFS (declared after the stream it writes to)
+  std::unique_ptr<OutputJournal> restartJournal;
+
   /// Binary output archive to which data is written (pointer since no
   /// default ctor for oarchive and may not be initialized); 
   std::unique_ptr<boost::archive::binary_oarchive> restartOutputArchive;
@@ -246,6 +356,22 @@ public:
   /// append a parameter/response set to the restart file
   void append_restart(const ParamResponsePair& prp);
 
+  /// synchronously write any journaled restart and tabular records
+  void commit_journals();
+  /// commit journaled records and stop the background writers, e.g.,
+  /// prior to fork(); records are written synchronously until resumed
+  void suspend_journals();
+  /// restart the background writers stopped by suspend_journals()
+  void resume_journals();
+
+  /// append the records of a restart file written by another process
+  /// (e.g., a forked local iterator job) to the restart file, then
+  /// remove it
+  void merge_restart(const String& restart_filename);
+  /// append the console output of a file written by another process
+  /// (e.g., a forked local iterator job) to os, then remove it
+  void merge_output(const String& output_filename, std::ostream& os);
+
 
   // -----
   // Graphics and tabular output
@@ -375,6 +501,9 @@ private:
   /// Perform initial output/error redirects from user requests
   void initial_redirects(const ProgramOptions& prog_opts);
   
+  /// commit and detach the tabular journal prior to closing the stream
+  void close_tabular_journal();
+
   /// conditionally import evaluations from restart file, then always
   /// create or overwrite restart file
   void read_write_restart(bool restart_requested, bool read_restart_flag,
@@ -429,6 +558,15 @@ private:
   /// file stream for tabulation of graphics data within compute_response
   std::ofstream tabularDataFStream;
 
+  /// optional group-commit journal bound to tabularDataFStream
+  std::unique_ptr<OutputJournal> tabularJournal;
+
+  /// number of records per group commit of restart and tabular output
+  /// (0 writes and flushes each record immediately)
+  int journalCommitRecords;
+  /// maximum seconds between group commits
+  Real journalCommitInterval;
+
   /// label for counter used in first line comment w/i the tabular data file
   std::string tabularCntrLabel;
   /// label for interface used in first line comment w/i the tabular data file
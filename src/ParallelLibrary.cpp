@@ -16,6 +16,7 @@
 #include "ProgramOptions.hpp"
 #include "dakota_results_types.hpp"
 #include "ResultsManager.hpp"
+#include "PerformanceRegistry.hpp"
 
 #ifdef DAKOTA_UTILIB
 #include <utilib/exception_mngr.h>
@@ -1299,6 +1300,13 @@ void ParallelLibrary::output_timers()
 #endif // DAKOTA_UTILIB
   }
   iterator_results_db.add_metadata_to_study(time_attrs);
+
+  // hierarchical timers and counters, if requested
+  if (performance_registry.active() && mpiManager.world_rank() == 0) {
+    performance_registry.print_summary(Cout);
+    performance_registry.write_results(iterator_results_db);
+    performance_registry.write_trace();
+  }
 }
 
 } // namespace Dakota
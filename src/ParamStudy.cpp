@@ -26,7 +26,8 @@ static const char rcsId[]="@(#) $Id: ParamStudy.cpp 7024 2010-10-16 01:24:42Z ms
 namespace Dakota {
 
 ParamStudy::ParamStudy(ProblemDescDB& problem_db, Model& model):
-  PStudyDACE(problem_db, model)
+  PStudyDACE(problem_db, model),
+  streamingFlag(probDescDB.get_bool("method.pstudy.streaming"))
 {
   // use allVariables instead of default allSamples
   compactMode = false;
@@ -172,8 +173,22 @@ void ParamStudy::pre_run()
     copy_data(vars.discrete_real_variables(),   initialDRVPoint); // copy
   }
 
+  // sub-iterators (e.g., the DACE iterator of a DataFitSurrModel) must
+  // return all_variables() and all_responses() to their caller
+  if (streamingFlag && subIteratorFlag) {
+    Cerr << "\nWarning: 'streaming' is not supported for parameter studies "
+	 << "used as sub-iterators;\n         points will be stored."
+	 << std::endl;
+    streamingFlag = false;
+  }
+  // ranks require every response, which streaming does not retain
+  if (streamingFlag && methodName == MULTIDIM_PARAMETER_STUDY)
+    Cerr << "\nWarning: rank correlations are not computed by streaming "
+	 << "parameter studies;\n         only simple and partial correlations "
+	 << "will be reported." << std::endl;
+
   size_t av_size = allVariables.size();
-  if (av_size != numEvals) {
+  if (!streamingFlag && av_size != numEvals) {
     allVariables.resize(numEvals);
     for (size_t i=av_size; i<numEvals; ++i)
       allVariables[i] = vars.copy();
@@ -187,7 +202,7 @@ void ParamStudy::pre_run()
   case LIST_PARAMETER_STUDY:
     if (outputLevel > SILENT_OUTPUT)
       Cout << "\nList parameter study for " << numEvals << " samples\n\n";
-    sample();
+    if (!streamingFlag) sample();
     break;
   case VECTOR_PARAMETER_STUDY:
     if (!contStepVector.empty()       || !discIntStepVector.empty() ||
@@ -218,7 +233,7 @@ void ParamStudy::pre_run()
       if (numSteps) // define step vectors from initial, final, & num steps
 	final_point_to_step_vector();
     }
-    vector_loop();
+    if (!streamingFlag) vector_loop();
     break;
   case CENTERED_PARAMETER_STUDY:
     if (outputLevel > SILENT_OUTPUT) {
@@ -235,7 +250,7 @@ void ParamStudy::pre_run()
 		    initialDIVPoint, initialDSVPoint, initialDRVPoint);
       Cout << '\n';
     }
-    centered_loop();
+    if (!streamingFlag) centered_loop();
     break;
   case MULTIDIM_PARAMETER_STUDY:
     if (outputLevel > SILENT_OUTPUT) {
@@ -245,7 +260,7 @@ void ParamStudy::pre_run()
 		    discRealVarPartitions);
     }
     distribute_partitions();
-    multidim_loop();
+    if (!streamingFlag) multidim_loop();
     break;
   default:
     Cerr << "\nError: bad methodName (" << method_enum_to_string(methodName)
@@ -259,11 +274,15 @@ void ParamStudy::core_run()
 {
 
   archive_allocate_sets();
-  // perform the evaluations; multidim exception
-  bool log_resp_flag = (methodName == MULTIDIM_PARAMETER_STUDY)
-    ? (!subIteratorFlag) : false;
-  bool log_best_flag = (numObjFns || numLSqTerms); // opt or NLS data set
-  evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
+  if (streamingFlag) // generate the points as they are evaluated
+    stream_parameter_sets();
+  else {
+    // perform the evaluations; multidim exception
+    bool log_resp_flag = (methodName == MULTIDIM_PARAMETER_STUDY)
+      ? (!subIteratorFlag) : false;
+    bool log_best_flag = (numObjFns || numLSqTerms); // opt or NLS data set
+    evaluate_parameter_sets(iteratedModel, log_resp_flag, log_best_flag);
+  }
 }
 
 void ParamStudy::archive_model_variables(const Model& model, size_t idx) const
@@ -323,7 +342,8 @@ void ParamStudy::archive_allocate_sets() const
 {
   if(resultsDB.active())
   {
-    size_t num_evals = (compactMode) ? allSamples.numCols() : allVariables.size();
+    size_t num_evals = (streamingFlag) ? numEvals :
+      ( (compactMode) ? allSamples.numCols() : allVariables.size() );
 
     StringMultiArrayConstView cv_labels
                 = iteratedModel.continuous_variable_labels();
@@ -397,9 +417,12 @@ void ParamStudy::post_run(std::ostream& s)
 {
   bool log_resp_flag = (!subIteratorFlag);
   if (methodName == MULTIDIM_PARAMETER_STUDY && log_resp_flag) {
-    pStudyDACESensGlobal.compute_correlations(allVariables, allResponses, 
-      iteratedModel.discrete_set_string_values()); // to map string variable
-                                                   // values back to indices
+    if (streamingFlag) // accumulated by stream_parameter_sets()
+      pStudyDACESensGlobal.compute_streamed_correlations();
+    else
+      pStudyDACESensGlobal.compute_correlations(allVariables, allResponses, 
+	iteratedModel.discrete_set_string_values()); // to map string variable
+                                                     // values back to indices
     if(resultsDB.active()) {
       StringMultiArrayConstView
         cv_labels  = iteratedModel.continuous_variable_labels(),
@@ -473,17 +496,8 @@ void ParamStudy::vector_loop()
       dsr_step(j, i, dsr_values[j], vars);
 
     // store each output header in allHeaders
-    if (outputLevel > SILENT_OUTPUT) {
-      String& h_string = allHeaders[i];
-      h_string.clear();
-      if (iteratedModel.asynch_flag())
-	h_string += "\n\n";
-      if (numSteps == 0) // Allow numSteps == 0 case
-	h_string += ">>>>> Initial_point only (no steps)\n";
-      h_string += ">>>>> Vector parameter study evaluation for ";
-      h_string += std::to_string(i*100./numSteps);
-      h_string += "% along vector\n";
-    }
+    if (outputLevel > SILENT_OUTPUT)
+      vector_header(i, allHeaders[i]);
   }
 }
 
@@ -516,7 +530,8 @@ void ParamStudy::centered_loop()
       if (i) {
 	Variables& vars = allVariables[cntr];
 	reset(vars); c_step(k, i, vars);
-	if (outputLevel > SILENT_OUTPUT) centered_header(cv_str, k, i, cntr);
+	if (outputLevel > SILENT_OUTPUT)
+	  centered_header(cv_str, k, i, allHeaders[cntr]);
 	++cntr;
       }
   }
@@ -532,7 +547,8 @@ void ParamStudy::centered_loop()
 	if (i) {
 	  Variables& vars = allVariables[cntr];
 	  reset(vars); dsi_step(k, i, dsi_vals_k, vars);
-	  if (outputLevel > SILENT_OUTPUT) centered_header(div_str, k, i, cntr);
+	  if (outputLevel > SILENT_OUTPUT)
+	    centered_header(div_str, k, i, allHeaders[cntr]);
 	  ++cntr;
 	}
       ++dsi_cntr;
@@ -542,7 +558,8 @@ void ParamStudy::centered_loop()
 	if (i) {
 	  Variables& vars = allVariables[cntr];
 	  reset(vars); dri_step(k, i, vars);
-	  if (outputLevel > SILENT_OUTPUT) centered_header(div_str, k, i, cntr);
+	  if (outputLevel > SILENT_OUTPUT)
+	    centered_header(div_str, k, i, allHeaders[cntr]);
 	  ++cntr;
 	}
     }
@@ -557,7 +574,8 @@ void ParamStudy::centered_loop()
       if (i) {
 	Variables& vars = allVariables[cntr];
 	reset(vars); dss_step(k, i, dss_vals_k, vars);
-	if (outputLevel > SILENT_OUTPUT) centered_header(dsv_str, k, i, cntr);
+	if (outputLevel > SILENT_OUTPUT)
+	  centered_header(dsv_str, k, i, allHeaders[cntr]);
 	++cntr;
       }
   }
@@ -571,7 +589,8 @@ void ParamStudy::centered_loop()
       if (i) {
 	Variables& vars = allVariables[cntr];
 	reset(vars); dsr_step(k, i, dsr_vals_k, vars);
-	if (outputLevel > SILENT_OUTPUT) centered_header(drv_str, k, i, cntr);
+	if (outputLevel > SILENT_OUTPUT)
+	  centered_header(drv_str, k, i, allHeaders[cntr]);
 	++cntr;
       }
   }
@@ -622,6 +641,222 @@ void ParamStudy::multidim_loop()
 }
 
 
+/** Mirrors Analyzer::evaluate_parameter_sets(), except that each point
+    is generated by study_point() as it is queued and each response is
+    processed and released once it has been synchronized.  Asynchronous
+    evaluations are queued in batches of the evaluation capacity of the
+    model, each of which is synchronized before the next is generated,
+    such that storage is bounded by the concurrency rather than the
+    number of points. */
+void ParamStudy::stream_parameter_sets()
+{
+  bool asynch_flag = iteratedModel.asynch_flag(),
+    header_flag = ( outputLevel > SILENT_OUTPUT &&
+		    ( methodName == VECTOR_PARAMETER_STUDY ||
+		      methodName == CENTERED_PARAMETER_STUDY ) ),
+    log_best_flag = (numObjFns || numLSqTerms), // opt or NLS data set
+    corr_flag = (methodName == MULTIDIM_PARAMETER_STUDY);
+
+  allResponses.clear();
+  if (corr_flag)
+    pStudyDACESensGlobal.initialize_streaming_correlations(numContinuousVars +
+      numDiscreteIntVars + numDiscreteStringVars + numDiscreteRealVars,
+      numFunctions);
+  size_t i, max_queued = std::max(iteratedModel.evaluation_capacity(), 1);
+  Variables vars = iteratedModel.current_variables().copy();
+  // study index (for archiving) and variables (only needed for best point
+  // and correlations) of the queued evaluations, keyed by evaluation id
+  IntIntMap queued_index;
+  IntVariablesMap queued_vars;
+  String header;
+
+  for (i=0; i<numEvals; ++i) {
+    study_point(i, vars);
+    // output the evaluation header (if present)
+    if (header_flag)
+      { study_header(i, header); Cout << header; }
+
+    update_model_from_variables(iteratedModel, vars);
+
+    if (asynch_flag) {
+      iteratedModel.evaluate_nowait(activeSet);
+      int eval_id = iteratedModel.evaluation_id();
+      archive_model_variables(iteratedModel, i);
+      queued_index[eval_id] = i;
+      if (log_best_flag || corr_flag)
+	queued_vars[eval_id] = vars.copy();
+      // synchronize once the batch is full
+      if (queued_index.size() >= max_queued)
+	process_streamed_responses(iteratedModel.synchronize(), queued_index,
+				   queued_vars, log_best_flag, corr_flag);
+    }
+    else {
+      iteratedModel.evaluate(activeSet);
+      int eval_id = iteratedModel.evaluation_id();
+      IntResponseMap resp_map;
+      resp_map[eval_id] = iteratedModel.current_response();
+      queued_index[eval_id] = i;
+      if (log_best_flag || corr_flag)
+	queued_vars[eval_id] = vars; // processed before vars is updated
+      process_streamed_responses(resp_map, queued_index, queued_vars,
+				 log_best_flag, corr_flag);
+      archive_model_variables(iteratedModel, i);
+    }
+  }
+  // synchronize the final partial batch
+  if (!queued_index.empty())
+    process_streamed_responses(iteratedModel.synchronize(), queued_index,
+			       queued_vars, log_best_flag, corr_flag);
+}
+
+
+void ParamStudy::
+process_streamed_responses(const IntResponseMap& resp_map,
+			   IntIntMap& queued_index, IntVariablesMap& queued_vars,
+			   bool log_best_flag, bool corr_flag)
+{
+  const StringSetArray& dss_values = iteratedModel.discrete_set_string_values();
+  for (IntRespMCIter r_cit=resp_map.begin(); r_cit!=resp_map.end(); ++r_cit) {
+    int eval_id = r_cit->first;
+    if (log_best_flag || corr_flag) {
+      IntVarsMIter v_it = queued_vars.find(eval_id);
+      if (log_best_flag) // update best variables/response
+	update_best(v_it->second, eval_id, r_cit->second);
+      if (corr_flag)
+	pStudyDACESensGlobal.accumulate_correlations(v_it->second,
+						     r_cit->second, dss_values);
+      queued_vars.erase(v_it);
+    }
+    // responses are archived by study index, as in evaluate_parameter_sets()
+    IntIntMIter i_it = queued_index.find(eval_id);
+    archive_model_response(r_cit->second, i_it->second);
+    queued_index.erase(i_it);
+  }
+}
+
+
+/** Generates the point at index idx in the order of sample(),
+    vector_loop(), centered_loop(), or multidim_loop(), such that points
+    may be generated on demand and index_to_var_step() applies for
+    centered studies. */
+void ParamStudy::study_point(size_t idx, Variables& vars)
+{
+  const BitArray&      di_set_bits = iteratedModel.discrete_int_sets();
+  const IntSetArray&    dsi_values = iteratedModel.discrete_set_int_values();
+  const StringSetArray& dss_values = iteratedModel.discrete_set_string_values();
+  const RealSetArray&   dsr_values = iteratedModel.discrete_set_real_values();
+  size_t j, dsi_cntr;
+
+  switch (methodName) {
+  case LIST_PARAMETER_STUDY:
+    if (numContinuousVars)
+      vars.continuous_variables(listCVPoints[idx]);
+    if (numDiscreteIntVars)
+      vars.discrete_int_variables(listDIVPoints[idx]);
+    if (numDiscreteStringVars)
+      vars.discrete_string_variables(
+	listDSVPoints[boost::indices[idx][idx_range(0, numDiscreteStringVars)]]);
+    if (numDiscreteRealVars)
+      vars.discrete_real_variables(listDRVPoints[idx]);
+    break;
+  case VECTOR_PARAMETER_STUDY:
+    for (j=0; j<numContinuousVars; ++j)
+      c_step(j, idx, vars);
+    for (j=0, dsi_cntr=0; j<numDiscreteIntVars; ++j)
+      if (di_set_bits[j]) dsi_step(j, idx, dsi_values[dsi_cntr++], vars);
+      else                dri_step(j, idx, vars);
+    for (j=0; j<numDiscreteStringVars; ++j)
+      dss_step(j, idx, dss_values[j], vars);
+    for (j=0; j<numDiscreteRealVars; ++j)
+      dsr_step(j, idx, dsr_values[j], vars);
+    break;
+  case CENTERED_PARAMETER_STUDY: {
+    reset(vars);
+    if (idx == 0) // center point
+      break;
+    size_t var_idx, step_idx;
+    index_to_var_step(idx, var_idx, step_idx);
+    int step = (int)step_idx - stepsPerVariable[var_idx];
+    if (var_idx < numContinuousVars)
+      { c_step(var_idx, step, vars); break; }
+    var_idx -= numContinuousVars;
+    if (var_idx < numDiscreteIntVars) {
+      if (di_set_bits[var_idx]) {
+	for (j=0, dsi_cntr=0; j<var_idx; ++j)
+	  if (di_set_bits[j]) ++dsi_cntr;
+	dsi_step(var_idx, step, dsi_values[dsi_cntr], vars);
+      }
+      else
+	dri_step(var_idx, step, vars);
+      break;
+    }
+    var_idx -= numDiscreteIntVars;
+    if (var_idx < numDiscreteStringVars)
+      dss_step(var_idx, step, dss_values[var_idx], vars);
+    else {
+      var_idx -= numDiscreteStringVars;
+      dsr_step(var_idx, step, dsr_values[var_idx], vars);
+    }
+    break;
+  }
+  case MULTIDIM_PARAMETER_STUDY: {
+    // decode the multidimensional index set from idx, with the first
+    // variable varying fastest as in increment_indices()
+    size_t radix, rem = idx;
+    for (j=0; j<numContinuousVars; ++j) {
+      radix = contVarPartitions[j] + 1;
+      c_step(j, rem % radix, vars);
+      rem /= radix;
+    }
+    for (j=0, dsi_cntr=0; j<numDiscreteIntVars; ++j) {
+      radix = discIntVarPartitions[j] + 1;
+      if (di_set_bits[j])
+	dsi_step(j, rem % radix, dsi_values[dsi_cntr++], vars);
+      else
+	dri_step(j, rem % radix, vars);
+      rem /= radix;
+    }
+    for (j=0; j<numDiscreteStringVars; ++j) {
+      radix = discStringVarPartitions[j] + 1;
+      dss_step(j, rem % radix, dss_values[j], vars);
+      rem /= radix;
+    }
+    for (j=0; j<numDiscreteRealVars; ++j) {
+      radix = discRealVarPartitions[j] + 1;
+      dsr_step(j, rem % radix, dsr_values[j], vars);
+      rem /= radix;
+    }
+    break;
+  }
+  }
+}
+
+
+void ParamStudy::study_header(size_t idx, String& h_string)
+{
+  if (methodName == VECTOR_PARAMETER_STUDY)
+    { vector_header(idx, h_string); return; }
+
+  if (idx == 0) {
+    h_string = (iteratedModel.asynch_flag()) ?
+      "\n\n>>>>> Centered parameter study evaluation for center point\n" :
+      ">>>>> Centered parameter study evaluation for center point\n";
+    return;
+  }
+  size_t var_idx, step_idx;
+  index_to_var_step(idx, var_idx, step_idx);
+  int step = (int)step_idx - stepsPerVariable[var_idx];
+  if (var_idx < numContinuousVars)
+    centered_header("cv", var_idx, step, h_string);
+  else if ((var_idx -= numContinuousVars) < numDiscreteIntVars)
+    centered_header("div", var_idx, step, h_string);
+  else if ((var_idx -= numDiscreteIntVars) < numDiscreteStringVars)
+    centered_header("dsv", var_idx, step, h_string);
+  else
+    centered_header("drv", var_idx - numDiscreteStringVars, step, h_string);
+}
+
+
 /** Load from file and distribute points; using this function to
     manage construction of the temporary arrays.  Historically all
     data was read as a real (mixture of values and indices), but now
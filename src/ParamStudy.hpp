@@ -86,6 +86,22 @@ private:
   /// defined by a set of multidimensional partitions
   void multidim_loop();
 
+  /// performs the evaluations for points generated on demand, retaining
+  /// only the variables of queued evaluations (streaming specification)
+  void stream_parameter_sets();
+  /// update the best point and correlations from the completed evaluations
+  /// in resp_map, archive them by their study index in queued_index, and
+  /// release their queued data
+  void process_streamed_responses(const IntResponseMap& resp_map,
+				  IntIntMap& queued_index,
+				  IntVariablesMap& queued_vars,
+				  bool log_best_flag, bool corr_flag);
+  /// populate vars with the point at (zero-based) index idx of the study
+  void study_point(size_t idx, Variables& vars);
+  /// store the header for the point at (zero-based) index idx of a vector
+  /// or centered parameter study within h_string
+  void study_header(size_t idx, String& h_string);
+
   /// load list of points from data file and distribute among
   /// listCVPoints, listDIVPoints, listDSVPoints, and listDRVPoints
   bool load_distribute_points(const String& points_filename, 
@@ -165,9 +181,12 @@ private:
 
   /// reset vars to initial point (center)
   void reset(Variables& vars);
-  /// store a centered parameter study header within allHeaders
+  /// store a vector parameter study header for the step-th step
+  /// within h_string
+  void vector_header(size_t step, String& h_string);
+  /// store a centered parameter study header within h_string
   void centered_header(const String& type, size_t var_index, int step,
-		       size_t hdr_index);
+		       String& h_string);
 
   /// specialized per-variable slice output for centered param study
   void archive_allocate_cps() const;
@@ -191,6 +210,10 @@ private:
   /// total number of parameter study evaluations computed from specification
   size_t numEvals;
 
+  /// whether points are generated on demand in core_run() rather than
+  /// stored in allVariables (\c streaming specification)
+  bool streamingFlag;
+
   /// array of continuous evaluation points for the list_parameter_study
   RealVectorArray listCVPoints;
   /// array of discrete int evaluation points for the list_parameter_study
@@ -757,11 +780,23 @@ inline void ParamStudy::reset(Variables& vars)
 }
 
 
+inline void ParamStudy::vector_header(size_t step, String& h_string)
+{
+  h_string.clear();
+  if (iteratedModel.asynch_flag())
+    h_string += "\n\n";
+  if (numSteps == 0) // Allow numSteps == 0 case
+    h_string += ">>>>> Initial_point only (no steps)\n";
+  h_string += ">>>>> Vector parameter study evaluation for ";
+  h_string += std::to_string(step*100./numSteps);
+  h_string += "% along vector\n";
+}
+
+
 inline void ParamStudy::
 centered_header(const String& type, size_t var_index, int step,
-		size_t hdr_index)
+		String& h_string)
 {
-  String& h_string = allHeaders[hdr_index];
   h_string.clear();
   if (iteratedModel.asynch_flag())
     h_string += "\n\n";
@@ -0,0 +1,293 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       PerformanceRegistry
+//- Description: Implementation code for the PerformanceRegistry class
+//- Owner:
+//- Checked by:
+
+#include "PerformanceRegistry.hpp"
+#include "ResultsManager.hpp"
+#include "dakota_global_defs.hpp"
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>  // for getpid
+#endif
+
+static const char rcsId[]="@(#) $Id$";
+
+
+namespace Dakota {
+
+/// bound on the number of spans recorded for trace output (~24 bytes each)
+static const size_t MAX_TRACE_EVENTS = 1000000;
+
+
+PerformanceRegistry::PerformanceRegistry():
+  activeFlag(false), traceFlag(false), droppedEvents(0)
+{ }
+
+
+PerformanceRegistry::~PerformanceRegistry()
+{ }
+
+
+void PerformanceRegistry::activate(const String& trace_file)
+{
+  if (!activeFlag) {
+    startTime = std::chrono::steady_clock::now();
+    SpanNode root = { "dakota", "dakota", 0, SizetArray(), 0, 0, 0, 0 };
+    spanNodes.assign(1, root);
+    openSpans.assign(1, std::make_pair((size_t)0, 0LL));
+    activeFlag = true;
+  }
+  if (!trace_file.empty()) {
+    traceFile = trace_file;
+    traceFlag = true;
+  }
+}
+
+
+long long PerformanceRegistry::elapsed_us() const
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>
+    (std::chrono::steady_clock::now() - startTime).count();
+}
+
+
+/** Children are found by a linear search, since the fan-out at each
+    level of instrumentation is small.  Names are compared by pointer
+    first, as literals from the same call site share an address. */
+size_t PerformanceRegistry::child_node(const char* name, const char* category)
+{
+  size_t parent = openSpans.back().first;
+  const SizetArray& children = spanNodes[parent].children;
+  for (size_t i=0; i<children.size(); ++i) {
+    const char* child_name = spanNodes[children[i]].name;
+    if (child_name == name || std::strcmp(child_name, name) == 0)
+      return children[i];
+  }
+  SpanNode node = { name, category, parent, SizetArray(), 0, 0, 0, 0 };
+  spanNodes.push_back(node);
+  size_t index = spanNodes.size() - 1;
+  spanNodes[parent].children.push_back(index);
+  return index;
+}
+
+
+void PerformanceRegistry::begin_span(const char* name, const char* category)
+{
+  if (!activeFlag) return;
+  openSpans.push_back(std::make_pair(child_node(name, category),
+				     elapsed_us()));
+}
+
+
+void PerformanceRegistry::begin_span(const String& name, const char* category)
+{
+  if (!activeFlag) return;
+  // reuse the registry-owned copy of a previously seen name
+  size_t parent = openSpans.back().first;
+  const SizetArray& children = spanNodes[parent].children;
+  for (size_t i=0; i<children.size(); ++i)
+    if (name == spanNodes[children[i]].name) {
+      openSpans.push_back(std::make_pair(children[i], elapsed_us()));
+      return;
+    }
+  ownedNames.push_back(name);
+  begin_span(ownedNames.back().c_str(), category);
+}
+
+
+void PerformanceRegistry::end_span()
+{
+  // the root span is never closed
+  if (!activeFlag || openSpans.size() <= 1) return;
+
+  long long end_us = elapsed_us(), begin_us = openSpans.back().second,
+    dur_us = end_us - begin_us;
+  size_t index = openSpans.back().first;
+  openSpans.pop_back();
+
+  SpanNode& node = spanNodes[index];
+  if (node.count == 0 || dur_us < node.minUS) node.minUS = dur_us;
+  if (node.count == 0 || dur_us > node.maxUS) node.maxUS = dur_us;
+  node.totalUS += dur_us;
+  ++node.count;
+
+  if (traceFlag) {
+    if (traceEvents.size() < MAX_TRACE_EVENTS) {
+      TraceEvent event = { index, begin_us, dur_us };
+      traceEvents.push_back(event);
+    }
+    else
+      ++droppedEvents;
+  }
+}
+
+
+void PerformanceRegistry::increment(const char* name, long delta)
+{
+  if (activeFlag)
+    counters[name] += delta;
+}
+
+
+String PerformanceRegistry::node_path(size_t node) const
+{
+  String path(spanNodes[node].name);
+  for (size_t p = spanNodes[node].parent; p != 0; p = spanNodes[p].parent)
+    path = String(spanNodes[p].name) + "/" + path;
+  return path;
+}
+
+
+void PerformanceRegistry::print_summary(std::ostream& s) const
+{
+  if (!activeFlag || spanNodes.size() <= 1) return;
+
+  s << "\nPerformance summary (wall clock seconds):\n"
+    << std::setw(12) << "count" << std::setw(14) << "total"
+    << std::setw(14) << "mean"  << std::setw(14) << "max" << "  span\n";
+  // depth-first traversal so that nested spans follow their parent
+  SizetArray stack(spanNodes[0].children.rbegin(),
+		   spanNodes[0].children.rend());
+  SizetArray depth(stack.size(), 0);
+  s << std::setprecision(6) << std::resetiosflags(std::ios::floatfield);
+  while (!stack.empty()) {
+    size_t index = stack.back(), d = depth.back();
+    stack.pop_back(); depth.pop_back();
+    const SpanNode& node = spanNodes[index];
+    Real total = node.totalUS * 1.e-6,
+      mean = (node.count) ? total / node.count : 0.;
+    s << std::setw(12) << node.count << std::setw(14) << total
+      << std::setw(14) << mean << std::setw(14) << node.maxUS * 1.e-6 << "  "
+      << String(2*d, ' ') << node.name << '\n';
+    for (SizetArray::const_reverse_iterator c_rit = node.children.rbegin();
+	 c_rit != node.children.rend(); ++c_rit)
+      { stack.push_back(*c_rit); depth.push_back(d+1); }
+  }
+  if (!counters.empty()) {
+    s << "Performance counters:\n";
+    for (std::map<String, long>::const_iterator c_it = counters.begin();
+	 c_it != counters.end(); ++c_it)
+      s << std::setw(12) << c_it->second << "  " << c_it->first << '\n';
+  }
+  s << std::flush;
+}
+
+
+void PerformanceRegistry::write_results(ResultsManager& results_db) const
+{
+  if (!activeFlag || !results_db.active() || spanNodes.size() <= 1) return;
+
+  size_t i, num_spans = spanNodes.size() - 1;
+  StringArray span_paths(num_spans),
+    span_stats_labels = { "count", "total", "minimum", "maximum" };
+  RealMatrix span_stats(num_spans, span_stats_labels.size());
+  for (i=0; i<num_spans; ++i) {
+    const SpanNode& node = spanNodes[i+1];
+    span_paths[i] = node_path(i+1);
+    span_stats(i,0) = (Real)node.count;
+    span_stats(i,1) = node.totalUS * 1.e-6;
+    span_stats(i,2) = node.minUS   * 1.e-6;
+    span_stats(i,3) = node.maxUS   * 1.e-6;
+  }
+  results_db.add_study_table("performance/spans", span_paths,
+			     span_stats_labels, span_stats);
+
+  if (!counters.empty()) {
+    StringArray counter_names, counter_labels = { "value" };
+    RealMatrix counter_values(counters.size(), 1);
+    for (std::map<String, long>::const_iterator c_it = counters.begin();
+	 c_it != counters.end(); ++c_it) {
+      counter_values(counter_names.size(), 0) = (Real)c_it->second;
+      counter_names.push_back(c_it->first);
+    }
+    results_db.add_study_table("performance/counters", counter_names,
+			       counter_labels, counter_values);
+  }
+}
+
+
+/// write str to s as a quoted and escaped JSON string
+static void json_string(std::ostream& s, const char* str)
+{
+  s << '"';
+  for (; *str; ++str)
+    switch (*str) {
+    case '"':  s << "\\\""; break;
+    case '\\': s << "\\\\"; break;
+    case '\n': s << "\\n";  break;
+    case '\t': s << "\\t";  break;
+    default:
+      if ((unsigned char)*str < 0x20)
+	s << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+	  << (int)*str << std::dec << std::setfill(' ');
+      else
+	s << *str;
+    }
+  s << '"';
+}
+
+
+/** The file may be loaded in chrome://tracing or https://ui.perfetto.dev.
+    Spans are written as complete ("X") events and counters as a single
+    counter ("C") event at the end of the run. */
+void PerformanceRegistry::write_trace() const
+{
+  if (!activeFlag || !traceFlag) return;
+
+  std::ofstream trace_fs(traceFile.c_str());
+  if (!trace_fs.good()) {
+    Cerr << "\nWarning: could not open performance trace file '"
+	 << traceFile << "' for writing." << std::endl;
+    return;
+  }
+#ifdef HAVE_UNISTD_H
+  long pid = (long)getpid();
+#else
+  long pid = 0;
+#endif
+
+  trace_fs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  for (size_t i=0; i<traceEvents.size(); ++i) {
+    const TraceEvent& event = traceEvents[i];
+    const SpanNode&   node  = spanNodes[event.node];
+    trace_fs << ((i) ? ",\n" : "\n") << "{\"name\":";
+    json_string(trace_fs, node.name);
+    trace_fs << ",\"cat\":";
+    json_string(trace_fs, node.category);
+    trace_fs << ",\"ph\":\"X\",\"ts\":" << event.beginUS << ",\"dur\":"
+	     << event.durationUS << ",\"pid\":" << pid << ",\"tid\":0}";
+  }
+  if (!counters.empty()) {
+    trace_fs << ((traceEvents.empty()) ? "\n" : ",\n")
+	     << "{\"name\":\"counters\",\"ph\":\"C\",\"ts\":" << elapsed_us()
+	     << ",\"pid\":" << pid << ",\"tid\":0,\"args\":{";
+    for (std::map<String, long>::const_iterator c_it = counters.begin();
+	 c_it != counters.end(); ++c_it) {
+      if (c_it != counters.begin()) trace_fs << ',';
+      json_string(trace_fs, c_it->first.c_str());
+      trace_fs << ':' << c_it->second;
+    }
+    trace_fs << "}}";
+  }
+  trace_fs << "\n],\"otherData\":{\"dropped_events\":" << droppedEvents
+	   << "}}\n";
+
+  if (droppedEvents)
+    Cout << "\nWarning: performance trace limited to " << MAX_TRACE_EVENTS
+	 << " spans; " << droppedEvents << " spans were not recorded."
+	 << std::endl;
+}
+
+} // namespace Dakota
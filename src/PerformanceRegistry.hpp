@@ -0,0 +1,178 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       PerformanceRegistry
+//- Description: Hierarchical timers and counters for performance diagnosis
+//- Owner:
+//- Version: $Id$
+
+#ifndef PERFORMANCE_REGISTRY_H
+#define PERFORMANCE_REGISTRY_H
+
+#include "dakota_data_types.hpp"
+#include <chrono>
+
+
+namespace Dakota {
+
+class ResultsManager;
+
+
+/// Registry of nested timing spans and event counters
+
+/** Spans are opened and closed in LIFO order (see ScopedTimer) and are
+    aggregated into a call tree keyed by the sequence of enclosing span
+    names, e.g., iterator -> model -> interface -> evaluation.  Each tree
+    node accumulates a count and the total, minimum, and maximum wall
+    clock time.  When trace output is requested, individual spans are
+    also recorded (up to a fixed limit) for export in the Chrome trace
+    event format.  All operations are no-ops unless the registry has
+    been activated, such that instrumentation may remain in place. */
+
+class PerformanceRegistry
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  PerformanceRegistry();  ///< default constructor
+  ~PerformanceRegistry(); ///< destructor
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// activate span and counter collection; a non-empty trace_file
+  /// additionally enables recording of individual spans
+  void activate(const String& trace_file = String());
+  /// return whether collection is active
+  bool active() const;
+
+  /// open a span nested within the currently open span; name must
+  /// remain valid for the life of the registry (e.g., a string literal)
+  void begin_span(const char* name, const char* category);
+  /// open a span with a name that is copied into the registry
+  void begin_span(const String& name, const char* category);
+  /// close the most recently opened span
+  void end_span();
+
+  /// add delta to the named counter
+  void increment(const char* name, long delta = 1);
+
+  /// print the span tree and counters
+  void print_summary(std::ostream& s) const;
+  /// insert the span tree and counters into the results database(s)
+  void write_results(ResultsManager& results_db) const;
+  /// write recorded spans as a Chrome trace event (JSON) file
+  void write_trace() const;
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// find or create the child of the open span with the given name
+  size_t child_node(const char* name, const char* category);
+  /// microseconds elapsed since activation
+  long long elapsed_us() const;
+  /// build the full path name of a node (e.g., "run/map/simulation")
+  String node_path(size_t node) const;
+
+  //
+  //- Heading: Data
+  //
+
+  /// aggregate data for a unique sequence of nested span names
+  struct SpanNode {
+    const char* name;       ///< span name (registry-owned or literal)
+    const char* category;   ///< category for trace output
+    size_t parent;          ///< index of the enclosing node
+    SizetArray children;    ///< indices of nested nodes
+    size_t count;           ///< number of completed spans
+    long long totalUS;      ///< accumulated time (microseconds)
+    long long minUS;        ///< minimum span time (microseconds)
+    long long maxUS;        ///< maximum span time (microseconds)
+  };
+
+  /// an individual span recorded for trace output
+  struct TraceEvent {
+    size_t node;            ///< index into spanNodes
+    long long beginUS;      ///< start time since activation (microseconds)
+    long long durationUS;   ///< span duration (microseconds)
+  };
+
+  /// whether collection is active
+  bool activeFlag;
+  /// whether individual spans are recorded for trace output
+  bool traceFlag;
+  /// Chrome trace output file name
+  String traceFile;
+  /// reference time for all spans
+  std::chrono::steady_clock::time_point startTime;
+
+  /// span tree; index 0 is the root
+  std::vector<SpanNode> spanNodes;
+  /// stack of (node index, start time) for the open spans
+  std::vector<std::pair<size_t, long long> > openSpans;
+  /// storage for span names that are not string literals
+  std::list<String> ownedNames;
+  /// named event counters
+  std::map<String, long> counters;
+  /// recorded spans for trace output
+  std::vector<TraceEvent> traceEvents;
+  /// number of spans not recorded once traceEvents reached its limit
+  size_t droppedEvents;
+};
+
+
+inline bool PerformanceRegistry::active() const
+{ return activeFlag; }
+
+
+/// global registry, defined in dakota_global_defs.cpp
+extern PerformanceRegistry performance_registry;
+
+
+/// RAII span: opened at construction and closed at destruction
+
+/** Instantiate at the top of a scope to time it, e.g.,
+    ScopedTimer timer("map", "interface");  The activity check is inlined
+    so that the cost when inactive is a single branch. */
+
+class ScopedTimer
+{
+public:
+
+  /// open a span with a static name
+  ScopedTimer(const char* name, const char* category = "dakota"):
+    openFlag(performance_registry.active())
+  { if (openFlag) performance_registry.begin_span(name, category); }
+  /// open a span with a dynamic name
+  ScopedTimer(const String& name, const char* category = "dakota"):
+    openFlag(performance_registry.active())
+  { if (openFlag) performance_registry.begin_span(name, category); }
+  /// close the span
+  ~ScopedTimer()
+  { if (openFlag) performance_registry.end_span(); }
+
+private:
+
+  ScopedTimer(const ScopedTimer&) = delete;            ///< not copyable
+  ScopedTimer& operator=(const ScopedTimer&) = delete; ///< not assignable
+
+  /// whether this instance opened a span (registry may be activated later)
+  bool openFlag;
+};
+
+} // namespace Dakota
+
+#endif
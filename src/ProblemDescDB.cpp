@@ -1979,7 +1979,8 @@ const StringArray& ProblemDescDB::get_sa(const String& entry_name) const
     { /* interface */
       { "application.analysis_drivers", P_INT analysisDrivers},
       { "copyFiles", P_INT copyFiles},
-      { "linkFiles", P_INT linkFiles}
+      { "linkFiles", P_INT linkFiles},
+      { "templateFiles", P_INT templateFiles}
     },
     { /* responses */
       { "labels", P_RES responseLabels},
@@ -2017,6 +2018,7 @@ const String& ProblemDescDB::get_string(const String& entry_name) const
     { /* environment */
       {"error_file", P_ENV errorFile},
       {"output_file", P_ENV outputFile},
+      {"performance_trace_file", P_ENV perfTraceFile},
       {"post_run_input", P_ENV postRunInput},
       {"post_run_output", P_ENV postRunOutput},
       {"pre_run_input", P_ENV preRunInput},
@@ -2157,7 +2159,9 @@ const Real& ProblemDescDB::get_real(const String& entry_name) const
 {
   return get<const Real>
   ( "get_real()",
-    { /* environment */ },
+    { /* environment */
+      {"journal_commit_interval", P_ENV journalCommitInterval}
+    },
     { /* method */
       {"asynch_pattern_search.constraint_penalty", P_MET constrPenalty},
       {"asynch_pattern_search.contraction_factor", P_MET contractStepLength},
@@ -2182,6 +2186,7 @@ const Real& ProblemDescDB::get_real(const String& entry_name) const
       {"jega.fitness_limit", P_MET fitnessLimit},
       {"jega.percent_change", P_MET convergenceTolerance},
       {"jega.shrinkage_percentage", P_MET shrinkagePercent},
+      {"jega.steady_state.completion_fraction", P_MET steadyStateFraction},
       {"mesh_adaptive_search.initial_delta", P_MET initMeshSize},
       {"mesh_adaptive_search.variable_neighborhood_search", P_MET vns},
       {"mesh_adaptive_search.variable_tolerance", P_MET minMeshSize},
@@ -2252,6 +2257,7 @@ int ProblemDescDB::get_int(const String& entry_name) const
   return get<int>
   ( "get_int()",
     { /* environment */
+      {"journal_commit_records", P_ENV journalCommitRecords},
       {"output_precision", P_ENV outputPrecision},
       {"stop_restart", P_ENV stopRestart}
     },
@@ -2299,6 +2305,7 @@ int ProblemDescDB::get_int(const String& entry_name) const
       {"c3function_train.max_cross_iterations", P_MOD maxCrossIterations},
       {"initial_samples", P_MOD initialSamples},
       {"nested.iterator_servers", P_MOD subMethodServers},
+      {"nested.local_iterator_concurrency", P_MOD subMethodLocalConcurrency},
       {"nested.processors_per_iterator", P_MOD subMethodProcs},
       {"rf.expansion_bases", P_MOD subspaceDimension},
       {"soft_convergence_limit", P_MOD softConvergenceLimit},
@@ -2623,6 +2630,8 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
     { /* environment */
       {"check", P_ENV checkFlag},
       {"graphics", P_ENV graphicsFlag},
+      {"output_journal", P_ENV outputJournalFlag},
+      {"performance_summary", P_ENV perfSummaryFlag},
       {"post_run", P_ENV postRunFlag},
       {"pre_run", P_ENV preRunFlag},
       {"results_output", P_ENV resultsOutputFlag},
@@ -2641,6 +2650,8 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"export_surrogate", P_MET exportSurrogate},
       {"fixed_seed", P_MET fixedSeedFlag},
       {"fsu_quasi_mc.fixed_sequence", P_MET fixedSequenceFlag},
+      {"fuse_model_transforms", P_MET fuseModelTransforms},
+      {"jega.steady_state", P_MET steadyStateFlag},
       {"import_approx_active_only", P_MET importApproxActive},
       {"import_build_active_only", P_MET importBuildActive},
       {"laplace_approx", P_MET modelEvidLaplace},
@@ -2656,6 +2667,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"nond.allocation_target.optimization", P_MET useTargetVarianceOptimizationFlag},
       {"nond.c3function_train.adapt_order", P_MET adaptOrder},
       {"nond.c3function_train.adapt_rank", P_MET adaptRank},
+      {"nond.concurrent_bounds", P_MET concurrentBoundsFlag},
       {"nond.cross_validation", P_MET crossValidation},
       {"nond.cross_validation.noise_only", P_MET crossValidNoiseOnly},
       {"nond.d_optimal", P_MET dOptimal},
@@ -2663,6 +2675,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"nond.export_sample_sequence", P_MET exportSampleSeqFlag},
       {"nond.generate_posterior_samples", P_MET generatePosteriorSamples},
       {"nond.gpmsa_normalize", P_MET gpmsaNormalize},
+      {"nond.lockstep_mpp_search", P_MET lockstepMPPSearch},
       {"nond.logit_transform", P_MET logitTransform},
       {"nond.model_discrepancy", P_MET calModelDiscrepancy},
       {"nond.mutual_info_ksg2", P_MET mutualInfoKSG2},
@@ -2679,11 +2692,13 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"principal_components", P_MET pcaFlag},
       {"print_each_pop", P_MET printPopFlag},
       {"pstudy.import_active_only", P_MET pstudyFileActive},
+      {"pstudy.streaming", P_MET pstudyStreaming},
       {"quality_metrics", P_MET volQualityFlag},
       {"sbg.replace_points", P_MET surrBasedGlobalReplacePts},
       {"sbl.truth_surrogate_bypass", P_MET surrBasedLocalLayerBypass},
       {"scaling", P_MET methodScaling},
       {"speculative", P_MET speculativeFlag},
+      {"streaming_statistics", P_MET streamingStatsFlag},
       {"variance_based_decomp", P_MET vbdFlag},
       {"wilks", P_MET wilksFlag}
     },
@@ -2710,6 +2725,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"surrogate.import_build_active_only", P_MOD importBuildActive},
       {"surrogate.import_surrogate", P_MOD importSurrogate},
       {"surrogate.import_use_variable_labels", P_MOD importUseVariableLabels},
+      {"surrogate.overlap_evaluations", P_MOD overlapEvalsFlag},
       {"surrogate.point_selection", P_MOD pointSelection},
       {"surrogate.press", P_MOD pressFlag},
       {"surrogate.response_scaling", P_MOD respScalingFlag}
@@ -2723,6 +2739,7 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"application.aprepro", P_INT apreproFlag},
       {"application.file_save", P_INT fileSaveFlag},
       {"application.file_tag", P_INT fileTagFlag},
+      {"application.shell", P_INT shellFlag},
       {"application.verbatim", P_INT verbatimFlag},
       {"asynch", P_INT asynchFlag},
       {"batch", P_INT batchEvalFlag},
@@ -2733,11 +2750,14 @@ bool ProblemDescDB::get_bool(const String& entry_name) const
       {"python.numpy", P_INT numpyFlag},
       {"restart_file", P_INT restartFileFlag},
       {"templateReplace", P_INT templateReplace},
-      {"useWorkdir", P_INT useWorkdir}
+      {"useWorkdir", P_INT useWorkdir},
+      {"workdirPool", P_INT workdirPool}
     },
     { /* responses */
       {"calibration_data", P_RES calibrationDataFlag},
       {"central_hess", P_RES centralHess},
+      {"fd_stencil_compact", P_RES fdStencilCompact},
+      {"fd_stencil_reuse", P_RES fdStencilReuse},
       {"ignore_bounds", P_RES ignoreBounds},
       {"interpolate", P_RES interpolateFlag},
       {"read_field_coordinates", P_RES readFieldCoords}
@@ -17,6 +17,7 @@
 #include "ProblemDescDB.hpp"
 #include "ParallelLibrary.hpp"
 #include "WorkdirHelper.hpp"
+#include "PerformanceRegistry.hpp"
 #include <algorithm>
 #include <boost/filesystem/fstream.hpp>
 
@@ -202,6 +203,35 @@ ProcessApplicInterface(const ProblemDescDB& problem_db):
     }
   }
 
+  // Staging ahead of time only helps when each evaluation gets a
+  // new directory, so the pool requires tagged or temporary workdirs
+  if (useWorkdir && problem_db.get_bool("interface.workdirPool")) {
+    if (dirTag || workDirName.empty()) {
+      // pooled directories are renamed, so must share the parent directory
+      bfs::path wd_parent = (workDirName.empty()) ?
+	WorkdirHelper::system_tmp_path() : bfs::path(workDirName).parent_path();
+      workdirPool.reset(new WorkdirPool(wd_parent, copyFiles, linkFiles,
+					!dirSave));
+    }
+    else
+      Cout << "\nWarning: work_directory pool requires directory_tag for a "
+	   << "named work_directory;\n         ignoring pool." << std::endl;
+  }
+
+  // templates are parsed once, then rendered for each evaluation
+  const StringArray& template_files
+    = problem_db.get_sa("interface.templateFiles");
+  if (!template_files.empty()) {
+    if (batchEval)
+      Cout << "\nWarning: template_files not supported for batch evaluations;"
+	   << "\n         ignoring template_files." << std::endl;
+    else {
+      inputTemplates.resize(template_files.size());
+      for (size_t i=0; i<template_files.size(); ++i)
+	inputTemplates[i].compile(template_files[i]);
+    }
+  }
+
 }
 
 
@@ -223,7 +253,10 @@ derived_map(const Variables& vars, const ActiveSet& set, Response& response,
     write_parameters_files(vars, set, response, fn_eval_id);
 
   // execute the simulator application -- blocking call
-  create_evaluation_process(BLOCK);
+  {
+    ScopedTimer sim_timer("simulation", "evaluation");
+    create_evaluation_process(BLOCK);
+  }
 
   try { 
     if (evalCommRank == 0)
@@ -270,6 +303,7 @@ void ProcessApplicInterface::derived_map_asynch(const ParamResponsePair& pair)
     write_parameters_files(pair.variables(), pair.active_set(),
 			 pair.response(),  fn_eval_id);
     // execute the simulator application -- nonblocking call
+    ScopedTimer launch_timer("launch", "evaluation");
     pid_t pid = create_evaluation_process(FALL_THROUGH);
     // bind process id with eval id for use in synchronization
     map_bookkeeping(pid, fn_eval_id);
@@ -279,6 +313,7 @@ void ProcessApplicInterface::derived_map_asynch(const ParamResponsePair& pair)
 
 void ProcessApplicInterface::wait_local_evaluations(PRPQueue& prp_queue)
 {
+  ScopedTimer wait_timer("wait_local_evaluations", "scheduling");
   if (batchEval) wait_local_evaluation_batch(prp_queue);
   else           wait_local_evaluation_sequence(prp_queue);
 }
@@ -310,8 +345,10 @@ void ProcessApplicInterface::wait_local_evaluation_batch(PRPQueue& prp_queue)
     int fn_eval_id = pair.eval_id();
     fullEvalId = final_eval_id_tag(fn_eval_id); // must be set for eval ID to 
                                                 // appear in params file
+    std::vector<String> eval_an_comps(an_comps);
+    append_evaluation_components(fn_eval_id, eval_an_comps);
     write_parameters_file(pair.variables(), pair.active_set(), 
-        pair.response(), programNames[0], an_comps, 
+        pair.response(), programNames[0], eval_an_comps, 
         paramsFileWritten, false /*append to file*/);
   }
 
@@ -420,11 +457,18 @@ void ProcessApplicInterface::define_filenames(const String& eval_id_tag)
     if (useWorkdir) {
       // curWorkdir is used by Fork/SysCall arg_adjust
       curWorkdir = get_workdir_name();
-      // TODO: Create with 0700 mask?
-      wd_created = WorkdirHelper::create_directory(curWorkdir, DIR_PERSIST);
-      // copy/link tolerate empty items
-      WorkdirHelper::copy_items(copyFiles, curWorkdir, templateReplace);
-      WorkdirHelper::link_items(linkFiles, curWorkdir, templateReplace);
+      // a staged directory from the pool is already populated
+      if (workdirPool && !bfs::exists(curWorkdir) &&
+	  workdirPool->acquire(curWorkdir, (asynchLocalEvalConcurrency > 0) ?
+			       asynchLocalEvalConcurrency : 0))
+	wd_created = true;
+      else {
+	// TODO: Create with 0700 mask?
+	wd_created = WorkdirHelper::create_directory(curWorkdir, DIR_PERSIST);
+	// copy/link tolerate empty items
+	WorkdirHelper::copy_items(copyFiles, curWorkdir, templateReplace);
+	WorkdirHelper::link_items(linkFiles, curWorkdir, templateReplace);
+      }
     }
 
     // non-empty createdDir communicates to write_parameters_files that
@@ -544,6 +588,7 @@ void ProcessApplicInterface::
 write_parameters_files(const Variables& vars,    const ActiveSet& set,
 		       const Response& response, const int id)
 {
+  ScopedTimer io_timer("write_parameters", "file_io");
   PathTriple file_names(paramsFileWritten, resultsFileWritten, createdDir);
 
   // If a new evaluation, insert the modified file names into map for use in
@@ -574,6 +619,11 @@ write_parameters_files(const Variables& vars,    const ActiveSet& set,
   Cout << std::endl;
   */
 
+  // components supplied for this evaluation are appended to those of
+  // each analysis (see evaluation_components())
+  std::vector<String> eval_an_comps;
+  append_evaluation_components(id, eval_an_comps);
+
   // Write paramsFileName without prog_num tag if there's an input filter or if
   // multiple sets of analysisComponents are not used.
   size_t num_programs = programNames.size();
@@ -587,6 +637,8 @@ write_parameters_files(const Variables& vars,    const ActiveSet& set,
     std::vector<String> all_an_comps;
     if (!analysisComponents.empty())
       copy_data(analysisComponents, all_an_comps);
+    all_an_comps.insert(all_an_comps.end(), eval_an_comps.begin(),
+			eval_an_comps.end());
     if (!allowExistingResults)
       std::remove(resultsFileWritten.c_str());
     write_parameters_file(vars, set, response, prog, all_an_comps,
@@ -602,10 +654,40 @@ write_parameters_files(const Variables& vars,    const ActiveSet& set,
       std::string tag_params_fname  = paramsFileWritten  + prog_num;
       if (!allowExistingResults)
 	std::remove(tag_results_fname.c_str());
+      std::vector<String> prog_an_comps(analysisComponents[i]);
+      prog_an_comps.insert(prog_an_comps.end(), eval_an_comps.begin(),
+			   eval_an_comps.end());
       write_parameters_file(vars, set, response, programNames[i],
-			    analysisComponents[i], tag_params_fname);
+			    prog_an_comps, tag_params_fname);
     }
   }
+
+  if (!inputTemplates.empty())
+    write_template_files(vars);
+}
+
+
+/** The components apply to the evaluations with IDs in (after_id,
+    next after_id] and are written after any user-specified analysis
+    components for each; an empty array ends a range.  Callers thus
+    delimit their evaluations by the IDs the interface has assigned
+    rather than predicting the next one. */
+void ProcessApplicInterface::
+evaluation_components(int after_id, const StringArray& an_comps)
+{ evalComponentsMap[after_id] = an_comps; }
+
+
+void ProcessApplicInterface::
+append_evaluation_components(int id, std::vector<String>& an_comps)
+{
+  // the range holding id is keyed by the largest ID below it
+  std::map<int, StringArray>::iterator c_it = evalComponentsMap.lower_bound(id);
+  if (c_it == evalComponentsMap.begin())
+    return;
+  --c_it;
+  an_comps.insert(an_comps.end(), c_it->second.begin(), c_it->second.end());
+  // evaluations are launched in ID order, so earlier ranges are complete
+  evalComponentsMap.erase(evalComponentsMap.begin(), c_it);
 }
 
 
@@ -711,9 +793,50 @@ write_parameters_file(const Variables& vars, const ActiveSet& set,
 }
 
 
+/** Each parameter is available to the templates by its label, as in
+    pyprepro's treatment of a Dakota parameters file, with the label
+    transformed into a valid variable name (e.g., 'x:1' becomes 'x_1'). */
+void ProcessApplicInterface::write_template_files(const Variables& vars) const
+{
+  TemplateEnv params;
+  const RealVector& acv = vars.all_continuous_variables();
+  StringMultiArrayConstView acv_labels = vars.all_continuous_variable_labels();
+  size_t i, num_acv = acv.length();
+  for (i=0; i<num_acv; ++i)
+    params[InputTemplate::variable_name(acv_labels[i])]
+      = TemplateValue(acv[i]);
+  const IntVector& adiv = vars.all_discrete_int_variables();
+  StringMultiArrayConstView adiv_labels
+    = vars.all_discrete_int_variable_labels();
+  size_t num_adiv = adiv.length();
+  for (i=0; i<num_adiv; ++i)
+    params[InputTemplate::variable_name(adiv_labels[i])]
+      = TemplateValue((Real)adiv[i]);
+  StringMultiArrayConstView adsv = vars.all_discrete_string_variables();
+  StringMultiArrayConstView adsv_labels
+    = vars.all_discrete_string_variable_labels();
+  size_t num_adsv = adsv.size();
+  for (i=0; i<num_adsv; ++i)
+    params[InputTemplate::variable_name(adsv_labels[i])]
+      = TemplateValue(adsv[i]);
+  const RealVector& adrv = vars.all_discrete_real_variables();
+  StringMultiArrayConstView adrv_labels
+    = vars.all_discrete_real_variable_labels();
+  size_t num_adrv = adrv.length();
+  for (i=0; i<num_adrv; ++i)
+    params[InputTemplate::variable_name(adrv_labels[i])]
+      = TemplateValue(adrv[i]);
+
+  for (const InputTemplate& input_template : inputTemplates)
+    input_template.render(params,
+			  (curWorkdir / input_template.output_name()).string());
+}
+
+
 void ProcessApplicInterface::
 read_results_files(Response& response, const int id, const String& eval_id_tag)
 {
+  ScopedTimer io_timer("read_results", "file_io");
   // Retrieve parameters & results file names using fn. eval. id.  A map of
   // filenames is used because the names of tmp files must be available here
   // and asynch_recv operations can perform output filtering out of order
@@ -894,6 +1017,10 @@ remove_params_results_files(const bfs::path& params_path,
 /** Remove any files and directories still referenced in the fileNameMap */
 void ProcessApplicInterface::file_cleanup() const
 {
+  // remove directories staged for evaluations that will not be run
+  if (workdirPool)
+    workdirPool->clear();
+
   if (fileSaveFlag && dirSave)
     return;
 
@@ -1042,8 +1169,13 @@ file_and_workdir_cleanup(const bfs::path &params_path,
   if (removing_workdir) {
     if (outputLevel > NORMAL_OUTPUT)
       Cout << "Removing work_directory " << workdir_path << std::endl;
-    WorkdirHelper::recursive_remove(workdir_path, FILEOP_ERROR);
+    if (workdirPool) // recycled or removed in the background
+      workdirPool->release(workdir_path, true);
+    else
+      WorkdirHelper::recursive_remove(workdir_path, FILEOP_ERROR);
   }
+  else if (workdirPool && !workdir_path.empty())
+    workdirPool->release(workdir_path, false);
 
 }
 
@@ -17,12 +17,15 @@
 #define PROCESS_APPLIC_INTERFACE_H
 
 #include "ApplicationInterface.hpp"
+#include "InputTemplate.hpp"
 #ifdef _WIN32
 typedef intptr_t pid_t;
 #endif
 
+#include "WorkdirPool.hpp"
 #include <boost/tuple/tuple.hpp>
 #include <boost/filesystem/path.hpp>
+#include <memory>
 namespace bfs = boost::filesystem;
 
 namespace Dakota {
@@ -72,6 +75,8 @@ protected:
 
   void file_cleanup() const;
 
+  void evaluation_components(int after_id, const StringArray& an_comps);
+
   void file_and_workdir_cleanup(const bfs::path &params_path,
       const bfs::path &results_path,
       const bfs::path &workdir_path,
@@ -209,6 +214,9 @@ protected:
   /// workdir) paths used in spawning function evaluations.  Workdir
   /// will be empty if not created specifically for this eval.
   std::map<int, PathTriple> fileNameMap;
+  /// additional analysis components for ranges of evaluations, keyed by
+  /// the evaluation ID preceding each range (see evaluation_components())
+  std::map<int, StringArray> evalComponentsMap;
 
   // work_directory creation/removal controls
 
@@ -236,6 +244,10 @@ protected:
   StringArray copyFiles;
   /// whether to replace existing files
   bool templateReplace;
+  /// pool of work directories staged in the background (if requested)
+  std::unique_ptr<WorkdirPool> workdirPool;
+  /// compiled input templates, processed into each work directory
+  std::vector<InputTemplate> inputTemplates;
 
 private:
 
@@ -243,6 +255,10 @@ private:
   //- Heading: Convenience functions
   //
 
+  /// append (and release) the additional analysis components of
+  /// evaluation id to an_comps
+  void append_evaluation_components(int id, std::vector<String>& an_comps);
+
   /// write the variables, active set vector, derivative variables vector,
   /// and analysis components to the specified parameters file in either
   /// standard or aprepro format
@@ -251,6 +267,9 @@ private:
 			     const std::vector<String>& an_comps,
 			     const std::string& params_fname,
                              const bool file_mode_out = true);
+  /// process the input templates into the work directory, substituting
+  /// the values of vars
+  void write_template_files(const Variables& vars) const;
 
   /// Open and read the results file at path, properly handling errors
   void read_results_file(Response &response, const bfs::path &path, 
@@ -11,6 +11,8 @@
 #include "MarginalsCorrDistribution.hpp"
 #include "ParallelLibrary.hpp"
 #include "Teuchos_SerialDenseHelpers.hpp"
+#include "WorkdirHelper.hpp"
+#include <cstdint>
 
 namespace Dakota {
 
@@ -26,7 +28,7 @@ RandomFieldModel::RandomFieldModel(ProblemDescDB& problem_db):
   covarianceForm(problem_db.get_ushort("model.rf.analytic_covariance")),
   requestedReducedRank(problem_db.get_int("model.rf.expansion_bases")),
   percentVariance(problem_db.get_real("model.truncation_tolerance")),
-  actualReducedRank(5)
+  actualReducedRank(5), fieldRealizationId(0), fieldBatchId(0)
 {
   modelType = "random_field";
   modelId = RecastModel::recast_model_id(root_model_id(), "RANDOM_FIELD");
@@ -37,7 +39,11 @@ RandomFieldModel::RandomFieldModel(ProblemDescDB& problem_db):
 
 
 RandomFieldModel::~RandomFieldModel()
-{  /* empty dtor */  }
+{
+  // remove any batch files still held by unreturned evaluations
+  if (!fieldWorkDir.empty())
+    WorkdirHelper::recursive_remove(fieldWorkDir, FILEOP_SILENT);
+}
 
 
 Model RandomFieldModel::get_sub_model(ProblemDescDB& problem_db)
@@ -129,6 +135,9 @@ bool RandomFieldModel::initialize_mapping(ParLevLIter pl_iter)
   // complete initialization of the base RecastModel
   initialize_recast();
 
+  // cache the scaled basis once for all subsequent realizations
+  initialize_field_basis();
+
   if (expansionForm == RF_KARHUNEN_LOEVE) {
     // augment mvDist with normal(0,1)
     initialize_rf_coeffs();
@@ -264,6 +273,44 @@ void RandomFieldModel::identify_field_model()
 }
 
 
+/** The basis is scaled once here so that each batch of realizations
+    reduces to field = mean + fieldBasis * coeffs. */
+void RandomFieldModel::initialize_field_basis()
+{
+  pendingFieldCoeffs.clear();
+  pendingFieldEvalIds.clear();
+
+  // RF Suite generates its own realizations; no basis is available
+  if (covarianceForm != NOCOVAR || rfBasis.get_matrix().numRows() == 0) {
+    fieldBasis.shape(0, 0);
+    return;
+  }
+
+  const RealMatrix& rf_ev_trans = rfBasis.get_right_singular_vector_transpose();
+  fieldBasis.shapeUninitialized(numFns, actualReducedRank);
+  switch (expansionForm) {
+  case RF_KARHUNEN_LOEVE: {
+    // ReducedBasis gives the singular values of the centered data
+    // matrix; the covariance is scaled by n-1:
+    int cov_dof = std::sqrt( (double)rfBasis.get_matrix().numRows() - 1 );
+    const RealVector& data_singular_values = rfBasis.get_singular_values();
+    for (int i=0; i<actualReducedRank; ++i) {
+      Real scale = data_singular_values[i]/cov_dof;
+      for (int k=0; k<numFns; ++k)
+	fieldBasis(k,i) = scale*rf_ev_trans(i,k);
+    }
+    break;
+  }
+  case RF_PCA_GP:
+    // reduced basis comprised of the rows of V'
+    for (int i=0; i<actualReducedRank; ++i)
+      for (int k=0; k<numFns; ++k)
+	fieldBasis(k,i) = rf_ev_trans(i,k);
+    break;
+  }
+}
+
+
 /** Initialize the recast model to augment the uncertain variables
     with actualReducedRank additional N(0,1) variables, with no
     response function mapping (for now).*/
@@ -481,13 +528,23 @@ void RandomFieldModel::derived_evaluate(const ActiveSet& set)
   else if (expansionForm == RF_PCA_GP)
     generate_pca_gp_realization();
 
-  // May need hook to communicate the appropraiate mesh file to the simulation
+  // the field must be on disk before the submodel evaluations are
+  // launched; realize it (together with any pending asynch requests) now.
+  // RecastModel numbers the recast evaluation on entry.
+  Interface& sub_interface = subModel.derived_interface();
+  queue_field_evaluation(sub_interface.evaluation_id(),
+			 recastModelEvalCntr + 1);
+  realize_field_batch();
 
   RecastModel::derived_evaluate(set);
-
+  end_field_evaluation();
+  release_field_evaluation(recastModelEvalCntr);
 }
 
 
+/** Realization is deferred: the coefficients are queued and the fields
+    for all queued evaluations are generated in one batch at the next
+    synchronize, prior to the submodel launching its jobs. */
 void RandomFieldModel::derived_evaluate_nowait(const ActiveSet& set)
 {
   fieldRealizationId++;
@@ -497,18 +554,104 @@ void RandomFieldModel::derived_evaluate_nowait(const ActiveSet& set)
   else if (expansionForm == RF_PCA_GP)
     generate_pca_gp_realization();
 
+  // register the batch file location with the submodel evaluations
+  // queued for this recast evaluation, which are launched at synchronize
+  Interface& sub_interface = subModel.derived_interface();
+  int prev_iface_id = sub_interface.evaluation_id();
   RecastModel::derived_evaluate_nowait(set);
+  queue_field_evaluation(prev_iface_id, recastModelEvalCntr);
+  end_field_evaluation();
 }
 
 
-void RandomFieldModel::generate_kl_realization()
+const IntResponseMap& RandomFieldModel::derived_synchronize()
+{
+  realize_field_batch();
+  const IntResponseMap& resp_map = RecastModel::derived_synchronize();
+  for (IntRespMCIter r_it=resp_map.begin(); r_it!=resp_map.end(); ++r_it)
+    release_field_evaluation(r_it->first);
+  return resp_map;
+}
+
+
+const IntResponseMap& RandomFieldModel::derived_synchronize_nowait()
+{
+  realize_field_batch();
+  const IntResponseMap& resp_map = RecastModel::derived_synchronize_nowait();
+  for (IntRespMCIter r_it=resp_map.begin(); r_it!=resp_map.end(); ++r_it)
+    release_field_evaluation(r_it->first);
+  return resp_map;
+}
+
+
+/** The location of the realization (the batch file that will hold the
+    pending batch and the column within it) is passed to the submodel
+    evaluations with interface IDs above prev_iface_id as two
+    additional analysis components, appended to any user-specified
+    ones in the parameters file.  These may be several evaluations,
+    e.g., for finite difference gradients. */
+void RandomFieldModel::
+queue_field_evaluation(int prev_iface_id, int recast_eval_id)
+{
+  // RF Suite generates its own realizations; no batch file is written
+  if (!fieldBasis.numRows())
+    { pendingFieldCoeffs.clear(); return; }
+
+  StringArray an_comps(2);
+  an_comps[0] = field_batch_path(fieldBatchId + 1);
+  an_comps[1] = std::to_string(pendingFieldCoeffs.size() - 1);
+  subModel.derived_interface().evaluation_components(prev_iface_id, an_comps);
+
+  pendingFieldEvalIds.push_back(recast_eval_id);
+}
+
+
+/** The range of submodel evaluations opened by queue_field_evaluation()
+    ends with the last evaluation the interface has assigned. */
+void RandomFieldModel::end_field_evaluation()
+{
+  if (!fieldBasis.numRows())
+    return;
+  Interface& sub_interface = subModel.derived_interface();
+  sub_interface.evaluation_components(sub_interface.evaluation_id(),
+				      StringArray());
+}
+
+
+/** Batch files are written to a private work directory, created on
+    first use and removed with the model. */
+String RandomFieldModel::field_batch_path(int batch_id)
+{
+  if (fieldWorkDir.empty()) {
+    fieldWorkDir = WorkdirHelper::rel_to_abs(
+      WorkdirHelper::system_tmp_file("dakota_rf_work")).string();
+    WorkdirHelper::create_directory(fieldWorkDir, DIR_CLEAN);
+  }
+  bfs::path batch_path = bfs::path(fieldWorkDir) /
+    ("field_realizations." + std::to_string(batch_id) + ".bin");
+  return batch_path.string();
+}
+
+
+/** The batch file is removed once every evaluation reading from it
+    has been returned by the submodel. */
+void RandomFieldModel::release_field_evaluation(int recast_eval_id)
 {
-  // ReducedBasis gives the singular values of the centered data
-  // matrix; the covariance is scaled by n-1:
-  int cov_dof = std::sqrt( (double)rfBasis.get_matrix().numRows() - 1 );
-  const RealVector& data_singular_values = rfBasis.get_singular_values();
-  RealMatrix rf_ev_trans = rfBasis.get_right_singular_vector_transpose();
+  std::map<int, int>::iterator id_it = fieldBatchIdMap.find(recast_eval_id);
+  if (id_it == fieldBatchIdMap.end())
+    return;
+  std::map<int, std::pair<String, size_t> >::iterator f_it
+    = fieldBatchFiles.find(id_it->second);
+  fieldBatchIdMap.erase(id_it);
+  if (f_it != fieldBatchFiles.end() && --f_it->second.second == 0) {
+    WorkdirHelper::recursive_remove(f_it->second.first, FILEOP_WARN);
+    fieldBatchFiles.erase(f_it);
+  }
+}
+
 
+void RandomFieldModel::generate_kl_realization()
+{
   // extract N(0,1) KL coefficients to generate a field realization
   //
   // BMA TODO: properly extract the N(0,1) vars from their place in
@@ -518,7 +661,7 @@ void RandomFieldModel::generate_kl_realization()
   size_t num_sm_normal
     = std::count(sm_cv_types.begin(), sm_cv_types.end(), NORMAL_UNCERTAIN);
   const RealVector& augmented_cvars = currentVariables.continuous_variables();
-  RealVector kl_coeffs(Teuchos::View, augmented_cvars.values() + num_sm_normal,
+  RealVector kl_coeffs(Teuchos::Copy, augmented_cvars.values() + num_sm_normal,
                        actualReducedRank);
 
   if (outputLevel >= DEBUG_OUTPUT) {
@@ -545,54 +688,163 @@ void RandomFieldModel::generate_kl_realization()
   // ForkApplicInterface called ExternalFieldManagerInterface
   // in order to better manage hierarchical tagging
 
-  // augment the mean prediction with the covariance contributions
-  RealVector kl_prediction = rfBasis.get_column_means();
+  // the covariance contributions are added to the mean prediction in
+  // realize_field_batch()
+  pendingFieldCoeffs.push_back(kl_coeffs);
+}
+
+
+void RandomFieldModel::generate_pca_gp_realization()
+{
+  const RealVector& new_sample = currentVariables.continuous_variables();
+  RealVector pca_coeffs(actualReducedRank, false);
   for (int i=0; i<actualReducedRank; ++i) {
-    // BMA TODO: replace with matrix-vector ops (perhaps in ReducedBasis)
-    Real mult = data_singular_values[i]/cov_dof * kl_coeffs[i];
-    for (int k=0; k<numFns; ++k)
-      kl_prediction[k] += mult*rf_ev_trans(i,k);
+    pca_coeffs[i] = gpApproximations[i].value(new_sample);
+    if (outputLevel == DEBUG_OUTPUT)
+      Cout << "DEBUG: pca_coeff = " << pca_coeffs[i] << '\n';
   }
 
-  write_field(kl_prediction);
+  // the GP contributions are added to the mean prediction in
+  // realize_field_batch()
+  pendingFieldCoeffs.push_back(pca_coeffs);
 }
 
 
-void RandomFieldModel::generate_pca_gp_realization()
+/** Forms field_batch = mean * 1' + fieldBasis * coeff_batch with a
+    single matrix-matrix product rather than one rank-by-numFns update
+    per evaluation. */
+void RandomFieldModel::realize_field_batch()
 {
-  // augment the mean prediction with the GP contributions
-  RealVector pca_prediction = rfBasis.get_column_means();
-  // reduced basis comprised of the rows of V'
-  const RealMatrix& principal_comp
-    = rfBasis.get_right_singular_vector_transpose();
+  size_t j, num_pending = pendingFieldCoeffs.size();
+  if (num_pending == 0)
+    return;
+
+  if (fieldBasis.numRows()) {
+    RealMatrix coeff_batch(actualReducedRank, num_pending, false);
+    for (j=0; j<num_pending; ++j)
+      Teuchos::setCol(pendingFieldCoeffs[j], (int)j, coeff_batch);
+
+    if (fieldBatch.numRows() != numFns || fieldBatch.numCols() != num_pending)
+      fieldBatch.shapeUninitialized(numFns, num_pending);
+    const RealVector& col_means = rfBasis.get_column_means();
+    for (j=0; j<num_pending; ++j)
+      Teuchos::setCol(col_means, (int)j, fieldBatch);
+    fieldBatch.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1., fieldBasis,
+			coeff_batch, 1.);
+
+    String batch_filename = field_batch_path(++fieldBatchId);
+    write_field_batch(batch_filename, fieldBatch, pendingFieldEvalIds);
+    if (outputLevel >= VERBOSE_OUTPUT)
+      Cout << "RandomFieldModel: wrote " << num_pending
+	   << " field realizations to " << batch_filename << std::endl;
+    fieldBatchFiles[fieldBatchId]
+      = std::pair<String, size_t>(batch_filename, num_pending);
+    for (j=0; j<num_pending; ++j)
+      fieldBatchIdMap[pendingFieldEvalIds[j]] = fieldBatchId;
+
+    if (outputLevel >= VERBOSE_OUTPUT)
+      for (j=0; j<num_pending; ++j) {
+	RealVector field_j(Teuchos::View, fieldBatch[j], numFns);
+	write_field(field_j, pendingFieldEvalIds[j]);
+      }
+  }
 
-  for (int i=0; i<actualReducedRank; ++i) {
-    const RealVector& new_sample = currentVariables.continuous_variables();
-    Real pca_coeff = gpApproximations[i].value(new_sample);
-    if (outputLevel == DEBUG_OUTPUT)
-      Cout << "DEBUG: pca_coeff = " << pca_coeff << '\n';
-    for (int k=0; k<numFns; ++k)
-      pca_prediction[k] += pca_coeff*principal_comp(i,k);
+  pendingFieldCoeffs.clear();
+  pendingFieldEvalIds.clear();
+}
+
+
+/** Each batch is written as field_realizations.<batch>.bin with a
+    fixed-size header of 8-byte words (magic "DAKRFLD", format version,
+    number of realizations n, field length m), followed by n int64
+    evaluation ids and then the m x n field values as column-major
+    doubles.  All sections are 8-byte aligned so that drivers can
+    memory map the file and index a realization directly. */
+void RandomFieldModel::write_field_batch(const String& batch_filename,
+					 const RealMatrix& field_batch,
+					 const IntArray& eval_ids)
+{
+  std::ofstream batch_file(batch_filename.c_str(),
+			   std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!batch_file) {
+    Cerr << "\nError: RandomFieldModel could not open field batch file "
+	 << batch_filename << std::endl;
+    abort_handler(MODEL_ERROR);
   }
 
-  write_field(pca_prediction);
+  const char magic[8] = { 'D', 'A', 'K', 'R', 'F', 'L', 'D', '\0' };
+  int64_t header[3] = { 1, field_batch.numCols(), field_batch.numRows() };
+  batch_file.write(magic, sizeof(magic));
+  batch_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  std::vector<int64_t> ids(eval_ids.begin(), eval_ids.end());
+  batch_file.write(reinterpret_cast<const char*>(ids.data()),
+		   ids.size()*sizeof(int64_t));
+  // the column-major storage is contiguous when stride == numRows
+  if (field_batch.stride() == field_batch.numRows())
+    batch_file.write(reinterpret_cast<const char*>(field_batch.values()),
+		     sizeof(Real)*field_batch.numRows()*field_batch.numCols());
+  else
+    for (int j=0; j<field_batch.numCols(); ++j)
+      batch_file.write(reinterpret_cast<const char*>(field_batch[j]),
+		       sizeof(Real)*field_batch.numRows());
+  batch_file.close();
 }
 
 
-void RandomFieldModel::write_field(const RealVector& field_prediction)
+/** Reads the realization in (0-based) column col of a batch file
+    written by write_field_batch(), as located by the analysis
+    components passed to the simulation. */
+int RandomFieldModel::read_field_realization(const String& batch_filename,
+					     size_t col, RealVector& field)
 {
-  // TODO: write to file per eval, preferrably in work_directory
-  // BMA TODO: something smarter than modelEvalCntr / eval ID
-  if (outputLevel >= VERBOSE_OUTPUT) {
-    String pred_count(std::to_string(evaluation_id() + 1));
-    std::ofstream myfile;
-    myfile.open(("field_prediction." + pred_count + ".txt").c_str());
-    Cout << "Field prediction " << pred_count << "\n";
-    Cout << field_prediction << std::endl;
-    for (int i=0; i<field_prediction.length(); ++i) 
-      myfile << field_prediction[i] << " ";
-    myfile << std::endl;
+  std::ifstream batch_file(batch_filename.c_str(),
+			   std::ios::in | std::ios::binary);
+  if (!batch_file) {
+    Cerr << "\nError: RandomFieldModel could not open field batch file "
+	 << batch_filename << std::endl;
+    abort_handler(MODEL_ERROR);
   }
+
+  char magic[8];
+  int64_t header[3];
+  batch_file.read(magic, sizeof(magic));
+  batch_file.read(reinterpret_cast<char*>(header), sizeof(header));
+  if (!batch_file || std::string(magic, 7) != "DAKRFLD" || header[0] != 1 ||
+      col >= (size_t)header[1]) {
+    Cerr << "\nError: invalid field batch file " << batch_filename
+	 << " or realization " << col << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+
+  int64_t num_real = header[1], field_len = header[2], eval_id;
+  batch_file.seekg(sizeof(magic) + sizeof(header) + col*sizeof(int64_t));
+  batch_file.read(reinterpret_cast<char*>(&eval_id), sizeof(eval_id));
+  batch_file.seekg(sizeof(magic) + sizeof(header) + num_real*sizeof(int64_t)
+		   + col*field_len*sizeof(Real));
+  field.sizeUninitialized(field_len);
+  batch_file.read(reinterpret_cast<char*>(field.values()),
+		  field_len*sizeof(Real));
+  if (!batch_file) {
+    Cerr << "\nError: truncated field batch file " << batch_filename
+	 << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+  return (int)eval_id;
+}
+
+
+void RandomFieldModel::write_field(const RealVector& field_prediction,
+				   int eval_id)
+{
+  // TODO: write to file per eval, preferrably in work_directory
+  String pred_count(std::to_string(eval_id));
+  std::ofstream myfile;
+  myfile.open(("field_prediction." + pred_count + ".txt").c_str());
+  Cout << "Field prediction " << pred_count << "\n";
+  Cout << field_prediction << std::endl;
+  for (int i=0; i<field_prediction.length(); ++i) 
+    myfile << field_prediction[i] << " ";
+  myfile << std::endl;
 }
 
 
@@ -27,7 +27,14 @@ class ProblemDescDB;
     RecastModel capable of performing forward UQ including the field
     and auxialliary uncertain variables reduced space.  This
     RandomFieldModel wraps the random field propagation model (not the
-    RF-generating model) */
+    RF-generating model).
+
+    For KL and PCA/GP expansions, the realizations for a batch of
+    evaluations are written to one binary file in a private work
+    directory (see write_field_batch()).  Each simulation receives two
+    additional analysis components locating its realization: the
+    absolute path of the batch file and the 0-based column within it.
+    Batch files are removed once all of their evaluations return. */
 class RandomFieldModel: public RecastModel
 {
 public:
@@ -50,6 +57,20 @@ public:
   //bool finalize_mapping();
   bool resize_pending() const;
 
+  //
+  //- Heading: Member functions
+  //
+
+  /// write a batch of field realizations (one per column) to a binary
+  /// batch file
+  static void write_field_batch(const String& batch_filename,
+				const RealMatrix& field_batch,
+				const IntArray& eval_ids);
+  /// read the realization in column col of a batch file; returns the
+  /// evaluation id stored with it
+  static int read_field_realization(const String& batch_filename, size_t col,
+				    RealVector& field);
+
 protected:
 
   //
@@ -72,6 +93,9 @@ protected:
 
   void assign_instance();
 
+  /// not fusable, since evaluations realize random fields
+  bool fusable_recast() const;
+
   // ---
   // Construct time convenience functions
   // ---
@@ -135,15 +159,43 @@ protected:
   void derived_evaluate(const ActiveSet& set);
   /// generate a random field realization, then evaluate the submodel (asynch)
   void derived_evaluate_nowait(const ActiveSet& set);
+  /// realize the pending batch of fields, then synchronize the submodel
+  const IntResponseMap& derived_synchronize();
+  /// realize the pending batch of fields, then synchronize the submodel
+  const IntResponseMap& derived_synchronize_nowait();
+
+  /// cache the scaled reduced basis used to map coefficients to fields
+  void initialize_field_basis();
 
-  /// generate a KL realization and write to file
+  /// extract the KL coefficients for the current variables and append
+  /// them to the pending batch
   void generate_kl_realization();
 
-  /// generate a PCA/GP realization and write to file
+  /// evaluate the PCA/GP coefficients for the current variables and
+  /// append them to the pending batch
   void generate_pca_gp_realization();
 
+  /// map all pending coefficient vectors to fields with a single GEMM
+  /// over the cached basis and write them as one batch
+  void realize_field_batch();
+
+  /// register the batch file and column of the latest pending
+  /// realization with the submodel evaluations following prev_iface_id
+  void queue_field_evaluation(int prev_iface_id, int recast_eval_id);
+  /// end the range of submodel evaluations reading the latest pending
+  /// realization at the last evaluation queued or launched
+  void end_field_evaluation();
+
+  /// absolute path of the batch file for batch_id within the work
+  /// directory (created on first use)
+  String field_batch_path(int batch_id);
+
+  /// decrement the reference count of the batch file read by
+  /// recast_eval_id, removing the file when no evaluations remain
+  void release_field_evaluation(int recast_eval_id);
+
   /// write a field realization to console and file
-  void write_field(const RealVector& field_prediction);
+  void write_field(const RealVector& field_prediction, int eval_id);
 
   // ---
   // Data source
@@ -201,6 +253,26 @@ protected:
   /// counter for RF Suite
   int fieldRealizationId;
 
+  /// cached (numFns x actualReducedRank) basis mapping KL or PCA
+  /// coefficients to field deviations from the column means
+  RealMatrix fieldBasis;
+
+  /// coefficient vectors accumulated by derived_evaluate_nowait()
+  /// awaiting realization at the next synchronize
+  RealVectorArray pendingFieldCoeffs;
+  /// recast evaluation ids corresponding to pendingFieldCoeffs
+  IntArray pendingFieldEvalIds;
+  /// (numFns x batch size) workspace holding the latest field batch
+  RealMatrix fieldBatch;
+  /// counter for field batches written to file
+  int fieldBatchId;
+  /// work directory holding the field batch files
+  String fieldWorkDir;
+  /// batch file name and number of unreturned evaluations, by batch id
+  std::map<int, std::pair<String, size_t> > fieldBatchFiles;
+  /// batch id for each recast evaluation id awaiting its response
+  std::map<int, int> fieldBatchIdMap;
+
   // ---
   // Data for PCA/GP model
   // ---
@@ -235,6 +307,10 @@ inline bool RandomFieldModel::resize_pending() const
 inline void RandomFieldModel::assign_instance()
 { rfmInstance = this; }
 
+
+inline bool RandomFieldModel::fusable_recast() const
+{ return false; }
+
 } // namespace Dakota
 
 #endif
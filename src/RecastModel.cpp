@@ -67,7 +67,8 @@ RecastModel(const Model& sub_model, const Sizet2DArray& vars_map_indices,
   variablesMapping(variables_map), setMapping(set_map),
   primaryRespMapping(primary_resp_map),
   secondaryRespMapping(secondary_resp_map), invVarsMapping(NULL),
-  invSetMapping(NULL), invPriRespMapping(NULL), invSecRespMapping(NULL)
+  invSetMapping(NULL), invPriRespMapping(NULL), invSecRespMapping(NULL),
+  fuseRecasts(false), fusedLayersResolved(false)
 {
   modelType = "recast"; 
   supportsEstimDerivs = false; // subModel estimates derivatives by default
@@ -133,7 +134,8 @@ RecastModel(const Model& sub_model, //size_t num_deriv_vars,
   subModel(sub_model), nonlinearVarsMapping(false), recastModelEvalCntr(0),
   variablesMapping(NULL), setMapping(NULL), primaryRespMapping(NULL),
   secondaryRespMapping(NULL), invVarsMapping(NULL), invSetMapping(NULL),
-  invPriRespMapping(NULL), invSecRespMapping(NULL)
+  invPriRespMapping(NULL), invSecRespMapping(NULL), fuseRecasts(false),
+  fusedLayersResolved(false)
 {
   modelType = "recast";
   supportsEstimDerivs = false; // subModel estimates derivatives by default
@@ -153,7 +155,8 @@ RecastModel::RecastModel(ProblemDescDB& problem_db, const Model& sub_model):
   Model(BaseConstructor(), problem_db), subModel(sub_model),
   recastModelEvalCntr(0), variablesMapping(NULL), setMapping(NULL),
   primaryRespMapping(NULL), secondaryRespMapping(NULL), invVarsMapping(NULL),
-  invSetMapping(NULL), invPriRespMapping(NULL), invSecRespMapping(NULL)
+  invSetMapping(NULL), invPriRespMapping(NULL), invSecRespMapping(NULL),
+  fuseRecasts(false), fusedLayersResolved(false)
 {
   modelType = "recast";
   supportsEstimDerivs = false; // subModel estimates derivatives by default
@@ -170,7 +173,7 @@ RecastModel::RecastModel(const Model& sub_model):
   subModel(sub_model), recastModelEvalCntr(0), variablesMapping(NULL),
   setMapping(NULL), primaryRespMapping(NULL), secondaryRespMapping(NULL),
   invVarsMapping(NULL), invSetMapping(NULL), invPriRespMapping(NULL),
-  invSecRespMapping(NULL)
+  invSecRespMapping(NULL), fuseRecasts(false), fusedLayersResolved(false)
 { 
   modelType = "recast";
   supportsEstimDerivs = false; // subModel estimates derivatives by default
@@ -393,6 +396,11 @@ void RecastModel::derived_evaluate(const ActiveSet& set)
 {
   ++recastModelEvalCntr;
 
+  if (fuseRecasts) {
+    if (!fusedLayersResolved) resolve_fused_layers();
+    if (!fusedLayers.empty()) { fused_evaluate(set); return; }
+  }
+
   // transform from recast (Iterator) to sub-model (user) variables
   transform_variables(currentVariables, subModel.current_variables());
 
@@ -427,6 +435,11 @@ void RecastModel::derived_evaluate_nowait(const ActiveSet& set)
 {
   ++recastModelEvalCntr;
 
+  if (fuseRecasts) {
+    if (!fusedLayersResolved) resolve_fused_layers();
+    if (!fusedLayers.empty()) { fused_evaluate_nowait(set); return; }
+  }
+
   // transform from recast (Iterator) to sub-model (user) variables
   transform_variables(currentVariables, subModel.current_variables());
 
@@ -457,6 +470,9 @@ void RecastModel::derived_evaluate_nowait(const ActiveSet& set)
 
 const IntResponseMap& RecastModel::derived_synchronize()
 {
+  if (!fusedLayers.empty())
+    return fused_synchronize(true);
+
   recastResponseMap.clear();
 
   if (primaryRespMapping || secondaryRespMapping) {
@@ -473,6 +489,9 @@ const IntResponseMap& RecastModel::derived_synchronize()
 
 const IntResponseMap& RecastModel::derived_synchronize_nowait()
 {
+  if (!fusedLayers.empty())
+    return fused_synchronize(false);
+
   recastResponseMap.clear();
 
   if (primaryRespMapping || secondaryRespMapping) {
@@ -511,6 +530,168 @@ transform_response_map(const IntResponseMap& old_resp_map,
 }
 
 
+void RecastModel::fuse_recasts(bool fuse_flag)
+{
+  if (!recastIdMap.empty()) {
+    Cerr << "Error: RecastModel::fuse_recasts() called with pending "
+	 << "evaluations." << std::endl;
+    abort_handler(MODEL_ERROR);
+  }
+  fuseRecasts = (fuse_flag && fusable_recast());
+  fusedLayersResolved = false;
+  fusedLayers.clear();
+}
+
+
+/** The chain is identified on first evaluation, once the evaluation
+    store has been configured by this model's sources.  It ends above
+    the first sub-model that is not a fusable RecastModel, that stores
+    its evaluations or writes them to graphics/tabular output, that may
+    estimate derivatives itself, or that has pending evaluations; that
+    sub-model is evaluated as usual. */
+void RecastModel::resolve_fused_layers()
+{
+  fusedLayers.clear();
+  Model* sub_model = &subModel;
+  for (;;) {
+    std::shared_ptr<RecastModel> layer
+      = std::dynamic_pointer_cast<RecastModel>(sub_model->model_rep());
+    if (!layer || !layer->fusable_recast() || !layer->recastIdMap.empty())
+      break;
+    if (layer->modelEvaluationsDBState == EvaluationsDBState::UNINITIALIZED) {
+      layer->modelEvaluationsDBState = evaluationsDB.model_allocate(
+	layer->modelId, layer->modelType, layer->currentVariables,
+	layer->mvDist, layer->currentResponse, layer->default_active_set());
+      if (layer->modelEvaluationsDBState == EvaluationsDBState::ACTIVE)
+	layer->declare_sources();
+    }
+    if (layer->modelEvaluationsDBState == EvaluationsDBState::ACTIVE ||
+	layer->modelAutoGraphicsFlag)
+      break;
+    const String &grad_type = layer->gradientType,
+                 &hess_type = layer->hessianType;
+    if ( layer->supportsEstimDerivs &&
+	 ( grad_type == "numerical" || grad_type == "mixed" ||
+	   hess_type == "numerical" || hess_type == "mixed" ||
+	   hess_type == "quasi" ) )
+      break;
+    fusedLayers.push_back(layer);
+    sub_model = &layer->subModel;
+  }
+  fusedLayersResolved = true;
+
+  if (outputLevel >= DEBUG_OUTPUT)
+    Cout << "RecastModel " << modelId << " fuses " << fusedLayers.size()
+	 << " recast sub-models.\n";
+}
+
+
+void RecastModel::
+fused_transform_set(const ActiveSet& set, std::vector<ActiveSet>& level_sets)
+{
+  size_t i, num_levels = fusedLayers.size() + 1;
+  level_sets.resize(num_levels + 1);
+  level_sets[0] = set;
+  for (i=0; i<num_levels; ++i) {
+    RecastModel* level = fused_level(i);
+    // count the evaluation at each level as Model::evaluate() would
+    if (i) { ++level->modelEvalCntr; ++level->recastModelEvalCntr; }
+    level->transform_variables(level->currentVariables,
+			       level->subModel.current_variables());
+    level->transform_set(level->currentVariables, level_sets[i],
+			 level_sets[i+1]);
+  }
+}
+
+
+/** Equivalent to a derived_evaluate() at each level, with the
+    currentResponse of each level updated from the level beneath it. */
+void RecastModel::fused_evaluate(const ActiveSet& set)
+{
+  std::vector<ActiveSet> level_sets;
+  fused_transform_set(set, level_sets);
+
+  size_t num_levels = fusedLayers.size() + 1;
+  fused_sub_model().evaluate(level_sets[num_levels]);
+
+  for (int i=(int)num_levels-1; i>=0; --i) {
+    RecastModel* level = fused_level(i);
+    level->currentResponse.active_set(level_sets[i]);
+    if (level->primaryRespMapping || level->secondaryRespMapping)
+      level->transform_response(level->currentVariables,
+				level->subModel.current_variables(),
+				level->subModel.current_response(),
+				level->currentResponse);
+    else
+      level->currentResponse.update(level->subModel.current_response());
+  }
+}
+
+
+/** Variables are copied only for levels with response mappings, and a
+    sub-model variables copy is shared with the level beneath. */
+void RecastModel::fused_evaluate_nowait(const ActiveSet& set)
+{
+  std::vector<ActiveSet> level_sets;
+  fused_transform_set(set, level_sets);
+
+  size_t i, num_levels = fusedLayers.size() + 1;
+  Model& sub_model = fused_sub_model();
+  sub_model.evaluate_nowait(level_sets[num_levels]);
+  recastIdMap[sub_model.evaluation_id()] = recastModelEvalCntr;
+
+  FusedEvaluation& fused_eval = fusedEvalMap[recastModelEvalCntr];
+  fused_eval.recastVars.resize(num_levels);
+  fused_eval.subModelVars.resize(num_levels);
+  Variables above_sub_vars; // sub-model vars copied for the level above
+  for (i=0; i<num_levels; ++i) {
+    RecastModel* level = fused_level(i);
+    Variables sub_vars;
+    if (level->primaryRespMapping || level->secondaryRespMapping) {
+      Variables& recast_vars = fused_eval.recastVars[i];
+      recast_vars = (above_sub_vars.is_null()) ?
+	level->currentVariables.copy() : above_sub_vars;
+      if (level->variablesMapping)
+	sub_vars = level->subModel.current_variables().copy();
+      fused_eval.subModelVars[i] = (sub_vars.is_null()) ? recast_vars
+	                                                 : sub_vars;
+    }
+    above_sub_vars = sub_vars;
+  }
+  fused_eval.sets.swap(level_sets);
+}
+
+
+/** Each level's response mappings are applied to the whole batch of
+    completed evaluations before moving up to the next level. */
+const IntResponseMap& RecastModel::fused_synchronize(bool block)
+{
+  recastResponseMap.clear();
+  rekey_synch(fused_sub_model(), block, recastIdMap, recastResponseMap);
+
+  IntRespMIter r_it;
+  size_t num_levels = fusedLayers.size() + 1;
+  for (int i=(int)num_levels-1; i>=0; --i) {
+    RecastModel* level = fused_level(i);
+    if (!level->primaryRespMapping && !level->secondaryRespMapping)
+      continue;
+    for (r_it=recastResponseMap.begin(); r_it!=recastResponseMap.end(); ++r_it){
+      const FusedEvaluation& fused_eval = fusedEvalMap[r_it->first];
+      Response level_resp(level->currentResponse.copy());
+      level_resp.active_set(fused_eval.sets[i]);
+      level->transform_response(fused_eval.recastVars[i],
+				fused_eval.subModelVars[i], r_it->second,
+				level_resp);
+      r_it->second = level_resp;
+    }
+  }
+  for (r_it=recastResponseMap.begin(); r_it!=recastResponseMap.end(); ++r_it)
+    fusedEvalMap.erase(r_it->first);
+
+  return recastResponseMap;
+}
+
+
 void RecastModel::
 transform_variables(const Variables& recast_vars, Variables& sub_model_vars)
 {
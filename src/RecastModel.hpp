@@ -179,6 +179,11 @@ public:
 
   /// override the submodel's derivative estimation behavior
   void submodel_supports_derivative_estimation(bool sed_flag);
+
+  /// activate fused evaluation of this RecastModel and the chain of
+  /// RecastModels beneath it (see fusedLayers); requires that no
+  /// evaluations are pending
+  void fuse_recasts(bool fuse_flag);
   
   String root_model_id();
 
@@ -442,6 +447,11 @@ protected:
   /// default clear metadata in Recasts; derived classes can override to no-op
   virtual void init_metadata();
 
+  /// whether the transformations of this RecastModel can be applied
+  /// within a fused chain of recasts; derived classes that specialize
+  /// the evaluation of their subModel override to false
+  virtual bool fusable_recast() const;
+
   //
   //- Heading: Member functions
   //
@@ -547,6 +557,26 @@ private:
   /// synchronize with subModel sizes
   void resize_response_mapping();
 
+  /// identify the consecutive RecastModels beneath this one that can
+  /// be fused into its evaluations
+  void resolve_fused_layers();
+  /// RecastModel at level index of the fused chain (0 is this model)
+  RecastModel* fused_level(size_t index);
+  /// the model evaluated beneath the fused chain
+  Model& fused_sub_model();
+  /// transform variables and sets through all levels of the fused
+  /// chain; level_sets[i] is the set for level i and the last entry is
+  /// the set for fused_sub_model()
+  void fused_transform_set(const ActiveSet& set,
+			   std::vector<ActiveSet>& level_sets);
+  /// blocking evaluation through the fused chain
+  void fused_evaluate(const ActiveSet& set);
+  /// nonblocking evaluation through the fused chain
+  void fused_evaluate_nowait(const ActiveSet& set);
+  /// synchronize fused evaluations, applying the response mappings of
+  /// each level to all completions at once
+  const IntResponseMap& fused_synchronize(bool block);
+
   //
   //- Heading: Data members
   //
@@ -616,6 +646,29 @@ private:
 			     const Response& recast_resp,
 			     Response& sub_model_resp);
 
+  /// data bookkept for a fused evaluation for use by the response
+  /// mappings in fused_synchronize()
+  struct FusedEvaluation {
+    /// recast active set of each level
+    std::vector<ActiveSet> sets;
+    /// recast variables of each level with a response mapping
+    VariablesArray recastVars;
+    /// sub-model variables of each level with a response mapping
+    VariablesArray subModelVars;
+  };
+
+  /// whether fused evaluation was requested by fuse_recasts()
+  bool fuseRecasts;
+  /// whether fusedLayers has been identified since fuse_recasts()
+  bool fusedLayersResolved;
+  /// consecutive RecastModels beneath this one (ordered top to bottom)
+  /// whose transformations this model applies directly in fused
+  /// evaluations, bypassing their Model-level evaluation (their
+  /// evaluation counters are still incremented)
+  std::vector<std::shared_ptr<RecastModel> > fusedLayers;
+  /// bookkeeping for pending fused evaluations, replacing recastSetMap,
+  /// recastVarsMap, and subModelVarsMap of all levels
+  std::map<int, FusedEvaluation> fusedEvalMap;
 };
 
 
@@ -623,6 +676,18 @@ inline RecastModel::~RecastModel()
 { }
 
 
+inline bool RecastModel::fusable_recast() const
+{ return true; }
+
+
+inline RecastModel* RecastModel::fused_level(size_t index)
+{ return (index) ? fusedLayers[index-1].get() : this; }
+
+
+inline Model& RecastModel::fused_sub_model()
+{ return fusedLayers.back()->subModel; }
+
+
 inline bool RecastModel::nonlinear_variables_mapping() const
 { return nonlinearVarsMapping; }
 
@@ -117,6 +117,12 @@ public:
   void add_metadata_to_study(const AttributeArray &attrs) override
   { return; }
 
+  /// Study-level tables are not written to the text database
+  void add_study_table(const String &name, const StringArray &row_labels,
+                       const StringArray &col_labels,
+                       const RealMatrix &data) override
+  { return; }
+
 private:
 
   /// print metadata to ostream
@@ -114,6 +114,12 @@ public:
   /// Associate key:value metadata to the study
   virtual void add_metadata_to_study(const AttributeArray &attrs) = 0;
 
+  /// Insert a labeled table of study-level data at the named location
+  virtual void add_study_table(const String &name,
+                               const StringArray &row_labels,
+                               const StringArray &col_labels,
+                               const RealMatrix &data) = 0;
+
   // ##############################################################
   // Methods to support legacy text output
   // ##############################################################
@@ -34,7 +34,7 @@ namespace Dakota {
 // 0. Similarly, when incrementing the minor version, reset the patch level to 
 // 0.
 
-const std::string ResultsDBHDF5::outputVersion = "2.1.0";
+const std::string ResultsDBHDF5::outputVersion = "2.2.0";
 
 
 // Helper functions for naming datasets and scales
@@ -232,6 +232,18 @@ void ResultsDBHDF5::add_metadata_to_study(const AttributeArray &attrs) {
   add_attributes(String("/"), attrs);
 } 
 
+void ResultsDBHDF5::add_study_table(const String &name,
+                                    const StringArray &row_labels,
+                                    const StringArray &col_labels,
+                                    const RealMatrix &data) {
+  String dset_name = "/" + name, scale_root = "/_scales/" + name;
+  hdf5Stream->store_matrix(dset_name, data);
+  hdf5Stream->store_vector(scale_root + "/rows", row_labels);
+  hdf5Stream->attach_scale(dset_name, scale_root + "/rows", "rows", 0);
+  hdf5Stream->store_vector(scale_root + "/columns", col_labels);
+  hdf5Stream->attach_scale(dset_name, scale_root + "/columns", "columns", 1);
+}
+
 void ResultsDBHDF5::
 attach_scales(const String &dset_name,
             const StrStrSizet& iterator_id,
@@ -226,6 +226,12 @@ public:
   /// Associate key:value metadata with the study
   void add_metadata_to_study(const AttributeArray &attrs) override; 
 
+  /// Insert a labeled table of study-level data at /<name>, with the
+  /// labels attached as dimension scales
+  void add_study_table(const String &name, const StringArray &row_labels,
+                       const StringArray &col_labels,
+                       const RealMatrix &data) override;
+
   // ##############################################################
   // Methods to support legacy Any DB (no-op for HDF5)
   // ##############################################################
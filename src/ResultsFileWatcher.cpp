@@ -0,0 +1,326 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       ResultsFileWatcher
+//- Description: Class implementation
+//- Owner:
+
+#include "ResultsFileWatcher.hpp"
+#include <boost/filesystem/operations.hpp>
+#include <cerrno>
+#include <ctime>
+#include <thread>
+
+#ifndef _WIN32
+  #include <poll.h>
+#endif
+#ifdef HAVE_SYS_INOTIFY_H
+  #include <sys/inotify.h>
+  #include <sys/vfs.h>
+  #include <unistd.h>
+#endif
+
+static const char rcsId[]="@(#) $Id$";
+
+
+namespace Dakota {
+
+/// interval without events after which watched files are checked for
+/// existence, in seconds
+static const int SWEEP_INTERVAL = 2;
+
+std::set<ResultsFileWatcher*> ResultsFileWatcher::watcherInstances;
+std::mutex ResultsFileWatcher::instancesMutex;
+
+
+ResultsFileWatcher::ResultsFileWatcher():
+  inotifyFd(-1), lastActivity(std::chrono::steady_clock::now())
+{
+#ifdef HAVE_SYS_INOTIFY_H
+  inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+  std::lock_guard<std::mutex> instances_lock(instancesMutex);
+  watcherInstances.insert(this);
+}
+
+
+ResultsFileWatcher::~ResultsFileWatcher()
+{
+  {
+    std::lock_guard<std::mutex> instances_lock(instancesMutex);
+    watcherInstances.erase(this);
+  }
+#ifdef HAVE_SYS_INOTIFY_H
+  if (inotifyFd >= 0)
+    close(inotifyFd); // also removes all watches
+#endif
+}
+
+
+/** IN_CLOEXEC only covers exec(); a forked child sharing the parent's
+    instance would consume events destined for the parent. */
+void ResultsFileWatcher::reopen_all()
+{
+  std::lock_guard<std::mutex> instances_lock(instancesMutex);
+  for (ResultsFileWatcher* watcher : watcherInstances)
+    watcher->reopen();
+}
+
+
+void ResultsFileWatcher::reopen()
+{
+#ifdef HAVE_SYS_INOTIFY_H
+  if (inotifyFd < 0)
+    return;
+  // closing this descriptor leaves the parent's instance and its
+  // watches intact
+  close(inotifyFd);
+  inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+  watchedFiles.clear(); watchedDirs.clear(); wdDirs.clear();
+}
+
+
+bfs::path ResultsFileWatcher::watch_key(const bfs::path& file)
+{ return bfs::absolute(file); }
+
+
+/** The containing directory is watched for close-after-write and
+    rename events, shared among the files it contains.  A file that
+    already exists (e.g., allow_existing_results) is reported as
+    completed immediately, as existence testing would. */
+bool ResultsFileWatcher::watch(const bfs::path& file)
+{
+#ifdef HAVE_SYS_INOTIFY_H
+  if (inotifyFd < 0)
+    return false;
+
+  bfs::path key = watch_key(file);
+  std::map<bfs::path, WatchedFile>::iterator f_it = watchedFiles.find(key);
+  if (f_it != watchedFiles.end()) { // e.g., a replacement evaluation
+    f_it->second.completed = false;
+    return true;
+  }
+
+  bfs::path dir = key.parent_path();
+  std::map<bfs::path, WatchedDir>::iterator d_it = watchedDirs.find(dir);
+  if (d_it == watchedDirs.end()) {
+    if (!local_file_system(dir))
+      return false;
+    int wd = inotify_add_watch(inotifyFd, dir.c_str(),
+      IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+    if (wd < 0) // e.g., ENOSPC when max_user_watches is reached
+      return false;
+    // A directory reached by a different path may share the descriptor
+    std::map<int, bfs::path>::iterator wd_it = wdDirs.find(wd);
+    if (wd_it != wdDirs.end())
+      return false;
+    WatchedDir new_dir = { wd, 0 };
+    d_it = watchedDirs.insert(std::make_pair(dir, new_dir)).first;
+    wdDirs[wd] = dir;
+  }
+  ++d_it->second.refs;
+
+  // the watch is in place, so a file created from now on generates an event
+  boost::system::error_code ec;
+  WatchedFile new_file = { d_it->second.wd, bfs::exists(key, ec) };
+  watchedFiles[key] = new_file;
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+void ResultsFileWatcher::unwatch(const bfs::path& file)
+{
+  std::map<bfs::path, WatchedFile>::iterator f_it
+    = watchedFiles.find(watch_key(file));
+  if (f_it == watchedFiles.end())
+    return;
+  int wd = f_it->second.wd;
+  watchedFiles.erase(f_it);
+
+  std::map<int, bfs::path>::iterator wd_it = wdDirs.find(wd);
+  if (wd_it == wdDirs.end())
+    return;
+  std::map<bfs::path, WatchedDir>::iterator d_it
+    = watchedDirs.find(wd_it->second);
+  if (--d_it->second.refs == 0) {
+#ifdef HAVE_SYS_INOTIFY_H
+    inotify_rm_watch(inotifyFd, wd);
+#endif
+    watchedDirs.erase(d_it);
+    wdDirs.erase(wd_it);
+  }
+}
+
+
+bool ResultsFileWatcher::completed(const bfs::path& file) const
+{
+  std::map<bfs::path, WatchedFile>::const_iterator f_it
+    = watchedFiles.find(watch_key(file));
+  return f_it != watchedFiles.end() && f_it->second.completed;
+}
+
+
+void ResultsFileWatcher::process_events()
+{
+  if (!watchedFiles.empty())
+    read_events();
+}
+
+
+/** Blocks in poll() on the inotify descriptor, if any files are
+    watched, and on wake_fd, which lets the caller also be woken by
+    other events (e.g., the self-pipe of SpawnCommand::exit_notifier()).
+    A signal interrupting poll() also ends the wait.  If no watched
+    file has completed within SWEEP_INTERVAL seconds, the watched
+    files are swept for existence so that a lost event cannot stall
+    the evaluation schedule. */
+bool ResultsFileWatcher::wait(int timeout_ms, int wake_fd)
+{
+  bool watching = !watchedFiles.empty(), found = watching && read_events();
+  if (found)
+    return true;
+
+#ifndef _WIN32
+  struct pollfd pfds[2];
+  nfds_t num_fds = 0;
+  if (watching) {
+    pfds[num_fds].fd = inotifyFd; pfds[num_fds].events = POLLIN;
+    pfds[num_fds++].revents = 0;
+  }
+  if (wake_fd >= 0) {
+    pfds[num_fds].fd = wake_fd; pfds[num_fds].events = POLLIN;
+    pfds[num_fds++].revents = 0;
+  }
+  if (num_fds) {
+    if (poll(pfds, num_fds, timeout_ms) > 0 && watching)
+      found = read_events();
+  }
+  else
+#endif
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+
+  if (!found && watching && std::chrono::steady_clock::now() - lastActivity
+      >= std::chrono::seconds(SWEEP_INTERVAL))
+    found = sweep_files();
+  return found;
+}
+
+
+bool ResultsFileWatcher::read_events()
+{
+  bool found = false;
+#ifdef HAVE_SYS_INOTIFY_H
+  // buffer aligned for struct inotify_event, holding many events
+  alignas(struct inotify_event) char buffer[16384];
+  for (;;) {
+    ssize_t len = read(inotifyFd, buffer, sizeof(buffer));
+    if (len < 0 && errno == EINTR)
+      continue;
+    if (len <= 0) // EAGAIN: queue drained
+      break;
+    for (char* ptr = buffer; ptr < buffer + len; ) {
+      const struct inotify_event* event
+	= reinterpret_cast<const struct inotify_event*>(ptr);
+      ptr += sizeof(struct inotify_event) + event->len;
+
+      if (event->mask & IN_Q_OVERFLOW) // events lost: check all files
+	{ found |= sweep_files(); continue; }
+      if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF))
+	{ drop_directory(event->wd); continue; }
+      if (!event->len)
+	continue;
+
+      std::map<int, bfs::path>::const_iterator wd_it = wdDirs.find(event->wd);
+      if (wd_it == wdDirs.end())
+	continue;
+      std::map<bfs::path, WatchedFile>::iterator f_it
+	= watchedFiles.find(wd_it->second / event->name);
+      if (f_it != watchedFiles.end() && !f_it->second.completed)
+	found = f_it->second.completed = true;
+    }
+  }
+#endif
+  if (found)
+    lastActivity = std::chrono::steady_clock::now();
+  return found;
+}
+
+
+/** Files are treated as complete only if they have not been modified
+    for SWEEP_INTERVAL seconds, since one still being written may not
+    have produced its close event yet. */
+bool ResultsFileWatcher::sweep_files()
+{
+  bool found = false;
+  std::time_t now = std::time(NULL);
+  boost::system::error_code ec;
+  for (std::map<bfs::path, WatchedFile>::iterator f_it = watchedFiles.begin();
+       f_it != watchedFiles.end(); ++f_it)
+    if (!f_it->second.completed && bfs::exists(f_it->first, ec)) {
+      std::time_t mtime = bfs::last_write_time(f_it->first, ec);
+      if (!ec && now - mtime >= SWEEP_INTERVAL)
+	found = f_it->second.completed = true;
+    }
+  lastActivity = std::chrono::steady_clock::now();
+  return found;
+}
+
+
+/** Files in the directory remain watched, but are only detected by
+    sweep_files(); the owner of a removed or renamed results directory
+    would otherwise wait forever. */
+void ResultsFileWatcher::drop_directory(int wd)
+{
+  std::map<int, bfs::path>::iterator wd_it = wdDirs.find(wd);
+  if (wd_it == wdDirs.end())
+    return;
+  // the watch descriptor is no longer valid; files in the directory keep
+  // their (now stale) descriptor so unwatch() can no longer find it
+  watchedDirs.erase(wd_it->second);
+  wdDirs.erase(wd_it);
+  lastActivity = std::chrono::steady_clock::time_point(); // sweep next wait
+}
+
+
+bool ResultsFileWatcher::local_file_system(const bfs::path& dir)
+{
+#ifdef HAVE_SYS_INOTIFY_H
+  struct statfs fs;
+  if (statfs(dir.c_str(), &fs) != 0)
+    return false;
+  // magic numbers from linux/magic.h and the respective file systems
+  switch ((unsigned long)fs.f_type) {
+  case 0x6969UL:     // NFS
+  case 0x517BUL:     // SMB
+  case 0xFF534D42UL: // CIFS
+  case 0xFE534D42UL: // SMB2
+  case 0x65735546UL: // FUSE
+  case 0x0BD00BD0UL: // Lustre
+  case 0x47504653UL: // GPFS
+  case 0x00C36400UL: // Ceph
+  case 0x5346414FUL: // AFS
+  case 0x6B414653UL: // kAFS
+  case 0x01021997UL: // 9P
+  case 0xAAD7AAEAUL: // PanFS
+  case 0x19830326UL: // BeeGFS
+  case 0x013111A8UL: // IBRIX
+    return false;
+  default:
+    return true;
+  }
+#else
+  return false;
+#endif
+}
+
+} // namespace Dakota
@@ -0,0 +1,158 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       ResultsFileWatcher
+//- Description: Event-driven detection of completed results files
+//- Owner:
+//- Version: $Id$
+
+#ifndef RESULTS_FILE_WATCHER_H
+#define RESULTS_FILE_WATCHER_H
+
+#include "dakota_data_types.hpp"
+#include <boost/filesystem/path.hpp>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace bfs = boost::filesystem;
+
+
+namespace Dakota {
+
+/// Detects completion of results files from file system events rather
+/// than by repeatedly testing for their existence
+
+/** Uses inotify on Linux to watch the directories containing the
+    results files of asynchronous evaluations.  A results file is
+    complete once it is closed after writing or renamed into place,
+    so it is reported exactly once and is never read while the
+    simulation is still writing it.  Files must be watched before the
+    process that writes them is launched.
+
+    watch() returns false, leaving the caller to test for existence of
+    the file as before, when inotify is unavailable, when the watch
+    limit is reached, or when the directory is on a network or FUSE
+    file system, whose writes by other hosts produce no events.  Files
+    that are not watched are therefore handled exactly as without the
+    watcher.  As a guard against lost events, watched files that exist
+    and have not been modified for a few seconds are also treated as
+    complete when no events arrive. */
+
+class ResultsFileWatcher
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  ResultsFileWatcher();  ///< constructor; initializes inotify if available
+  ~ResultsFileWatcher(); ///< destructor; closes the inotify instance
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// whether events are available on this platform
+  bool active() const;
+
+  /// watch for completion of file; returns false if file cannot be
+  /// watched and must be tested for existence instead
+  bool watch(const bfs::path& file);
+  /// stop watching file (if watched)
+  void unwatch(const bfs::path& file);
+  /// whether file is being watched
+  bool watched(const bfs::path& file) const;
+  /// whether a completion event has been received for the watched file
+  bool completed(const bfs::path& file) const;
+
+  /// process pending events without blocking
+  void process_events();
+  /// wait up to timeout_ms milliseconds for events and process them,
+  /// returning early if wake_fd (when nonnegative) becomes readable;
+  /// returns true if any watched file completed
+  bool wait(int timeout_ms, int wake_fd = -1);
+
+  /// in a forked child, replace the inotify instances shared with the
+  /// parent by new ones (see reopen())
+  static void reopen_all();
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// state of a watched file
+  struct WatchedFile {
+    int wd;         ///< watch descriptor of the containing directory
+    bool completed; ///< whether a completion event has been received
+  };
+
+  /// a watched directory
+  struct WatchedDir {
+    int wd;        ///< watch descriptor
+    size_t refs;   ///< number of watched files it contains
+  };
+
+  /// read and dispatch the events in the inotify queue; returns true
+  /// if any watched file completed
+  bool read_events();
+  /// mark as completed the watched files that exist and are no longer
+  /// being modified; returns true if any were found
+  bool sweep_files();
+  /// stop using events for the files in the directory with watch
+  /// descriptor wd (e.g., after it is removed)
+  void drop_directory(int wd);
+  /// whether the file system containing dir delivers events for all
+  /// writes
+  static bool local_file_system(const bfs::path& dir);
+
+  /// absolute, normalized form of file
+  static bfs::path watch_key(const bfs::path& file);
+
+  /// replace the inotify instance by a new one, such that events are
+  /// not consumed from an instance shared with another process; the
+  /// files watched so far are instead tested for existence
+  void reopen();
+
+  //
+  //- Heading: Data
+  //
+
+  /// inotify file descriptor (-1 if unavailable)
+  int inotifyFd;
+  /// watched files, keyed by absolute path
+  std::map<bfs::path, WatchedFile> watchedFiles;
+  /// watched directories, keyed by absolute path
+  std::map<bfs::path, WatchedDir> watchedDirs;
+  /// watched directory paths, keyed by watch descriptor
+  std::map<int, bfs::path> wdDirs;
+  /// time of the last completion event or sweep
+  std::chrono::steady_clock::time_point lastActivity;
+
+  /// all watchers in this process, for reopen_all()
+  static std::set<ResultsFileWatcher*> watcherInstances;
+  /// protects watcherInstances
+  static std::mutex instancesMutex;
+};
+
+
+inline bool ResultsFileWatcher::active() const
+{ return inotifyFd >= 0; }
+
+
+inline bool ResultsFileWatcher::watched(const bfs::path& file) const
+{ return !watchedFiles.empty() && watchedFiles.count(watch_key(file)); }
+
+} // namespace Dakota
+
+#endif
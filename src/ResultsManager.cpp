@@ -78,6 +78,15 @@ void ResultsManager::add_metadata_to_study(const AttributeArray &attrs)
     db->add_metadata_to_study(attrs);
 }
 
+void ResultsManager::add_study_table(const String &name,
+                                     const StringArray &row_labels,
+                                     const StringArray &col_labels,
+                                     const RealMatrix &data)
+{
+  for( auto & db : resultsDBs )
+    db->add_study_table(name, row_labels, col_labels, data);
+}
+
 void ResultsManager::allocate_vector(const StrStrSizet& iterator_id,
               const StringArray &location,
               ResultsOutputType stored_type, 
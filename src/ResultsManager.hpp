@@ -189,6 +189,11 @@ public:
   /// Associate key:value metadata with the object at the location
   void add_metadata_to_study(const AttributeArray &attrs);
 
+  /// Insert a labeled table of study-level (not method-specific) data,
+  /// e.g., performance summaries, at the named location
+  void add_study_table(const String &name, const StringArray &row_labels,
+                       const StringArray &col_labels, const RealMatrix &data);
+
 
   // ##############################################################
   // Methods and variables to support legacy text output
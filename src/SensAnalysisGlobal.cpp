@@ -274,6 +274,90 @@ compute_correlations(const RealMatrix&     vars_samples,
 }
 
 
+void SensAnalysisGlobal::
+initialize_streaming_correlations(size_t num_vars, size_t num_fns)
+{
+  numVars = num_vars;
+  numFns  = num_fns;
+  int num_corr = numVars + numFns;
+  numStreamedObs = 0;
+  streamedMeans.size(num_corr);        // initialized to 0
+  streamedCoMoments.shape(num_corr, num_corr); // initialized to 0
+  streamedObs.sizeUninitialized(num_corr);
+  corrComputed = false;
+}
+
+
+/** Observations with any NaN or +/-Inf response are dropped, consistent
+    with find_valid_samples().  The means and co-moments are updated with
+    the one-pass recurrence of Welford, which avoids the cancellation of
+    accumulating raw sums of products. */
+void SensAnalysisGlobal::
+accumulate_correlations(const Variables& vars, const Response& resp,
+			const StringSetArray& dss_vals)
+{
+  const RealVector& fn_vals = resp.function_values();
+  int i, j, num_corr = numVars + numFns;
+  for (i=0; i<numFns; ++i)
+    if (!std::isfinite(fn_vals[i]))
+      return;
+
+  RealVector obs_vars(Teuchos::View, streamedObs.values(), (int)numVars);
+  vars.as_vector(dss_vals, obs_vars);
+  for (i=0; i<numFns; ++i)
+    streamedObs[numVars+i] = fn_vals[i];
+
+  ++numStreamedObs;
+  Real n = (Real)numStreamedObs, scale = (n - 1.) / n;
+  for (i=0; i<num_corr; ++i) {
+    streamedObs[i] -= streamedMeans[i]; // deviation from the previous mean
+    streamedMeans[i] += streamedObs[i] / n;
+  }
+  for (i=0; i<num_corr; ++i)
+    for (j=0; j<=i; ++j)
+      streamedCoMoments(i,j) += scale * streamedObs[i] * streamedObs[j];
+}
+
+
+/** Simple correlations are the normalized co-moments and partial
+    correlations are formed from blocks of the co-moment matrix, such
+    that both agree with compute_correlations() to within round-off. */
+void SensAnalysisGlobal::compute_streamed_correlations()
+{
+  int i, j, num_corr = numVars + numFns;
+  simpleCorr.shape(num_corr, num_corr);
+  if (numStreamedObs <= 1)
+    simpleCorr.putScalar(std::numeric_limits<double>::quiet_NaN());
+  else {
+    for (i=0; i<num_corr; ++i)
+      for (j=0; j<i; ++j)
+	streamedCoMoments(j,i) = streamedCoMoments(i,j);
+    for (i=0; i<num_corr; ++i) {
+      Real norm_i = std::sqrt(streamedCoMoments(i,i));
+      // set finite diagonal values to 1.0
+      simpleCorr(i,i) = (norm_i > 0.) ? 1. :
+	std::numeric_limits<double>::quiet_NaN();
+      for (j=0; j<i; ++j) {
+	Real corr_ij = streamedCoMoments(i,j) / norm_i
+	  / std::sqrt(streamedCoMoments(j,j));
+	correl_adjust(corr_ij);
+	simpleCorr(i,j) = simpleCorr(j,i) = corr_ij;
+      }
+    }
+  }
+
+  partial_corr(streamedCoMoments, numVars, simpleCorr, partialCorr,
+	       numericalIssuesRaw);
+
+  // rank correlations require all of the observations
+  simpleRankCorr.shape(0, 0);
+  partialRankCorr.shape(0, 0);
+  numericalIssuesRank = false;
+
+  corrComputed = true;
+}
+
+
 /** Calculates simple correlation coefficients from a matrix of data
     (oriented factors x observations):
      - num_corr is number of rows of total data 
@@ -482,6 +566,96 @@ partial_corr(RealMatrix& total_data, const int num_in,
       correl_adjust(corr_matrix(i,j));
 }
 
+/** Mirrors partial_corr() for a data matrix, since X'X, Z'X, and Z'Z
+    for the centered data are blocks of the co-moment matrix.  The
+    truncated pseudo-inverse of Z'Z is formed from its SVD; as Z'Z squares
+    the condition number of Z, singular values are truncated relative to
+    the precision of the co-moments rather than that of the data. */
+void SensAnalysisGlobal::
+partial_corr(const RealMatrix& co_moments, const int num_in,
+	     const RealMatrix& simple_corr_mat,
+	     RealMatrix& corr_matrix, bool& numerical_issues)
+{
+  int num_out = co_moments.numRows() - num_in;
+
+  // initialize output data
+  corr_matrix.reshape(num_in, num_out);
+  numerical_issues = false;
+
+  if (numStreamedObs <= 1) {
+    corr_matrix.putScalar(std::numeric_limits<double>::quiet_NaN());
+    numerical_issues = true;
+    return;
+  }
+
+  // For a single input factor, partial = simple (no controlling factors)
+  if (num_in == 1) {
+    for (int k=0; k<num_out; ++k)
+      corr_matrix(0, k) = simple_corr_mat(0, k+1);
+    return;
+  }
+
+  int j, k, m, num_z = num_in - 1, num_x = 1 + num_out;
+  for (int i=0; i<num_in; ++i) {
+
+    // row/col indices of X = [Vi | R] and Z = [V~i] in co_moments
+    IntArray x_idx(num_x), z_idx(num_z);
+    x_idx[0] = i;
+    for (k=0; k<num_out; ++k)
+      x_idx[1+k] = num_in + k;
+    for (k=0; k<num_z; ++k)
+      z_idx[k] = (k < i) ? k : k + 1;
+
+    RealMatrix partial_cov(num_x, num_x), Zt_X(num_z, num_x),
+      Zt_Z(num_z, num_z);
+    for (j=0; j<num_x; ++j) {
+      for (k=0; k<num_x; ++k)
+	partial_cov(j,k) = co_moments(x_idx[j], x_idx[k]);
+      for (m=0; m<num_z; ++m)
+	Zt_X(m,j) = co_moments(z_idx[m], x_idx[j]);
+    }
+    for (j=0; j<num_z; ++j)
+      for (k=0; k<num_z; ++k)
+	Zt_Z(j,k) = co_moments(z_idx[j], z_idx[k]);
+
+    RealVector sing_vals;
+    RealMatrix v_trans;
+    svd(Zt_Z, sing_vals, v_trans);
+    Real tol = std::numeric_limits<double>::epsilon() * num_z * sing_vals[0];
+    int sv_keep = 0;
+    for ( ; sv_keep < sing_vals.length(); ++sv_keep)
+      if (sing_vals[sv_keep] <= tol)
+	break;
+
+    bool numerical_except = (sv_keep == 0);
+    if (!numerical_except) {
+      // X'X - (X'Z)*pinv(Z'Z)*(Z'X) = X'X - W'W, W = S^{-1/2} V' Z'X
+      v_trans.reshape(sv_keep, num_z);
+      RealMatrix W(sv_keep, num_x);
+      W.multiply(Teuchos::NO_TRANS, Teuchos::NO_TRANS, 1.0, v_trans, Zt_X, 0.0);
+      for (j=0; j<sv_keep; ++j) {
+	Real scale = 1. / std::sqrt(sing_vals[j]);
+	for (k=0; k<num_x; ++k)
+	  W(j,k) *= scale;
+      }
+      partial_cov.multiply(Teuchos::TRANS, Teuchos::NO_TRANS, -1.0, W, W, 1.0);
+    }
+    numerical_issues = numerical_issues || numerical_except;
+
+    for (k=0; k<num_out; ++k)
+      if (numerical_except)
+        corr_matrix(i,k) = std::numeric_limits<Real>::quiet_NaN();
+      else
+        corr_matrix(i,k) = partial_cov(0, k+1) / std::sqrt(partial_cov(0,0)) /
+          std::sqrt(partial_cov(k+1, k+1));
+  }
+
+  // snap all finite values to [-1.0, 1.0]
+  for (int i=0; i<num_in; ++i)
+    for (j=0; j<num_out; ++j)
+      correl_adjust(corr_matrix(i,j));
+}
+
 // Return true if any correlation coefficient is NaN or Inf, false otherwise
 bool SensAnalysisGlobal::has_nan_or_inf(const RealMatrix &corr) const {
   int num_rows = corr.numRows(), num_cols = corr.numCols();
@@ -856,6 +1030,8 @@ print_correlations(std::ostream& s, StringMultiArrayConstView cv_labels,
       s << '\n';
     }
   }
+  else if (!simpleRankCorr.numRows()) // see compute_streamed_correlations()
+    s << "\nRank correlations are not computed for streamed observations.\n";
 
   //  This warning message has been supplanted by more generic tests for NaNs and
   //  Infs
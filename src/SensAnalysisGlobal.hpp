@@ -60,6 +60,17 @@ public:
   void compute_correlations(const RealMatrix&     vars_samples,
                             const IntResponseMap& resp_samples);
 
+  /// reset the one-pass accumulators for correlations among num_vars
+  /// inputs and num_fns outputs
+  void initialize_streaming_correlations(size_t num_vars, size_t num_fns);
+  /// accumulate a single observation into the running means and co-moments
+  void accumulate_correlations(const Variables& vars, const Response& resp,
+                               const StringSetArray& dss_vals);
+  /// computes simple and partial correlations from the accumulated
+  /// co-moments; rank correlations require all observations and are
+  /// not computed
+  void compute_streamed_correlations();
+
   /// save correlations to database
   void archive_correlations(const StrStrSizet& run_identifier,  
                             ResultsManager& iterator_results,
@@ -124,6 +135,11 @@ private:
   void partial_corr(RealMatrix& total_data, const int num_in, 
                     const RealMatrix& simple_corr_mat,
                     RealMatrix& corr_matrix, bool& numerical_issues);
+  /// computes partial correlations from the co-moments of the inputs and
+  /// outputs, populating corr_matrix and numerical_issues
+  void partial_corr(const RealMatrix& co_moments, const int num_in,
+                    const RealMatrix& simple_corr_mat,
+                    RealMatrix& corr_matrix, bool& numerical_issues);
 
   /// Return true if there are any NaN or Inf entries in the matrix
   bool has_nan_or_inf(const RealMatrix &corr) const;
@@ -155,10 +171,21 @@ private:
 
   /// flag indictaing whether correlations have been computed
   bool corrComputed;
+
+  /// number of finite observations passed to accumulate_correlations()
+  size_t numStreamedObs;
+  /// running means of the inputs and outputs
+  RealVector streamedMeans;
+  /// running sums of products of deviations from streamedMeans (lower
+  /// triangle)
+  RealMatrix streamedCoMoments;
+  /// work vector for a single observation of the inputs and outputs
+  RealVector streamedObs;
 };
 
 
-inline SensAnalysisGlobal::SensAnalysisGlobal(): corrComputed(false)
+inline SensAnalysisGlobal::SensAnalysisGlobal():
+  corrComputed(false), numStreamedObs(0)
 { }
 
 
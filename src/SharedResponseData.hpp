@@ -266,6 +266,9 @@ public:
 
   /// create a deep copy of the current object and return by value
   SharedResponseData copy() const;
+
+  /// return true if srd shares the same representation
+  bool same_rep(const SharedResponseData& srd) const;
   /// reshape the data, disconnecting a shared rep if necessary
   void reshape(size_t num_fns);
   /// reshape the shared metadata (labels only at this time)
@@ -330,6 +333,10 @@ inline SharedResponseData::~SharedResponseData()
 { /* empty dtor in case we add virtual functions */ }
 
 
+inline bool SharedResponseData::same_rep(const SharedResponseData& srd) const
+{ return (srdRep == srd.srdRep); }
+
+
 inline size_t SharedResponseData::num_scalar_responses() const
 { return srdRep->numScalarResponses; }
 
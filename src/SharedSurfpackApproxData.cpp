@@ -40,7 +40,7 @@ SharedSurfpackApproxData(ProblemDescDB& problem_db, size_t num_vars):
   crossValidateFlag(problem_db.get_bool("model.surrogate.cross_validate")),
   numFolds(problem_db.get_int("model.surrogate.folds")),
   percentFold(problem_db.get_real("model.surrogate.percent")),
-  pressFlag(problem_db.get_bool("model.surrogate.press"))
+  pressFlag(problem_db.get_bool("model.surrogate.press")), buildCount(0)
 {
   // For Polynomial surface fits
   if (approxType == "global_polynomial")
@@ -62,7 +62,8 @@ SharedSurfpackApproxData(const String& approx_type,
 			 short data_order, short output_level):
   SharedApproxData(NoDBBaseConstructor(), approx_type, num_vars, data_order,
 		   output_level),
-  crossValidateFlag(false), numFolds(0), percentFold(0.0), pressFlag(false)
+  crossValidateFlag(false), numFolds(0), percentFold(0.0), pressFlag(false),
+  buildCount(0)
 {
   approxType = approx_type;
   if (approx_order.empty())
@@ -26,6 +26,8 @@ template< typename T > class SurfpackMatrix;
 
 namespace Dakota {
 
+class SurrogatesGPApprox;
+
 
 /// Derived approximation class for Surfpack approximation classes.
 /// Interface between Surfpack and Dakota.
@@ -71,6 +73,12 @@ public:
 
 protected:
 
+  //
+  //- Heading: Virtual function redefinitions
+  //
+
+  void build();
+
 private:
 
   //
@@ -149,13 +157,27 @@ private:
   Real percentFold;
   /// whether to perform PRESS
   bool pressFlag;
+
+  /// Surrogates GPs sharing this data, in order of construction; those
+  /// with the same build data share one multi-output GaussianProcess
+  std::vector<SurrogatesGPApprox*> gpApproxReps;
+  /// number of builds of the shared data; each GP in gpApproxReps is
+  /// built once per shared build
+  size_t buildCount;
 };
 
 
-inline SharedSurfpackApproxData::SharedSurfpackApproxData()
+inline SharedSurfpackApproxData::SharedSurfpackApproxData():
+  buildCount(0)
 { }
 
 
+/** Subsequent builds of the SurrogatesGPApprox instances in
+    gpApproxReps build a new shared GaussianProcess. */
+inline void SharedSurfpackApproxData::build()
+{ ++buildCount; }
+
+
 inline SharedSurfpackApproxData::~SharedSurfpackApproxData()
 { }
 
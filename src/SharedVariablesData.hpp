@@ -572,6 +572,9 @@ public:
   /// create a deep copy of the current object and return by value
   SharedVariablesData copy() const;
 
+  /// return true if svd shares the same representation
+  bool same_rep(const SharedVariablesData& svd) const;
+
   /// compute all variables sums from
   /// SharedVariablesDataRep::variablesCompsTotals and
   /// SharedVariablesDataRep::allRelaxedDiscrete{Int,Real}
@@ -985,6 +988,10 @@ inline SharedVariablesData::~SharedVariablesData()
 { /* empty dtor in case we add virtual functions */ }
 
 
+inline bool SharedVariablesData::same_rep(const SharedVariablesData& svd) const
+{ return (svdRep == svd.svdRep); }
+
+
 inline void SharedVariablesData::
 all_counts(size_t& num_acv, size_t& num_adiv, size_t& num_adsv,
 	   size_t& num_adrv) const
@@ -438,7 +438,10 @@ inline bool SimulationModel::restart_file(bool recurse_flag) const
 
 
 inline void SimulationModel::set_evaluation_reference()
-{ userDefinedInterface.set_evaluation_reference(); }
+{
+  userDefinedInterface.set_evaluation_reference();
+  stencil_evaluation_reference();
+}
 
 
 inline void SimulationModel::fine_grained_evaluation_counters()
@@ -451,6 +454,8 @@ print_evaluation_summary(std::ostream& s, bool minimal_header,
 {
   userDefinedInterface.print_evaluation_summary(s, minimal_header,
 						relative_count);
+  if (stencilReuse)
+    print_stencil_summary(s, relative_count);
 }
 
 } // namespace Dakota
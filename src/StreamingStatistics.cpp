@@ -0,0 +1,206 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       StreamingStatistics
+//- Description: Implementation code for the StreamingStatistics class
+//- Owner:
+//- Checked by:
+
+#include "StreamingStatistics.hpp"
+#include "pecos_data_types.hpp"
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+static const char rcsId[]="@(#) $Id$";
+
+
+namespace Dakota {
+
+void StreamingStatistics::
+initialize(size_t num_qoi, const RealVectorArray& resp_levels,
+	   const RealVectorArray& cdf_prob_levels)
+{
+  numObs = 0;
+  qoiStats.resize(num_qoi);
+  for (size_t i=0; i<num_qoi; ++i) {
+    QoIStatistics& stats = qoiStats[i];
+    stats.count = 0;
+    stats.mean = stats.m2 = stats.m3 = stats.m4 = 0.;
+    stats.min = DBL_MAX; stats.max = -DBL_MAX;
+    stats.respLevels = (i < resp_levels.size()) ? resp_levels[i] : RealVector();
+    stats.bins.assign(stats.respLevels.length() + 1, 0);
+    size_t j, num_prob = (i < cdf_prob_levels.size()) ?
+      cdf_prob_levels[i].length() : 0;
+    stats.markers.resize(num_prob);
+    for (j=0; j<num_prob; ++j)
+      stats.markers[j].prob = cdf_prob_levels[i][j];
+  }
+}
+
+
+void StreamingStatistics::update(const RealVector& fn_vals)
+{
+  ++numObs;
+  size_t i, num_qoi = qoiStats.size();
+  for (i=0; i<num_qoi; ++i) {
+    Real sample = fn_vals[i];
+    if (std::isfinite(sample)) // neither NaN nor +/-Inf
+      update(i, sample);
+  }
+}
+
+
+void StreamingStatistics::update(size_t qoi, Real sample)
+{
+  QoIStatistics& stats = qoiStats[qoi];
+  size_t j, k, n_prev = stats.count, num_lev = stats.respLevels.length();
+  ++stats.count;
+
+  // central sums: single-observation case of the Pebay (2008) update
+  Real n = (Real)stats.count, delta = sample - stats.mean,
+    delta_n = delta / n, delta_n2 = delta_n * delta_n,
+    term1 = delta * delta_n * (Real)n_prev;
+  stats.mean += delta_n;
+  stats.m4 += term1 * delta_n2 * (n*n - 3.*n + 3.)
+    + 6. * delta_n2 * stats.m2 - 4. * delta_n * stats.m3;
+  stats.m3 += term1 * delta_n * (n - 2.) - 3. * delta_n * stats.m2;
+  stats.m2 += term1;
+
+  if (sample < stats.min) stats.min = sample;
+  if (sample > stats.max) stats.max = sample;
+
+  // 1st bin from -inf to 1st resp lev; last bin from last resp lev to +inf
+  for (k=0; k<num_lev; ++k)
+    if (sample <= stats.respLevels[k]) // cumulative p(g<=z)
+      break;
+  ++stats.bins[k];
+
+  size_t num_markers = stats.markers.size();
+  for (j=0; j<num_markers; ++j) {
+    QuantileMarkers& qm = stats.markers[j];
+    Real* h = qm.heights; Real* pos = qm.positions; Real* des = qm.desired;
+    if (n_prev < 5) {
+      // retain the initial observations in ascending order
+      for (k=n_prev; k>0 && h[k-1] > sample; --k)
+	h[k] = h[k-1];
+      h[k] = sample;
+      if (stats.count == 5) {
+	Real p = qm.prob;
+	for (k=0; k<5; ++k) pos[k] = (Real)(k+1);
+	des[0] = 1.; des[1] = 1. + 2.*p; des[2] = 1. + 4.*p;
+	des[3] = 3. + 2.*p; des[4] = 5.;
+      }
+      continue;
+    }
+
+    // locate the cell containing the sample, extending the extremes
+    if (sample < h[0])
+      { h[0] = sample; k = 0; }
+    else if (sample >= h[4])
+      { h[4] = sample; k = 3; }
+    else
+      for (k=0; k<3; ++k)
+	if (sample < h[k+1])
+	  break;
+    for (size_t m=k+1; m<5; ++m)
+      pos[m] += 1.;
+    Real p = qm.prob;
+    des[1] += p / 2.; des[2] += p; des[3] += (1. + p) / 2.; des[4] += 1.;
+
+    // adjust interior markers that have drifted from their desired position
+    for (k=1; k<4; ++k) {
+      Real d = des[k] - pos[k];
+      if ( ( d >=  1. && pos[k+1] - pos[k] >  1. ) ||
+	   ( d <= -1. && pos[k-1] - pos[k] < -1. ) ) {
+	int s = (d >= 0.) ? 1 : -1;
+	Real parabolic = h[k] + s / (pos[k+1] - pos[k-1]) *
+	  ( (pos[k] - pos[k-1] + s) * (h[k+1] - h[k]) / (pos[k+1] - pos[k]) +
+	    (pos[k+1] - pos[k] - s) * (h[k] - h[k-1]) / (pos[k] - pos[k-1]) );
+	if (h[k-1] < parabolic && parabolic < h[k+1])
+	  h[k] = parabolic;
+	else // fall back to linear prediction
+	  h[k] += s * (h[k+s] - h[k]) / (pos[k+s] - pos[k]);
+	pos[k] += s;
+      }
+    }
+  }
+}
+
+
+/** Unbiased estimators are consistent with Pecos::accumulate_moments(). */
+void StreamingStatistics::
+moments(size_t qoi, short moments_type, Real* moments) const
+{
+  const QoIStatistics& stats = qoiStats[qoi];
+  if (!stats.count) {
+    for (size_t j=0; j<4; ++j)
+      moments[j] = std::numeric_limits<double>::quiet_NaN();
+    return;
+  }
+
+  Real ns = (Real)stats.count, nm1 = ns - 1., nm2 = ns - 2.,
+    sum2 = stats.m2, sum3 = stats.m3, sum4 = stats.m4;
+  bool central = (moments_type == Pecos::CENTRAL_MOMENTS),
+    pos_var = (sum2 > 0.);
+  moments[0] = stats.mean;
+
+  Real cm2 = (stats.count > 1) ? sum2 / nm1 : 0.;
+  moments[1] = (stats.count > 1 && pos_var) ?
+    ( (central) ? cm2 : std::sqrt(cm2) ) : 0.;
+
+  if (stats.count > 2 && pos_var) {
+    moments[2] = sum3 * ns / (nm1 * nm2);
+    if (!central) moments[2] /= cm2 * std::sqrt(cm2);
+  }
+  else
+    moments[2] = 0.;
+
+  if (stats.count > 3 && pos_var) {
+    // standardized excess kurtosis
+    moments[3] = nm1 * ( (ns + 1.) * ns * sum4 / (sum2 * sum2) - 3. * nm1 )
+               / ( nm2 * (ns - 3.) );
+    if (central) moments[3] = (moments[3] + 3.) * cm2 * cm2;
+  }
+  else
+    moments[3] = 0.;
+}
+
+
+/** Prior to five observations, the estimate interpolates the sorted
+    observations in the manner of NonDSampling::compute_level_mappings().
+    Thereafter, the marker heights are interpolated at the desired
+    position of the target marker, which converges to the P-squared
+    estimate as the markers settle. */
+Real StreamingStatistics::quantile(size_t qoi, size_t lev) const
+{
+  const QoIStatistics&  stats = qoiStats[qoi];
+  const QuantileMarkers& qm   = stats.markers[lev];
+  const Real* h = qm.heights;
+  if (!stats.count)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  if (stats.count < 5) {
+    Real cdf_incr_id = qm.prob * (Real)stats.count,
+      lo_id = (cdf_incr_id < 1.) ? 1. : std::floor(cdf_incr_id);
+    size_t lo = (size_t)lo_id - 1;
+    return (lo + 1 < stats.count) ?
+      h[lo] + (cdf_incr_id - lo_id) * (h[lo+1] - h[lo]) : h[lo];
+  }
+
+  const Real* pos = qm.positions;
+  Real target = qm.desired[2];
+  if (target <= pos[0]) return h[0];
+  if (target >= pos[4]) return h[4];
+  size_t k = 0;
+  while (target > pos[k+1]) ++k;
+  return h[k] + (target - pos[k]) * (h[k+1] - h[k]) / (pos[k+1] - pos[k]);
+}
+
+} // namespace Dakota
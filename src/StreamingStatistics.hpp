@@ -0,0 +1,152 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       StreamingStatistics
+//- Description: One-pass moments, level mappings, and quantile estimates
+//- Owner:
+//- Version: $Id$
+
+#ifndef STREAMING_STATISTICS_H
+#define STREAMING_STATISTICS_H
+
+#include "dakota_data_types.hpp"
+
+
+namespace Dakota {
+
+/// One-pass accumulation of sampling statistics for a set of QoI
+
+/** Observations are accumulated one at a time in storage that is
+    independent of the number of observations: the mean and central sums
+    M2-M4 are updated with the numerically stable recurrences of Welford
+    and Pebay, response levels are binned exactly, and each requested
+    probability level is tracked by the five markers of the P-squared
+    algorithm (Jain and Chlamtac, 1985).  Non-finite observations are
+    counted as failures and otherwise omitted, consistent with the
+    sample-based computations in NonDSampling. */
+
+class StreamingStatistics
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  StreamingStatistics();  ///< default constructor
+  ~StreamingStatistics(); ///< destructor
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// size the accumulators for num_qoi QoI, binning at the response
+  /// levels (CDF sense) and estimating the cumulative probability levels
+  /// given for each QoI; resets any accumulated data
+  void initialize(size_t num_qoi, const RealVectorArray& resp_levels,
+		  const RealVectorArray& cdf_prob_levels);
+
+  /// accumulate one observation of all QoI
+  void update(const RealVector& fn_vals);
+
+  /// number of observations passed to update()
+  size_t num_observations() const;
+  /// number of finite observations of QoI qoi
+  size_t count(size_t qoi) const;
+
+  /// compute the mean and the unbiased central (variance, third, fourth)
+  /// or standardized (std deviation, skewness, excess kurtosis) moments
+  void moments(size_t qoi, short moments_type, Real* moments) const;
+
+  /// minimum finite observation of QoI qoi
+  Real minimum(size_t qoi) const;
+  /// maximum finite observation of QoI qoi
+  Real maximum(size_t qoi) const;
+
+  /// counts of finite observations binned by the response levels of
+  /// QoI qoi: bins[j] counts z_{j-1} < g <= z_j and the final bin
+  /// counts g > z_{num_levels-1}
+  const SizetArray& bins(size_t qoi) const;
+
+  /// estimate of the response value at cumulative probability level
+  /// lev of QoI qoi
+  Real quantile(size_t qoi, size_t lev) const;
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// accumulate one finite observation of QoI qoi
+  void update(size_t qoi, Real sample);
+
+  //
+  //- Heading: Data
+  //
+
+  /// P-squared marker state for a single cumulative probability level
+  struct QuantileMarkers {
+    Real prob;              ///< cumulative probability of interest
+    Real heights[5];        ///< marker heights (observations until full)
+    Real positions[5];      ///< actual marker positions
+    Real desired[5];        ///< desired marker positions
+  };
+
+  /// per-QoI accumulators
+  struct QoIStatistics {
+    size_t count;           ///< number of finite observations
+    Real mean;              ///< running mean
+    Real m2;                ///< running sum of squared deviations
+    Real m3;                ///< running sum of cubed deviations
+    Real m4;                ///< running sum of fourth power deviations
+    Real min;               ///< minimum finite observation
+    Real max;               ///< maximum finite observation
+    RealVector respLevels;  ///< response levels used for binning
+    SizetArray bins;        ///< bin counts for respLevels
+    std::vector<QuantileMarkers> markers; ///< one per probability level
+  };
+
+  /// total number of observations, including non-finite
+  size_t numObs;
+  /// accumulators for each QoI
+  std::vector<QoIStatistics> qoiStats;
+};
+
+
+inline StreamingStatistics::StreamingStatistics(): numObs(0)
+{ }
+
+
+inline StreamingStatistics::~StreamingStatistics()
+{ }
+
+
+inline size_t StreamingStatistics::num_observations() const
+{ return numObs; }
+
+
+inline size_t StreamingStatistics::count(size_t qoi) const
+{ return qoiStats[qoi].count; }
+
+
+inline Real StreamingStatistics::minimum(size_t qoi) const
+{ return qoiStats[qoi].min; }
+
+
+inline Real StreamingStatistics::maximum(size_t qoi) const
+{ return qoiStats[qoi].max; }
+
+
+inline const SizetArray& StreamingStatistics::bins(size_t qoi) const
+{ return qoiStats[qoi].bins; }
+
+} // namespace Dakota
+
+#endif
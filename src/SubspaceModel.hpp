@@ -93,6 +93,9 @@ protected:
 
   void assign_instance();
 
+  /// not fusable, since evaluations manage component parallel modes
+  bool fusable_recast() const;
+
   // ---
   // New virtual functions
   // ---
@@ -192,6 +195,10 @@ inline void SubspaceModel::assign_instance()
 { smInstance = this; }
 
 
+inline bool SubspaceModel::fusable_recast() const
+{ return false; }
+
+
 inline bool SubspaceModel::resize_pending() const
 { return !mappingInitialized; }
 
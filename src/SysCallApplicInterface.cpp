@@ -18,18 +18,42 @@
 #include "ParallelLibrary.hpp"
 #include "CommandShell.hpp"
 #include "WorkdirHelper.hpp"
+#include "dakota_data_util.hpp"
 #include <thread>
 
 namespace Dakota {
 
 SysCallApplicInterface::
 SysCallApplicInterface(const ProblemDescDB& problem_db):
-  ProcessApplicInterface(problem_db)
-{ }
+  ProcessApplicInterface(problem_db),
+  spawnFlag(!problem_db.get_bool("interface.application.shell"))
+{
+  // Parse the drivers and filters once; if any of them uses shell syntax,
+  // pass all of them to the shell so that evaluations run consistently
+  if (spawnFlag && !iFilterName.empty())
+    spawnFlag = iFilterCommand.parse(iFilterName);
+  size_t i, num_programs = programNames.size();
+  driverCommands.resize(num_programs);
+  for (i=0; spawnFlag && i<num_programs; ++i)
+    spawnFlag = driverCommands[i].parse(programNames[i]);
+  if (spawnFlag && !oFilterName.empty())
+    spawnFlag = oFilterCommand.parse(oFilterName);
+  if (!spawnFlag)
+    driverCommands.clear();
+  if (outputLevel >= VERBOSE_OUTPUT)
+    Cout << "System interface: " << ( (spawnFlag) ?
+      "launching analysis drivers and filters without a shell." :
+      "launching analysis drivers and filters through the shell." )
+	 << std::endl;
+}
 
 
 void SysCallApplicInterface::map_bookkeeping(pid_t pid, int fn_eval_id)
-{ sysCallSet.insert(fn_eval_id); } // ignores pid
+{
+  sysCallSet.insert(fn_eval_id);
+  if (pid) // launched without a shell; track its remaining commands
+    spawnedEvals[fn_eval_id] = launchedEval;
+}
 
 
 pid_t SysCallApplicInterface::create_evaluation_process(bool block_flag)
@@ -109,11 +133,19 @@ pid_t SysCallApplicInterface::create_evaluation_process(bool block_flag)
     if (!oFilterName.empty() && evalCommRank == 0)
       spawn_output_filter_to_shell(BLOCK);
   }
-  else // launch entire fn eval in a single system call on the local processor
+  else { // launch entire fn eval in a single system call on the local processor
     // An asynchronous_local_analyses scheduler is not supported because of the
     // difficulty in detecting analysis completion (there is not a user
     // specified results file in all cases).
+
+    // Watch for the results file before the evaluation can write it; if it
+    // can't be watched, test_local_evaluation_sequence() tests for existence
+    if (!block_flag)
+      resultsWatcher.watch(completion_file(resultsFileWritten));
+    if (spawnFlag)
+      return spawn_evaluation(block_flag);
     spawn_evaluation_to_shell(block_flag);
+  }
 
   return 0; // pid's not available for system calls
 }
@@ -121,19 +153,37 @@ pid_t SysCallApplicInterface::create_evaluation_process(bool block_flag)
 
 /** Check for completion of active asynch jobs (tracked with sysCallSet).
     Make one pass through sysCallSet & complete all jobs that have returned. */
-void SysCallApplicInterface::test_local_evaluation_sequence(PRPQueue& prp_queue)
+void SysCallApplicInterface::
+test_evaluation_sequence(PRPQueue& prp_queue, bool block_flag)
 {
   // Convenience function for common code between wait and nowait case.
 
+  // commands exiting from now on end the wait below
+  if (!spawnedEvals.empty())
+    SpawnCommand::clear_exit_notifications();
+  advance_spawned_evaluations();
+  resultsWatcher.process_events();
+  size_t num_polled = 0;
   for (ISIter it=sysCallSet.begin(); it!=sysCallSet.end(); ++it) {
 
     // Identify the corresponding PRPair
     int fn_eval_id = *it;
     bool err_msg_caught = false;
 
+    // Evaluations launched without a shell are complete once their
+    // commands have exited and the results file(s) exist
+    if (spawnedEvals.find(fn_eval_id) != spawnedEvals.end())
+      continue;
+
     // Test for existence of the results file(s) corresponding to this PRPair
     const bfs::path& file_to_test = fileNameMap[fn_eval_id].get<1>();
+    bfs::path last_file = completion_file(file_to_test);
+    if (!resultsWatcher.watched(last_file))
+      ++num_polled;
     if (system_call_file_test(file_to_test)) {
+      // The completion event is received once; any read failures below are
+      // retried by testing for existence
+      resultsWatcher.unwatch(last_file);
       // File exists; test for complete/valid set of results (an incomplete 
       // set can result from a race condition in which Dakota is reading a 
       // file that a simulator has not finished writing).  Response::read
@@ -211,7 +261,15 @@ void SysCallApplicInterface::test_local_evaluation_sequence(PRPQueue& prp_queue)
 
   // reduce processor load from DAKOTA testing if jobs are not finishing
   if (completionSet.empty()) { // no jobs completed in pass through entire set
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // if all jobs are watched or launched without a shell, block until a
+    // results file is completed or a launched command exits (returning
+    // periodically to allow sweeps for lost events)
+    int exit_fd = (spawnedEvals.empty()) ? -1 : SpawnCommand::exit_notifier();
+    if (num_polled == 0 && !sysCallSet.empty() &&
+	(spawnedEvals.empty() || exit_fd >= 0))
+      resultsWatcher.wait(block_flag ? 1000 : 1, exit_fd);
+    else
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
   }
   // remove completed jobs from sysCallSet
   for (ISCIter it = completionSet.begin(); it != completionSet.end(); ++it)
@@ -221,6 +279,13 @@ void SysCallApplicInterface::test_local_evaluation_sequence(PRPQueue& prp_queue)
 
 bool SysCallApplicInterface::system_call_file_test(const bfs::path& root_file)
 {
+  // a watched results file is complete once it has been closed after writing
+  // or renamed into place; the existence tests below would also accept a
+  // file that is still being written
+  bfs::path last_file = completion_file(root_file);
+  if (resultsWatcher.watched(last_file))
+    return resultsWatcher.completed(last_file);
+
   size_t num_programs = programNames.size();
   if ( num_programs > 1 && oFilterName.empty() ) {
 #ifdef __SUNPRO_CC
@@ -236,9 +301,7 @@ bool SysCallApplicInterface::system_call_file_test(const bfs::path& root_file)
 #else
     // Testing all files is usually overkill for sequential analyses.  It's only
     // really necessary to check the last tagged_file: root_file.[num_programs]
-    bfs::path tagged_file = 
-      WorkdirHelper::concat_path(root_file, "." + std::to_string(num_programs));
-    return bfs::exists(tagged_file);
+    return bfs::exists(last_file);
 #endif // __SUNPRO_CC
   }
   else
@@ -246,6 +309,124 @@ bool SysCallApplicInterface::system_call_file_test(const bfs::path& root_file)
 }
 
 
+bfs::path SysCallApplicInterface::
+completion_file(const bfs::path& root_file) const
+{
+  size_t num_programs = programNames.size();
+  return ( num_programs > 1 && oFilterName.empty() ) ?
+    WorkdirHelper::concat_path(root_file, "." + std::to_string(num_programs)) :
+    root_file;
+}
+
+
+/** Launch the input filter, analysis drivers, and output filter
+    without a shell.  If block_flag, they are run in sequence;
+    otherwise, the first is launched and the others are launched by
+    advance_spawned_evaluations() as their predecessors exit. */
+pid_t SysCallApplicInterface::spawn_evaluation(bool block_flag)
+{
+  // same file names as spawn_evaluation_to_shell(): drivers use names
+  // relative to the work directory, while filters use the full names
+  String wd_prefix = useWorkdir ? curWorkdir.string() + '/' : String();
+  size_t i, num_programs = programNames.size();
+  std::deque<SpawnCommand> cmds;
+  if (!iFilterName.empty())
+    cmds.push_back(iFilterCommand.substitute(paramsFileName, resultsFileName,
+					     commandLineArgs));
+  for (i=0; i<num_programs; ++i) {
+    String params_file(paramsFileName), results_file(resultsFileName);
+    if (useWorkdir && strbegins(params_file, wd_prefix))
+      params_file.erase(0, wd_prefix.size());
+    if (useWorkdir && strbegins(results_file, wd_prefix))
+      results_file.erase(0, wd_prefix.size());
+    String prog_num("." + std::to_string(i+1));
+    if (multipleParamsFiles)
+      params_file += prog_num;
+    if (num_programs > 1)
+      results_file += prog_num;
+    cmds.push_back(driverCommands[i].substitute(params_file, results_file,
+						commandLineArgs));
+  }
+  if (!oFilterName.empty())
+    cmds.push_back(oFilterCommand.substitute(paramsFileName, resultsFileName,
+					     commandLineArgs));
+
+  if (!suppressOutput) { // output the commands as the shell would show them
+    bool needparen = !block_flag && cmds.size() > 1;
+    if (needparen)
+      Cout << '(';
+    for (i=0; i<cmds.size(); ++i)
+      Cout << ( (i) ? "; " : "" ) << cmds[i].command_line();
+    if (needparen)
+      Cout << ')';
+    Cout << ( (block_flag) ? "" : " &" ) << std::endl;
+  }
+
+  pid_t pid = 0;
+  prepare_process_environment();
+  if (block_flag)
+    for (i=0; i<cmds.size(); ++i)
+      cmds[i].run();
+  else {
+    // notify the exits of this evaluation's commands to
+    // test_evaluation_sequence()
+    SpawnCommand::exit_notifier();
+    pid = cmds.front().spawn();
+    cmds.pop_front();
+    // retain the remaining commands and their environment
+    launchedEval.pid = pid;
+    launchedEval.pending.swap(cmds);
+    launchedEval.workdir = curWorkdir;
+    launchedEval.paramsFile = paramsFileName;
+    launchedEval.resultsFile = resultsFileName;
+  }
+  reset_process_environment();
+  return pid;
+}
+
+
+void SysCallApplicInterface::advance_spawned_evaluations()
+{
+  std::map<int, SpawnedEvaluation>::iterator it = spawnedEvals.begin();
+  while (it != spawnedEvals.end()) {
+    SpawnedEvaluation& eval = it->second;
+    if (!SpawnCommand::exited(eval.pid))
+      ++it;
+    else if (eval.pending.empty()) // all commands have exited
+      spawnedEvals.erase(it++);
+    else {
+      // launch the next command in the environment of its evaluation,
+      // which may differ from that of the most recent evaluation
+      bfs::path cur_workdir(curWorkdir);
+      String cur_params(paramsFileName), cur_results(resultsFileName);
+      curWorkdir = eval.workdir;
+      paramsFileName = eval.paramsFile; resultsFileName = eval.resultsFile;
+      prepare_process_environment();
+      eval.pid = eval.pending.front().spawn();
+      reset_process_environment();
+      curWorkdir = cur_workdir;
+      paramsFileName = cur_params; resultsFileName = cur_results;
+      eval.pending.pop_front();
+      ++it;
+    }
+  }
+}
+
+
+pid_t SysCallApplicInterface::
+spawn_command(const SpawnCommand& cmd, bool block_flag)
+{
+  if (!suppressOutput)
+    Cout << cmd.command_line() << ( (block_flag) ? "" : " &" ) << std::endl;
+  prepare_process_environment();
+  pid_t pid = cmd.spawn();
+  reset_process_environment();
+  if (block_flag)
+    SpawnCommand::wait(pid);
+  return pid;
+}
+
+
 /** Put the SysCallApplicInterface to the shell.  This function is
     used when all portions of the function evaluation (i.e., all analysis
     drivers) are executed on the local processor. */
@@ -330,8 +511,6 @@ void SysCallApplicInterface::spawn_evaluation_to_shell(bool block_flag)
 void SysCallApplicInterface::
 spawn_analysis_to_shell(int analysis_id, bool block_flag)
 {
-  CommandShell shell;
-
   const size_t &num_programs = programNames.size();
   String prog_num( (multipleParamsFiles || num_programs > 1) ?
                    "." + std::to_string(analysis_id) : "" );
@@ -341,6 +520,14 @@ spawn_analysis_to_shell(int analysis_id, bool block_flag)
   if(num_programs > 1)
     results_file += prog_num;
 
+  if (spawnFlag) {
+    spawn_command(driverCommands[analysis_id-1].substitute(params_file,
+      results_file, commandLineArgs), block_flag);
+    return;
+  }
+
+  CommandShell shell;
+
   shell << substitute_params_and_results(programNames[analysis_id-1], params_file,
       results_file);
   if(commandLineArgs) {
@@ -363,6 +550,12 @@ spawn_analysis_to_shell(int analysis_id, bool block_flag)
     externally. */
 void SysCallApplicInterface::spawn_input_filter_to_shell(bool block_flag)
 {
+  if (spawnFlag) {
+    spawn_command(iFilterCommand.substitute(paramsFileName, resultsFileName,
+      commandLineArgs), block_flag);
+    return;
+  }
+
   CommandShell shell;
 
   shell << substitute_params_and_results(iFilterName, paramsFileName, resultsFileName);
@@ -385,6 +578,12 @@ void SysCallApplicInterface::spawn_input_filter_to_shell(bool block_flag)
     externally. */
 void SysCallApplicInterface::spawn_output_filter_to_shell(bool block_flag)
 {
+  if (spawnFlag) {
+    spawn_command(oFilterCommand.substitute(paramsFileName, resultsFileName,
+      commandLineArgs), block_flag);
+    return;
+  }
+
   CommandShell shell;
 
   shell << substitute_params_and_results(oFilterName, paramsFileName, resultsFileName);
@@ -17,6 +17,9 @@
 #define SYS_CALL_APPLIC_INTERFACE_H
 
 #include "ProcessApplicInterface.hpp"
+#include "ResultsFileWatcher.hpp"
+#include "CommandShell.hpp"
+#include <deque>
 
 
 namespace Dakota {
@@ -26,7 +29,14 @@ namespace Dakota {
 /// using system calls.
 
 /** system() is part of the C API and can be used on both Windows and
-    Unix systems. */
+    Unix systems.  Completion of asynchronous evaluations is detected
+    from the results files, using file system events where available
+    (see ResultsFileWatcher) and testing for their existence
+    otherwise.  Unless the shell is requested, drivers and filters that
+    use no shell syntax are instead launched directly (see
+    SpawnCommand), in which case the results files are read once their
+    processes have exited, and waits for completion also end when one
+    of them exits. */
 
 class SysCallApplicInterface: public ProcessApplicInterface
 {
@@ -67,9 +77,27 @@ private:
   //- Heading: Methods
   //
 
-  /// detect completion of a function evaluation through existence of
-  /// the necessary results file(s); return true if results files found
+  /// check active asynch jobs once, completing those that have
+  /// returned; if none have and block_flag, wait for file system events
+  /// (or pause briefly) before returning
+  void test_evaluation_sequence(PRPQueue& prp_queue, bool block_flag);
+
+  /// detect completion of a function evaluation through events for, or
+  /// existence of, the necessary results file(s); return true if results
+  /// files found
   bool system_call_file_test(const bfs::path& root_file);
+  /// the results file whose appearance signals completion of an
+  /// evaluation with results file root_file
+  bfs::path completion_file(const bfs::path& root_file) const;
+
+  /// launch the drivers and filters of a complete function evaluation
+  /// without a shell; returns the process id of the first if nonblocking
+  pid_t spawn_evaluation(bool block_flag);
+  /// launch the next command of each nonblocking evaluation launched
+  /// without a shell whose previous command has exited
+  void advance_spawned_evaluations();
+  /// launch cmd without a shell, waiting for it to exit if block_flag
+  pid_t spawn_command(const SpawnCommand& cmd, bool block_flag);
 
   /// spawn a complete function evaluation
   void spawn_evaluation_to_shell(bool block_flag);
@@ -90,6 +118,33 @@ private:
     
   /// map linking function evaluation id's to number of response read failures
   IntShortMap failCountMap; 
+
+  /// watches the results files of asynchronous evaluations for completion
+  ResultsFileWatcher resultsWatcher;
+
+  /// whether the drivers and filters are launched without a shell
+  bool spawnFlag;
+  /// input filter parsed for launching without a shell
+  SpawnCommand iFilterCommand;
+  /// analysis drivers parsed for launching without a shell
+  std::vector<SpawnCommand> driverCommands;
+  /// output filter parsed for launching without a shell
+  SpawnCommand oFilterCommand;
+
+  /// state of a nonblocking evaluation launched without a shell
+  struct SpawnedEvaluation {
+    pid_t pid;                          ///< process of the running command
+    std::deque<SpawnCommand> pending;   ///< commands yet to be launched
+    bfs::path workdir;                  ///< work directory of the evaluation
+    String paramsFile;                  ///< parameters file of the evaluation
+    String resultsFile;                 ///< results file of the evaluation
+  };
+  /// evaluation most recently launched by spawn_evaluation(), pending
+  /// map_bookkeeping()
+  SpawnedEvaluation launchedEval;
+  /// evaluations launched without a shell whose commands have not all
+  /// exited, keyed by evaluation id
+  std::map<int, SpawnedEvaluation> spawnedEvals;
 };
 
 
@@ -107,10 +162,15 @@ inline void SysCallApplicInterface::
 wait_local_evaluation_sequence(PRPQueue& prp_queue)
 {
   while (completionSet.empty()) // complete at least one job
-    test_local_evaluation_sequence(prp_queue);
+    test_evaluation_sequence(prp_queue, true);
 }
 
 
+inline void SysCallApplicInterface::
+test_local_evaluation_sequence(PRPQueue& prp_queue)
+{ test_evaluation_sequence(prp_queue, false); }
+
+
 /** This code provides the derived function used by 
     ApplicationInterface::serve_analyses_synch(). */
 inline int SysCallApplicInterface::synchronous_local_analysis(int analysis_id)
@@ -0,0 +1,496 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       WorkdirPool
+//- Description: Implementation code for the WorkdirPool class
+//- Owner:
+//- Checked by:
+
+#include "WorkdirPool.hpp"
+#include "WorkdirHelper.hpp"
+#include "dakota_data_util.hpp"  // for strcontains
+#include <cerrno>
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #ifdef __linux__
+    #include <sys/ioctl.h>
+    #include <linux/fs.h>  // for FICLONE
+  #endif
+#endif
+
+static const char rcsId[]="@(#) $Id$";
+
+
+namespace Dakota {
+
+std::set<WorkdirPool*> WorkdirPool::poolInstances;
+std::mutex WorkdirPool::instancesMutex;
+
+
+WorkdirPool::
+WorkdirPool(const bfs::path& parent_dir, const StringArray& copy_files,
+	    const StringArray& link_files, bool recycle):
+  parentDir(parent_dir), recycleFlag(recycle), reflinkFlag(true),
+  numInProgress(0), numActive(0), peakActive(0), evalConcurrency(0),
+  nameCntr(0), numHits(0), numMisses(0), stopFlag(true), stageFailed(false)
+{
+  // the background thread must not depend on the current directory,
+  // which changes while launching evaluations
+  if (parentDir.is_relative())
+    parentDir = WorkdirHelper::rel_to_abs(parentDir);
+  for (const String& item : copy_files)
+    copyItems.push_back(bfs::path(item).is_relative() ?
+			WorkdirHelper::rel_to_abs(item).string() : item);
+  for (const String& item : link_files)
+    linkItems.push_back(bfs::path(item).is_relative() ?
+			WorkdirHelper::rel_to_abs(item).string() : item);
+
+  // unique among concurrent studies sharing the parent directory
+  poolPrefix = bfs::unique_path("dakota_pool_%%%%%%%%").string() + ".";
+
+#ifdef _WIN32
+  recycleFlag = false; // no inode or change time to detect modified items
+#endif
+
+  std::lock_guard<std::mutex> instances_lock(instancesMutex);
+  poolInstances.insert(this);
+}
+
+
+WorkdirPool::~WorkdirPool()
+{
+  {
+    std::lock_guard<std::mutex> instances_lock(instancesMutex);
+    poolInstances.erase(this);
+  }
+  clear();
+}
+
+
+bool WorkdirPool::acquire(const bfs::path& dest_dir, size_t concurrency)
+{
+  PooledDir staged;
+  {
+    std::lock_guard<std::mutex> pool_lock(poolMutex);
+    evalConcurrency = concurrency;
+    if (++numActive > peakActive) peakActive = numActive;
+    if (stopFlag && !workerThread.joinable()) {
+      stopFlag = false;
+      workerThread = std::thread(&WorkdirPool::work_loop, this);
+    }
+    // replenish the pool whether or not a staged directory is available
+    workCondition.notify_one();
+    if (readyDirs.empty())
+      { ++numMisses; return false; }
+    staged = std::move(readyDirs.front());
+    readyDirs.pop_front();
+  }
+
+  boost::system::error_code ec;
+  bfs::path abs_dest = bfs::absolute(dest_dir);
+  bfs::rename(staged.path, abs_dest, ec);
+  std::lock_guard<std::mutex> pool_lock(poolMutex);
+  if (ec) { // e.g., dest_dir is not in parentDir or on another filesystem
+    removeDirs.push_back(staged.path);
+    ++numMisses;
+    return false;
+  }
+  activeManifests[abs_dest] = std::move(staged.manifest);
+  ++numHits;
+  return true;
+}
+
+
+void WorkdirPool::release(const bfs::path& dir, bool remove_dir)
+{
+  bfs::path abs_dir = bfs::absolute(dir), pool_path;
+  PooledDir used;
+  bool recycle = false;
+  {
+    std::lock_guard<std::mutex> pool_lock(poolMutex);
+    if (numActive) --numActive;
+    std::map<bfs::path, Manifest>::iterator m_it
+      = activeManifests.find(abs_dir);
+    if (m_it != activeManifests.end()) {
+      recycle = (remove_dir && recycleFlag && !stageFailed &&
+		 readyDirs.size() + resetDirs.size() + numInProgress
+		 < target_ready());
+      if (recycle) used.manifest = std::move(m_it->second);
+      activeManifests.erase(m_it);
+    }
+    if (!remove_dir)
+      return;
+    pool_path = next_pool_path();
+  }
+
+  // free the work directory name immediately; the contents are handled
+  // in the background
+  boost::system::error_code ec;
+  bfs::rename(abs_dir, pool_path, ec);
+  if (ec) {
+    WorkdirHelper::recursive_remove(abs_dir, FILEOP_ERROR);
+    return;
+  }
+  std::lock_guard<std::mutex> pool_lock(poolMutex);
+  if (recycle) {
+    used.path = pool_path;
+    resetDirs.push_back(std::move(used));
+  }
+  else
+    removeDirs.push_back(pool_path);
+  workCondition.notify_one();
+}
+
+
+void WorkdirPool::clear()
+{
+  suspend();
+
+  boost::system::error_code ec;
+  for (const PooledDir& dir : readyDirs)
+    bfs::remove_all(dir.path, ec);
+  for (const PooledDir& dir : resetDirs)
+    bfs::remove_all(dir.path, ec);
+  for (const bfs::path& path : removeDirs)
+    bfs::remove_all(path, ec);
+  readyDirs.clear(); resetDirs.clear(); removeDirs.clear();
+}
+
+
+void WorkdirPool::suspend()
+{
+  {
+    std::lock_guard<std::mutex> pool_lock(poolMutex);
+    stopFlag = true;
+    workCondition.notify_one();
+  }
+  if (workerThread.joinable())
+    workerThread.join();
+}
+
+
+/** A forked child inherits the pool state but not its thread; the
+    staged directories must not be acquired or removed by both
+    processes. */
+void WorkdirPool::relinquish()
+{
+  std::lock_guard<std::mutex> pool_lock(poolMutex);
+  readyDirs.clear(); resetDirs.clear(); removeDirs.clear();
+  activeManifests.clear();
+  numInProgress = numActive = 0;
+  poolPrefix = bfs::unique_path("dakota_pool_%%%%%%%%").string() + ".";
+  nameCntr = 0;
+}
+
+
+void WorkdirPool::suspend_all()
+{
+  std::lock_guard<std::mutex> instances_lock(instancesMutex);
+  for (WorkdirPool* pool : poolInstances)
+    pool->suspend();
+}
+
+
+void WorkdirPool::relinquish_all()
+{
+  std::lock_guard<std::mutex> instances_lock(instancesMutex);
+  for (WorkdirPool* pool : poolInstances)
+    pool->relinquish();
+}
+
+
+/** Beyond the directories in use, keep enough staged directories for
+    the remaining concurrent evaluations, and at least one for the next
+    evaluation.  When concurrency is unlimited, the peak number of
+    concurrent evaluations so far is used. */
+size_t WorkdirPool::target_ready() const
+{
+  size_t target = (evalConcurrency) ? evalConcurrency : peakActive;
+  return (target > numActive + 1) ? target - numActive : 1;
+}
+
+
+bfs::path WorkdirPool::next_pool_path()
+{ return parentDir / (poolPrefix + std::to_string(++nameCntr)); }
+
+
+void WorkdirPool::work_loop()
+{
+  std::unique_lock<std::mutex> pool_lock(poolMutex);
+  while (!stopFlag) {
+    // recycled directories are reset first, since they are the
+    // least expensive to make ready
+    if (!resetDirs.empty()) {
+      PooledDir dir = std::move(resetDirs.front());
+      resetDirs.pop_front();
+      ++numInProgress;
+      pool_lock.unlock();
+      bool reset_ok = reset(dir);
+      pool_lock.lock();
+      --numInProgress;
+      if (reset_ok) readyDirs.push_back(std::move(dir));
+      else          removeDirs.push_back(dir.path);
+    }
+    else if (!stageFailed &&
+	     readyDirs.size() + numInProgress < target_ready()) {
+      PooledDir dir;
+      dir.path = next_pool_path();
+      ++numInProgress;
+      pool_lock.unlock();
+      bool stage_ok = stage(dir);
+      pool_lock.lock();
+      --numInProgress;
+      if (stage_ok)
+	readyDirs.push_back(std::move(dir));
+      else {
+	// acquire() falls back to synchronous staging, which reports errors
+	removeDirs.push_back(dir.path);
+	stageFailed = true;
+      }
+    }
+    else if (!removeDirs.empty()) {
+      bfs::path path = removeDirs.front();
+      removeDirs.pop_front();
+      pool_lock.unlock();
+      boost::system::error_code ec;
+      bfs::remove_all(path, ec);
+      pool_lock.lock();
+    }
+    else
+      workCondition.wait(pool_lock);
+  }
+}
+
+
+/** Mirrors WorkdirHelper::copy_items() followed by link_items():
+    existing items are not overwritten. */
+bool WorkdirPool::stage(PooledDir& dir)
+{
+  boost::system::error_code ec;
+  bfs::create_directories(dir.path, ec);
+  if (ec)
+    return false;
+
+  std::vector<bfs::path> srcs;
+  expand_items(copyItems, srcs);
+  for (const bfs::path& src : srcs)
+    if (!copy_item(src, dir.path / src.filename(), src.filename(),
+		   dir.manifest))
+      return false;
+
+  srcs.clear();
+  expand_items(linkItems, srcs);
+  for (const bfs::path& src : srcs)
+    if (!link_item(src, dir.path / src.filename(), src.filename(),
+		   dir.manifest))
+      return false;
+
+  return true;
+}
+
+
+bool WorkdirPool::reset(PooledDir& dir)
+{
+  if (!recycleFlag)
+    return false;
+
+  // remove any items created by the evaluation
+  boost::system::error_code ec;
+  std::vector<bfs::path> created;
+  bfs::recursive_directory_iterator dir_it(dir.path, ec), dir_end;
+  for ( ; !ec && dir_it != dir_end; dir_it.increment(ec))
+    if (!dir.manifest.count(dir_it->path().lexically_relative(dir.path))) {
+      created.push_back(dir_it->path());
+      dir_it.no_push(); // removed recursively
+    }
+  if (ec)
+    return false;
+  for (const bfs::path& path : created) {
+    bfs::remove_all(path, ec);
+    if (ec) return false;
+  }
+
+  // restore the template items that were modified or removed; parent
+  // directories precede their contents in the manifest
+  FileSignature sig;
+  for (Manifest::iterator m_it=dir.manifest.begin();
+       m_it!=dir.manifest.end(); ++m_it) {
+    ManifestEntry& entry = m_it->second;
+    bfs::path path = dir.path / m_it->first;
+    bool exists = file_signature(path, sig);
+    if (exists && sig == entry.signature)
+      continue;
+    if (entry.signature.kind == POOL_DIR)
+      return false; // restage rather than restore a directory tree
+    if (exists) {
+      bfs::remove_all(path, ec);
+      if (ec) return false;
+    }
+    if (entry.signature.kind == POOL_LINK)
+      bfs::create_symlink(entry.source, path, ec);
+    else if (!clone_file(entry.source, path))
+      return false;
+    if (ec || !file_signature(path, entry.signature))
+      return false;
+  }
+  return true;
+}
+
+
+void WorkdirPool::
+expand_items(const StringArray& items, std::vector<bfs::path>& paths) const
+{
+  boost::system::error_code ec;
+  for (const String& item : items) {
+    if ( strcontains(item, "*") || strcontains(item, "?") ) {
+      bfs::path root_dir, wild_card;
+      WorkdirHelper::split_wildcard(item, root_dir, wild_card);
+      MatchesWC wc_predicate(wild_card);
+      bfs::directory_iterator dir_it(root_dir, ec), dir_end;
+      for ( ; !ec && dir_it != dir_end; dir_it.increment(ec))
+	if (wc_predicate(dir_it->path()))
+	  paths.push_back(dir_it->path());
+    }
+    else if (bfs::exists(item, ec)) // as for copy_items(), skip if missing
+      paths.push_back(item);
+  }
+}
+
+
+bool WorkdirPool::copy_item(const bfs::path& src, const bfs::path& dest,
+			    const bfs::path& rel_path, Manifest& manifest)
+{
+  boost::system::error_code ec;
+  if (bfs::exists(bfs::symlink_status(dest, ec)))
+    return true; // persist an item already staged
+
+  ManifestEntry& entry = manifest[rel_path];
+  entry.source = src;
+  bfs::file_status src_status = bfs::symlink_status(src, ec);
+  if (ec)
+    return false;
+  if (bfs::is_symlink(src_status))
+    bfs::copy_symlink(src, dest, ec);
+  else if (bfs::is_directory(src_status)) {
+    bfs::create_directory(dest, ec);
+    bfs::directory_iterator dir_it(src, ec), dir_end;
+    for ( ; !ec && dir_it != dir_end; dir_it.increment(ec)) {
+      const bfs::path& src_item = dir_it->path();
+      if (!copy_item(src_item, dest / src_item.filename(),
+		     rel_path / src_item.filename(), manifest))
+	return false;
+    }
+  }
+  else if (!clone_file(src, dest))
+    return false;
+
+  return (!ec && file_signature(dest, entry.signature));
+}
+
+
+bool WorkdirPool::link_item(const bfs::path& src, const bfs::path& dest,
+			    const bfs::path& rel_path, Manifest& manifest)
+{
+  boost::system::error_code ec;
+  if (bfs::exists(bfs::symlink_status(dest, ec)))
+    return true; // persist an item already staged
+
+  ManifestEntry& entry = manifest[rel_path];
+  entry.source = src;
+  bfs::create_symlink(src, dest, ec); // also valid for directories on POSIX
+  return (!ec && file_signature(dest, entry.signature));
+}
+
+
+/** A reflink shares the data blocks of src until either file is
+    modified, so the template is never modified through the staged
+    copy (unlike a hard link).  Once the filesystem rejects a clone,
+    only regular copies are attempted. */
+bool WorkdirPool::clone_file(const bfs::path& src, const bfs::path& dest)
+{
+#if defined(__linux__) && defined(FICLONE)
+  if (reflinkFlag) {
+    int src_fd = ::open(src.c_str(), O_RDONLY);
+    if (src_fd >= 0) {
+      struct stat src_stat;
+      int dest_fd = (::fstat(src_fd, &src_stat) == 0) ?
+	::open(dest.c_str(), O_WRONLY | O_CREAT | O_EXCL,
+	       src_stat.st_mode & 07777) : -1;
+      if (dest_fd >= 0) {
+	int clone_rc = ::ioctl(dest_fd, FICLONE, src_fd),
+	    clone_errno = errno;
+	::close(dest_fd);
+	if (clone_rc == 0)
+	  { ::close(src_fd); return true; }
+	::unlink(dest.c_str());
+	if (clone_errno == EOPNOTSUPP || clone_errno == EXDEV ||
+	    clone_errno == EINVAL     || clone_errno == ENOTTY)
+	  reflinkFlag = false;
+      }
+      ::close(src_fd);
+    }
+  }
+#endif
+
+  boost::system::error_code ec;
+  bfs::copy_file(src, dest, ec);
+  return !ec;
+}
+
+
+bool WorkdirPool::
+file_signature(const bfs::path& path, FileSignature& sig) const
+{
+#ifdef _WIN32
+  boost::system::error_code ec;
+  bfs::file_status status = bfs::symlink_status(path, ec);
+  if (ec || !bfs::exists(status))
+    return false;
+  sig.kind = (bfs::is_symlink(status)) ? POOL_LINK :
+    ( (bfs::is_directory(status)) ? POOL_DIR : POOL_FILE );
+  sig.size = (sig.kind == POOL_FILE) ? bfs::file_size(path, ec) : 0;
+  sig.device = sig.inode = 0;
+  sig.mtimeNs = sig.ctimeNs = 0;
+#else
+  struct stat st;
+  if (::lstat(path.c_str(), &st) != 0)
+    return false;
+  sig.kind = (S_ISLNK(st.st_mode)) ? POOL_LINK :
+    ( (S_ISDIR(st.st_mode)) ? POOL_DIR : POOL_FILE );
+  // directory sizes and times change with their contents, which are
+  // checked separately
+  bool dir = (sig.kind == POOL_DIR);
+  sig.size   = (dir) ? 0 : (uintmax_t)st.st_size;
+  sig.device = (uintmax_t)st.st_dev;
+  sig.inode  = (uintmax_t)st.st_ino;
+#ifdef __APPLE__
+  const struct timespec& mtim = st.st_mtimespec;
+  const struct timespec& ctim = st.st_ctimespec;
+#else
+  const struct timespec& mtim = st.st_mtim;
+  const struct timespec& ctim = st.st_ctim;
+#endif
+  sig.mtimeNs = (dir) ? 0 : 1000000000LL * mtim.tv_sec + mtim.tv_nsec;
+  sig.ctimeNs = (dir) ? 0 : 1000000000LL * ctim.tv_sec + ctim.tv_nsec;
+#endif
+  return true;
+}
+
+
+bool WorkdirPool::FileSignature::operator==(const FileSignature& sig) const
+{
+  return (kind    == sig.kind    && size    == sig.size    &&
+	  device  == sig.device  && inode   == sig.inode   &&
+	  mtimeNs == sig.mtimeNs && ctimeNs == sig.ctimeNs);
+}
+
+} // namespace Dakota
@@ -0,0 +1,240 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+//- Class:       WorkdirPool
+//- Description: Background staging, recycling, and removal of work directories
+//- Owner:
+//- Version: $Id$
+
+#ifndef WORKDIR_POOL_H
+#define WORKDIR_POOL_H
+
+#include "dakota_data_types.hpp"
+#include <boost/filesystem/path.hpp>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace bfs = boost::filesystem;
+
+
+namespace Dakota {
+
+/// Pool of work directories populated from the copy_files and
+/// link_files template ahead of the evaluations that use them
+
+/** Creating and populating a work directory for each evaluation, and
+    removing it afterwards, is synchronous with the evaluation schedule
+    and may take longer than the simulation for large templates.  A
+    background thread instead stages directories in the parent of the
+    work directories, such that acquire() only renames a staged
+    directory to the name of the evaluation's work directory.  Regular
+    files are cloned (reflinked) where the filesystem supports it and
+    copied otherwise.  Directories that are no longer needed are renamed
+    out of the way by release() and then either recycled, by restoring
+    only the template items that the evaluation modified or removed and
+    removing the items it created, or removed in the background.
+
+    Modified items are detected from the file type, size, inode, and
+    modification and status change times recorded when each item was
+    staged, so recycling assumes that the template is not modified during
+    the study; it is not available on Windows.  The template items are
+    expanded when a directory is staged, rather than when it is
+    acquired.  Since the background thread reports no errors, a failure
+    to stage a directory stops background staging and acquire() returns
+    false, leaving the caller to create and populate the directory (and
+    report any errors) as usual. */
+
+class WorkdirPool
+{
+public:
+
+  //
+  //- Heading: Constructors and destructor
+  //
+
+  /// constructor taking the parent directory of the work directories
+  /// and the copy_files and link_files template items (relative paths
+  /// are relative to the startup directory)
+  WorkdirPool(const bfs::path& parent_dir, const StringArray& copy_files,
+	      const StringArray& link_files, bool recycle);
+  /// destructor; stops the background thread and removes the pooled
+  /// directories
+  ~WorkdirPool();
+
+  //
+  //- Heading: Member functions
+  //
+
+  /// move a staged directory to dest_dir, which must not exist, given
+  /// the number of evaluations that may run concurrently (0 if
+  /// unlimited); returns false if no staged directory was available
+  bool acquire(const bfs::path& dest_dir, size_t concurrency);
+  /// return a work directory that is no longer needed by an evaluation
+  /// (whether or not it was acquired from the pool): when remove_dir,
+  /// recycle it into the pool or remove it in the background
+  void release(const bfs::path& dir, bool remove_dir);
+
+  /// stop the background thread and remove all pooled directories
+  void clear();
+
+  /// stop the background threads of all pools, e.g., prior to fork();
+  /// each is restarted by its next acquire()
+  static void suspend_all();
+  /// in a forked child, relinquish the directories of all pools to the
+  /// parent (see relinquish())
+  static void relinquish_all();
+
+  /// number of acquire() requests satisfied by a staged directory
+  size_t num_hits() const;
+  /// number of acquire() requests not satisfied by a staged directory
+  size_t num_misses() const;
+
+private:
+
+  //
+  //- Heading: Convenience functions
+  //
+
+  /// kind of a template item within a staged directory
+  enum { POOL_FILE, POOL_DIR, POOL_LINK };
+
+  /// identifies the state of a staged item; see file_signature()
+  struct FileSignature {
+    unsigned short kind; ///< POOL_FILE, POOL_DIR, or POOL_LINK
+    uintmax_t size;      ///< size in bytes (regular files)
+    uintmax_t device;    ///< device of the inode
+    uintmax_t inode;     ///< inode number
+    long long mtimeNs;   ///< modification time in nanoseconds
+    long long ctimeNs;   ///< status change time in nanoseconds
+    bool operator==(const FileSignature& sig) const;
+  };
+
+  /// staged state and template source of an item in a pooled directory
+  struct ManifestEntry {
+    FileSignature signature; ///< state recorded when staged or restored
+    bfs::path source;        ///< absolute path of the template item
+  };
+
+  /// items of a pooled directory, keyed by path relative to it
+  typedef std::map<bfs::path, ManifestEntry> Manifest;
+
+  /// a pooled directory and its manifest
+  struct PooledDir {
+    bfs::path path;    ///< absolute path of the directory
+    Manifest manifest; ///< staged template items
+  };
+
+  /// stop the background thread, leaving the pooled directories
+  void suspend();
+  /// forget the pooled and acquired directories, which remain the
+  /// responsibility of the parent process, and name subsequent
+  /// directories uniquely to this process
+  void relinquish();
+
+  /// background staging, recycling, and removal loop
+  void work_loop();
+  /// number of staged directories to maintain; poolMutex must be held
+  size_t target_ready() const;
+  /// generate the next unique pooled directory name; poolMutex must be held
+  bfs::path next_pool_path();
+
+  /// create and populate the directory dir.path from the template
+  bool stage(PooledDir& dir);
+  /// restore a used directory to its staged state; returns false if the
+  /// directory must instead be removed
+  bool reset(PooledDir& dir);
+
+  /// expand the template items, including wildcards, to absolute paths
+  void expand_items(const StringArray& items,
+		    std::vector<bfs::path>& paths) const;
+  /// recursively copy src to dest, recording the items in manifest
+  bool copy_item(const bfs::path& src, const bfs::path& dest,
+		 const bfs::path& rel_path, Manifest& manifest);
+  /// create a symlink dest to src, recording it in manifest
+  bool link_item(const bfs::path& src, const bfs::path& dest,
+		 const bfs::path& rel_path, Manifest& manifest);
+  /// clone (reflink) or copy the regular file src to dest
+  bool clone_file(const bfs::path& src, const bfs::path& dest);
+  /// retrieve the signature of path without following symlinks;
+  /// returns false if it does not exist
+  bool file_signature(const bfs::path& path, FileSignature& sig) const;
+
+  //
+  //- Heading: Data
+  //
+
+  /// absolute parent directory of the pooled and work directories
+  bfs::path parentDir;
+  /// unique prefix for the names of pooled directories
+  String poolPrefix;
+  /// copy_files template items, made absolute
+  StringArray copyItems;
+  /// link_files template items, made absolute
+  StringArray linkItems;
+  /// whether released directories may be recycled
+  bool recycleFlag;
+  /// whether to attempt cloning files (cleared when unsupported)
+  bool reflinkFlag;
+
+  /// staged directories, ready to be acquired
+  std::deque<PooledDir> readyDirs;
+  /// released directories awaiting reset
+  std::deque<PooledDir> resetDirs;
+  /// released directories awaiting removal
+  std::deque<bfs::path> removeDirs;
+  /// manifests of the acquired directories, keyed by absolute path
+  std::map<bfs::path, Manifest> activeManifests;
+
+  /// number of directories being staged or reset by the background thread
+  size_t numInProgress;
+  /// number of work directories in use by evaluations
+  size_t numActive;
+  /// maximum of numActive over the study
+  size_t peakActive;
+  /// most recent concurrency passed to acquire() (0 if unlimited)
+  size_t evalConcurrency;
+  /// counter for unique pooled directory names
+  size_t nameCntr;
+  /// number of acquire() requests satisfied by a staged directory
+  size_t numHits;
+  /// number of acquire() requests not satisfied by a staged directory
+  size_t numMisses;
+
+  /// whether the background thread is stopping (or was never started)
+  bool stopFlag;
+  /// whether background staging failed and has been stopped
+  bool stageFailed;
+  /// protects all pool state
+  std::mutex poolMutex;
+  /// signals the background thread when there is work or on stop
+  std::condition_variable workCondition;
+  /// background thread, started on the first acquire()
+  std::thread workerThread;
+
+  /// all pools in this process, for suspend_all() and relinquish_all()
+  static std::set<WorkdirPool*> poolInstances;
+  /// protects poolInstances
+  static std::mutex instancesMutex;
+};
+
+
+inline size_t WorkdirPool::num_hits() const
+{ return numHits; }
+
+
+inline size_t WorkdirPool::num_misses() const
+{ return numMisses; }
+
+} // namespace Dakota
+
+#endif
@@ -1348,7 +1348,6 @@ template<typename ContainerT>
 void container_read(MPIUnpackBuffer& s, ContainerT& c,
 		    std::forward_iterator_tag) // generic version
 {
-#ifdef DAKOTA_HAVE_MPI
   c.clear();
   typename ContainerT::size_type i, len;
   s >> len;
@@ -1357,7 +1356,6 @@ void container_read(MPIUnpackBuffer& s, ContainerT& c,
     s >> data;
     c.push_back(data);
   }
-#endif
 }
 
 template<typename ContainerT>
@@ -1368,14 +1366,12 @@ void container_read(MPIUnpackBuffer& s, ContainerT& c,
   // While the generic version above could be augmented with reserve(len) for
   // vector, deque does not support this.  Therefore, we use resize() with
   // operator[] instead of reserve() + push_back():
-#ifdef DAKOTA_HAVE_MPI
   c.clear(); // ensures fresh allocations in resize() (see note above)
   typename ContainerT::size_type i, len;
   s >> len;
   c.resize(len); // deque<T> supports resize() but not reserve()
   for (i=0; i<len; ++i)
     s >> c[i];
-#endif
 }
 
 template<typename ContainerT>
@@ -1386,12 +1382,10 @@ MPIUnpackBuffer& operator>>(MPIUnpackBuffer& s, ContainerT& c) // two versions
 template<typename ContainerT>
 MPIPackBuffer& operator<<(MPIPackBuffer& s, const ContainerT& c) // one version
 {
-#ifdef DAKOTA_HAVE_MPI
   typename ContainerT::size_type len = c.size();
   s << len;
   for (const typename ContainerT::value_type& entry : c)
     s << entry;
-#endif
   return s;
 }
 
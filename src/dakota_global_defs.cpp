@@ -23,6 +23,7 @@
 #include "ProblemDescDB.hpp"
 #include "ResultsManager.hpp"
 #include "EvaluationStore.hpp"
+#include "PerformanceRegistry.hpp"
 
 #ifdef DAKOTA_DISABLE_FPE_TRAPS
 #include <fenv.h>
@@ -66,6 +67,8 @@ PRPCache data_pairs;          ///< contains all parameter/response pairs.
 ResultsManager iterator_results_db;
 /// Global database for evaluation storage
 EvaluationStore evaluation_store_db;
+/// Global registry for hierarchical performance timers and counters
+PerformanceRegistry performance_registry;
 
 
 int write_precision = 10;     ///< used in ostream data output functions
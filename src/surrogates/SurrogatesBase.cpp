@@ -9,9 +9,12 @@
 
 #include "SurrogatesBase.hpp"
 
+#include "surrogates_tools.hpp"
 #include "util_math_tools.hpp"
 #include "util_metrics.hpp"
 
+#include <sstream>
+
 namespace dakota {
 namespace surrogates {
 
@@ -73,86 +76,101 @@ std::shared_ptr<Surrogate> Surrogate::load(const std::string& infile,
 
 VectorXd Surrogate::evaluate_metrics(const StringArray& mnames,
                                      const MatrixXd& points,
-                                     const MatrixXd& ref_values) {
-  const int num_metrics = mnames.size();
-  /* Assuming numQOI = 1 */
-  VectorXd surr_values(ref_values.size());
-  VectorXd metrics(num_metrics);
-
-  for (int m = 0; m < num_metrics; m++) {
-    surr_values = this->value(points);
-    metrics(m) =
-        util::compute_metric(surr_values, ref_values.col(0), mnames[m]);
-  }
-  return metrics;
+                                     const MatrixXd& ref_values,
+                                     const int qoi) {
+  const VectorXd surr_values = this->value(points, qoi);
+  return util::compute_metrics(surr_values, ref_values.col(0), mnames);
 }
 
 VectorXd Surrogate::cross_validate(const MatrixXd& samples,
                                    const MatrixXd& response,
                                    const StringArray& mnames,
-                                   const int num_folds, const int seed) {
-  const int num_metrics = mnames.size();
-  VectorXd cv_results = VectorXd::Zero(num_metrics);
-  VectorXd metrics_values(num_metrics);
+                                   const int num_folds, const int seed,
+                                   const int num_threads) {
+  const std::vector<ParameterList> candidate_options(1, configOptions);
+  return cross_validate(samples, response, mnames, candidate_options,
+                        num_folds, seed, num_threads)
+      .row(0)
+      .transpose();
+}
 
+MatrixXd Surrogate::cross_validate(
+    const MatrixXd& samples, const MatrixXd& response,
+    const StringArray& mnames,
+    const std::vector<ParameterList>& candidate_options, const int num_folds,
+    const int seed, const int num_threads) {
+  const int num_metrics = mnames.size();
+  const int num_candidates = candidate_options.size();
   const int num_samples = samples.rows();
   const int num_features = samples.cols();
-  std::vector<VectorXi> cv_folds;
-  VectorXi fold_indices;
-  MatrixXd train_samples, train_response;
-  MatrixXd val_samples, val_response;
-
-  int num_train_samples, num_val_samples;
-  int samples_index, train_index;
+  const int num_responses = response.cols();
 
+  /* the fold assignment depends only on the seed */
+  std::vector<VectorXi> cv_folds;
   util::create_cv_folds(num_folds, num_samples, cv_folds, seed);
 
-  // clone the surrogate's configuration so CV doesn't invalidate *this
-  std::shared_ptr<Surrogate> cv_surrogate = this->clone();
-  // ParameterList cv_surrogate_options;
-  // cv_surrogate->get_options(cv_surrogate_options);
-  // int verbosity_level = cv_surrogate_options.get<int>("verbosity");
   int verbosity_level = configOptions.get<int>("verbosity");
 
-  for (int i = 0; i < num_folds; i++) {
+  /* clone the surrogate's configuration for each (candidate, fold) so CV
+   * doesn't invalidate *this and the folds are independent; clone here since
+   * copying the options is not thread safe */
+  const int num_tasks = num_candidates * num_folds;
+  std::vector<std::shared_ptr<Surrogate>> cv_surrogates(num_tasks);
+  for (int t = 0; t < num_tasks; t++) {
+    cv_surrogates[t] = this->clone();
+    cv_surrogates[t]->set_options(candidate_options[t / num_folds]);
+  }
+
+  MatrixXd fold_metrics(num_tasks, num_metrics);
+  auto run_fold = [&](const int t) {
+    const int c = t / num_folds, i = t % num_folds;
     if (verbosity_level > 0) {
-      std::cout << "\nCross-validation fold " << i + 1 << "/" << num_folds
-                << "\n\n";
+      std::ostringstream fold_msg;
+      fold_msg << "\nCross-validation fold " << i + 1 << "/" << num_folds;
+      if (num_candidates > 1)
+        fold_msg << " of candidate " << c + 1 << "/" << num_candidates;
+      std::cout << fold_msg.str() << "\n\n";
     }
-    /* validation samples */
-    fold_indices = cv_folds[i];
-    num_val_samples = fold_indices.size();
-    val_samples.resize(num_val_samples, num_features);
-    val_response.resize(num_val_samples, 1);
+
+    /* gather the validation and training samples by index */
+    const VectorXi& val_indices = cv_folds[i];
+    const int num_val_samples = val_indices.size();
+    MatrixXd val_samples(num_val_samples, num_features),
+        val_response(num_val_samples, num_responses);
     for (int j = 0; j < num_val_samples; j++) {
-      samples_index = fold_indices(j);
-      val_samples.row(j) = samples.row(samples_index);
-      val_response(j, 0) = response(samples_index, 0);
+      val_samples.row(j) = samples.row(val_indices(j));
+      val_response.row(j) = response.row(val_indices(j));
     }
-
-    /* training samples */
-    num_train_samples = num_samples - num_val_samples;
-    train_samples.resize(num_train_samples, num_features);
-    train_response.resize(num_train_samples, 1);
-    train_index = 0;
+    const int num_train_samples = num_samples - num_val_samples;
+    MatrixXd train_samples(num_train_samples, num_features),
+        train_response(num_train_samples, num_responses);
+    int train_index = 0;
     for (int k = 0; k < num_folds; k++) {
-      if (k != i) {
-        fold_indices = cv_folds[k];
-        for (int j = 0; j < fold_indices.size(); j++) {
-          samples_index = fold_indices(j);
-          train_samples.row(train_index) = samples.row(samples_index);
-          train_response(train_index, 0) = response(samples_index, 0);
-          train_index++;
-        }
+      if (k == i) continue;
+      for (int j = 0; j < cv_folds[k].size(); j++, train_index++) {
+        train_samples.row(train_index) = samples.row(cv_folds[k](j));
+        train_response.row(train_index) = response.row(cv_folds[k](j));
       }
     }
 
-    cv_surrogate->build(train_samples, train_response);
-    metrics_values =
-        cv_surrogate->evaluate_metrics(mnames, val_samples, val_response);
-    cv_results += metrics_values;
+    cv_surrogates[t]->build(train_samples, train_response);
+    fold_metrics.row(t) =
+        cv_surrogates[t]
+            ->evaluate_metrics(mnames, val_samples, val_response)
+            .transpose();
+    cv_surrogates[t].reset();
+  };
+
+  /* the folds of each candidate are claimed in order by the threads; errors
+   * are rethrown once all threads are done */
+  parallel_for(num_tasks, num_threads, run_fold);
+
+  /* average over the folds in fold order, independent of the threads */
+  MatrixXd cv_results = MatrixXd::Zero(num_candidates, num_metrics);
+  for (int c = 0; c < num_candidates; c++) {
+    for (int i = 0; i < num_folds; i++)
+      cv_results.row(c) += fold_metrics.row(c * num_folds + i);
   }
-
   cv_results /= double(num_folds);
   return cv_results;
 }
@@ -205,14 +205,27 @@ class Surrogate {
   // also demo load via ctor
   //  Surrogate(infile, binary)
 
-  /// Evalute metrics at specified points (within surrogates)
+  /// Evalute metrics at specified points (within surrogates) for the
+  /// QoI with index qoi, whose reference values are ref_values.col(0)
   VectorXd evaluate_metrics(const StringArray& mnames, const MatrixXd& points,
-                            const MatrixXd& ref_values);
+                            const MatrixXd& ref_values, const int qoi = 0);
 
-  /// Perform K-folds cross-validation (within surrogates)
+  /// Perform K-folds cross-validation (within surrogates); each fold
+  /// is built on its own clone of the surrogate, concurrently on
+  /// num_threads threads
   VectorXd cross_validate(const MatrixXd& samples, const MatrixXd& response,
                           const StringArray& mnames, const int num_folds = 5,
-                          const int seed = 20);
+                          const int seed = 20, const int num_threads = 1);
+
+  /// Perform K-folds cross-validation (within surrogates) for each
+  /// candidate configuration, building the folds of all candidates
+  /// concurrently on num_threads threads; returns the metrics of each
+  /// candidate - (num_candidates by num_metrics)
+  MatrixXd cross_validate(const MatrixXd& samples, const MatrixXd& response,
+                          const StringArray& mnames,
+                          const std::vector<ParameterList>& candidate_options,
+                          const int num_folds = 5, const int seed = 20,
+                          const int num_threads = 1);
 
  protected:
   /// Number of samples in the Surrogate's build samples.
@@ -25,6 +25,19 @@ void SquaredExponentialKernel::compute_gram(const std::vector<MatrixXd>& dists2,
   gram = exp(2.0 * theta_values(0)) * (-0.5 * Dbar2.array()).exp();
 }
 
+void SquaredExponentialKernel::compute_scaled_gram(
+    const MatrixXd& scaled_dists2, const VectorXd& theta_values,
+    MatrixXd& gram) const {
+  gram = exp(2.0 * theta_values(0)) * (-0.5 * scaled_dists2.array()).exp();
+}
+
+void SquaredExponentialKernel::compute_scaled_gram_deriv(
+    const MatrixXd& scaled_dists2, const VectorXd& theta_values,
+    MatrixXd& gram_deriv) const {
+  gram_deriv =
+      -0.5 * exp(2.0 * theta_values(0)) * (-0.5 * scaled_dists2.array()).exp();
+}
+
 void SquaredExponentialKernel::compute_gram_derivs(
     const MatrixXd& gram, const std::vector<MatrixXd>& dists2,
     const VectorXd& theta_values, std::vector<MatrixXd>& gram_derivs) {
@@ -69,6 +82,22 @@ void Matern32Kernel::compute_gram(const std::vector<MatrixXd>& dists2,
          (1.0 + Dbar.array()).cwiseProduct((-Dbar).array().exp());
 }
 
+void Matern32Kernel::compute_scaled_gram(const MatrixXd& scaled_dists2,
+                                         const VectorXd& theta_values,
+                                         MatrixXd& gram) const {
+  const MatrixXd scaled_dists = sqrt3 * scaled_dists2.cwiseSqrt();
+  gram = exp(2.0 * theta_values(0)) *
+         (1.0 + scaled_dists.array())
+             .cwiseProduct((-scaled_dists).array().exp());
+}
+
+void Matern32Kernel::compute_scaled_gram_deriv(const MatrixXd& scaled_dists2,
+                                               const VectorXd& theta_values,
+                                               MatrixXd& gram_deriv) const {
+  gram_deriv = -1.5 * exp(2.0 * theta_values(0)) *
+               (-sqrt3 * scaled_dists2.cwiseSqrt()).array().exp();
+}
+
 void Matern32Kernel::compute_gram_derivs(const MatrixXd& gram,
                                          const std::vector<MatrixXd>& dists2,
                                          const VectorXd& theta_values,
@@ -122,6 +151,24 @@ void Matern52Kernel::compute_gram(const std::vector<MatrixXd>& dists2,
              .cwiseProduct((-Dbar).array().exp());
 }
 
+void Matern52Kernel::compute_scaled_gram(const MatrixXd& scaled_dists2,
+                                         const VectorXd& theta_values,
+                                         MatrixXd& gram) const {
+  const MatrixXd scaled_dists = sqrt5 * scaled_dists2.cwiseSqrt();
+  gram = exp(2.0 * theta_values(0)) *
+         (1.0 + scaled_dists.array() + scaled_dists.array().square() / 3.0)
+             .cwiseProduct((-scaled_dists).array().exp());
+}
+
+void Matern52Kernel::compute_scaled_gram_deriv(const MatrixXd& scaled_dists2,
+                                               const VectorXd& theta_values,
+                                               MatrixXd& gram_deriv) const {
+  const MatrixXd scaled_dists = sqrt5 * scaled_dists2.cwiseSqrt();
+  gram_deriv = -5.0 / 6.0 * exp(2.0 * theta_values(0)) *
+               (1.0 + scaled_dists.array())
+                   .cwiseProduct((-scaled_dists).array().exp());
+}
+
 void Matern52Kernel::compute_gram_derivs(const MatrixXd& gram,
                                          const std::vector<MatrixXd>& dists2,
                                          const VectorXd& theta_values,
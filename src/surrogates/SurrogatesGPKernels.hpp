@@ -35,6 +35,32 @@ class Kernel {
   virtual void compute_gram(const std::vector<MatrixXd>& dists2,
                             const VectorXd& theta_values, MatrixXd& gram) = 0;
 
+  /**
+   *  \brief Compute a Gram matrix given squared distances that are already
+   *  scaled by the length-scale hyperparameters. Unlike compute_gram(), this
+   *  does not modify the kernel, so it may be called concurrently.
+   *  \param[in] scaled_dists2 Matrix of hyperparameter-scaled squared
+   *  distances.
+   *  \param[in] theta_values Vector of hyperparameters.
+   *  \param[out] gram Gram matrix.
+   */
+  virtual void compute_scaled_gram(const MatrixXd& scaled_dists2,
+                                   const VectorXd& theta_values,
+                                   MatrixXd& gram) const = 0;
+
+  /**
+   *  \brief Compute the derivative of the kernel with respect to the
+   *  hyperparameter-scaled squared distance. Like compute_scaled_gram(), this
+   *  may be called concurrently.
+   *  \param[in] scaled_dists2 Matrix of hyperparameter-scaled squared
+   *  distances.
+   *  \param[in] theta_values Vector of hyperparameters.
+   *  \param[out] gram_deriv Matrix of kernel derivatives.
+   */
+  virtual void compute_scaled_gram_deriv(const MatrixXd& scaled_dists2,
+                                         const VectorXd& theta_values,
+                                         MatrixXd& gram_deriv) const = 0;
+
   /**
    *  \brief Compute the derivatives of the Gram matrix with respect to the
    *  kernel hyperparameters.
@@ -107,6 +133,14 @@ class SquaredExponentialKernel : public Kernel {
   void compute_gram(const std::vector<MatrixXd>& dists2,
                     const VectorXd& theta_values, MatrixXd& gram) override;
 
+  void compute_scaled_gram(const MatrixXd& scaled_dists2,
+                           const VectorXd& theta_values,
+                           MatrixXd& gram) const override;
+
+  void compute_scaled_gram_deriv(const MatrixXd& scaled_dists2,
+                                 const VectorXd& theta_values,
+                                 MatrixXd& gram_deriv) const override;
+
   void compute_gram_derivs(const MatrixXd& gram,
                            const std::vector<MatrixXd>& dists2,
                            const VectorXd& theta_values,
@@ -132,6 +166,14 @@ class Matern32Kernel : public Kernel {
   void compute_gram(const std::vector<MatrixXd>& dists2,
                     const VectorXd& theta_values, MatrixXd& gram) override;
 
+  void compute_scaled_gram(const MatrixXd& scaled_dists2,
+                           const VectorXd& theta_values,
+                           MatrixXd& gram) const override;
+
+  void compute_scaled_gram_deriv(const MatrixXd& scaled_dists2,
+                                 const VectorXd& theta_values,
+                                 MatrixXd& gram_deriv) const override;
+
   void compute_gram_derivs(const MatrixXd& gram,
                            const std::vector<MatrixXd>& dists2,
                            const VectorXd& theta_values,
@@ -160,6 +202,14 @@ class Matern52Kernel : public Kernel {
   void compute_gram(const std::vector<MatrixXd>& dists2,
                     const VectorXd& theta_values, MatrixXd& gram) override;
 
+  void compute_scaled_gram(const MatrixXd& scaled_dists2,
+                           const VectorXd& theta_values,
+                           MatrixXd& gram) const override;
+
+  void compute_scaled_gram_deriv(const MatrixXd& scaled_dists2,
+                                 const VectorXd& theta_values,
+                                 MatrixXd& gram_deriv) const override;
+
   void compute_gram_derivs(const MatrixXd& gram,
                            const std::vector<MatrixXd>& dists2,
                            const VectorXd& theta_values,
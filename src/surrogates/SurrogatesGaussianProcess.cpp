@@ -14,8 +14,11 @@
 #include "ROL_LineSearchStep.hpp"
 #include "SurrogatesGPObjective.hpp"
 #include "Teuchos_oblackholestream.hpp"
+#include "surrogates_tools.hpp"
 #include "util_math_tools.hpp"
 
+#include <algorithm>
+
 namespace dakota {
 namespace surrogates {
 
@@ -61,6 +64,8 @@ GaussianProcess::~GaussianProcess() {}
 void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   configOptions.validateParametersAndSetDefaults(defaultConfigOptions);
   verbosity = configOptions.get<int>("verbosity");
+  predictionBlockSize = configOptions.get<int>("prediction block size");
+  numPredictionThreads = configOptions.get<int>("prediction threads");
 
   if (verbosity > 0) {
     if (verbosity == 1) {
@@ -73,27 +78,101 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
           "Invalid verbosity int for GaussianProcess surrogate"));
   }
 
+  numQOI = response.cols();
+  numSamples = samples.rows();
+  numVariables = samples.cols();
+  kernel_type = configOptions.get<std::string>("kernel type");
+  kernel = kernel_factory(kernel_type);
+
+  /* Scale the data */
+  dataScaler =
+      *(util::scaler_factory(util::DataScaler::scaler_type(
+                                 configOptions.get<std::string>("scaler name")),
+                             samples));
+  dataScaler.scale_samples(samples, scaledBuildPoints);
+
+  qoiModels.clear();
+  sharedBuildDists2.reset();
+  if (numQOI > 1 && !configOptions.sublist("Multiple Outputs")
+                         .get<bool>("tie hyperparameters"))
+    build_qoi_models(response);
+  else
+    build_model(response);
+}
+
+void GaussianProcess::build_qoi_models(const MatrixXd& response) {
+  /* compute the build squared distances once for all QoIs (a sparse GP
+   * does not use them) */
+  const int num_inducing = configOptions.sublist("Inducing Points")
+                               .get<int>("num inducing points");
+  std::shared_ptr<std::vector<MatrixXd>> shared_dists2;
+  if (num_inducing <= 0 || num_inducing >= numSamples) {
+    compute_build_dists();
+    shared_dists2 = std::make_shared<std::vector<MatrixXd>>();
+    shared_dists2->swap(cwiseDists2);
+  }
+
+  /* this GP only dispatches to the QoI models */
+  estimateTrend = false;
+  estimateNugget = false;
+  fixedNuggetValue = estimatedNuggetValue = 0.0;
+  numInducingPoints = 0;
+  hasBestCholFact = true;
+  targetValues = response;
+  responseOffsets = VectorXd::Zero(numQOI);
+  responseScaleFactors = VectorXd::Ones(numQOI);
+
+  qoiModels.resize(numQOI);
+  for (int q = 0; q < numQOI; q++) {
+    auto qoi_model = std::make_shared<GaussianProcess>(configOptions);
+    qoi_model->numQOI = 1;
+    qoi_model->numSamples = numSamples;
+    qoi_model->numVariables = numVariables;
+    qoi_model->verbosity = verbosity;
+    qoi_model->predictionBlockSize = predictionBlockSize;
+    qoi_model->numPredictionThreads = numPredictionThreads;
+    qoi_model->kernel_type = kernel_type;
+    qoi_model->kernel = kernel_factory(kernel_type);
+    qoi_model->dataScaler = dataScaler;
+    qoi_model->scaledBuildPoints = scaledBuildPoints;
+    qoi_model->sharedBuildDists2 = shared_dists2;
+    qoiModels[q] = qoi_model;
+  }
+
+  /* estimate the hyperparameters of each QoI, concurrently if requested;
+   * errors are rethrown once all threads are done */
+  const int num_threads =
+      configOptions.sublist("Multiple Outputs").get<int>("num threads");
+  parallel_for(numQOI, num_threads,
+               [&](int q) { qoiModels[q]->build_model(response.col(q)); });
+}
+
+void GaussianProcess::build_model(const MatrixXd& response) {
   /* Standardize the response */
   bool standardize_response = configOptions.get<bool>("standardize response");
   if (standardize_response) {
     auto responseScaler = util::scaler_factory(
         util::DataScaler::scaler_type("standardization"), response);
     targetValues = responseScaler->scale_samples(response);
-    responseOffset = responseScaler->get_scaler_features_offsets()(0);
-    responseScaleFactor =
-        responseScaler->get_scaler_features_scale_factors()(0);
-  } else
+    responseOffsets = responseScaler->get_scaler_features_offsets();
+    responseScaleFactors =
+        responseScaler->get_scaler_features_scale_factors();
+  } else {
     targetValues = response;
-
-  numQOI = response.cols();
-  numSamples = samples.rows();
-  numVariables = samples.cols();
-  eyeMatrix = MatrixXd::Identity(numSamples, numSamples);
+    responseOffsets = VectorXd::Zero(numQOI);
+    responseScaleFactors = VectorXd::Ones(numQOI);
+  }
+  responseOffset = responseOffsets(0);
+  responseScaleFactor = responseScaleFactors(0);
   hasBestCholFact = false;
-  kernel_type = configOptions.get<std::string>("kernel type");
 
-  /* Kernel function */
-  kernel = kernel_factory(kernel_type);
+  /* Sparse GP, unless there are too few samples to benefit */
+  numInducingPoints = configOptions.sublist("Inducing Points")
+                          .get<int>("num inducing points");
+  if (numInducingPoints < 0 || numInducingPoints >= numSamples)
+    numInducingPoints = 0;
+  if (numInducingPoints == 0)
+    eyeMatrix = MatrixXd::Identity(numSamples, numSamples);
 
   /* Optimization-related data*/
   VectorXd sigma_bounds(2), nugget_bounds(2);
@@ -101,43 +180,50 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   setup_hyperparameter_bounds(sigma_bounds, length_scale_bounds, nugget_bounds);
   const int num_restarts = configOptions.get<int>("num restarts");
 
-  /* Scale the data and compute build squared distances */
-  dataScaler =
-      *(util::scaler_factory(util::DataScaler::scaler_type(
-                                 configOptions.get<std::string>("scaler name")),
-                             samples));
-  dataScaler.scale_samples(samples, scaledBuildPoints);
-  compute_build_dists();
+  /* Compute build squared distances, unless shared with other QoIs */
+  if (numInducingPoints > 0)
+    select_inducing_points();
+  else if (!sharedBuildDists2)
+    compute_build_dists();
 
   MatrixXd beta_bounds;
+  int num_betas = 0;
   estimateTrend = configOptions.sublist("Trend").get<bool>("estimate trend");
   if (estimateTrend) {
     polyRegression = std::make_shared<PolynomialRegression>(
         scaledBuildPoints, targetValues,
         configOptions.sublist("Trend").sublist("Options"));
     numPolyTerms = polyRegression->get_num_terms();
+    num_betas = numPolyTerms * numQOI;
     polyRegression->compute_basis_matrix(scaledBuildPoints, basisMatrix);
-    beta_bounds = MatrixXd::Ones(numPolyTerms, 2);
+    beta_bounds = MatrixXd::Ones(num_betas, 2);
     beta_bounds.col(0) *= -betaBound;
     beta_bounds.col(1) *= betaBound;
   }
 
-  /* size of thetaValues for squared exponential kernel and one QoI */
+  /* size of thetaValues for squared exponential kernel; the QoIs share the
+   * hyperparameters but each has its own trend */
   thetaValues.resize(numVariables + 1);
   bestThetaValues.resize(numVariables + 1);
-  betaValues.resize(numPolyTerms);
-  bestBetaValues.resize(numPolyTerms);
+  betaValues.resize(num_betas);
+  bestBetaValues.resize(num_betas);
   /* set the size of the GramMatrix and its derivatives */
-  GramMatrix.resize(numSamples, numSamples);
-  GramMatrixDerivs.resize(numVariables + 1);
-  for (int k = 0; k < numVariables + 1; k++) {
-    GramMatrixDerivs[k].resize(numSamples, numSamples);
+  if (numInducingPoints == 0) {
+    GramMatrix.resize(numSamples, numSamples);
+    GramMatrixDerivs.resize(numVariables + 1);
+    for (int k = 0; k < numVariables + 1; k++) {
+      GramMatrixDerivs[k].resize(numSamples, numSamples);
+    }
   }
 
   /* DTS: if the nugget is being estimated, should the fixed value be set to
    * zero? */
   fixedNuggetValue =
       configOptions.sublist("Nugget").get<double>("fixed nugget");
+  if (numInducingPoints > 0 && fixedNuggetValue <= 0.0 && !estimateNugget)
+    throw(std::runtime_error(
+        "Sparse Gaussian Process requires a positive fixed nugget or nugget "
+        "estimation"));
 
   /* set up the initial guesses */
   // srand(configOptions.get<int>("gp seed"));
@@ -167,7 +253,7 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   setup_default_optimization_params(gp_mle_rol_params);
 
   auto gp_objective = std::make_shared<GP_Objective>(*this);
-  int dim = numVariables + 1 + numPolyTerms + numNuggetTerms;
+  int dim = numVariables + 1 + num_betas + numNuggetTerms;
 
   // Define algorithm
   ROL::Ptr<ROL::Step<double>> step =
@@ -199,7 +285,7 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
     }
   }
   if (estimateTrend) {
-    for (int i = 0; i < numPolyTerms; i++) {
+    for (int i = 0; i < num_betas; i++) {
       (*lo_ptr)[numVariables + 1 + i] = beta_bounds(i, 0);
       (*hi_ptr)[numVariables + 1 + i] = beta_bounds(i, 1);
     }
@@ -224,6 +310,8 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   double final_obj_value;
   VectorXd final_obj_gradient(dim);
 
+  /* the best restart of this build, not of a previous one, is kept */
+  bestObjFunValue = std::numeric_limits<double>::max();
   for (int i = 0; i < num_restarts; i++) {
     for (int j = 0; j < dim; ++j) {
       (*x_ptr)[j] = initial_guesses(i, j);
@@ -233,12 +321,12 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
       (thetaValues)(j) = (*x_ptr)[j];
     }
     if (estimateTrend) {
-      for (int j = 0; j < numPolyTerms; ++j) {
+      for (int j = 0; j < num_betas; ++j) {
         betaValues(j) = (*x_ptr)[numVariables + 1 + j];
       }
     }
     if (estimateNugget) {
-      estimatedNuggetValue = (*x_ptr)[numVariables + 1 + numPolyTerms];
+      estimatedNuggetValue = (*x_ptr)[numVariables + 1 + num_betas];
     }
     /* get the final objective function value and gradient */
     negative_marginal_log_likelihood(true, true, final_obj_value,
@@ -253,7 +341,7 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
     objectiveGradientHistory.row(i) = final_obj_gradient;
     thetaHistory.row(i).head(numVariables + 1) = thetaValues;
     if (estimateTrend)
-      thetaHistory.row(i).segment(numVariables + 1, numPolyTerms) = betaValues;
+      thetaHistory.row(i).segment(numVariables + 1, num_betas) = betaValues;
     if (estimateNugget) thetaHistory.row(i).tail(1)(0) = estimatedNuggetValue;
     algo.reset();
   }
@@ -262,14 +350,12 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
   if (estimateTrend) {
     betaValues = bestBetaValues;
     /* set the betas in the polynomialRegression class */
-    polyRegression->set_polynomial_coeffs(bestBetaValues);
+    polyRegression->set_polynomial_coeffs(trend_coeffs());
   }
   if (estimateNugget) estimatedNuggetValue = bestEstimatedNuggetValue;
 
-  /* compute and store best Cholesky factorization */
-  compute_gram(cwiseDists2, true, false, GramMatrix);
-  CholFact.compute(GramMatrix);
-  hasBestCholFact = true;
+  /* compute and store best Cholesky factorization and prediction solves */
+  compute_prediction_cache();
 
   /* Useful info for debugging */
   /*
@@ -284,9 +370,8 @@ void GaussianProcess::build(const MatrixXd& samples, const MatrixXd& response) {
 }
 
 VectorXd GaussianProcess::value(const MatrixXd& eval_points, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (!qoiModels.empty()) return qoiModels[qoi]->value(eval_points, 0);
 
   if (eval_points.cols() != numVariables) {
     throw(
@@ -295,41 +380,34 @@ VectorXd GaussianProcess::value(const MatrixXd& eval_points, const int qoi) {
                            "point and Gaussian Process do not match"));
   }
 
-  VectorXd approx_values;
+  /* compute the Gram matrix and its Cholesky factorization */
+  if (!hasBestCholFact) compute_prediction_cache();
 
   /* scale the eval_points (prediction points) */
   const MatrixXd& scaled_pred_points = dataScaler.scale_samples(eval_points);
-  compute_pred_dists(scaled_pred_points);
-
-  /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
-
-  VectorXd resid, chol_solve_resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-
-  if (estimateTrend) {
-    resid = targetValues - basisMatrix * betaValues;
-  } else
-    resid = targetValues;
-
-  chol_solve_resid = CholFact.solve(resid);
-  approx_values = predMixedGramMatrix * chol_solve_resid;
+  const int num_pred_pts = scaled_pred_points.rows();
+  VectorXd approx_values(num_pred_pts);
+
+  for_each_pred_block(num_pred_pts, [&](int first_pt, int num_pts) {
+    const MatrixXd block_pts = scaled_pred_points.middleRows(first_pt, num_pts);
+    MatrixXd pred_gram;
+    compute_pred_gram_block(block_pts, &pred_gram, nullptr);
+    VectorXd block_values = pred_gram * predictionWeights.col(qoi);
+    if (estimateTrend) {
+      MatrixXd block_basis;
+      polyRegression->compute_basis_matrix(block_pts, block_basis);
+      block_values += block_basis * trend_coeffs().col(qoi);
+    }
+    approx_values.segment(first_pt, num_pts) = block_values;
+  });
 
-  if (estimateTrend) {
-    polyRegression->compute_basis_matrix(scaled_pred_points, predBasisMatrix);
-    MatrixXd z = CholFact.solve(basisMatrix);
-    approx_values += predBasisMatrix * betaValues;
-  }
-  return responseScaleFactor * approx_values.array() + responseOffset;
+  return responseScaleFactors(qoi) * approx_values.array() +
+         responseOffsets(qoi);
 }
 
 MatrixXd GaussianProcess::gradient(const MatrixXd& eval_points, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (!qoiModels.empty()) return qoiModels[qoi]->gradient(eval_points, 0);
 
   if (eval_points.cols() != numVariables) {
     throw(std::runtime_error(
@@ -338,46 +416,44 @@ MatrixXd GaussianProcess::gradient(const MatrixXd& eval_points, const int qoi) {
         "Gaussian Process do not match"));
   }
 
-  const int numPredictionPts = eval_points.rows();
-
-  MatrixXd gradient(numPredictionPts, numVariables);
+  /* compute the Gram matrix and its Cholesky factorization */
+  if (!hasBestCholFact) compute_prediction_cache();
 
   /* scale the eval_points (prediction points) */
   MatrixXd scaled_pred_pts;
   dataScaler.scale_samples(eval_points, scaled_pred_pts);
-  compute_pred_dists(scaled_pred_pts);
-
-  /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
-
-  MatrixXd chol_solve_resid, first_deriv_pred_gram, grad_components, resid;
-  compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-  resid = targetValues;
-  if (estimateTrend) resid -= basisMatrix * betaValues;
-  chol_solve_resid = CholFact.solve(resid);
-
-  for (int i = 0; i < numVariables; i++) {
-    first_deriv_pred_gram = kernel->compute_first_deriv_pred_gram(
-        predMixedGramMatrix, cwiseMixedDists, thetaValues, i);
-    grad_components = first_deriv_pred_gram * chol_solve_resid;
-    gradient.col(i) = grad_components.col(0);
-  }
-
-  /* extra terms for GP with a trend */
-  if (estimateTrend) {
-    MatrixXd poly_grad_pred_pts;
-    gradient += polyRegression->gradient(scaled_pred_pts);
-  }
-  return responseScaleFactor * gradient;
+  const int num_pred_pts = scaled_pred_pts.rows();
+  MatrixXd gradient(num_pred_pts, numVariables);
+
+  /* With k' the derivative of the kernel with respect to the scaled squared
+   * distance r2, dk/dx_i = 2 k' (x_i - y_i) / l_i^2, so the gradient is
+   * formed from products of k' with the kernel centers */
+  const VectorXd inv_length_scales2 =
+      (-2.0 * thetaValues.tail(numVariables)).array().exp();
+  const MatrixXd weighted_centers =
+      predictionWeights.col(qoi).asDiagonal() * kernel_centers();
+
+  for_each_pred_block(num_pred_pts, [&](int first_pt, int num_pts) {
+    const MatrixXd block_pts = scaled_pred_pts.middleRows(first_pt, num_pts);
+    MatrixXd pred_gram_deriv;
+    compute_pred_gram_block(block_pts, nullptr, &pred_gram_deriv);
+    const VectorXd deriv_weights =
+        pred_gram_deriv * predictionWeights.col(qoi);
+    MatrixXd block_grad = 2.0 *
+                          (deriv_weights.asDiagonal() * block_pts -
+                           pred_gram_deriv * weighted_centers) *
+                          inv_length_scales2.asDiagonal();
+    /* extra terms for GP with a trend */
+    if (estimateTrend) block_grad += polyRegression->gradient(block_pts, qoi);
+    gradient.middleRows(first_pt, num_pts) = block_grad;
+  });
+
+  return responseScaleFactors(qoi) * gradient;
 }
 
 MatrixXd GaussianProcess::hessian(const MatrixXd& eval_point, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (!qoiModels.empty()) return qoiModels[qoi]->hessian(eval_point, 0);
 
   if (eval_point.rows() != 1) {
     throw(std::runtime_error(
@@ -393,40 +469,34 @@ MatrixXd GaussianProcess::hessian(const MatrixXd& eval_point, const int qoi) {
   compute_pred_dists(scaled_pred_point);
 
   /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
+  if (!hasBestCholFact) compute_prediction_cache();
 
-  MatrixXd chol_solve_resid, second_deriv_pred_gram, resid;
+  MatrixXd second_deriv_pred_gram;
   compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-  resid = targetValues;
-  if (estimateTrend) resid -= basisMatrix * betaValues;
-  chol_solve_resid = CholFact.solve(resid);
 
   /* Hessian */
   for (int i = 0; i < numVariables; i++) {
     for (int j = i; j < numVariables; j++) {
       second_deriv_pred_gram = kernel->compute_second_deriv_pred_gram(
           predMixedGramMatrix, cwiseMixedDists, thetaValues, i, j);
-      hessian(i, j) = (second_deriv_pred_gram * chol_solve_resid)(0, 0);
+      hessian(i, j) =
+          (second_deriv_pred_gram * predictionWeights.col(qoi))(0);
       if (i != j) hessian(j, i) = hessian(i, j);
     }
   }
 
   if (estimateTrend) {
     MatrixXd poly_hessian_pred_pt;
-    hessian += polyRegression->hessian(scaled_pred_point);
+    hessian += polyRegression->hessian(scaled_pred_point, qoi);
   }
 
-  return responseScaleFactor * hessian;
+  return responseScaleFactors(qoi) * hessian;
 }
 
 MatrixXd GaussianProcess::covariance(const MatrixXd& eval_points,
                                      const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (!qoiModels.empty()) return qoiModels[qoi]->covariance(eval_points, 0);
 
   if (eval_points.cols() != numVariables) {
     throw(std::runtime_error(
@@ -441,43 +511,88 @@ MatrixXd GaussianProcess::covariance(const MatrixXd& eval_points,
   compute_pred_dists(scaled_pred_points);
 
   /* compute the Gram matrix and its Cholesky factorization */
-  if (!hasBestCholFact) {
-    compute_gram(cwiseDists2, true, false, GramMatrix);
-    CholFact.compute(GramMatrix);
-  }
+  if (!hasBestCholFact) compute_prediction_cache();
 
-  VectorXd resid;
   MatrixXd chol_solve_pred_mat;
   compute_gram(cwiseMixedDists2, false, false, predMixedGramMatrix);
-
-  if (estimateTrend)
-    resid = targetValues - basisMatrix * betaValues;
-  else
-    resid = targetValues;
-
   chol_solve_pred_mat = CholFact.solve(predMixedGramMatrix.transpose());
 
   compute_gram(cwisePredDists2, true, false, predGramMatrix);
-  predCovariance = predGramMatrix - predMixedGramMatrix * chol_solve_pred_mat;
+  if (numInducingPoints > 0) {
+    /* K_** - Q_** plus the posterior covariance of the inducing values */
+    predCovariance =
+        predGramMatrix -
+        predMixedGramMatrix *
+            inducingCholFact.solve(predMixedGramMatrix.transpose()) +
+        noise_variance() * predMixedGramMatrix * chol_solve_pred_mat;
+  } else
+    predCovariance = predGramMatrix - predMixedGramMatrix * chol_solve_pred_mat;
 
   if (estimateTrend) {
-    MatrixXd chol_solve_resid = CholFact.solve(resid);
     polyRegression->compute_basis_matrix(scaled_pred_points, predBasisMatrix);
-    MatrixXd z = CholFact.solve(basisMatrix);
-    MatrixXd R_mat = predBasisMatrix - predMixedGramMatrix * (z);
-    MatrixXd h_mat = basisMatrix.transpose() * z;
-    predCovariance += R_mat * (h_mat.ldlt().solve(R_mat.transpose()));
+    MatrixXd R_mat = predBasisMatrix - predMixedGramMatrix * GramBasisSolution;
+    predCovariance += R_mat * (trendCholFact.solve(R_mat.transpose()));
   }
 
-  return pow(responseScaleFactor, 2) * predCovariance;
+  return pow(responseScaleFactors(qoi), 2) * predCovariance;
 }
 
 VectorXd GaussianProcess::variance(const MatrixXd& eval_points, const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  check_qoi(qoi);
+  if (!qoiModels.empty()) return qoiModels[qoi]->variance(eval_points, 0);
 
-  VectorXd variance = covariance(eval_points).diagonal();
+  if (eval_points.cols() != numVariables) {
+    throw(std::runtime_error(
+        "Gaussian Process variance input has wrong dimension."
+        " Dimension of the feature space for the evaluation point and Gaussian "
+        "Process do not match"));
+  }
+
+  /* compute the Gram matrix and its Cholesky factorization */
+  if (!hasBestCholFact) compute_prediction_cache();
+
+  /* scale the eval_points (prediction points) */
+  const MatrixXd& scaled_pred_points = dataScaler.scale_samples(eval_points);
+  const int num_pred_pts = scaled_pred_points.rows();
+  VectorXd variance(num_pred_pts);
+
+  /* the diagonal of the prediction Gram matrix, including the nuggets */
+  MatrixXd prior_variance;
+  kernel->compute_scaled_gram(MatrixXd::Zero(1, 1), thetaValues,
+                              prior_variance);
+  prior_variance.array() += noise_variance();
+
+  /* diagonal of gram fact^{-1} gram^T */
+  auto diag_quad_form = [](const Eigen::LDLT<MatrixXd>& fact,
+                           const MatrixXd& gram) -> VectorXd {
+    return gram.cwiseProduct(fact.solve(gram.transpose()).transpose())
+        .rowwise()
+        .sum();
+  };
+
+  /* the diagonal of the covariance, one block of points at a time */
+  for_each_pred_block(num_pred_pts, [&](int first_pt, int num_pts) {
+    const MatrixXd block_pts = scaled_pred_points.middleRows(first_pt, num_pts);
+    MatrixXd pred_gram;
+    compute_pred_gram_block(block_pts, &pred_gram, nullptr);
+    VectorXd block_variance;
+    if (numInducingPoints > 0)
+      block_variance =
+          prior_variance(0, 0) -
+          diag_quad_form(inducingCholFact, pred_gram).array() +
+          noise_variance() * diag_quad_form(CholFact, pred_gram).array();
+    else
+      block_variance = prior_variance(0, 0) -
+                       diag_quad_form(CholFact, pred_gram).array();
+    if (estimateTrend) {
+      MatrixXd block_basis;
+      polyRegression->compute_basis_matrix(block_pts, block_basis);
+      const MatrixXd R_mat = block_basis - pred_gram * GramBasisSolution;
+      block_variance += diag_quad_form(trendCholFact, R_mat);
+    }
+    variance.segment(first_pt, num_pts) =
+        pow(responseScaleFactors(qoi), 2) * block_variance;
+  });
 
   for (int i = 0; i < variance.size(); i++) {
     if (variance(i) < 0.0 || std::isnan(variance(i))) {
@@ -492,27 +607,36 @@ void GaussianProcess::negative_marginal_log_likelihood(bool compute_grad,
                                                        bool form_gram,
                                                        double& obj_value,
                                                        VectorXd& obj_gradient) {
+  if (numInducingPoints > 0) {
+    sparse_negative_marginal_log_likelihood(compute_grad, form_gram, obj_value,
+                                            obj_gradient);
+    return;
+  }
+
+  /* The QoIs share the Gram matrix, so their joint negative log-likelihood
+   * needs one factorization and a solve with a residual column per QoI */
   if (form_gram) {
-    compute_gram(cwiseDists2, true, true, GramMatrix);
+    compute_gram(build_dists2(), true, true, GramMatrix);
     CholFact.compute(GramMatrix);
     trendTargetResidual = targetValues;
-    if (estimateTrend) trendTargetResidual -= basisMatrix * betaValues;
+    if (estimateTrend) trendTargetResidual -= basisMatrix * trend_coeffs();
     GramResidualSolution = CholFact.solve(trendTargetResidual);
   }
 
   obj_value =
-      0.5 * log(CholFact.vectorD().array()).matrix().sum() +
-      0.5 * (trendTargetResidual.transpose() * GramResidualSolution)(0, 0) +
-      static_cast<double>(numSamples) / 2.0 * log(2.0 * PI);
+      0.5 * numQOI * log(CholFact.vectorD().array()).matrix().sum() +
+      0.5 * trendTargetResidual.cwiseProduct(GramResidualSolution).sum() +
+      static_cast<double>(numQOI * numSamples) / 2.0 * log(2.0 * PI);
 
   if (compute_grad) {
     /* DTS: This Cholesky solve is much more expensive than the factorization!
      */
     MatrixXd Q =
         -0.5 * (GramResidualSolution * GramResidualSolution.transpose() -
-                CholFact.solve(eyeMatrix));
+                numQOI * CholFact.solve(eyeMatrix));
     if (estimateTrend) {
-      obj_gradient.segment(numVariables + 1, numPolyTerms) =
+      Eigen::Map<MatrixXd>(obj_gradient.data() + numVariables + 1,
+                           numPolyTerms, numQOI) =
           -basisMatrix.transpose() * GramResidualSolution;
     }
 
@@ -520,7 +644,7 @@ void GaussianProcess::negative_marginal_log_likelihood(bool compute_grad,
       obj_gradient(k) = (GramMatrixDerivs[k].cwiseProduct(Q)).sum();
 
     if (estimateNugget) {
-      obj_gradient(numVariables + 1 + numPolyTerms) =
+      obj_gradient(numVariables + 1 + numPolyTerms * numQOI) =
           2.0 * exp(2.0 * estimatedNuggetValue) * Q.trace();
     }
   }
@@ -559,7 +683,7 @@ void GaussianProcess::setup_hyperparameter_bounds(VectorXd& sigma_bounds,
 }
 
 int GaussianProcess::get_num_opt_variables() {
-  return numVariables + 1 + numPolyTerms + numNuggetTerms;
+  return numVariables + 1 + numPolyTerms * numQOI + numNuggetTerms;
 }
 
 int GaussianProcess::get_num_variables() const { return numVariables; }
@@ -568,12 +692,13 @@ void GaussianProcess::set_opt_params(const std::vector<double>& opt_params) {
   for (int i = 0; i < numVariables + 1; i++) thetaValues(i) = opt_params[i];
 
   if (estimateTrend) {
-    for (int i = 0; i < numPolyTerms; i++)
+    for (int i = 0; i < numPolyTerms * numQOI; i++)
       betaValues(i) = opt_params[numVariables + 1 + i];
   }
 
   if (estimateNugget)
-    estimatedNuggetValue = opt_params[numVariables + 1 + numPolyTerms];
+    estimatedNuggetValue =
+        opt_params[numVariables + 1 + numPolyTerms * numQOI];
 }
 
 void GaussianProcess::default_options() {
@@ -632,6 +757,11 @@ void GaussianProcess::default_options() {
      1 - minimum level: print out building notification
      0 - no output */
   defaultConfigOptions.set("verbosity", 1, "console output verbosity");
+  /* Prediction */
+  defaultConfigOptions.set("prediction block size", 0,
+                           "prediction points per block (0 for automatic)");
+  defaultConfigOptions.set("prediction threads", 1,
+                           "threads for concurrent prediction blocks");
   /* Nugget */
   defaultConfigOptions.sublist("Nugget").set("fixed nugget", 1.0e-10,
                                              "fixed nugget term");
@@ -641,6 +771,17 @@ void GaussianProcess::default_options() {
       "lower bound", nugget_lower_bound, "nugget term lower bound");
   defaultConfigOptions.sublist("Nugget").sublist("Bounds").set(
       "upper bound", nugget_upper_bound, "nugget term upper bound");
+  /* Inducing points for a sparse GP */
+  defaultConfigOptions.sublist("Inducing Points")
+      .set("num inducing points", 0,
+           "number of inducing points for a sparse GP (0 for a dense GP)");
+  /* Multiple responses */
+  defaultConfigOptions.sublist("Multiple Outputs")
+      .set("tie hyperparameters", false,
+           "share the kernel hyperparameters and nugget among the QoIs");
+  defaultConfigOptions.sublist("Multiple Outputs")
+      .set("num threads", 1,
+           "threads for concurrent hyperparameter estimation of the QoIs");
   /* Polynomial Trend */
   defaultConfigOptions.sublist("Trend").set("estimate trend", false,
                                             "estimate a trend term");
@@ -674,18 +815,19 @@ void GaussianProcess::compute_build_dists() {
 }
 
 void GaussianProcess::compute_pred_dists(const MatrixXd& scaled_pred_pts) {
+  const MatrixXd& centers = kernel_centers();
   const int num_pred_pts = scaled_pred_pts.rows();
+  const int num_centers = centers.rows();
   cwiseMixedDists.resize(numVariables);
   cwiseMixedDists2.resize(numVariables);
   cwisePredDists2.resize(numVariables);
 
   for (int k = 0; k < numVariables; k++) {
-    cwiseMixedDists[k].resize(num_pred_pts, numSamples);
+    cwiseMixedDists[k].resize(num_pred_pts, num_centers);
     cwisePredDists2[k].resize(num_pred_pts, num_pred_pts);
     for (int i = 0; i < num_pred_pts; i++) {
-      for (int j = 0; j < numSamples; j++) {
-        cwiseMixedDists[k](i, j) =
-            scaled_pred_pts(i, k) - scaledBuildPoints(j, k);
+      for (int j = 0; j < num_centers; j++) {
+        cwiseMixedDists[k](i, j) = scaled_pred_pts(i, k) - centers(j, k);
       }
       for (int j = i; j < num_pred_pts; j++) {
         cwisePredDists2[k](i, j) =
@@ -697,6 +839,258 @@ void GaussianProcess::compute_pred_dists(const MatrixXd& scaled_pred_pts) {
   }
 }
 
+void GaussianProcess::select_inducing_points() {
+  /* start from the build point nearest the centroid, then repeatedly add the
+   * build point farthest from those already selected */
+  const RowVectorXd centroid = scaledBuildPoints.colwise().mean();
+  int index;
+  (scaledBuildPoints.rowwise() - centroid).rowwise().squaredNorm().minCoeff(
+      &index);
+
+  inducingPoints.resize(numInducingPoints, numVariables);
+  const double max_dist2 = std::numeric_limits<double>::max();
+  VectorXd min_dists2 = VectorXd::Constant(numSamples, max_dist2);
+  for (int i = 0; i < numInducingPoints; i++) {
+    inducingPoints.row(i) = scaledBuildPoints.row(index);
+    min_dists2 = min_dists2.cwiseMin(
+        (scaledBuildPoints.rowwise() - inducingPoints.row(i))
+            .rowwise()
+            .squaredNorm());
+    min_dists2.maxCoeff(&index);
+  }
+  cwiseDists2.clear();
+}
+
+const std::vector<MatrixXd>& GaussianProcess::build_dists2() const {
+  return sharedBuildDists2 ? *sharedBuildDists2 : cwiseDists2;
+}
+
+Eigen::Map<const MatrixXd> GaussianProcess::trend_coeffs() const {
+  return Eigen::Map<const MatrixXd>(betaValues.data(),
+                                    betaValues.size() / numQOI, numQOI);
+}
+
+std::shared_ptr<GaussianProcess> GaussianProcess::qoi_model(
+    const int qoi) const {
+  check_qoi(qoi);
+  return qoiModels.empty() ? nullptr : qoiModels[qoi];
+}
+
+void GaussianProcess::check_qoi(int qoi) const {
+  if (qoi < 0 || qoi >= numQOI)
+    throw(std::runtime_error(
+        "Gaussian Process QoI index is out of range for the number of "
+        "responses"));
+}
+
+const MatrixXd& GaussianProcess::kernel_centers() const {
+  return (numInducingPoints > 0) ? inducingPoints : scaledBuildPoints;
+}
+
+void GaussianProcess::compute_scaled_dists2(const MatrixXd& pts,
+                                            const MatrixXd& centers,
+                                            MatrixXd& scaled_dists2) const {
+  const VectorXd inv_length_scales =
+      (-thetaValues.tail(numVariables)).array().exp();
+  const MatrixXd length_scaled_pts = pts * inv_length_scales.asDiagonal();
+  const MatrixXd length_scaled_centers =
+      centers * inv_length_scales.asDiagonal();
+
+  /* |x|^2 + |y|^2 - 2 x.y, with roundoff clipped at zero */
+  scaled_dists2 = -2.0 * length_scaled_pts * length_scaled_centers.transpose();
+  scaled_dists2.colwise() += length_scaled_pts.rowwise().squaredNorm();
+  scaled_dists2.rowwise() +=
+      length_scaled_centers.rowwise().squaredNorm().transpose();
+  scaled_dists2 = scaled_dists2.cwiseMax(0.0);
+}
+
+double GaussianProcess::noise_variance() const {
+  double noise_var = fixedNuggetValue;
+  if (estimateNugget) noise_var += exp(2.0 * estimatedNuggetValue);
+  return noise_var;
+}
+
+void GaussianProcess::compute_sparse_gram() {
+  /* K_mm, with relative jitter for conditioning */
+  compute_scaled_dists2(inducingPoints, inducingPoints, inducingDists2);
+  inducingDists2.diagonal().setZero();
+  kernel->compute_scaled_gram(inducingDists2, thetaValues, inducingGramMatrix);
+  inducingGramMatrix.diagonal() *= 1.0 + inducingJitter;
+  inducingCholFact.compute(inducingGramMatrix);
+
+  /* K_mn and K_mm^{-1} K_mn */
+  compute_scaled_dists2(inducingPoints, scaledBuildPoints, inducingMixedDists2);
+  kernel->compute_scaled_gram(inducingMixedDists2, thetaValues,
+                              inducingMixedGramMatrix);
+  inducingGramSolution = inducingCholFact.solve(inducingMixedGramMatrix);
+
+  /* With Sigma = noise_var I + Q_nn the approximate Gram matrix and
+   * A = noise_var K_mm + K_mn K_nm, Sigma^{-1} = (I - K_nm A^{-1} K_mn) /
+   * noise_var */
+  const double noise_var = noise_variance();
+  GramMatrix = noise_var * inducingGramMatrix;
+  GramMatrix.noalias() +=
+      inducingMixedGramMatrix * inducingMixedGramMatrix.transpose();
+  CholFact.compute(GramMatrix);
+
+  trendTargetResidual = targetValues;
+  if (estimateTrend) trendTargetResidual -= basisMatrix * trend_coeffs();
+  predictionWeights =
+      CholFact.solve(inducingMixedGramMatrix * trendTargetResidual);
+  GramResidualSolution = (trendTargetResidual -
+                          inducingMixedGramMatrix.transpose() *
+                              predictionWeights) /
+                         noise_var;
+}
+
+void GaussianProcess::sparse_negative_marginal_log_likelihood(
+    bool compute_grad, bool form_gram, double& obj_value,
+    VectorXd& obj_gradient) {
+  if (form_gram) compute_sparse_gram();
+
+  const double noise_var = noise_variance();
+  MatrixXd prior_variance;
+  kernel->compute_scaled_gram(MatrixXd::Zero(1, 1), thetaValues,
+                              prior_variance);
+  /* trace of K_nn - Q_nn, where Q_nn = K_nm K_mm^{-1} K_mn */
+  const double trace_diff =
+      numSamples * prior_variance(0, 0) -
+      inducingGramSolution.cwiseProduct(inducingMixedGramMatrix).sum();
+
+  /* log|Sigma| = (n - m) log(noise_var) + log|A| - log|K_mm|; as for a
+   * dense GP, the QoIs share Sigma */
+  obj_value =
+      0.5 * numQOI *
+          ((numSamples - numInducingPoints) * log(noise_var) +
+           log(CholFact.vectorD().array()).matrix().sum() -
+           log(inducingCholFact.vectorD().array()).matrix().sum() +
+           trace_diff / noise_var) +
+      0.5 * trendTargetResidual.cwiseProduct(GramResidualSolution).sum() +
+      static_cast<double>(numQOI * numSamples) / 2.0 * log(2.0 * PI);
+
+  if (compute_grad) {
+    /* With W = q Sigma^{-1} - alpha alpha^T for q QoIs and
+     * P = K_mm^{-1} K_mn, the derivative is sum(G_mn .* dK_mn) +
+     * sum(G_mm .* dK_mm) + q d tr(K_nn) / (2 noise_var), where
+     * G_mn = P W - q P / noise_var and G_mm = (q P P^T / noise_var -
+     * P W P^T) / 2; P Sigma^{-1} = A^{-1} K_mn */
+    const MatrixXd& P = inducingGramSolution;
+    const MatrixXd& alpha = GramResidualSolution;
+    const MatrixXd P_alpha = P * alpha;
+    const MatrixXd A_solve_mixed = CholFact.solve(inducingMixedGramMatrix);
+    MatrixXd coeffs_mn = numQOI * (A_solve_mixed - P / noise_var) -
+                         P_alpha * alpha.transpose();
+    MatrixXd coeffs_mm =
+        0.5 * (numQOI * (P * P.transpose() / noise_var -
+                         A_solve_mixed * P.transpose()) +
+               P_alpha * P_alpha.transpose());
+
+    /* sigma: dK/dtheta_0 = 2 K */
+    obj_gradient(0) =
+        2.0 * (coeffs_mn.cwiseProduct(inducingMixedGramMatrix).sum() +
+               coeffs_mm.cwiseProduct(inducingGramMatrix).sum()) +
+        numQOI * numSamples * prior_variance(0, 0) / noise_var;
+
+    /* length scales: dK/dtheta_k = -2 k' (x_k - y_k)^2 / l_k^2, for k' the
+     * kernel derivative with respect to the scaled squared distance; sum
+     * the weighted squared component distances by expanding the squares */
+    auto weighted_dists2 = [](const MatrixXd& weights, const MatrixXd& pts,
+                              const MatrixXd& centers) -> VectorXd {
+      return pts.array().square().matrix().transpose() *
+                 weights.rowwise().sum() +
+             centers.array().square().matrix().transpose() *
+                 weights.colwise().sum().transpose() -
+             2.0 * pts.cwiseProduct(weights * centers).colwise().sum()
+                       .transpose();
+    };
+    MatrixXd gram_deriv;
+    kernel->compute_scaled_gram_deriv(inducingMixedDists2, thetaValues,
+                                      gram_deriv);
+    coeffs_mn = coeffs_mn.cwiseProduct(gram_deriv);
+    kernel->compute_scaled_gram_deriv(inducingDists2, thetaValues, gram_deriv);
+    coeffs_mm = coeffs_mm.cwiseProduct(gram_deriv);
+    const VectorXd dists2_sums =
+        weighted_dists2(coeffs_mn, inducingPoints, scaledBuildPoints) +
+        weighted_dists2(coeffs_mm, inducingPoints, inducingPoints);
+    for (int k = 0; k < numVariables; k++)
+      obj_gradient(k + 1) =
+          -2.0 * exp(-2.0 * thetaValues(k + 1)) * dists2_sums(k);
+
+    if (estimateTrend) {
+      Eigen::Map<MatrixXd>(obj_gradient.data() + numVariables + 1,
+                           numPolyTerms, numQOI) =
+          -basisMatrix.transpose() * alpha;
+    }
+
+    if (estimateNugget) {
+      /* tr(Sigma^{-1}) = (n - tr(A^{-1} K_mn K_nm)) / noise_var */
+      const double trace_inv =
+          (numSamples -
+           A_solve_mixed.cwiseProduct(inducingMixedGramMatrix).sum()) /
+          noise_var;
+      obj_gradient(numVariables + 1 + numPolyTerms * numQOI) =
+          exp(2.0 * estimatedNuggetValue) *
+          (numQOI * (trace_inv - trace_diff / (noise_var * noise_var)) -
+           alpha.squaredNorm());
+    }
+  }
+}
+
+void GaussianProcess::compute_prediction_cache() {
+  if (numInducingPoints > 0) {
+    compute_sparse_gram();
+    if (estimateTrend) {
+      /* basisMatrix^T Sigma^{-1} basisMatrix, using A as above */
+      const MatrixXd mixed_basis = inducingMixedGramMatrix * basisMatrix;
+      GramBasisSolution = CholFact.solve(mixed_basis);
+      trendCholFact.compute((basisMatrix.transpose() * basisMatrix -
+                             mixed_basis.transpose() * GramBasisSolution) /
+                            noise_variance());
+    }
+  } else {
+    compute_gram(build_dists2(), true, false, GramMatrix);
+    CholFact.compute(GramMatrix);
+
+    trendTargetResidual = targetValues;
+    if (estimateTrend) trendTargetResidual -= basisMatrix * trend_coeffs();
+    GramResidualSolution = CholFact.solve(trendTargetResidual);
+    predictionWeights = GramResidualSolution;
+
+    if (estimateTrend) {
+      GramBasisSolution = CholFact.solve(basisMatrix);
+      trendCholFact.compute(basisMatrix.transpose() * GramBasisSolution);
+    }
+  }
+
+  hasBestCholFact = true;
+}
+
+void GaussianProcess::compute_pred_gram_block(const MatrixXd& scaled_pred_pts,
+                                              MatrixXd* pred_gram,
+                                              MatrixXd* pred_gram_deriv) const {
+  MatrixXd scaled_dists2;
+  compute_scaled_dists2(scaled_pred_pts, kernel_centers(), scaled_dists2);
+  if (pred_gram)
+    kernel->compute_scaled_gram(scaled_dists2, thetaValues, *pred_gram);
+  if (pred_gram_deriv)
+    kernel->compute_scaled_gram_deriv(scaled_dists2, thetaValues,
+                                      *pred_gram_deriv);
+}
+
+void GaussianProcess::for_each_pred_block(
+    int num_pred_pts, const std::function<void(int, int)>& block_fn) const {
+  /* by default, size the blocks for 2^18 (2 MB) mixed Gram matrix entries */
+  int block_size = predictionBlockSize;
+  if (block_size <= 0)
+    block_size = std::max(16, static_cast<int>((1 << 18) /
+                                               kernel_centers().rows()));
+  const int num_blocks = (num_pred_pts + block_size - 1) / block_size;
+  parallel_for(num_blocks, numPredictionThreads, [&](int b) {
+    const int first_pt = b * block_size;
+    block_fn(first_pt, std::min(block_size, num_pred_pts - first_pt));
+  });
+}
+
 void GaussianProcess::compute_gram(const std::vector<MatrixXd>& dists2,
                                    bool add_nugget, bool compute_derivs,
                                    MatrixXd& gram) {
@@ -722,7 +1116,8 @@ void GaussianProcess::generate_initial_guesses(
     const VectorXd& nugget_bounds, const int num_restarts, const int seed,
     MatrixXd& initial_guesses) {
   initial_guesses = util::create_uniform_random_double_matrix(
-      num_restarts, numVariables + 1 + numPolyTerms + numNuggetTerms, seed,
+      num_restarts, numVariables + 1 + numPolyTerms * numQOI + numNuggetTerms,
+      seed,
       true, -1.0, 1.0);
 
   double mean, span;
@@ -751,13 +1146,13 @@ void GaussianProcess::generate_initial_guesses(
   if (estimateTrend) {
     int index_offset = numVariables + 1;
     for (int i = 0; i < num_restarts; ++i) {
-      for (int j = 0; j < numPolyTerms; j++) {
+      for (int j = 0; j < numPolyTerms * numQOI; j++) {
         initial_guesses(i, index_offset + j) = 0.0;
       }
     }
   }
   if (estimateNugget) {
-    int index_offset = numVariables + 1 + numPolyTerms;
+    int index_offset = numVariables + 1 + numPolyTerms * numQOI;
     span = 0.5 * (log(nugget_bounds(1)) - log(nugget_bounds(0)));
     mean = 0.5 * (log(nugget_bounds(1)) + log(nugget_bounds(0)));
     for (int i = 0; i < num_restarts; ++i) {
@@ -18,6 +18,8 @@
 
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/vector.hpp>
+#include <boost/serialization/version.hpp>
+#include <functional>
 
 namespace dakota {
 
@@ -45,6 +47,32 @@ namespace surrogates {
  *  Once the GP is constructed its mean, variance,
  *  and covariance matrix can be computed for a set of prediction
  *  points. Gradients and Hessians are available.
+ *
+ *  For large build data sets, the "Inducing Points" options select a
+ *  sparse GP using the variational free energy (VFE) approximation of
+ *  Titsias (2009): the kernel is interpolated through a subset of
+ *  the build points, chosen by farthest point sampling, and the
+ *  hyperparameters maximize a lower bound on the marginal likelihood
+ *  that treats the nugget as observation noise. Each likelihood
+ *  evaluation then costs O(num_samples num_inducing^2) rather than
+ *  O(num_samples^3), and prediction costs scale with the number of
+ *  inducing points rather than build points.
+ *
+ *  The weights reused by every prediction are computed once the GP is
+ *  built (or loaded). The mean, gradient, and variance are computed in
+ *  blocks of prediction points, evaluating the kernel directly from the
+ *  length-scaled points, so their memory use is proportional to the
+ *  block size times the number of build (or inducing) points rather
+ *  than to the number of prediction points. Blocks may be evaluated
+ *  concurrently.
+ *
+ *  Multiple responses (QoIs) share the scaled build points and their
+ *  squared distances. By default ("Multiple Outputs" options), each QoI
+ *  has its own hyperparameters, which are estimated concurrently on
+ *  "num threads" threads. When the hyperparameters are tied, they
+ *  maximize the joint likelihood of the QoIs (each with its own trend
+ *  coefficients), so the Gram matrix is factored once per likelihood
+ *  evaluation and solved for all QoIs at once.
  */
 class GaussianProcess : public Surrogate {
  public:
@@ -73,10 +101,9 @@ class GaussianProcess : public Surrogate {
    * \brief Constructor for the GaussianProcess that sets configOptions
    *        and builds the GP.
    * \param[in] samples Matrix of data for surrogate construction - (num_samples
-   * by num_features) \param[in] response Vector of targets for surrogate
-   * construction - (num_samples by num_qoi = 1; only 1 response is supported
-   * currently). \param[in] param_list List that overrides entries in
-   * defaultConfigOptions
+   * by num_features) \param[in] response Matrix of targets for surrogate
+   * construction - (num_samples by num_qoi). \param[in] param_list List that
+   * overrides entries in defaultConfigOptions
    */
   GaussianProcess(const MatrixXd& samples, const MatrixXd& response,
                   const ParameterList& param_list);
@@ -86,9 +113,9 @@ class GaussianProcess : public Surrogate {
    *        and builds the GP.
    *
    * \param[in] samples Matrix of data for surrogate construction - (num_samples
-   * by num_features) \param[in] response Vector of targets for surrogate
-   * construction - (num_samples by num_qoi = 1; only 1 response is supported
-   * currently). \param[in] param_list_yaml_filename A ParameterList file
+   * by num_features) \param[in] response Matrix of targets for surrogate
+   * construction - (num_samples by num_qoi). \param[in]
+   * param_list_yaml_filename A ParameterList file
    * (relative to the location of the Dakota input file) that overrides entries
    * in defaultConfigOptions.
    */
@@ -103,9 +130,8 @@ class GaussianProcess : public Surrogate {
   /**
    * \brief Build the GP using specified build data.
    * \param[in] eval_points Matrix of data for surrogate construction -
-   * (num_samples by num_features) \param[in] response Vector of targets for
-   * surrogate construction - (num_samples by num_qoi = 1; only 1 response is
-   * supported currently).
+   * (num_samples by num_features) \param[in] response Matrix of targets for
+   * surrogate construction - (num_samples by num_qoi).
    */
   void build(const MatrixXd& eval_points, const MatrixXd& response) override;
 
@@ -203,6 +229,14 @@ class GaussianProcess : public Surrogate {
     return variance(eval_points, 0);
   }
 
+  /**
+   *  \brief Get the GP predicting a single QoI when the hyperparameters
+   *  of the QoIs are not tied.
+   *  \param[in] qoi Index of the QoI.
+   *  \returns GP for the QoI, or null if this GP predicts all QoIs.
+   */
+  std::shared_ptr<GaussianProcess> qoi_model(const int qoi) const;
+
   /**
    *  \brief Evaluate the negative marginal loglikelihood and its
    *  gradient.
@@ -215,6 +249,13 @@ class GaussianProcess : public Surrogate {
                                         double& obj_value,
                                         VectorXd& obj_gradient);
 
+  /**
+   *  \brief Get the number of inducing points of a sparse GP.
+   *  \returns numInducingPoints Number of inducing points (0 for a dense
+   *  GP).
+   */
+  int get_num_inducing_points() const { return numInducingPoints; }
+
   /**
    *  \brief Initialize the hyperparameter bounds for MLE from
    *  values in configOptions.
@@ -281,9 +322,74 @@ class GaussianProcess : public Surrogate {
   /// Construct and populate the defaultConfigOptions.
   void default_options() override;
 
+  /**
+   *  \brief Build one GP per QoI from the scaled build points, sharing their
+   *  squared distances, and estimate their hyperparameters concurrently.
+   *  \param[in] response Matrix of targets - (num_samples by num_qoi).
+   */
+  void build_qoi_models(const MatrixXd& response);
+
+  /**
+   *  \brief Build the GP from the scaled build points, with hyperparameters
+   *  shared by all QoIs.
+   *  \param[in] response Matrix of targets - (num_samples by num_qoi).
+   */
+  void build_model(const MatrixXd& response);
+
+  /// Throw if qoi is not a valid QoI index.
+  void check_qoi(int qoi) const;
+
   /// Compute squared distances between the scaled build points.
   void compute_build_dists();
 
+  /// Squared component-wise distances between the build points, which may
+  /// be shared with the GPs for other QoIs.
+  const std::vector<MatrixXd>& build_dists2() const;
+
+  /// Trend coefficients - (num_poly_terms by num_qoi).
+  Eigen::Map<const MatrixXd> trend_coeffs() const;
+
+  /// Select the inducing points of a sparse GP from the scaled build points
+  /// by farthest point sampling.
+  void select_inducing_points();
+
+  /// Build points, or the inducing points of a sparse GP, on which
+  /// predictions are based.
+  const MatrixXd& kernel_centers() const;
+
+  /**
+   *  \brief Compute squared distances between two sets of points scaled by
+   *  the length-scale hyperparameters.
+   *  \param[in] pts Matrix of scaled points.
+   *  \param[in] centers Matrix of scaled points.
+   *  \param[out] scaled_dists2 Matrix of scaled squared distances.
+   */
+  void compute_scaled_dists2(const MatrixXd& pts, const MatrixXd& centers,
+                             MatrixXd& scaled_dists2) const;
+
+  /**
+   *  \brief Form and factor the inducing point Gram matrices of a sparse GP
+   *  and solve for the residual weights at the current hyperparameters.
+   */
+  void compute_sparse_gram();
+
+  /**
+   *  \brief Evaluate the negative VFE lower bound on the marginal
+   *  log-likelihood of a sparse GP and its gradient.
+   *  \param[in] compute_grad Flag for computation of gradient.
+   *  \param[in] compute_gram Flag for various Gram matrix calculations.
+   *  \param[out] obj_value Value of the objection function.
+   *  \param[out] obj_gradient Gradient of the objective function.
+   */
+  void sparse_negative_marginal_log_likelihood(bool compute_grad,
+                                               bool compute_gram,
+                                               double& obj_value,
+                                               VectorXd& obj_gradient);
+
+  /// Sum of the fixed and estimated nuggets, which is the observation noise
+  /// variance of a sparse GP.
+  double noise_variance() const;
+
   /**
    *  \brief Compute distances between build and prediction points. This
    * includes build-prediction and prediction-prediction distance matrices.
@@ -291,6 +397,35 @@ class GaussianProcess : public Surrogate {
    */
   void compute_pred_dists(const MatrixXd& scaled_pred_pts);
 
+  /**
+   *  \brief Factor the Gram matrix for the final hyperparameters and cache
+   *  the solves reused by every prediction.
+   */
+  void compute_prediction_cache();
+
+  /**
+   *  \brief Compute the Gram matrix between a block of prediction points and
+   *  the build points, and optionally its derivative with respect to the
+   *  scaled squared distances, without forming component-wise distances.
+   *  \param[in] scaled_pred_pts Matrix of scaled prediction points.
+   *  \param[out] pred_gram Mixed prediction/build Gram matrix (if not null).
+   *  \param[out] pred_gram_deriv Derivative of pred_gram (if not null).
+   */
+  void compute_pred_gram_block(const MatrixXd& scaled_pred_pts,
+                               MatrixXd* pred_gram,
+                               MatrixXd* pred_gram_deriv) const;
+
+  /**
+   *  \brief Apply block_fn to consecutive blocks of prediction points,
+   *  concurrently if the "prediction threads" option exceeds one.
+   *  \param[in] num_pred_pts Number of prediction points.
+   *  \param[in] block_fn Function of the first point and number of points
+   *  in a block; it must only write results for its own points.
+   */
+  void for_each_pred_block(
+      int num_pred_pts,
+      const std::function<void(int, int)>& block_fn) const;
+
   /**
    *  \brief Compute a Gram matrix given a vector of squared distances and
    *  optionally compute its derivatives and/or adds nugget terms.
@@ -347,7 +482,7 @@ class GaussianProcess : public Surrogate {
   /// Vector of log-space hyperparameters.
   VectorXd thetaValues;
 
-  /// Vector of polynomial coefficients.
+  /// Vector of polynomial coefficients, stacked by QoI.
   VectorXd betaValues;
 
   /// Estimated nugget term.
@@ -371,14 +506,52 @@ class GaussianProcess : public Surrogate {
   /// Final hyperparameter values for each optimization run.
   MatrixXd thetaHistory;
 
-  /// Gram matrix for the build points
+  /// Gram matrix for the build points (for a sparse GP, the matrix
+  /// noise_variance() K_mm + K_mn K_nm of inducing (m) and build (n) points).
   MatrixXd GramMatrix;
 
   /// Difference between target values and trend predictions.
-  VectorXd trendTargetResidual;
+  MatrixXd trendTargetResidual;
+
+  /// Cholesky solve for Gram matrix with trendTargetResidual rhs (for a
+  /// sparse GP, the solve with the approximate Gram matrix).
+  MatrixXd GramResidualSolution;
+
+  /// Weights of the kernel centers in the predictive mean, one column per
+  /// QoI.
+  MatrixXd predictionWeights;
+
+  /// Solve with the basis matrix that maps the mixed prediction Gram matrix
+  /// to the trend predicted by the GP.
+  MatrixXd GramBasisSolution;
+
+  /// Factorization of the trend covariance matrix, basisMatrix^T times
+  /// the inverse of the (approximate) Gram matrix times basisMatrix.
+  Eigen::LDLT<MatrixXd> trendCholFact;
+
+  /// Number of inducing points for a sparse GP (0 for a dense GP).
+  int numInducingPoints = 0;
 
-  /// Cholesky solve for Gram matrix with trendTargetResidual rhs.
-  VectorXd GramResidualSolution;
+  /// The scaled inducing points of a sparse GP.
+  MatrixXd inducingPoints;
+
+  /// Gram matrix for the inducing points, K_mm.
+  MatrixXd inducingGramMatrix;
+
+  /// Gram matrix for the mixed inducing/build points, K_mn.
+  MatrixXd inducingMixedGramMatrix;
+
+  /// Scaled squared distances between the inducing points.
+  MatrixXd inducingDists2;
+
+  /// Scaled squared distances between the inducing and build points.
+  MatrixXd inducingMixedDists2;
+
+  /// Solve for inducingGramMatrix with inducingMixedGramMatrix rhs.
+  MatrixXd inducingGramSolution;
+
+  /// Pivoted Cholesky factorization of inducingGramMatrix.
+  Eigen::LDLT<MatrixXd> inducingCholFact;
 
   /// Derivatives of the Gram matrix w.r.t. the hyperparameters.
   std::vector<MatrixXd> GramMatrixDerivs;
@@ -386,6 +559,20 @@ class GaussianProcess : public Surrogate {
   /// Squared component-wise distances between points in the surrogate dataset.
   std::vector<MatrixXd> cwiseDists2;
 
+  /// Squared component-wise distances shared by the GPs for each QoI
+  /// (null unless this GP is one of them).
+  std::shared_ptr<std::vector<MatrixXd>> sharedBuildDists2;
+
+  /// GPs for each QoI when their hyperparameters are not tied (empty if
+  /// this GP predicts all QoIs).
+  std::vector<std::shared_ptr<GaussianProcess>> qoiModels;
+
+  /// Response offset for each QoI.
+  VectorXd responseOffsets;
+
+  /// Response scale factor for each QoI.
+  VectorXd responseScaleFactors;
+
   /// Component-wise distances between prediction and build points.
   std::vector<MatrixXd> cwiseMixedDists;
 
@@ -398,7 +585,8 @@ class GaussianProcess : public Surrogate {
   /// Pivoted Cholesky factorization.
   Eigen::LDLT<MatrixXd> CholFact;
 
-  /// Flag for recomputation of the best Cholesky factorization.
+  /// Flag for recomputation of the best Cholesky factorization and the
+  /// cached prediction solves.
   bool hasBestCholFact;
 
   /// Gram matrix for the prediction points.
@@ -425,6 +613,9 @@ class GaussianProcess : public Surrogate {
   /// Large constant for polynomial coefficients upper/lower bounds.
   const double betaBound = 1.0e20;
 
+  /// Relative jitter added to the diagonal of inducingGramMatrix.
+  const double inducingJitter = 1.0e-8;
+
   /// Bool for polynomial trend (i.e. semi-parametric GP) estimation.
   bool estimateTrend;
 
@@ -440,6 +631,12 @@ class GaussianProcess : public Surrogate {
   /// Verbosity level.
   int verbosity;
 
+  /// Number of prediction points per block (0 for automatic sizing).
+  int predictionBlockSize = 0;
+
+  /// Number of threads evaluating blocks of prediction points.
+  int numPredictionThreads = 1;
+
   /// Final objective function value.
   double bestObjFunValue = std::numeric_limits<double>::max();
 
@@ -457,8 +654,6 @@ class GaussianProcess : public Surrogate {
 
 template <class Archive>
 void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
-  silence_unused_args(version);
-
   archive& boost::serialization::base_object<Surrogate>(*this);
 
   // BMA: Initial cut is aggressive, serializing most members
@@ -488,6 +683,21 @@ void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
       polyRegression.reset(new PolynomialRegression());
     archive&* polyRegression;
   }
+  if (version > 0) {
+    archive& numInducingPoints;
+    archive& inducingPoints;
+  }
+  if (version > 1) {
+    archive& numQOI;
+    archive& responseOffsets;
+    archive& responseScaleFactors;
+    archive& sharedBuildDists2;
+    archive& qoiModels;
+  } else if (Archive::is_loading::value) {
+    numQOI = 1;
+    responseOffsets = VectorXd::Constant(1, responseOffset);
+    responseScaleFactors = VectorXd::Constant(1, responseScaleFactor);
+  }
 
   // DTS: Set false so that the Cholesky factorization is recomputed after load
   hasBestCholFact = false;
@@ -500,5 +710,8 @@ void GaussianProcess::serialize(Archive& archive, const unsigned int version) {
 }  // namespace dakota
 
 BOOST_CLASS_EXPORT_KEY(dakota::surrogates::GaussianProcess)
+// Version 1 adds the inducing points of a sparse GP; version 2 adds
+// multiple QoIs
+BOOST_CLASS_VERSION(dakota::surrogates::GaussianProcess, 2)
 
 #endif  // include guard
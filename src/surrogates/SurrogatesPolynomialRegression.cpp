@@ -11,6 +11,8 @@
 
 #include "surrogates_tools.hpp"
 
+#include <algorithm>
+
 namespace dakota {
 namespace surrogates {
 
@@ -58,21 +60,149 @@ PolynomialRegression::~PolynomialRegression() {}
 
 void PolynomialRegression::compute_basis_matrix(const MatrixXd& samples,
                                                 MatrixXd& basis_matrix) const {
+  compute_basis_derivative_matrix(samples, -1, -1, basis_matrix);
+}
+
+void PolynomialRegression::compute_basis_derivative_matrix(
+    const MatrixXd& samples, int var1, int var2,
+    MatrixXd& deriv_matrix) const {
   const int num_samples = samples.rows();
-  basis_matrix = MatrixXd::Zero(num_samples, numTerms);
-  double val;
+  deriv_matrix.resize(num_samples, numTerms);
+  for_each_sample_block(num_samples, [&](int first_row, int num_rows) {
+    MatrixXd basis_block;
+    compute_basis_block(samples, first_row, num_rows, var1, var2,
+                        basis_block);
+    deriv_matrix.middleRows(first_row, num_rows) = basis_block;
+  });
+}
 
-  for (int j = 0; j < numTerms; ++j) {
-    for (int i = 0; i < num_samples; ++i) {
-      val = 1.0;
-      for (int d = 0; d < numVariables; ++d) {
-        val *= std::pow(samples(i, d), basisIndices(d, j));
+void PolynomialRegression::compute_term_exponents() {
+  const int num_vars = basisIndices.rows();
+  const int num_terms = basisIndices.cols();
+  termStarts.assign(1, 0);
+  termVars.clear();
+  termExponents.clear();
+  maxExponents.assign(num_vars, 0);
+  for (int j = 0; j < num_terms; ++j) {
+    for (int d = 0; d < num_vars; ++d) {
+      const int exponent = basisIndices(d, j);
+      if (exponent > 0) {
+        termVars.push_back(d);
+        termExponents.push_back(exponent);
+        maxExponents[d] = std::max(maxExponents[d], exponent);
       }
-      basis_matrix(i, j) = val;
     }
+    termStarts.push_back(static_cast<int>(termVars.size()));
+  }
+}
+
+void PolynomialRegression::compute_basis_block(const MatrixXd& samples,
+                                               int first_row, int num_rows,
+                                               int var1, int var2,
+                                               MatrixXd& basis_block) const {
+  const int num_vars = maxExponents.size();
+  if (samples.cols() != num_vars)
+    throw(std::runtime_error(
+        "Polynomial evaluation points have the wrong number of variables."));
+
+  /* Power table: column powers_offset[d] + p holds x_d^p for p = 1, ...,
+   * maxExponents[d] (p = 0 is implicit) */
+  std::vector<int> powers_offset(num_vars + 1, 0);
+  for (int d = 0; d < num_vars; ++d)
+    powers_offset[d + 1] = powers_offset[d] + maxExponents[d];
+  MatrixXd powers(num_rows, powers_offset[num_vars]);
+  for (int d = 0; d < num_vars; ++d) {
+    if (maxExponents[d] == 0) continue;
+    const int col = powers_offset[d];
+    powers.col(col) = samples.col(d).segment(first_row, num_rows);
+    for (int p = 1; p < maxExponents[d]; ++p)
+      powers.col(col + p) =
+          powers.col(col + p - 1).cwiseProduct(powers.col(col));
+  }
+  /* column of x_d^p, p >= 1 */
+  auto power = [&](int d, int p) {
+    return powers.col(powers_offset[d] + p - 1);
+  };
+
+  basis_block.resize(num_rows, numTerms);
+  for (int j = 0; j < numTerms; ++j) {
+    auto basis_col = basis_block.col(j);
+    /* factor from differentiation; exponents are reduced below */
+    double factor = 1.0;
+    for (int k = termStarts[j]; k < termStarts[j + 1]; ++k) {
+      const int d = termVars[k];
+      const int e = termExponents[k];
+      if (d == var1 && d == var2)
+        factor *= e * (e - 1);
+      else if (d == var1 || d == var2)
+        factor *= e;
+    }
+    /* zero if the term does not depend on the derivative variables */
+    if (factor == 0.0 ||
+        (var1 >= 0 && basisIndices(var1, j) == 0) ||
+        (var2 >= 0 && basisIndices(var2, j) == 0)) {
+      basis_col.setZero();
+      continue;
+    }
+    bool first_factor = true;
+    for (int k = termStarts[j]; k < termStarts[j + 1]; ++k) {
+      const int d = termVars[k];
+      const int e = termExponents[k] - (d == var1) - (d == var2);
+      if (e == 0) continue;
+      if (first_factor)
+        basis_col = power(d, e);
+      else
+        basis_col = basis_col.cwiseProduct(power(d, e));
+      first_factor = false;
+    }
+    if (first_factor)
+      basis_col.setConstant(factor);
+    else if (factor != 1.0)
+      basis_col *= factor;
   }
 }
 
+void PolynomialRegression::for_each_sample_block(
+    int num_samples, const std::function<void(int, int)>& block_fn) const {
+  /* by default, size the blocks for 2^16 (512 KB) basis entries */
+  int block_size = basisBlockSize;
+  if (block_size <= 0)
+    block_size = std::max(16, (1 << 16) / std::max(1, numTerms));
+  const int num_blocks = (num_samples + block_size - 1) / block_size;
+  parallel_for(num_blocks, basisThreads, [&](int b) {
+    const int first_row = b * block_size;
+    block_fn(first_row, std::min(block_size, num_samples - first_row));
+  });
+}
+
+VectorXd PolynomialRegression::basis_product(const MatrixXd& samples,
+                                             int var1, int var2,
+                                             const VectorXd& coeffs) const {
+  VectorXd result(samples.rows());
+  for_each_sample_block(samples.rows(), [&](int first_row, int num_rows) {
+    MatrixXd basis_block;
+    compute_basis_block(samples, first_row, num_rows, var1, var2,
+                        basis_block);
+    result.segment(first_row, num_rows).noalias() = basis_block * coeffs;
+  });
+  return result;
+}
+
+VectorXd PolynomialRegression::unscaled_coeffs(const int qoi) const {
+  if (qoi < 0 || qoi >= polynomialCoeffs.cols())
+    throw(std::runtime_error("Polynomial QoI index is out of range."));
+
+  /* scaled basis_j = (basis_j - offset_j) / scale_j, so the coefficients
+   * of the unscaled basis are divided by the scale factors */
+  VectorXd coeffs = polynomialCoeffs.col(qoi);
+  const VectorXd& scale_factors =
+      dataScaler.get_scaler_features_scale_factors();
+  for (int j = 0; j < coeffs.size() && j < scale_factors.size(); ++j)
+    if (std::abs(scale_factors(j)) >= util::near_zero)
+      coeffs(j) /= scale_factors(j);
+  return coeffs;
+}
+
 void PolynomialRegression::build(const MatrixXd& samples,
                                  const MatrixXd& response) {
   configOptions.validateParametersAndSetDefaults(defaultConfigOptions);
@@ -97,11 +227,14 @@ void PolynomialRegression::build(const MatrixXd& samples,
   double p_norm = configOptions.get<double>("p-norm");
   bool use_reduced_basis = configOptions.get<bool>("reduced basis");
   bool standardize_response = configOptions.get<bool>("standardize response");
+  basisBlockSize = configOptions.get<int>("basis block size");
+  basisThreads = configOptions.get<int>("basis threads");
   if (use_reduced_basis)
     compute_reduced_indices(numVariables, max_degree, basisIndices);
   else
     compute_hyperbolic_indices(numVariables, max_degree, p_norm, basisIndices);
   numTerms = basisIndices.cols();
+  compute_term_exponents();
 
   /* Standardize the response */
   MatrixXd scaled_response;
@@ -144,22 +277,18 @@ VectorXd PolynomialRegression::value(const MatrixXd& eval_points,
   silence_unused_args(qoi);
   assert(qoi == 0);
 
-  VectorXd approx_values;
-
-  /* Construct the basis matrix for the eval points */
-  MatrixXd unscaled_eval_pts_basis_matrix;
-  compute_basis_matrix(eval_points, unscaled_eval_pts_basis_matrix);
-
-  /* Scale the sample points */
-  MatrixXd scaled_eval_pts_basis_matrix;
-  dataScaler.scale_samples(unscaled_eval_pts_basis_matrix,
-                           scaled_eval_pts_basis_matrix);
+  /* Apply the basis scaling to the coefficients rather than to the
+   * basis evaluated at the eval points */
+  const VectorXd coeffs = unscaled_coeffs(0);
+  const double scaling_offset =
+      -dataScaler.get_scaler_features_offsets().dot(coeffs);
 
   /* Compute the prediction values*/
-  approx_values = scaled_eval_pts_basis_matrix * polynomialCoeffs;
-  approx_values =
-      (approx_values.array() + polynomialIntercept) * responseScaleFactor +
-      responseOffset;
+  VectorXd approx_values = basis_product(eval_points, -1, -1, coeffs);
+  approx_values = (approx_values.array() + scaling_offset +
+                   polynomialIntercept) *
+                      responseScaleFactor +
+                  responseOffset;
   return approx_values;
 }
 
@@ -172,6 +301,11 @@ void PolynomialRegression::default_options() {
                            "Type of regression solver");
   defaultConfigOptions.set("standardize response", false,
                            "Make the response zero mean and unit variance");
+  defaultConfigOptions.set("basis block size", 0,
+                           "samples per basis evaluation block (0 for "
+                           "automatic)");
+  defaultConfigOptions.set("basis threads", 1,
+                           "threads for concurrent basis evaluation blocks");
   /* Verbosity levels
      2 - maximum level: print out config options and building notification
      1 - minimum level: print out building notification
@@ -181,50 +315,19 @@ void PolynomialRegression::default_options() {
 
 MatrixXd PolynomialRegression::gradient(const MatrixXd& eval_points,
                                         const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
-
-  MatrixXd basis_indices = basisIndices.cast<double>();
-  basis_indices.transposeInPlace();
-  MatrixXd deriv_coeffs = MatrixXd::Zero(numTerms, numVariables);
-  MatrixXd diff;
-  MatrixXd::Index index;
-
-  for (int i = 0; i < numVariables; i++) {
-    MatrixXd dec_basis_indices = basis_indices;
-    dec_basis_indices.col(i).array() -= 1.0;
-    for (int k = 0; k < numTerms; k++) {
-      /* check for a -1 entries in the relevant row
-       * of the decremented basis indices array */
-      if (dec_basis_indices(k, i) > -0.5) {
-        diff = basis_indices;
-        (diff.rowwise() - dec_basis_indices.row(k))
-            .rowwise()
-            .squaredNorm()
-            .minCoeff(&index);
-        deriv_coeffs(index, i) = basis_indices(k, i) * polynomialCoeffs(k);
-      }
-    }
-  }
-
-  /* Generate the basis matrix */
-  MatrixXd unscaled_eval_pts_basis_matrix, scaled_eval_pts_basis_matrix;
-  compute_basis_matrix(eval_points, unscaled_eval_pts_basis_matrix);
-
-  /* Scale the basis matrix */
-  dataScaler.scale_samples(unscaled_eval_pts_basis_matrix,
-                           scaled_eval_pts_basis_matrix);
-
-  /* Compute the gradient */
-  return scaled_eval_pts_basis_matrix * deriv_coeffs * responseScaleFactor;
+  /* The derivatives of a polynomial with coefficients for multiple
+   * responses (e.g. the trend of a GaussianProcess) use column qoi */
+  const VectorXd coeffs = unscaled_coeffs(qoi);
+
+  MatrixXd gradient(eval_points.rows(), numVariables);
+  for (int i = 0; i < numVariables; i++)
+    gradient.col(i) = basis_product(eval_points, i, -1, coeffs);
+  return gradient * responseScaleFactor;
 }
 
 MatrixXd PolynomialRegression::hessian(const MatrixXd& eval_point,
                                        const int qoi) {
-  /* Surrogate models don't yet support multiple responses */
-  silence_unused_args(qoi);
-  assert(qoi == 0);
+  const VectorXd coeffs = unscaled_coeffs(qoi);
 
   if (eval_point.rows() != 1) {
     throw(std::runtime_error(
@@ -233,46 +336,9 @@ MatrixXd PolynomialRegression::hessian(const MatrixXd& eval_point,
   }
 
   MatrixXd hessian(numVariables, numVariables);
-  MatrixXd basis_indices = basisIndices.cast<double>();
-  basis_indices.transposeInPlace();
-  MatrixXd deriv_coeffs = VectorXd::Zero(numTerms);
-  MatrixXd dec_basis_indices, diff;
-  MatrixXd::Index index;
-
-  /* Generate the (row) basis matrix */
-  MatrixXd unscaled_eval_pts_basis_matrix, scaled_eval_pts_basis_matrix;
-  compute_basis_matrix(eval_point, unscaled_eval_pts_basis_matrix);
-
-  /* Scale the (row) basis matrix */
-  dataScaler.scale_samples(unscaled_eval_pts_basis_matrix,
-                           scaled_eval_pts_basis_matrix);
-
   for (int i = 0; i < numVariables; i++) {
     for (int j = i; j < numVariables; j++) {
-      deriv_coeffs.setZero();
-      dec_basis_indices = basis_indices;
-      dec_basis_indices.col(i).array() -= 1.0;
-      dec_basis_indices.col(j).array() -= 1.0;
-      for (int k = 0; k < numTerms; k++) {
-        /* check for any -1 entries in the relevant row
-         * of the decremented basis indices array */
-        if (!(dec_basis_indices.row(k).any() < -0.5)) {
-          diff = basis_indices;
-          (diff.rowwise() - dec_basis_indices.row(k))
-              .rowwise()
-              .squaredNorm()
-              .minCoeff(&index);
-          if (i == j) {
-            deriv_coeffs(index) = basis_indices(k, i) *
-                                  (basis_indices(k, i) - 1.0) *
-                                  polynomialCoeffs(k);
-          } else {
-            deriv_coeffs(index) =
-                basis_indices(k, i) * basis_indices(k, j) * polynomialCoeffs(k);
-          }
-        }
-      }
-      hessian(i, j) = (scaled_eval_pts_basis_matrix * deriv_coeffs)(0, 0);
+      hessian(i, j) = basis_product(eval_point, i, j, coeffs)(0);
       if (i != j) {
         hessian(j, i) = hessian(i, j);
       }
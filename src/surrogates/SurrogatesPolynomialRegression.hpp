@@ -17,6 +17,7 @@
 #include "util_data_types.hpp"
 
 #include <boost/serialization/base_object.hpp>
+#include <functional>
 
 namespace dakota {
 namespace surrogates {
@@ -31,6 +32,12 @@ namespace surrogates {
  *
  *  The DataScaler class provides the option of scaling the basis
  *  matrix.
+ *
+ *  The basis is evaluated in blocks of sample points: a table of the
+ *  powers of each variable up to its maximum exponent is computed once
+ *  per block, and each term (or its derivative) is the product of the
+ *  table columns for its nonzero exponents. Blocks may be processed
+ *  concurrently ("basis threads").
  */
 
 class PolynomialRegression : public Surrogate {
@@ -97,6 +104,21 @@ class PolynomialRegression : public Surrogate {
   void compute_basis_matrix(const MatrixXd& samples,
                             MatrixXd& basis_matrix) const;
 
+  /**
+   * \brief Constructs the matrix of first or second derivatives of the
+   * basis functions for a set of samples.
+   *
+   * \param[in] samples Matrix of sample points - (num_points by num_features).
+   * \param[in] var1 Index of the variable for the first derivative.
+   * \param[in] var2 Index of the variable for the second derivative, or -1
+   * for first derivatives.
+   * \param[out] deriv_matrix Matrix of basis function derivatives -
+   * (num_points by numTerms).
+   */
+  void compute_basis_derivative_matrix(const MatrixXd& samples, int var1,
+                                       int var2,
+                                       MatrixXd& deriv_matrix) const;
+
   /**
    * \brief Build the polynomial surrogate using specified build data.
    *
@@ -186,6 +208,42 @@ class PolynomialRegression : public Surrogate {
   /// Construct and populate the defaultConfigOptions.
   void default_options() override;
 
+  /// Compute the nonzero exponents of each term from basisIndices.
+  void compute_term_exponents();
+
+  /**
+   * \brief Evaluate the basis functions, or their derivatives, for a
+   * block of samples.
+   *
+   * \param[in] samples Matrix of sample points - (num_points by
+   * num_features).
+   * \param[in] first_row Index of the first sample in the block.
+   * \param[in] num_rows Number of samples in the block.
+   * \param[in] var1 Index of the variable for the first derivative, or -1.
+   * \param[in] var2 Index of the variable for the second derivative, or -1.
+   * \param[out] basis_block Basis evaluations - (num_rows by numTerms).
+   */
+  void compute_basis_block(const MatrixXd& samples, int first_row,
+                           int num_rows, int var1, int var2,
+                           MatrixXd& basis_block) const;
+
+  /**
+   * \brief Evaluate sum_j coeffs(j) * d(basis_j) at samples, where d
+   * is the identity or the derivative given by var1 and var2, in
+   * blocks of samples.
+   */
+  VectorXd basis_product(const MatrixXd& samples, int var1, int var2,
+                         const VectorXd& coeffs) const;
+
+  /// Call block_fn(first_row, num_rows) for each block of samples,
+  /// using basisThreads threads.
+  void for_each_sample_block(
+      int num_samples, const std::function<void(int, int)>& block_fn) const;
+
+  /// Coefficients of column qoi of polynomialCoeffs with respect to the
+  /// unscaled basis.
+  VectorXd unscaled_coeffs(const int qoi) const;
+
   /// Matrix that specifies the powers of each variable for each term
   /// in the polynomial - (numVariables by numTerms).
   MatrixXi basisIndices;
@@ -194,6 +252,19 @@ class PolynomialRegression : public Surrogate {
 
   /// Number of terms in the polynomial basis.
   int numTerms;
+  /// Start of the nonzero exponents of each term in termVars and
+  /// termExponents - (numTerms + 1).
+  std::vector<int> termStarts;
+  /// Variable index of each nonzero exponent.
+  std::vector<int> termVars;
+  /// Nonzero exponents of the terms.
+  std::vector<int> termExponents;
+  /// Maximum exponent of each variable over the terms - (numVariables).
+  std::vector<int> maxExponents;
+  /// Number of samples per block for basis evaluation (0 for automatic).
+  int basisBlockSize = 0;
+  /// Number of threads for concurrent basis evaluation blocks.
+  int basisThreads = 1;
   /// Vector of coefficients for the polynomial surrogate.
   MatrixXd polynomialCoeffs;
   /// Offset/intercept term for the polynomial surrogate.
@@ -219,6 +290,7 @@ void PolynomialRegression::serialize(Archive& archive,
   archive& polynomialCoeffs;
   archive& polynomialIntercept;
   archive& verbosity;
+  if (Archive::is_loading::value) compute_term_exponents();
   if (Archive::is_saving::value)
     writeParameterListToYamlFile(configOptions, "PolynomialRegression.yaml");
 }
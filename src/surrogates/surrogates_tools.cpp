@@ -9,6 +9,11 @@
 
 #include "surrogates_tools.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include "util_math_tools.hpp"
 
 namespace dakota {
@@ -317,5 +322,30 @@ void fd_check_hessian(Surrogate& surr, const MatrixXd& sample,
 
 // ------------------------------------------------------------
 
+void parallel_for(int num_tasks, int num_threads,
+                  const std::function<void(int)>& task_fn) {
+  std::vector<std::exception_ptr> errors(std::max(num_tasks, 0));
+  std::atomic<int> next_task(0);
+  auto run_tasks = [&]() {
+    for (int t = next_task++; t < num_tasks; t = next_task++) {
+      try {
+        task_fn(t);
+      } catch (...) {
+        errors[t] = std::current_exception();
+      }
+    }
+  };
+
+  const int num_workers = std::max(1, std::min(num_threads, num_tasks));
+  std::vector<std::thread> workers;
+  for (int w = 1; w < num_workers; w++) workers.emplace_back(run_tasks);
+  run_tasks();
+  for (auto& worker : workers) worker.join();
+  for (auto& error : errors)
+    if (error) std::rethrow_exception(error);
+}
+
+// ------------------------------------------------------------
+
 }  // namespace surrogates
 }  // namespace dakota
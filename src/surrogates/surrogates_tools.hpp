@@ -10,6 +10,8 @@
 #ifndef DAKOTA_SURROGATES_TOOLS_HPP
 #define DAKOTA_SURROGATES_TOOLS_HPP
 
+#include <functional>
+
 #include "SurrogatesBase.hpp"
 #include "util_data_types.hpp"
 
@@ -110,6 +112,21 @@ void fd_check_gradient(Surrogate& surr, const MatrixXd& sample,
 void fd_check_hessian(Surrogate& surr, const MatrixXd& sample,
                       MatrixXd& fd_error, const int num_steps = 10);
 
+/**
+ *  \brief Run task_fn(0), ..., task_fn(num_tasks - 1) on a pool of threads
+ *  (including the calling thread), which claim the tasks in order.
+ *  \param[in] num_tasks Number of tasks.
+ *  \param[in] num_threads Maximum number of threads; tasks run serially on
+ *  the calling thread if <= 1.
+ *  \param[in] task_fn Function running one task; tasks must not share
+ *  mutable state.
+ *
+ *  An exception thrown by a task is rethrown once all threads are done; if
+ *  several tasks throw, the exception of the first of them is rethrown.
+ */
+void parallel_for(int num_tasks, int num_threads,
+                  const std::function<void(int)>& task_fn);
+
 }  // namespace surrogates
 }  // namespace dakota
 
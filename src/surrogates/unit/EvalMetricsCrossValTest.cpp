@@ -126,7 +126,10 @@ TEUCHOS_UNIT_TEST(surrogates, cross_validate) {
   cv_diff = (cross_val_metrics - gold_poly_cv_metrics).norm();
   TEST_ASSERT(cv_diff < cv_norm_difftol);
 
-  /* Cross-validation with the GP */
+  /* Cross-validation with the GP; regenerated with each fold built on its own
+   * clone.  The values are unchanged from those of folds built in order on
+   * one clone, since the best likelihood of each fold improved on those of
+   * the previous folds, which then carried over to the next build. */
   VectorXd gold_gp_cv_metrics(2);
   gold_gp_cv_metrics << 0.0169657, 0.113947;
 
@@ -154,4 +157,86 @@ TEUCHOS_UNIT_TEST(surrogates, cross_validate) {
 
   cv_diff = (cross_val_metrics - gold_gp_cv_metrics).norm();
   TEST_ASSERT(cv_diff < cv_norm_difftol);
+
+  /* folds built concurrently keep the scores of the serial folds */
+  VectorXd parallel_metrics = gp_cv.cross_validate(
+      build_pts, target, metrics_names, num_folds, cv_seed, num_folds);
+  TEST_ASSERT((parallel_metrics - cross_val_metrics).norm() == 0.0);
+
+  /* candidates built concurrently keep the scores of the serial folds */
+  std::vector<ParameterList> gp_candidates(2, gp_opts);
+  MatrixXd candidate_metrics = gp_cv.cross_validate(
+      build_pts, target, metrics_names, gp_candidates, num_folds, cv_seed, 2);
+  for (int c = 0; c < 2; c++) {
+    cv_diff =
+        (candidate_metrics.row(c).transpose() - gold_gp_cv_metrics).norm();
+    TEST_ASSERT(cv_diff < cv_norm_difftol);
+  }
+}
+
+TEUCHOS_UNIT_TEST(surrogates, parallel_cross_validate) {
+  const int cv_seed = 33;
+  const int num_folds = 4;
+
+  /* True function = 0.4*x**2 + x, with noise */
+  VectorXd build_pts(14);
+  VectorXd target(14);
+
+  build_pts << 0.37454012, 0.95071431, 0.73199394, 0.59865848, 0.15601864,
+      0.15599452, 0.05808361, 0.86617615, 0.60111501, 0.70807258, 0.02058449,
+      0.96990985, 0.83244264, 0.21233911;
+
+  target << 0.38431047, 1.26568441, 0.97051622, 0.55068725, -0.00673642,
+      0.10949948, -0.04185002, 1.19770533, 0.65484831, 0.76738892, 0.16731886,
+      1.32362227, 1.11637976, 0.08789945;
+
+  StringArray metrics_names = {"mean_squared", "mean_abs", "max_abs"};
+
+  /* the folds are built concurrently on independent clones, so the thread
+   * count does not change the results */
+  ParameterList line_poly_pl("Line Test Parameters");
+  line_poly_pl.set("max degree", 1);
+  PolynomialRegression line_poly(line_poly_pl);
+  VectorXd serial_metrics = line_poly.cross_validate(
+      build_pts, target, metrics_names, num_folds, cv_seed);
+  VectorXd parallel_metrics = line_poly.cross_validate(
+      build_pts, target, metrics_names, num_folds, cv_seed, 3);
+  TEST_ASSERT((serial_metrics - parallel_metrics).norm() == 0.0);
+
+  /* a GP fold doesn't depend on the folds built before it on the same
+   * thread, whether there are fewer threads than folds or one per fold */
+  ParameterList gp_opts;
+  gp_opts.set("scaler name", "none");
+  gp_opts.set("standardize response", false);
+  gp_opts.sublist("Nugget").set("fixed nugget", 0.0);
+  gp_opts.sublist("Nugget").set("estimate nugget", true);
+  gp_opts.sublist("Nugget").sublist("Bounds").set("lower bound", 1.0e-4);
+  gp_opts.sublist("Nugget").sublist("Bounds").set("upper bound", 0.316);
+  gp_opts.set("num restarts", 20);
+  GaussianProcess gp_cv(gp_opts);
+  VectorXd gp_serial_metrics = gp_cv.cross_validate(
+      build_pts, target, metrics_names, num_folds, cv_seed);
+  for (int num_threads : {2, num_folds}) {
+    VectorXd gp_parallel_metrics = gp_cv.cross_validate(
+        build_pts, target, metrics_names, num_folds, cv_seed, num_threads);
+    TEST_ASSERT((gp_serial_metrics - gp_parallel_metrics).norm() == 0.0);
+  }
+
+  /* candidate polynomial degrees, built concurrently */
+  std::vector<ParameterList> candidates;
+  for (int degree = 1; degree <= 3; degree++) {
+    ParameterList degree_pl("Degree Test Parameters");
+    degree_pl.set("max degree", degree);
+    candidates.push_back(degree_pl);
+  }
+  MatrixXd candidate_metrics = line_poly.cross_validate(
+      build_pts, target, metrics_names, candidates, num_folds, cv_seed, 4);
+
+  std::cout << "\npolynomial degree 1-3 cross validation scores:\n"
+            << candidate_metrics << "\n\n";
+
+  TEST_EQUALITY(candidate_metrics.rows(), 3);
+  TEST_EQUALITY(candidate_metrics.cols(), 3);
+  TEST_ASSERT((candidate_metrics.row(0).transpose() - serial_metrics).norm() ==
+              0.0);
 }
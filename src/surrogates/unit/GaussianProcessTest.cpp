@@ -18,6 +18,7 @@
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/filesystem.hpp>
+#include <chrono>
 #include <fstream>
 
 // BMA TODO: Review with team for best practice
@@ -872,6 +873,235 @@ TEUCHOS_UNIT_TEST(surrogates, matern_52_gp) {
   }
 }
 
+TEUCHOS_UNIT_TEST(surrogates, gp_blocked_prediction) {
+  MatrixXd samples, length_scale_bounds, eval_pts;
+  VectorXd response, sigma_bounds;
+
+  /* build data; predict at the build points to span several blocks */
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+
+  /* tolerances for floating point comparisons */
+  const double abs_float_tol = 1.0e-8;
+  const double rel_float_tol = 1.0e-4;
+
+  for (bool estimate_trend : {false, true}) {
+    ParameterList param_list =
+        get_gp_config_options(sigma_bounds, length_scale_bounds);
+    param_list.set("num restarts", 5);
+    param_list.sublist("Nugget").set("fixed nugget", 1.0e-10);
+    param_list.sublist("Trend").set("estimate trend", estimate_trend);
+
+    /* one block (default sizing) */
+    GaussianProcess gp(param_list);
+    gp.build(samples, response);
+
+    /* blocks of 5 points evaluated by 3 threads */
+    param_list.set("prediction block size", 5);
+    param_list.set("prediction threads", 3);
+    GaussianProcess blocked_gp(param_list);
+    blocked_gp.build(samples, response);
+
+    VectorXd mean = gp.value(samples);
+    VectorXd blocked_mean = blocked_gp.value(samples);
+    TEST_ASSERT((blocked_mean - mean).cwiseAbs().maxCoeff() < abs_float_tol);
+
+    MatrixXd grad = gp.gradient(samples);
+    MatrixXd blocked_grad = blocked_gp.gradient(samples);
+    TEST_ASSERT((blocked_grad - grad).cwiseAbs().maxCoeff() < abs_float_tol);
+
+    /* the variance is the diagonal of the covariance */
+    VectorXd cov_diag = gp.covariance(eval_pts).diagonal();
+    VectorXd var = gp.variance(eval_pts);
+    VectorXd blocked_var = blocked_gp.variance(eval_pts);
+    TEST_ASSERT(relative_allclose(var, cov_diag, rel_float_tol));
+    TEST_ASSERT(relative_allclose(blocked_var, cov_diag, rel_float_tol));
+  }
+}
+
+TEUCHOS_UNIT_TEST(surrogates, sparse_gp_inducing_points) {
+  bool print_output = false;
+
+  MatrixXd samples, length_scale_bounds, eval_pts;
+  VectorXd response, sigma_bounds;
+
+  /* build and eval data */
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+
+  /* the sparse GP treats the nugget as observation noise */
+  ParameterList param_list =
+      get_gp_config_options(sigma_bounds, length_scale_bounds);
+  param_list.sublist("Nugget").set("fixed nugget", 0.0);
+  param_list.sublist("Nugget").set("estimate nugget", true);
+  param_list.sublist("Nugget").sublist("Bounds").set("lower bound", 3.17e-8);
+  param_list.sublist("Nugget").sublist("Bounds").set("upper bound", 1.0e-2);
+
+  /* dense GP reference */
+  auto start_time = std::chrono::steady_clock::now();
+  GaussianProcess dense_gp(param_list);
+  dense_gp.build(samples, response);
+  auto build_time = std::chrono::steady_clock::now() - start_time;
+  start_time = std::chrono::steady_clock::now();
+  VectorXd dense_mean = dense_gp.value(eval_pts);
+  auto predict_time = std::chrono::steady_clock::now() - start_time;
+  TEST_EQUALITY(dense_gp.get_num_inducing_points(), 0);
+
+  if (print_output) {
+    std::cout << "\ninducing points, build time (s), predict time (s), "
+              << "relative mean error\n";
+    std::cout << "dense, "
+              << std::chrono::duration<double>(build_time).count() << ", "
+              << std::chrono::duration<double>(predict_time).count()
+              << ", 0\n";
+  }
+
+  /* accuracy improves with the number of inducing points */
+  double mean_error = 1.0;
+  for (int num_inducing : {16, 32, 48}) {
+    param_list.sublist("Inducing Points")
+        .set("num inducing points", num_inducing);
+    start_time = std::chrono::steady_clock::now();
+    GaussianProcess sparse_gp(param_list);
+    sparse_gp.build(samples, response);
+    build_time = std::chrono::steady_clock::now() - start_time;
+    start_time = std::chrono::steady_clock::now();
+    VectorXd sparse_mean = sparse_gp.value(eval_pts);
+    predict_time = std::chrono::steady_clock::now() - start_time;
+    VectorXd sparse_var = sparse_gp.variance(eval_pts);
+
+    TEST_EQUALITY(sparse_gp.get_num_inducing_points(), num_inducing);
+    TEST_ASSERT(sparse_var.allFinite());
+    TEST_ASSERT(sparse_var.minCoeff() >= 0.0);
+
+    mean_error = (sparse_mean - dense_mean).norm() / dense_mean.norm();
+    if (print_output)
+      std::cout << num_inducing << ", "
+                << std::chrono::duration<double>(build_time).count() << ", "
+                << std::chrono::duration<double>(predict_time).count()
+                << ", " << mean_error << "\n";
+  }
+  TEST_ASSERT(mean_error < 5.0e-2);
+
+  /* derivatives and save/load of the last sparse GP */
+  GaussianProcess sparse_gp(param_list);
+  sparse_gp.build(samples, response);
+  auto eval_point = eval_pts.row(1);
+  MatrixXd grad_fd_error;
+  fd_check_gradient(sparse_gp, eval_point, grad_fd_error);
+  for (int i = 0; i < 2; i++)
+    TEST_ASSERT(log10(grad_fd_error.col(i)(0) /
+                      grad_fd_error.col(i).minCoeff()) > 6.0);
+
+  std::string filename("sparse_gp_test.surr");
+  for (bool binary : {true, false}) {
+    boost::filesystem::remove(filename);
+    Surrogate::save(sparse_gp, filename, binary);
+    GaussianProcess gp_loaded;
+    Surrogate::load(filename, binary, gp_loaded);
+    TEST_EQUALITY(gp_loaded.get_num_inducing_points(), 48);
+    TEST_ASSERT(matrix_equals(sparse_gp.value(eval_pts),
+                              gp_loaded.value(eval_pts), 1.0e-16));
+    TEST_ASSERT(matrix_equals(sparse_gp.variance(eval_pts),
+                              gp_loaded.variance(eval_pts), 1.0e-16));
+  }
+
+  /* no fewer inducing points than samples gives the dense GP */
+  param_list.sublist("Inducing Points").set("num inducing points", 64);
+  GaussianProcess full_gp(param_list);
+  full_gp.build(samples, response);
+  TEST_EQUALITY(full_gp.get_num_inducing_points(), 0);
+  TEST_ASSERT(matrix_equals(full_gp.value(eval_pts), dense_mean, 1.0e-12));
+}
+
+TEUCHOS_UNIT_TEST(surrogates, multi_output_gp) {
+  MatrixXd samples, length_scale_bounds, eval_pts;
+  VectorXd response, sigma_bounds;
+
+  /* build and eval data, with an affine transformation of the response and
+   * a second function as further QoIs */
+  get_2D_gp_test_data(samples, response, eval_pts);
+  get_gp_hyperparameter_bounds(2, sigma_bounds, length_scale_bounds);
+  MatrixXd responses(response.size(), 3);
+  responses.col(0) = response;
+  responses.col(1) = 2.0 * response.array() + 1.0;
+  responses.col(2) = (samples.col(0) - samples.col(1)).array().sin();
+
+  ParameterList param_list =
+      get_gp_config_options(sigma_bounds, length_scale_bounds);
+  param_list.set("standardize response", true);
+  param_list.sublist("Trend").set("estimate trend", true);
+  param_list.sublist("Trend").sublist("Options").set("max degree", 1);
+
+  /* untied hyperparameters, estimated concurrently, reproduce a GP per QoI */
+  param_list.sublist("Multiple Outputs").set("num threads", 2);
+  GaussianProcess untied_gp(param_list);
+  untied_gp.build(samples, responses);
+  for (int q = 0; q < 3; q++) {
+    GaussianProcess qoi_gp(param_list);
+    qoi_gp.build(samples, responses.col(q));
+    TEST_ASSERT(matrix_equals(untied_gp.value(eval_pts, q),
+                              qoi_gp.value(eval_pts), 1.0e-12));
+    TEST_ASSERT(matrix_equals(untied_gp.variance(eval_pts, q),
+                              qoi_gp.variance(eval_pts), 1.0e-12));
+    TEST_ASSERT(matrix_equals(untied_gp.gradient(eval_pts, q),
+                              qoi_gp.gradient(eval_pts), 1.0e-12));
+    TEST_ASSERT(matrix_equals(untied_gp.qoi_model(q)->value(eval_pts),
+                              qoi_gp.value(eval_pts), 1.0e-12));
+    const StringArray mnames = {"root_mean_squared", "max_abs"};
+    TEST_ASSERT(matrix_equals(
+        untied_gp.evaluate_metrics(mnames, samples, responses.col(q), q),
+        qoi_gp.evaluate_metrics(mnames, samples, responses.col(q)),
+        1.0e-12));
+  }
+  TEST_THROW(untied_gp.value(eval_pts, 3), std::runtime_error);
+  TEST_THROW(untied_gp.qoi_model(3), std::runtime_error);
+
+  /* tied hyperparameters: the standardized responses of QoIs 0 and 1 are
+   * the same, so their predictions are related by the same transformation */
+  param_list.sublist("Trend").set("estimate trend", false);
+  param_list.sublist("Multiple Outputs").set("tie hyperparameters", true);
+  GaussianProcess tied_gp(param_list);
+  tied_gp.build(samples, responses);
+  VectorXd mean_0 = tied_gp.value(eval_pts, 0);
+  VectorXd variance_0 = tied_gp.variance(eval_pts, 0);
+  TEST_ASSERT(matrix_equals(tied_gp.value(eval_pts, 1),
+                            (2.0 * mean_0.array() + 1.0).matrix(), 1.0e-10));
+  TEST_ASSERT(matrix_equals(tied_gp.variance(eval_pts, 1), 4.0 * variance_0,
+                            1.0e-10));
+  TEST_ASSERT(!tied_gp.qoi_model(1));
+  MatrixXd grad_fd_error;
+  fd_check_gradient(tied_gp, eval_pts.row(1), grad_fd_error);
+  for (int i = 0; i < 2; i++)
+    TEST_ASSERT(log10(grad_fd_error.col(i)(0) /
+                      grad_fd_error.col(i).minCoeff()) > 6.0);
+
+  /* save/load */
+  std::string filename("multi_output_gp_test.surr");
+  for (bool binary : {true, false}) {
+    for (GaussianProcess* gp : {&untied_gp, &tied_gp}) {
+      boost::filesystem::remove(filename);
+      Surrogate::save(*gp, filename, binary);
+      GaussianProcess gp_loaded;
+      Surrogate::load(filename, binary, gp_loaded);
+      for (int q = 0; q < 3; q++) {
+        TEST_ASSERT(matrix_equals(gp->value(eval_pts, q),
+                                  gp_loaded.value(eval_pts, q), 1.0e-16));
+        TEST_ASSERT(matrix_equals(gp->variance(eval_pts, q),
+                                  gp_loaded.variance(eval_pts, q), 1.0e-16));
+      }
+    }
+  }
+
+    /* the GP of a single QoI is saved on its own */
+    boost::filesystem::remove(filename);
+    Surrogate::save(*untied_gp.qoi_model(2), filename, binary);
+    GaussianProcess qoi_gp_loaded;
+    Surrogate::load(filename, binary, qoi_gp_loaded);
+    TEST_ASSERT(matrix_equals(untied_gp.value(eval_pts, 2),
+                              qoi_gp_loaded.value(eval_pts), 1.0e-16));
+}
+
 TEUCHOS_UNIT_TEST(surrogates, gp_read_from_parameterlist) {
   std::string test_parameterlist_file =
       "gp_test_data/GP_test_parameterlist.yaml";
@@ -328,6 +328,44 @@ void PolynomialRegressionSurrogate_gradient_and_hessian() {
   BOOST_CHECK(matrix_equals(gold_hessian, hessian, 1.0e-10));
 }
 
+void PolynomialRegressionSurrogate_scaled_threaded_basis() {
+  int num_vars = 2, num_samples = 20, degree = 3;
+
+  MatrixXd samples, responses;
+  get_samples(num_vars, num_samples, samples);
+  cubic_bivariate_function(samples, responses);
+
+  Teuchos::ParameterList config_options("Polynomial Test Parameters");
+  config_options.set("max degree", degree);
+  config_options.set("scaler type", "standardization");
+  // small blocks so that several threads share the build samples
+  config_options.set("basis block size", 3);
+  config_options.set("basis threads", 4);
+
+  PolynomialRegression pr(samples, responses, config_options);
+
+  // threaded, blocked basis matches the serial one
+  MatrixXd threaded_basis, serial_basis;
+  pr.compute_basis_matrix(samples, threaded_basis);
+  Teuchos::ParameterList serial_options("Polynomial Test Parameters");
+  serial_options.set("max degree", degree);
+  serial_options.set("scaler type", "standardization");
+  PolynomialRegression pr_serial(samples, responses, serial_options);
+  pr_serial.compute_basis_matrix(samples, serial_basis);
+  BOOST_CHECK(matrix_equals(serial_basis, threaded_basis, 1.0e-14));
+
+  // derivatives account for the scaling of the basis
+  MatrixXd gradient, hessian;
+  gradient = pr.gradient(samples.topRows(2));
+  hessian = pr.hessian(samples.topRows(1));
+
+  MatrixXd gold_gradient = cubic_bivariate_withcross_gradient(samples.topRows(2));
+  MatrixXd gold_hessian = cubic_bivariate_withcross_hessian(samples.topRows(1));
+
+  BOOST_CHECK(matrix_equals(gold_gradient, gradient, 1.0e-9));
+  BOOST_CHECK(matrix_equals(gold_hessian, hessian, 1.0e-9));
+}
+
 void PolynomialRegressionSurrogate_parameter_list_import() {
   int num_vars = 2, num_samples = 20, degree = 3;
 
@@ -428,6 +466,7 @@ int test_main(int argc, char* argv[])  // note the name!
   // Multivariate tests
   PolynomialRegressionSurrogate_multivariate_regression_builder();
   PolynomialRegressionSurrogate_gradient_and_hessian();
+  PolynomialRegressionSurrogate_scaled_threaded_basis();
 
   // ParameterList import test
   PolynomialRegressionSurrogate_parameter_list_import();
@@ -147,3 +147,34 @@ TEUCHOS_UNIT_TEST(surrogates, reduced_indices) {
 }
 
 // ------------------------------------------------------------
+
+TEUCHOS_UNIT_TEST(surrogates, parallel_for) {
+  const int num_tasks = 37;
+  for (int num_threads = 0; num_threads <= 4; num_threads++) {
+    /* each task runs exactly once */
+    VectorXi task_counts = VectorXi::Zero(num_tasks);
+    parallel_for(num_tasks, num_threads, [&](int t) { task_counts(t)++; });
+    TEST_ASSERT(task_counts == VectorXi::Ones(num_tasks));
+
+    /* the remaining tasks complete and the first error is rethrown on the
+     * calling thread */
+    task_counts.setZero();
+    std::string error_msg;
+    try {
+      parallel_for(num_tasks, num_threads, [&](int t) {
+        task_counts(t)++;
+        if (t % 10 == 3)
+          throw std::runtime_error("task " + std::to_string(t));
+      });
+    } catch (const std::runtime_error& e) {
+      error_msg = e.what();
+    }
+    TEST_EQUALITY(error_msg, "task 3");
+    TEST_ASSERT(task_counts == VectorXi::Ones(num_tasks));
+  }
+
+  /* no tasks */
+  parallel_for(0, 4, [](int) { throw std::runtime_error("no task"); });
+}
+
+// ------------------------------------------------------------
@@ -0,0 +1,153 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+
+/** \file evaluation_pool.cpp Test recycling of deep evaluation copies. */
+
+#include "EvaluationPool.hpp"
+#include <algorithm>
+
+#define BOOST_TEST_MODULE dakota_evaluation_pool
+#include <boost/test/included/unit_test.hpp>
+
+
+Dakota::Response make_response(double val)
+{
+  size_t num_derivs = 2, num_fns = 3;
+  Dakota::ActiveSet as(num_fns, num_derivs);
+  Dakota::SharedResponseData srd(as);
+  Dakota::Response resp(srd);
+  for (size_t i=0; i<num_fns; ++i)
+    resp.function_value(val + i, i);
+  return resp;
+}
+
+
+BOOST_AUTO_TEST_CASE(test_response_copy_reuses_free_letter)
+{
+  Dakota::Response source = make_response(1.);
+  Dakota::Response target = source.copy();
+  const double* target_storage = target.function_values().values();
+
+  source.function_value(10., 0);
+  source.copy(target);
+  // sole reference with common shared data: storage is reused
+  BOOST_CHECK(target.function_values().values() == target_storage);
+  BOOST_CHECK_EQUAL(target.function_value(0), 10.);
+
+  Dakota::Response holder = target; // shallow: letter now shared
+  source.function_value(20., 0);
+  source.copy(target);
+  // a shared letter must not change underneath its other handle
+  BOOST_CHECK(target.function_values().values() != target_storage);
+  BOOST_CHECK_EQUAL(target.function_value(0), 20.);
+  BOOST_CHECK_EQUAL(holder.function_value(0), 10.);
+
+  // differing shared data falls back to a fresh copy
+  Dakota::Response other = make_response(5.);
+  Dakota::Response other_target = other.copy();
+  source.copy(other_target);
+  BOOST_CHECK_EQUAL(other_target.function_value(0), 20.);
+  BOOST_CHECK_EQUAL(other.function_value(0), 5.);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_pool_recycles_across_batches)
+{
+  Dakota::EvaluationPool pool;
+  Dakota::Response source = make_response(0.);
+  const size_t batch_size = 4;
+
+  std::vector<const double*> batch_storage;
+  std::vector<Dakota::Response> retained, kept;
+  // batch 0 fills the first generation; batch 1 the second, while
+  // batch 0 is still referenced
+  for (size_t b=0; b<2; ++b) {
+    for (size_t i=0; i<batch_size; ++i) {
+      source.function_value(double(b*batch_size + i), 0);
+      retained.push_back(pool.copy(source));
+      if (b == 0)
+	batch_storage.push_back(retained.back().function_values().values());
+    }
+    if (b == 1) {
+      // release batch 0 prior to synchronizing batch 1, but retain one
+      // of its responses
+      kept.push_back(retained[1]);
+      retained.erase(retained.begin(), retained.begin() + batch_size);
+    }
+    pool.next_batch();
+  }
+
+  // the retained letter is relinquished; the others are recycled in order
+  std::vector<const double*> recycled_storage;
+  for (size_t i=0; i<batch_size; ++i)
+    if (i != 1)
+      recycled_storage.push_back(batch_storage[i]);
+  for (size_t i=0; i<batch_size; ++i) {
+    source.function_value(100. + i, 0);
+    Dakota::Response copied = pool.copy(source);
+    BOOST_CHECK_EQUAL(copied.function_value(0), 100. + i);
+    if (i < recycled_storage.size())
+      BOOST_CHECK(copied.function_values().values() == recycled_storage[i]);
+    else
+      BOOST_CHECK(std::find(batch_storage.begin(), batch_storage.end(),
+			    copied.function_values().values())
+		  == batch_storage.end());
+  }
+  BOOST_CHECK_EQUAL(kept[0].function_value(0), 1.);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_pool_recycles_with_evaluation_cache)
+{
+  Dakota::EvaluationPool pool;
+  Dakota::Response source = make_response(0.);
+  const size_t num_new = 3, num_dupl = 2, num_batches = 8;
+
+  // new evaluations are copied outside the pool since the cache retains
+  // them; duplicate responses are only referenced until the following
+  // batch is synchronized
+  std::vector<Dakota::Response> cache;
+  std::vector<std::vector<Dakota::Response> > transient(num_batches);
+  std::vector<Dakota::Real> cached_vals;
+  std::vector<std::vector<const double*> > storage;
+  for (size_t b=0; b<num_batches; ++b) {
+    if (b) transient[b-1].clear(); // response map of the previous batch
+    std::vector<const double*> batch_storage;
+    for (size_t i=0; i<num_new+num_dupl; ++i) {
+      Dakota::Real val = 10.*b + i;
+      source.function_value(val, 0);
+      Dakota::Response copied = (i < num_new) ? source.copy() :
+	pool.copy(source);
+      BOOST_CHECK_EQUAL(copied.function_value(0), val);
+      batch_storage.push_back(copied.function_values().values());
+      if (i < num_new)
+	{ cache.push_back(copied); cached_vals.push_back(val); }
+      else
+	transient[b].push_back(copied);
+    }
+    pool.next_batch();
+
+    // the duplicate copies of batch b-2 are recycled in batch b
+    if (b >= 2)
+      for (size_t i=0; i<num_dupl; ++i) {
+	const double* dupl_storage = storage[b-2][num_new + i];
+	BOOST_CHECK(std::find(batch_storage.begin(), batch_storage.end(),
+			      dupl_storage) != batch_storage.end());
+      }
+    storage.push_back(batch_storage);
+
+    // the pool holds the duplicate copies of two batches only
+    BOOST_CHECK(pool.size() <= 2*num_dupl);
+  }
+
+  // cached evaluations are never overwritten
+  for (size_t i=0; i<cache.size(); ++i)
+    BOOST_CHECK_EQUAL(cache[i].function_value(0), cached_vals[i]);
+}
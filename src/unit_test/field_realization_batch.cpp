@@ -0,0 +1,77 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+
+/** \file field_realization_batch.cpp Test round trip of random field
+    realizations through a batch file. */
+
+#include "RandomFieldModel.hpp"
+#include "WorkdirHelper.hpp"
+
+#define BOOST_TEST_MODULE dakota_field_realization_batch
+#include <boost/test/included/unit_test.hpp>
+
+
+BOOST_AUTO_TEST_CASE(test_field_realization_read_back)
+{
+  int num_fns = 5, num_real = 3;
+  Dakota::RealMatrix field_batch(num_fns, num_real, false);
+  for (int j=0; j<num_real; ++j)
+    for (int i=0; i<num_fns; ++i)
+      field_batch(i,j) = 10.*j + 0.5*i;
+  Dakota::IntArray eval_ids;
+  eval_ids.push_back(7); eval_ids.push_back(8); eval_ids.push_back(11);
+
+  Dakota::String batch_filename
+    = Dakota::WorkdirHelper::system_tmp_file("dakota_rf_test").string();
+  Dakota::RandomFieldModel::
+    write_field_batch(batch_filename, field_batch, eval_ids);
+
+  // each column is recovered by the (file, column) pair passed to the
+  // simulation as analysis components
+  for (int j=0; j<num_real; ++j) {
+    Dakota::RealVector field;
+    int eval_id = Dakota::RandomFieldModel::
+      read_field_realization(batch_filename, j, field);
+    BOOST_CHECK_EQUAL(eval_id, eval_ids[j]);
+    BOOST_REQUIRE_EQUAL(field.length(), num_fns);
+    for (int i=0; i<num_fns; ++i)
+      BOOST_CHECK_EQUAL(field[i], field_batch(i,j));
+  }
+
+  Dakota::WorkdirHelper::recursive_remove(batch_filename,
+					  Dakota::FILEOP_SILENT);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_field_realization_strided_batch)
+{
+  // a view into a larger matrix is written column by column
+  int num_fns = 4, num_real = 2;
+  Dakota::RealMatrix full(num_fns + 3, num_real);
+  for (int j=0; j<num_real; ++j)
+    for (int i=0; i<num_fns+3; ++i)
+      full(i,j) = 100.*j + i;
+  Dakota::RealMatrix field_batch(Teuchos::View, full, num_fns, num_real);
+  Dakota::IntArray eval_ids(num_real, 1);
+
+  Dakota::String batch_filename
+    = Dakota::WorkdirHelper::system_tmp_file("dakota_rf_test").string();
+  Dakota::RandomFieldModel::
+    write_field_batch(batch_filename, field_batch, eval_ids);
+
+  Dakota::RealVector field;
+  Dakota::RandomFieldModel::read_field_realization(batch_filename, 1, field);
+  BOOST_REQUIRE_EQUAL(field.length(), num_fns);
+  for (int i=0; i<num_fns; ++i)
+    BOOST_CHECK_EQUAL(field[i], full(i,1));
+
+  Dakota::WorkdirHelper::recursive_remove(batch_filename,
+					  Dakota::FILEOP_SILENT);
+}
@@ -0,0 +1,92 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+
+/** \file input_template.cpp Test compiled pyprepro-style input templates. */
+
+#include "InputTemplate.hpp"
+#include <sstream>
+
+#define BOOST_TEST_MODULE dakota_input_template
+#include <boost/test/included/unit_test.hpp>
+
+
+namespace {
+
+Dakota::TemplateEnv test_params()
+{
+  Dakota::TemplateEnv params;
+  params["x1"] = Dakota::TemplateValue(1.5);
+  params["x2"] = Dakota::TemplateValue(-2.);
+  params["mat"] = Dakota::TemplateValue(Dakota::String("steel"));
+  return params;
+}
+
+std::string render(const std::string& text)
+{
+  Dakota::InputTemplate input_template;
+  input_template.compile(text, "test");
+  std::ostringstream rendered;
+  input_template.render(test_params(), rendered);
+  return rendered.str();
+}
+
+}
+
+
+BOOST_AUTO_TEST_CASE(test_substitution_and_expressions)
+{
+  BOOST_CHECK_EQUAL(render("x = {x1}\n"), "x = 1.5\n");
+  BOOST_CHECK_EQUAL(render("{x1 + 2*x2} {1/3}"), "-2.5 0.3333333333");
+  // Python precedence and semantics
+  BOOST_CHECK_EQUAL(render("{2**3**2} {-2**2} {7//2} {-7 % 3}"), "512 -4 3 2");
+  BOOST_CHECK_EQUAL(render("{sqrt(16)} {max(1, x1, 0)} {round(2.5)} {pi}"),
+		    "4 1.5 2 3.141592654");
+  BOOST_CHECK_EQUAL(render("{mat + '_1'} {'%6.3f' % x1} {'%d' % 2.7}"),
+		    "steel_1  1.500 2");
+}
+
+
+BOOST_AUTO_TEST_CASE(test_assignments)
+{
+  // inline assignments output the value
+  BOOST_CHECK_EQUAL(render("{p = 10}\n{p = p+1},{p += 1}\n{p}"),
+		    "10\n11,12\n12");
+  // parameters are immutable, so assignments only provide defaults
+  BOOST_CHECK_EQUAL(render("{x1 = 7} {x3 = 7}"), "1.5 7");
+  // code lines and blocks are not output
+  BOOST_CHECK_EQUAL(render("% y = 2*x1\n  {% z = y + 1 %}\ny = {y}, z = {z}\n"),
+		    "y = 3, z = 4\n");
+}
+
+
+BOOST_AUTO_TEST_CASE(test_escapes)
+{
+  BOOST_CHECK_EQUAL(render("\\{ x1 \\} \\\\{x1}"), "{ x1 } \\{x1}");
+  BOOST_CHECK_EQUAL(render("{s = \"a}b\"}"), "a}b");
+  BOOST_CHECK_EQUAL(render("no substitutions\n"), "no substitutions\n");
+}
+
+
+BOOST_AUTO_TEST_CASE(test_variable_names)
+{
+  // descriptors are keyed as pyprepro names them
+  BOOST_CHECK_EQUAL(Dakota::InputTemplate::variable_name("x:1"), "x_1");
+  BOOST_CHECK_EQUAL(Dakota::InputTemplate::variable_name("2d"), "i2d");
+  BOOST_CHECK_EQUAL(Dakota::InputTemplate::variable_name("x1"), "x1");
+
+  Dakota::TemplateEnv params;
+  params[Dakota::InputTemplate::variable_name("x:1")]
+    = Dakota::TemplateValue(3.);
+  Dakota::InputTemplate input_template;
+  input_template.compile("{x_1 + 1}", "test");
+  std::ostringstream rendered;
+  input_template.render(params, rendered);
+  BOOST_CHECK_EQUAL(rendered.str(), "4");
+}
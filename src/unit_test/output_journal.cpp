@@ -0,0 +1,115 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+
+/** \file output_journal.cpp Test that journaled tabular output matches
+    synchronously written output. */
+
+#include "OutputManager.hpp"
+#include "DakotaVariables.hpp"
+#include "DakotaResponse.hpp"
+#include "dakota_tabular_io.hpp"
+#include "WorkdirHelper.hpp"
+
+#define BOOST_TEST_MODULE dakota_output_journal
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+
+using namespace Dakota;
+
+
+String file_contents(const String& filename)
+{
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  std::ostringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+
+/// write tabular rows for evaluations [first, last] to s
+void write_rows(std::ostream& s, int first, int last)
+{
+  SizetArray vc_totals(NUM_VC_TOTALS);
+  vc_totals[0] = 2;
+  std::pair<short, short> view(MIXED_ALL, EMPTY_VIEW);
+  SharedVariablesData svd(view, vc_totals);
+  Variables vars(svd);
+  ActiveSet as(3, 2);
+  SharedResponseData srd(as);
+  Response resp(srd);
+
+  unsigned short format = TABULAR_ANNOTATED;
+  for (int eval_id=first; eval_id<=last; ++eval_id) {
+    vars.continuous_variable(0.1*eval_id, 0);
+    vars.continuous_variable(-1./eval_id, 1);
+    for (size_t i=0; i<3; ++i)
+      resp.function_value(eval_id + 0.25*i, i);
+    TabularIO::write_leading_columns(s, eval_id, "JOURNAL_IFACE", format);
+    TabularIO::write_data_tabular(s, vars);
+    TabularIO::write_data_tabular(s, resp); // ends the row with std::endl
+  }
+}
+
+
+BOOST_AUTO_TEST_CASE(test_journal_matches_synchronous_tabular)
+{
+  String sync_filename
+    = WorkdirHelper::system_tmp_file("dakota_journal_sync").string();
+  String jrnl_filename
+    = WorkdirHelper::system_tmp_file("dakota_journal_grp").string();
+
+  std::ofstream sync_stream, jrnl_stream;
+  TabularIO::open_file(sync_stream, sync_filename, "output_journal test");
+  TabularIO::open_file(jrnl_stream, jrnl_filename, "output_journal test");
+  // bind as in OutputManager::open_tabular_datastream()
+  std::unique_ptr<OutputJournal>
+    journal(new OutputJournal(jrnl_stream.rdbuf(), 4, 0.01));
+  jrnl_stream.std::ostream::rdbuf(journal.get());
+
+  write_rows(sync_stream, 1, 10);
+  write_rows(jrnl_stream, 1, 10);
+
+  // committed output is complete rows identical to the synchronous file
+  journal->commit();
+  sync_stream.flush();
+  BOOST_CHECK_EQUAL(file_contents(jrnl_filename), file_contents(sync_filename));
+
+  // records written while suspended (e.g., in a forked job) are written
+  // through, in order with those before and after
+  journal->suspend();
+  write_rows(sync_stream, 11, 13);
+  write_rows(jrnl_stream, 11, 13);
+  sync_stream.flush();
+  BOOST_CHECK_EQUAL(file_contents(jrnl_filename), file_contents(sync_filename));
+  journal->resume();
+
+  write_rows(sync_stream, 14, 57);
+  write_rows(jrnl_stream, 14, 57);
+  // a partial row is committed on close
+  TabularIO::write_leading_columns(sync_stream, 58, "JOURNAL_IFACE",
+				   TABULAR_ANNOTATED);
+  TabularIO::write_leading_columns(jrnl_stream, 58, "JOURNAL_IFACE",
+				   TABULAR_ANNOTATED);
+
+  // close as in OutputManager::close_tabular_journal()
+  journal->close();
+  jrnl_stream.std::ostream::rdbuf(jrnl_stream.rdbuf());
+  journal.reset();
+  TabularIO::close_file(jrnl_stream, jrnl_filename, "output_journal test");
+  TabularIO::close_file(sync_stream, sync_filename, "output_journal test");
+
+  String sync_contents = file_contents(sync_filename);
+  BOOST_CHECK(!sync_contents.empty());
+  BOOST_CHECK_EQUAL(file_contents(jrnl_filename), sync_contents);
+
+  WorkdirHelper::recursive_remove(sync_filename, FILEOP_SILENT);
+  WorkdirHelper::recursive_remove(jrnl_filename, FILEOP_SILENT);
+}
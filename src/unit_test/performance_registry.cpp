@@ -0,0 +1,113 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+#define BOOST_TEST_MODULE dakota_performance_registry
+#include <boost/test/included/unit_test.hpp>
+
+#include "PerformanceRegistry.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+//____________________________________________________________________________//
+
+BOOST_AUTO_TEST_CASE( test_inactive_registry_is_silent )
+{
+  Dakota::PerformanceRegistry registry;
+  registry.begin_span("map", "interface");
+  registry.increment("calls");
+  registry.end_span();
+
+  std::ostringstream summary;
+  registry.print_summary(summary);
+  BOOST_CHECK(!registry.active());
+  BOOST_CHECK(summary.str().empty());
+}
+
+//____________________________________________________________________________//
+
+BOOST_AUTO_TEST_CASE( test_nested_spans_aggregate )
+{
+  Dakota::PerformanceRegistry registry;
+  registry.activate();
+
+  // two evaluations under one iterator; the dynamic name is merged with
+  // the identical literal name at the same depth
+  registry.begin_span(std::string("sampling"), "iterator");
+  for (int i=0; i<2; ++i) {
+    registry.begin_span("map", "interface");
+    registry.begin_span("read_results", "file_io");
+    registry.end_span();
+    registry.end_span();
+  }
+  registry.begin_span("map", "interface");
+  registry.end_span();
+  registry.end_span();
+  registry.increment("interface.duplicate_evaluations", 2);
+  // unbalanced end_span() must not close the root
+  registry.end_span();
+
+  std::ostringstream summary;
+  registry.print_summary(summary);
+  const std::string s = summary.str();
+
+  // each span appears once, with nested spans indented below their parent
+  BOOST_CHECK(s.find("  sampling\n") != std::string::npos);
+  BOOST_CHECK(s.find("    map\n") != std::string::npos);
+  BOOST_CHECK(s.find("      read_results\n") != std::string::npos);
+  BOOST_CHECK(s.find("map", s.find("map") + 1) == std::string::npos);
+
+  std::istringstream lines(s);
+  std::string line;
+  int map_count = -1, read_count = -1;
+  while (std::getline(lines, line)) {
+    std::istringstream fields(line);
+    int count; double total, mean, max; std::string name;
+    if (fields >> count >> total >> mean >> max >> name) {
+      if (name == "map")          map_count  = count;
+      if (name == "read_results") read_count = count;
+    }
+  }
+  BOOST_CHECK_EQUAL(map_count, 3);
+  BOOST_CHECK_EQUAL(read_count, 2);
+  BOOST_CHECK(s.find("2  interface.duplicate_evaluations") != std::string::npos);
+}
+
+//____________________________________________________________________________//
+
+BOOST_AUTO_TEST_CASE( test_chrome_trace_output )
+{
+  const std::string trace_file("performance_registry_trace.json");
+  Dakota::PerformanceRegistry registry;
+  registry.activate(trace_file);
+
+  registry.begin_span(std::string("quoted \"name\""), "iterator");
+  registry.begin_span("simulation", "evaluation");
+  registry.end_span();
+  registry.end_span();
+  registry.increment("calls");
+  registry.write_trace();
+
+  std::ifstream trace_fs(trace_file.c_str());
+  BOOST_REQUIRE(trace_fs.good());
+  std::stringstream trace;
+  trace << trace_fs.rdbuf();
+  const std::string t = trace.str();
+
+  BOOST_CHECK(t.find("\"traceEvents\":[") != std::string::npos);
+  BOOST_CHECK(t.find("\"name\":\"quoted \\\"name\\\"\"") != std::string::npos);
+  BOOST_CHECK(t.find("\"name\":\"simulation\",\"cat\":\"evaluation\","
+		     "\"ph\":\"X\"") != std::string::npos);
+  BOOST_CHECK(t.find("\"ph\":\"C\"") != std::string::npos);
+  BOOST_CHECK(t.find("\"calls\":1") != std::string::npos);
+  BOOST_CHECK(t.find("\"dropped_events\":0") != std::string::npos);
+  // inner span completes first, so it is recorded first
+  BOOST_CHECK(t.find("simulation") < t.find("quoted"));
+}
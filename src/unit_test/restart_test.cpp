@@ -335,3 +335,47 @@ TEUCHOS_UNIT_TEST(io, restart_read_newfile)
 
   boost::filesystem::remove(rst_filename);
 }
+
+
+// Verify journaled (group-commit) writes yield complete records, both
+// after an explicit commit and at destruction
+TEUCHOS_UNIT_TEST(io, restart_journaled)
+{
+  std::string rst_filename("journaled.rst");
+  boost::filesystem::remove(rst_filename);
+
+  const int num_evals = 10;
+  PRPArray prps_out, prps_in;
+  // scope to force destruction of writer and close the file
+  {
+    // commit interval long enough that only count-triggered or explicit
+    // commits occur during the test
+    RestartWriter rst_writer(rst_filename, true, 4, 60.);
+    prps_out = generate_and_write_prps(num_evals, rst_writer);
+    rst_writer.flush();
+    rst_writer.commit();
+
+    std::ifstream ifs(rst_filename, std::ios::binary);
+    boost::archive::binary_iarchive inarch(ifs);
+    RestartVersion rst_ver;
+    inarch & rst_ver;
+    prps_in = read_prps(num_evals, inarch);
+    TEST_EQUALITY(prps_in, prps_out);
+
+    // records after the last commit are written at destruction
+    prps_out.push_back(generate_and_write_prps(1, rst_writer)[0]);
+    rst_writer.flush();
+  }
+
+  // scope to destruct ifstream so file can be removed
+  {
+    std::ifstream ifs(rst_filename, std::ios::binary);
+    boost::archive::binary_iarchive inarch(ifs);
+    RestartVersion rst_ver;
+    inarch & rst_ver;
+    prps_in = read_prps(num_evals + 1, inarch);
+    TEST_EQUALITY(prps_in, prps_out);
+  }
+
+  boost::filesystem::remove(rst_filename);
+}
@@ -0,0 +1,119 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+
+/** \file results_file_watcher.cpp Test event-driven results file detection. */
+
+#include "ResultsFileWatcher.hpp"
+#include <boost/filesystem/operations.hpp>
+#include <chrono>
+#include <fstream>
+#ifndef _WIN32
+  #include <unistd.h>
+#endif
+
+#define BOOST_TEST_MODULE dakota_results_file_watcher
+#include <boost/test/included/unit_test.hpp>
+
+
+namespace {
+
+/// fresh scratch directory for a test case
+bfs::path scratch_dir(const std::string& name)
+{
+  bfs::path dir = bfs::current_path() / ("results_file_watcher_" + name);
+  bfs::remove_all(dir);
+  bfs::create_directory(dir);
+  return dir;
+}
+
+}
+
+
+BOOST_AUTO_TEST_CASE(test_close_after_write)
+{
+  Dakota::ResultsFileWatcher watcher;
+  if (!watcher.active())
+    return; // no events on this platform; existence testing is used
+
+  bfs::path dir = scratch_dir("close");
+  bfs::path results = dir / "results.out.1", other = dir / "results.out.2";
+  if (!watcher.watch(results))
+    return; // e.g., network file system
+  BOOST_CHECK(watcher.watched(results));
+  BOOST_CHECK(watcher.watch(other));
+  BOOST_CHECK(!watcher.completed(results));
+
+  {
+    std::ofstream s(results.string().c_str());
+    s << "1.0 f" << std::endl; // flushed but still open
+    watcher.process_events();
+    BOOST_CHECK(!watcher.completed(results));
+  }
+  BOOST_CHECK(watcher.wait(1000));
+  BOOST_CHECK(watcher.completed(results));
+  BOOST_CHECK(!watcher.completed(other));
+
+  watcher.unwatch(results);
+  BOOST_CHECK(!watcher.watched(results));
+  BOOST_CHECK(watcher.watched(other));
+  watcher.unwatch(other);
+  bfs::remove_all(dir);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_rename_and_existing)
+{
+  Dakota::ResultsFileWatcher watcher;
+  if (!watcher.active())
+    return;
+
+  bfs::path dir = scratch_dir("rename");
+  bfs::path results = dir / "results.out", existing = dir / "existing.out";
+  { std::ofstream s(existing.string().c_str()); s << "1.0 f\n"; }
+  if (!watcher.watch(results))
+    return;
+  // an existing file is complete immediately (allow_existing_results)
+  BOOST_CHECK(watcher.watch(existing));
+  BOOST_CHECK(watcher.completed(existing));
+
+  bfs::path tmp = dir / "results.tmp";
+  { std::ofstream s(tmp.string().c_str()); s << "1.0 f\n"; }
+  watcher.process_events();
+  BOOST_CHECK(!watcher.completed(results));
+  bfs::rename(tmp, results);
+  BOOST_CHECK(watcher.wait(1000));
+  BOOST_CHECK(watcher.completed(results));
+
+  watcher.unwatch(results);
+  watcher.unwatch(existing);
+  bfs::remove_all(dir);
+}
+
+
+#ifndef _WIN32
+
+BOOST_AUTO_TEST_CASE(test_wake_descriptor)
+{
+  // a readable wake descriptor ends the wait whether or not files are
+  // watched; nothing is completed by it
+  Dakota::ResultsFileWatcher watcher;
+  int fds[2];
+  BOOST_REQUIRE(pipe(fds) == 0);
+  char byte = 0;
+  BOOST_REQUIRE(write(fds[1], &byte, 1) == 1);
+  std::chrono::steady_clock::time_point start
+    = std::chrono::steady_clock::now();
+  BOOST_CHECK(!watcher.wait(5000, fds[0]));
+  BOOST_CHECK(std::chrono::steady_clock::now() - start
+	      < std::chrono::seconds(4));
+  close(fds[0]); close(fds[1]);
+}
+
+#endif
@@ -0,0 +1,164 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+
+/** \file spawn_command.cpp Test parsing and launching commands without
+    a shell. */
+
+#include "CommandShell.hpp"
+#include <boost/filesystem/operations.hpp>
+#include <cstdlib>
+#include <fstream>
+#ifdef HAVE_POSIX_SPAWN
+  #include <cerrno>
+  #include <poll.h>
+#endif
+
+#define BOOST_TEST_MODULE dakota_spawn_command
+#include <boost/test/included/unit_test.hpp>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+
+/// parsed command line with file names substituted, or "shell" if the
+/// command requires a shell
+std::string parsed(const std::string& command)
+{
+  Dakota::SpawnCommand cmd;
+  if (!cmd.parse(command))
+    return "shell";
+  return cmd.substitute("params.in", "results.out", true).command_line();
+}
+
+}
+
+
+#ifdef HAVE_POSIX_SPAWN
+
+BOOST_AUTO_TEST_CASE(test_parse_simple_commands)
+{
+  BOOST_CHECK_EQUAL(parsed("driver"), "driver params.in results.out");
+  BOOST_CHECK_EQUAL(parsed("driver --opt=1 -i {PARAMETERS}"),
+		    "driver --opt=1 -i params.in params.in results.out");
+  BOOST_CHECK_EQUAL(parsed("sim -t 'a b' \"c d\""),
+		    "sim -t 'a b' 'c d' params.in results.out");
+  // redirections, in order, are moved after the arguments
+  BOOST_CHECK_EQUAL(parsed("sim < in > log 2>&1"),
+		    "sim params.in results.out < in > log 2>&1");
+  BOOST_CHECK_EQUAL(parsed("sim>>log 2>err"),
+		    "sim params.in results.out >> log 2> err");
+  BOOST_CHECK_EQUAL(parsed("sim a2>log"),
+		    "sim a2 params.in results.out > log");
+  // quoted operators are arguments
+  BOOST_CHECK_EQUAL(parsed("sim '>' \"a|b\""),
+		    "sim > a|b params.in results.out");
+}
+
+
+BOOST_AUTO_TEST_CASE(test_parse_shell_syntax)
+{
+  const char* shell_commands[] = {
+    "a | b", "a; b", "a && b", "a &", "(a)", "echo $HOME", "echo `date`",
+    "ls *.in", "ls file?", "X=1 sim", "sim \\ x", "sim >&2", "sim <<EOF",
+    "sim # comment", "~/sim", "sim ''", "sim {x}", "sim 'unterminated",
+    "sim \"$X\"", "sim >", ""
+  };
+  for (size_t i=0; i<sizeof(shell_commands)/sizeof(const char*); ++i)
+    BOOST_CHECK_MESSAGE(parsed(shell_commands[i]) == "shell",
+			"expected shell for: " << shell_commands[i]);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_spawn_with_redirection)
+{
+  bfs::path out_file = bfs::current_path() / "spawn_command_test.out";
+  bfs::remove(out_file);
+  Dakota::SpawnCommand cmd;
+  BOOST_REQUIRE(cmd.parse("sh -c 'echo out; echo err >&2' > "
+			  + out_file.string() + " 2>&1"));
+  pid_t pid = cmd.spawn();
+  BOOST_CHECK(pid > 0);
+  BOOST_CHECK_EQUAL(Dakota::SpawnCommand::wait(pid), 0);
+
+  std::ifstream s(out_file.string().c_str());
+  std::string line1, line2;
+  std::getline(s, line1); std::getline(s, line2);
+  BOOST_CHECK_EQUAL(line1, "out");
+  BOOST_CHECK_EQUAL(line2, "err");
+  s.close();
+  bfs::remove(out_file);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_spawn_script_without_interpreter)
+{
+  // an executable script lacking a #! line is run by /bin/sh, whether
+  // given by path or found on the PATH
+  const std::string driver_name("spawn_command_test_driver");
+  bfs::path script = bfs::current_path() / driver_name;
+  bfs::path out_file = bfs::current_path() / "spawn_command_test.out";
+  std::ofstream s_out(script.string().c_str());
+  s_out << "echo \"$1 $2\" > \"$3\"\n";
+  s_out.close();
+  bfs::permissions(script, bfs::owner_all);
+
+  const char* env_path = std::getenv("PATH");
+  const std::string orig_path = (env_path) ? env_path : "";
+  setenv("PATH", (bfs::current_path().string() + ":" + orig_path).c_str(), 1);
+  const std::string drivers[] = { script.string(), driver_name };
+  for (size_t i=0; i<2; ++i) {
+    bfs::remove(out_file);
+    Dakota::SpawnCommand cmd;
+    BOOST_REQUIRE(cmd.parse(drivers[i] + " 'a b' c " + out_file.string()));
+    BOOST_CHECK_EQUAL(Dakota::SpawnCommand::wait(cmd.spawn()), 0);
+
+    std::ifstream s_in(out_file.string().c_str());
+    std::string line;
+    std::getline(s_in, line);
+    BOOST_CHECK_EQUAL(line, "a b c");
+  }
+  setenv("PATH", orig_path.c_str(), 1);
+  bfs::remove(out_file);
+  bfs::remove(script);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_exit_notification)
+{
+  int exit_fd = Dakota::SpawnCommand::exit_notifier();
+  BOOST_REQUIRE(exit_fd >= 0);
+  Dakota::SpawnCommand::clear_exit_notifications();
+
+  Dakota::SpawnCommand cmd;
+  BOOST_REQUIRE(cmd.parse("sleep 1"));
+  pid_t pid = cmd.spawn();
+  struct pollfd pfd;
+  pfd.fd = exit_fd; pfd.events = POLLIN; pfd.revents = 0;
+  BOOST_CHECK_EQUAL(poll(&pfd, 1, 0), 0);       // still running
+  int num_ready;  // woken by its exit, possibly interrupted by SIGCHLD
+  do num_ready = poll(&pfd, 1, 10000);
+  while (num_ready < 0 && errno == EINTR);
+  BOOST_CHECK_EQUAL(num_ready, 1);
+  BOOST_CHECK(Dakota::SpawnCommand::exited(pid));
+
+  Dakota::SpawnCommand::clear_exit_notifications();
+  pfd.revents = 0;
+  BOOST_CHECK_EQUAL(poll(&pfd, 1, 0), 0);
+}
+
+#else
+
+BOOST_AUTO_TEST_CASE(test_parse_unsupported)
+{
+  // without posix_spawn, all commands are run through the shell
+  BOOST_CHECK_EQUAL(parsed("driver"), "shell");
+}
+
+#endif
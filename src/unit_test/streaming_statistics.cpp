@@ -0,0 +1,126 @@
+/*  _______________________________________________________________________
+
+    DAKOTA: Design Analysis Kit for Optimization and Terascale Applications
+    Copyright 2014-2022
+    National Technology & Engineering Solutions of Sandia, LLC (NTESS).
+    This software is distributed under the GNU Lesser General Public License.
+    For more information, see the README file in the top Dakota directory.
+    _______________________________________________________________________ */
+
+
+/** \file streaming_statistics.cpp Test one-pass sampling statistics. */
+
+#include "StreamingStatistics.hpp"
+#include "pecos_data_types.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define BOOST_TEST_MODULE dakota_streaming_statistics
+#include <boost/test/included/unit_test.hpp>
+
+
+namespace {
+
+/// deterministic, skewed samples on (0,1): squares of a Weyl sequence
+std::vector<double> skewed_samples(size_t num_samples)
+{
+  std::vector<double> samples(num_samples);
+  double golden = 0.5*(std::sqrt(5.) - 1.), u = 0.;
+  for (size_t i=0; i<num_samples; ++i) {
+    u = std::fmod(u + golden, 1.);
+    samples[i] = u*u;
+  }
+  return samples;
+}
+
+Dakota::RealVector single_level(double level)
+{
+  Dakota::RealVector levels(1);
+  levels[0] = level;
+  return levels;
+}
+
+}
+
+
+BOOST_AUTO_TEST_CASE(test_moments_match_two_pass)
+{
+  std::vector<double> samples = skewed_samples(1000);
+  Dakota::StreamingStatistics stats;
+  stats.initialize(1, Dakota::RealVectorArray(), Dakota::RealVectorArray());
+  Dakota::RealVector fn_vals(1);
+  for (size_t i=0; i<samples.size(); ++i)
+    { fn_vals[0] = samples[i]; stats.update(fn_vals); }
+
+  double ns = samples.size(), mean = 0., sum2 = 0., sum3 = 0., sum4 = 0.;
+  for (size_t i=0; i<samples.size(); ++i) mean += samples[i];
+  mean /= ns;
+  for (size_t i=0; i<samples.size(); ++i) {
+    double c = samples[i] - mean;
+    sum2 += c*c; sum3 += c*c*c; sum4 += c*c*c*c;
+  }
+  double nm1 = ns - 1., nm2 = ns - 2., var = sum2/nm1,
+    skew = sum3*ns/(nm1*nm2)/(var*std::sqrt(var)),
+    kurt = nm1*((ns+1.)*ns*sum4/(sum2*sum2) - 3.*nm1)/(nm2*(ns-3.));
+
+  double moments[4];
+  stats.moments(0, Pecos::STANDARD_MOMENTS, moments);
+  BOOST_CHECK_CLOSE(moments[0], mean, 1.e-10);
+  BOOST_CHECK_CLOSE(moments[1], std::sqrt(var), 1.e-10);
+  BOOST_CHECK_CLOSE(moments[2], skew, 1.e-8);
+  BOOST_CHECK_CLOSE(moments[3], kurt, 1.e-8);
+
+  stats.moments(0, Pecos::CENTRAL_MOMENTS, moments);
+  BOOST_CHECK_CLOSE(moments[1], var, 1.e-10);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_failures_bins_and_extremes)
+{
+  Dakota::StreamingStatistics stats;
+  Dakota::RealVectorArray resp_levels(1, single_level(0.5));
+  stats.initialize(1, resp_levels, Dakota::RealVectorArray());
+  Dakota::RealVector fn_vals(1);
+  double values[5]
+    = { 0.25, std::numeric_limits<double>::quiet_NaN(), 0.5, 0.75, 1. };
+  for (size_t i=0; i<5; ++i)
+    { fn_vals[0] = values[i]; stats.update(fn_vals); }
+
+  BOOST_CHECK_EQUAL(stats.num_observations(), 5);
+  BOOST_CHECK_EQUAL(stats.count(0), 4);
+  // p(g <= 0.5) bin and the remainder
+  BOOST_CHECK_EQUAL(stats.bins(0)[0], 2);
+  BOOST_CHECK_EQUAL(stats.bins(0)[1], 2);
+  BOOST_CHECK_EQUAL(stats.minimum(0), 0.25);
+  BOOST_CHECK_EQUAL(stats.maximum(0), 1.);
+}
+
+
+BOOST_AUTO_TEST_CASE(test_quantiles)
+{
+  // exact interpolation for few samples
+  Dakota::StreamingStatistics small;
+  Dakota::RealVectorArray median(1, single_level(0.5));
+  small.initialize(1, Dakota::RealVectorArray(), median);
+  Dakota::RealVector fn_vals(1);
+  double values[3] = { 3., 1., 2. };
+  for (size_t i=0; i<3; ++i)
+    { fn_vals[0] = values[i]; small.update(fn_vals); }
+  BOOST_CHECK_CLOSE(small.quantile(0, 0), 1.5, 1.e-12);
+
+  // P-squared estimates approach the sample quantiles
+  std::vector<double> samples = skewed_samples(20000);
+  Dakota::RealVector probs(3);
+  probs[0] = 0.05; probs[1] = 0.5; probs[2] = 0.95;
+  Dakota::StreamingStatistics stats;
+  stats.initialize(1, Dakota::RealVectorArray(),
+		   Dakota::RealVectorArray(1, probs));
+  for (size_t i=0; i<samples.size(); ++i)
+    { fn_vals[0] = samples[i]; stats.update(fn_vals); }
+  std::sort(samples.begin(), samples.end());
+  for (int j=0; j<3; ++j) {
+    double exact = samples[(size_t)(probs[j]*samples.size()) - 1];
+    BOOST_CHECK_SMALL(stats.quantile(0, j) - exact, 5.e-3);
+  }
+}
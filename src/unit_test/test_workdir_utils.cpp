@@ -8,6 +8,7 @@
     _______________________________________________________________________ */
 
 #include "WorkdirHelper.hpp"
+#include "WorkdirPool.hpp"
 #include "CommandShell.hpp"
 #include "dakota_global_defs.hpp"
 
@@ -17,7 +18,10 @@
 #include <boost/foreach.hpp>
 
 #include <cassert>
+#include <chrono>
+#include <fstream>
 #include <iostream>
+#include <thread>
 
 
 namespace Dakota {
@@ -291,6 +295,61 @@ void test_driver_relative_path(const bfs::path& rel_driver_path)
   sys_call_sh << Dakota::flush;
 }
 
+/// acquire dest from the pool, retrying while the background thread stages
+bool acquire_staged(WorkdirPool& pool, const bfs::path& dest)
+{
+  for (size_t i=0; i<500; ++i) {
+    if (pool.acquire(dest, 2))
+      return true;
+    pool.release(dest, false); // miss: nothing to return to the pool
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+
+
+void test_workdir_pool()
+{
+  bfs::path tmp_dir( WorkdirHelper::system_tmp_path() );
+  bfs::path parent( tmp_dir/bfs::unique_path("daktst_%%%%%%%%") );
+  bfs::path templ( parent/"template" );
+  WorkdirHelper::create_directory(templ, DIR_CLEAN);
+  { std::ofstream f((templ/"input.in").string()); f << "template\n"; }
+
+  StringArray copy_files(1, (templ/"*").string()), link_files;
+  {
+    WorkdirPool pool(parent, copy_files, link_files, true);
+
+    // modify the staged template and add an output file
+    bfs::path wd1( parent/"workdir.1" );
+    BOOST_CHECK( acquire_staged(pool, wd1) );
+    BOOST_CHECK( bfs::is_regular_file(wd1/"input.in") );
+    { std::ofstream f((wd1/"input.in").string()); f << "modified\n"; }
+    { std::ofstream f((wd1/"output.out").string()); f << "results\n"; }
+    pool.release(wd1, true);
+    BOOST_CHECK( !bfs::exists(wd1) );
+
+    // whether recycled or newly staged, the directory matches the template
+    bfs::path wd2( parent/"workdir.2" );
+    BOOST_CHECK( acquire_staged(pool, wd2) );
+    BOOST_CHECK( !bfs::exists(wd2/"output.out") );
+    std::string line;
+    { std::ifstream f((wd2/"input.in").string()); std::getline(f, line); }
+    BOOST_CHECK( line == "template" );
+    BOOST_CHECK( pool.num_hits() == 2 );
+    pool.release(wd2, true);
+
+    pool.clear();
+  }
+  // only the template remains once the pool is destroyed
+  size_t num_entries = 0;
+  for (bfs::directory_iterator it(parent); it!=bfs::directory_iterator(); ++it)
+    ++num_entries;
+  BOOST_CHECK( num_entries == 1 );
+
+  WorkdirHelper::recursive_remove(parent, FILEOP_WARN);
+}
+
 } // end namespace TestWorkdir
 } // end namespace Dakota
 
@@ -321,6 +380,8 @@ int test_main( int argc, char* argv[] )      // note the name!
   test_create_and_remove_tmpdir(do_copy);
   test_create_and_remove_wd_in_rundir("workdir", do_copy);
 
+  test_workdir_pool();
+
   /* WJB: consider refactor count_driver_scripts test -- bfs::path fq_search(argv[1]);
   std::string fq_search(rundir_str);
   fq_search += "/../test/d*.sh";
@@ -112,4 +112,26 @@ TEUCHOS_UNIT_TEST(util, metrics_verification) {
   TEST_ASSERT(std::abs(mval - metric) < atol);
 }
 
+TEUCHOS_UNIT_TEST(util, metrics_one_pass) {
+  const int N = 10;
+  VectorXd p = create_uniform_random_double_matrix(N, 1, 44);
+  VectorXd d = create_uniform_random_double_matrix(N, 1, 15);
+  const double atol = 1.0e-14;
+
+  StringArray metric_names = {"sum_squared", "mean_squared",
+                              "root_mean_squared", "sum_abs",
+                              "mean_abs", "max_abs",
+                              "ape", "mape",
+                              "rsquared", "mean_squared"};
+  VectorXd metrics = compute_metrics(p, d, metric_names);
+
+  TEST_EQUALITY(metrics.size(), 10);
+  for (int m = 0; m < metrics.size(); m++)
+    TEST_ASSERT(std::abs(metrics(m) - compute_metric(p, d, metric_names[m])) <
+                atol);
+
+  StringArray bad_names = {"sum_squared", "bogus"};
+  TEST_THROW(compute_metrics(p, d, bad_names), std::runtime_error);
+}
+
 }  // namespace
@@ -11,6 +11,7 @@
 
 #include "util_common.hpp"
 
+#include <algorithm>
 #include <boost/assign.hpp>
 #include <boost/bimap.hpp>
 
@@ -78,5 +79,77 @@ double compute_metric(const VectorXd& p, const VectorXd& d,
   return 0.0;
 }
 
+VectorXd compute_metrics(const VectorXd& p, const VectorXd& d,
+                         const StringArray& metric_names) {
+  const int N = p.size();
+  if (N != d.size()) error("Mismatch between prediction and data vector sizes");
+
+  const int num_metrics = metric_names.size();
+  std::vector<METRIC_TYPE> mtypes(num_metrics);
+  bool need_rsquared = false;
+  for (int m = 0; m < num_metrics; m++) {
+    mtypes[m] = metric_type(metric_names[m]);
+    if (mtypes[m] == METRIC_TYPE::R_SQUARED) need_rsquared = true;
+  }
+
+  /* residual sums for all metrics in one pass */
+  double sum_sq = 0.0, sum_abs = 0.0, max_abs = 0.0, sum_ape = 0.0,
+         sum_d = 0.0;
+  for (int i = 0; i < N; i++) {
+    const double diff = p(i) - d(i), abs_diff = std::abs(diff);
+    sum_sq += diff * diff;
+    sum_abs += abs_diff;
+    max_abs = std::max(max_abs, abs_diff);
+    sum_ape += std::abs(diff / d(i));
+    sum_d += d(i);
+  }
+
+  /* R^2 also needs deviations from the data mean */
+  double sum_p_dev = 0.0, sum_d_dev = 0.0;
+  if (need_rsquared) {
+    const double dbar = sum_d / N;
+    for (int i = 0; i < N; i++) {
+      sum_p_dev += (p(i) - dbar) * (p(i) - dbar);
+      sum_d_dev += (d(i) - dbar) * (d(i) - dbar);
+    }
+  }
+
+  VectorXd metrics(num_metrics);
+  for (int m = 0; m < num_metrics; m++) {
+    switch (mtypes[m]) {
+      case METRIC_TYPE::SUM_SQUARED:
+        metrics(m) = sum_sq;
+        break;
+      case METRIC_TYPE::MEAN_SQUARED:
+        metrics(m) = sum_sq / N;
+        break;
+      case METRIC_TYPE::ROOT_MEAN_SQUARED:
+        metrics(m) = std::sqrt(sum_sq / N);
+        break;
+      case METRIC_TYPE::SUM_ABS:
+        metrics(m) = sum_abs;
+        break;
+      case METRIC_TYPE::MEAN_ABS:
+        metrics(m) = sum_abs / N;
+        break;
+      case METRIC_TYPE::MAX_ABS:
+        metrics(m) = max_abs;
+        break;
+      case METRIC_TYPE::ABS_PERCENTAGE_ERROR:
+        metrics(m) = sum_ape;
+        break;
+      case METRIC_TYPE::MEAN_ABS_PERCENTAGE_ERROR:
+        metrics(m) = sum_ape / N;
+        break;
+      /* Warning: This definition of R^2 only has meaning for OLS when
+       * d is the training responses */
+      case METRIC_TYPE::R_SQUARED:
+        metrics(m) = sum_p_dev / sum_d_dev;
+        break;
+    }
+  }
+  return metrics;
+}
+
 }  // namespace util
 }  // namespace dakota
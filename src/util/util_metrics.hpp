@@ -45,6 +45,17 @@ METRIC_TYPE metric_type(const std::string& metric_name);
 double compute_metric(const VectorXd& p, const VectorXd& d,
                       const std::string& metric_name);
 
+/**
+ *  \brief Computes several metrics of the difference between prediction and
+ *  data vectors, accumulating the residual sums in one pass
+ *  \param[in] p prediction vector.
+ *  \param[in] d data vector.
+ *  \param[in] metric_names metrics to compute.
+ *  \returns the values of the computed metrics, in the order requested.
+ */
+VectorXd compute_metrics(const VectorXd& p, const VectorXd& d,
+                         const StringArray& metric_names);
+
 }  // namespace util
 }  // namespace dakota
 